@@ -15,6 +15,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <sys/socket.h>
 #include <array>
 
 namespace hailort
@@ -22,6 +23,42 @@ namespace hailort
 
 #define LINUX_RMEM_MAX_PATH "/proc/sys/net/core/rmem_max"
 
+static hailo_status send_errno_to_status(int error)
+{
+    if ((EWOULDBLOCK == error) || (EAGAIN == error)) {
+        LOGGER__ERROR("Udp send timeout");
+        return HAILO_TIMEOUT;
+    } else if (EINTR == error) {
+        LOGGER__ERROR("Udp send interrupted!");
+        return HAILO_INTERRUPTED_BY_SIGNAL;
+    } else if (EPIPE == error) {
+        // When socket is aborted from another thread sendto will return errno EPIPE
+        LOGGER__INFO("Udp send aborted!");
+        return HAILO_STREAM_ABORTED_BY_USER;
+    } else {
+        LOGGER__ERROR("Udp failed to send data, errno:{}.", error);
+        return HAILO_ETH_SEND_FAILURE;
+    }
+}
+
+static hailo_status recv_errno_to_status(int error, bool log_timeouts_in_debug)
+{
+    if ((EWOULDBLOCK == error) || (EAGAIN == error)) {
+        if (log_timeouts_in_debug) {
+            LOGGER__DEBUG("Udp recvfrom failed with timeout");
+        } else {
+            LOGGER__ERROR("Udp recvfrom failed with timeout");
+        }
+        return HAILO_TIMEOUT;
+    } else if (EINTR == error) {
+        LOGGER__ERROR("Udp recv interrupted!");
+        return HAILO_INTERRUPTED_BY_SIGNAL;
+    } else {
+        LOGGER__ERROR("Udp failed to recv data");
+        return HAILO_ETH_RECV_FAILURE;
+    }
+}
+
 hailo_status Socket::SocketModuleWrapper::init_module()
 {
     return HAILO_SUCCESS;
@@ -221,20 +258,7 @@ hailo_status Socket::send_to(const uint8_t *src_buffer, size_t src_buffer_size,
     number_of_sent_bytes = sendto(m_socket_fd, src_buffer, src_buffer_size, flags,
         dest_addr,  dest_addr_size);
     if (-1 == number_of_sent_bytes) {
-        if ((EWOULDBLOCK == errno) || (EAGAIN == errno)) {
-            LOGGER__ERROR("Udp send timeout");
-            return HAILO_TIMEOUT;
-        } else if (EINTR == errno) {
-            LOGGER__ERROR("Udp send interrupted!");
-            return HAILO_INTERRUPTED_BY_SIGNAL;
-        } else if (EPIPE == errno) {
-            // When socket is aborted from another thread sendto will return errno EPIPE
-            LOGGER__INFO("Udp send aborted!");
-            return HAILO_STREAM_ABORTED_BY_USER;
-        } else {
-            LOGGER__ERROR("Udp failed to send data, errno:{}.", errno);
-            return HAILO_ETH_SEND_FAILURE;
-        }
+        return send_errno_to_status(errno);
     }
 
     *bytes_sent = (size_t)number_of_sent_bytes;
@@ -255,20 +279,7 @@ hailo_status Socket::recv_from(uint8_t *dest_buffer, size_t dest_buffer_size, in
     number_of_received_bytes = recvfrom(m_socket_fd, dest_buffer, dest_buffer_size, flags,
         src_addr, &result_src_addr_size);
     if (-1 == number_of_received_bytes) {
-        if ((EWOULDBLOCK == errno) || (EAGAIN == errno)) {
-            if (log_timeouts_in_debug) {
-                LOGGER__DEBUG("Udp recvfrom failed with timeout");
-            } else {
-                LOGGER__ERROR("Udp recvfrom failed with timeout");
-            }
-            return HAILO_TIMEOUT;
-        } else if (EINTR == errno) {
-            LOGGER__ERROR("Udp recv interrupted!");
-            return HAILO_INTERRUPTED_BY_SIGNAL;
-        } else {
-            LOGGER__ERROR("Udp failed to recv data");
-            return HAILO_ETH_RECV_FAILURE;
-        }
+        return recv_errno_to_status(errno, log_timeouts_in_debug);
     }
     else if ((0 == number_of_received_bytes) && (0 != dest_buffer_size)) {
         LOGGER__INFO("Udp socket was aborted");
@@ -303,4 +314,86 @@ hailo_status Socket::has_data(sockaddr *src_addr, socklen_t src_addr_size, bool
     return HAILO_SUCCESS;
 }
 
+hailo_status Socket::send_multiple_to(const uint8_t *prefix, size_t prefix_size, const SocketDatagram *datagrams,
+    size_t datagrams_count, int flags, const sockaddr *dest_addr, socklen_t dest_addr_size, size_t *datagrams_sent)
+{
+    std::array<struct mmsghdr, MAX_DATAGRAMS_PER_BATCH> messages{};
+    // Each datagram is composed of (optional) prefix + data
+    std::array<struct iovec, 2 * MAX_DATAGRAMS_PER_BATCH> iovecs{};
+    const size_t iovecs_per_datagram = (0 < prefix_size) ? 2 : 1;
+
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(datagrams);
+    CHECK_ARG_NOT_NULL(dest_addr);
+    CHECK_ARG_NOT_NULL(datagrams_sent);
+    CHECK((nullptr != prefix) || (0 == prefix_size), HAILO_INVALID_ARGUMENT);
+    CHECK(datagrams_count <= MAX_DATAGRAMS_PER_BATCH, HAILO_INVALID_ARGUMENT,
+        "Can't send more than {} datagrams at once (got {})", MAX_DATAGRAMS_PER_BATCH, datagrams_count);
+
+    for (size_t i = 0; i < datagrams_count; i++) {
+        auto datagram_iovecs = &iovecs[i * iovecs_per_datagram];
+        if (0 < prefix_size) {
+            datagram_iovecs[0].iov_base = const_cast<uint8_t*>(prefix);
+            datagram_iovecs[0].iov_len = prefix_size;
+        }
+        datagram_iovecs[iovecs_per_datagram - 1].iov_base = datagrams[i].data;
+        datagram_iovecs[iovecs_per_datagram - 1].iov_len = datagrams[i].size;
+
+        messages[i].msg_hdr.msg_name = const_cast<sockaddr*>(dest_addr);
+        messages[i].msg_hdr.msg_namelen = dest_addr_size;
+        messages[i].msg_hdr.msg_iov = datagram_iovecs;
+        messages[i].msg_hdr.msg_iovlen = iovecs_per_datagram;
+    }
+
+    int number_of_sent_datagrams = sendmmsg(m_socket_fd, messages.data(), static_cast<unsigned int>(datagrams_count),
+        flags);
+    if (-1 == number_of_sent_datagrams) {
+        return send_errno_to_status(errno);
+    }
+
+    *datagrams_sent = static_cast<size_t>(number_of_sent_datagrams);
+    return HAILO_SUCCESS;
+}
+
+hailo_status Socket::recv_multiple_from(SocketDatagram *datagrams, size_t datagrams_count, int flags,
+    size_t *datagrams_received)
+{
+    std::array<struct mmsghdr, MAX_DATAGRAMS_PER_BATCH> messages{};
+    std::array<struct iovec, MAX_DATAGRAMS_PER_BATCH> iovecs{};
+
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(datagrams);
+    CHECK_ARG_NOT_NULL(datagrams_received);
+    CHECK((0 < datagrams_count) && (datagrams_count <= MAX_DATAGRAMS_PER_BATCH), HAILO_INVALID_ARGUMENT,
+        "Invalid datagrams count {}", datagrams_count);
+
+    for (size_t i = 0; i < datagrams_count; i++) {
+        iovecs[i].iov_base = datagrams[i].data;
+        iovecs[i].iov_len = datagrams[i].size;
+        messages[i].msg_hdr.msg_iov = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // MSG_WAITFORONE - block (up to SO_RCVTIMEO) only for the first datagram, then take whatever is already queued.
+    int number_of_received_datagrams = recvmmsg(m_socket_fd, messages.data(),
+        static_cast<unsigned int>(datagrams_count), flags | MSG_WAITFORONE, nullptr);
+    if (-1 == number_of_received_datagrams) {
+        return recv_errno_to_status(errno, false);
+    }
+
+    for (size_t i = 0; i < static_cast<size_t>(number_of_received_datagrams); i++) {
+        if ((0 == messages[i].msg_len) && (0 != datagrams[i].size)) {
+            LOGGER__INFO("Udp socket was aborted");
+            return HAILO_STREAM_ABORTED_BY_USER;
+        }
+        // The rest of a truncated datagram is dropped by the kernel, so it can't be reported as received
+        CHECK(0 == (messages[i].msg_hdr.msg_flags & MSG_TRUNC), HAILO_ETH_RECV_FAILURE,
+            "Received datagram {} was truncated to {} bytes", i, datagrams[i].size);
+        datagrams[i].size = messages[i].msg_len;
+    }
+
+    *datagrams_received = static_cast<size_t>(number_of_received_datagrams);
+    return HAILO_SUCCESS;
+}
+
 } /* namespace hailort */
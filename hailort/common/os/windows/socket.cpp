@@ -287,4 +287,63 @@ hailo_status Socket::has_data(sockaddr *src_addr, socklen_t src_addr_size, bool
     return HAILO_SUCCESS;
 }
 
+hailo_status Socket::send_multiple_to(const uint8_t *prefix, size_t prefix_size, const SocketDatagram *datagrams,
+    size_t datagrams_count, int flags, const sockaddr *dest_addr, socklen_t dest_addr_size, size_t *datagrams_sent)
+{
+    // No batched send on windows - sending the datagrams one by one
+    std::array<uint8_t, MAX_UDP_PAYLOAD_SIZE> prefixed_datagram{};
+
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(datagrams);
+    CHECK_ARG_NOT_NULL(datagrams_sent);
+    CHECK((nullptr != prefix) || (0 == prefix_size), HAILO_INVALID_ARGUMENT);
+
+    *datagrams_sent = 0;
+    for (size_t i = 0; i < datagrams_count; i++) {
+        const uint8_t *send_ptr = datagrams[i].data;
+        size_t send_size = datagrams[i].size;
+        if (0 < prefix_size) {
+            CHECK(prefixed_datagram.size() >= (prefix_size + send_size), HAILO_INVALID_ARGUMENT,
+                "Datagram size {} is too big", prefix_size + send_size);
+            memcpy(prefixed_datagram.data(), prefix, prefix_size);
+            memcpy(prefixed_datagram.data() + prefix_size, datagrams[i].data, send_size);
+            send_ptr = prefixed_datagram.data();
+            send_size += prefix_size;
+        }
+
+        size_t bytes_sent = 0;
+        auto status = send_to(send_ptr, send_size, flags, dest_addr, dest_addr_size, &bytes_sent);
+        if ((HAILO_SUCCESS != status) && (0 < i)) {
+            // The datagrams sent so far are reported, the error will be returned on the next call.
+            break;
+        }
+        CHECK_SUCCESS(status);
+        *datagrams_sent = i + 1;
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status Socket::recv_multiple_from(SocketDatagram *datagrams, size_t datagrams_count, int flags,
+    size_t *datagrams_received)
+{
+    // No batched receive on windows - receiving a single datagram
+    sockaddr_in src_addr{};
+
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(datagrams);
+    CHECK_ARG_NOT_NULL(datagrams_received);
+    CHECK(0 < datagrams_count, HAILO_INVALID_ARGUMENT);
+
+    auto status = recv_from(datagrams[0].data, datagrams[0].size, flags, reinterpret_cast<sockaddr*>(&src_addr),
+        sizeof(src_addr), &datagrams[0].size);
+    if (HAILO_TIMEOUT == status) {
+        return status;
+    }
+    CHECK_SUCCESS(status);
+
+    *datagrams_received = 1;
+    return HAILO_SUCCESS;
+}
+
 } /* namespace hailort */
@@ -15,6 +15,9 @@
 #include <cmath>
 #include <mutex>
 #include <limits>
+#include <atomic>
+#include <array>
+#include <vector>
 
 namespace hailort
 {
@@ -164,6 +167,321 @@ protected:
     }
 };
 
+// Lock-free accumulator that keeps the distribution of the data in a log-bucketed histogram (HDR-histogram style),
+// so percentiles can be reported in addition to the regular statistics.
+// Each power-of-2 range is split into SUB_BUCKETS_COUNT linear sub-buckets, so the reported percentiles have a relative
+// error of at most 1/(2 * SUB_BUCKETS_COUNT). The data is sharded between SHARDS_COUNT shards (each thread updates its own
+// shard), so add_data_point is a handful of relaxed atomic operations, without any lock or allocation.
+// Note: Data points added concurrently with get_and_clear may be accounted in either the cleared or the following window.
+template<typename T, std::enable_if_t<std::is_arithmetic<T>::value, int> = 0>
+class HistogramAccumulator : public Accumulator<T>
+{
+public:
+    static const uint32_t SUB_BUCKETS_BITS = 5;
+    static const size_t SUB_BUCKETS_COUNT = (1 << SUB_BUCKETS_BITS);
+    // Values in the range [2^MIN_EXPONENT, 2^MAX_EXPONENT) are bucketed (~0.2ns to ~4e9s when measuring seconds).
+    // Smaller values (e.g. zero) are kept in the first bucket, bigger values in the last one.
+    static const int MIN_EXPONENT = -32;
+    static const int MAX_EXPONENT = 32;
+    static const size_t BUCKETS_COUNT = 1 + ((MAX_EXPONENT - MIN_EXPONENT) * SUB_BUCKETS_COUNT);
+    static const size_t SHARDS_COUNT = 4;
+
+    // Creation isn't thread safe
+    HistogramAccumulator(const std::string& data_type) :
+        Accumulator<T>(data_type),
+        m_shards()
+    {
+        for (auto &shard : m_shards) {
+            clear_shard(shard);
+        }
+    }
+    HistogramAccumulator(HistogramAccumulator &&) = delete;
+    HistogramAccumulator(const HistogramAccumulator &) = delete;
+    HistogramAccumulator &operator=(HistogramAccumulator &&) = delete;
+    HistogramAccumulator &operator=(const HistogramAccumulator &) = delete;
+    virtual ~HistogramAccumulator() = default;
+
+    virtual void add_data_point(T data, uint32_t samples_count = 1) override
+    {
+        auto &shard = m_shards[current_thread_shard_index()];
+        const auto value = static_cast<double>(data);
+
+        shard.buckets[bucket_index(value)].fetch_add(samples_count, std::memory_order_relaxed);
+        atomic_add(shard.sum, value * samples_count);
+        atomic_add(shard.sum_of_squares, value * value * samples_count);
+        atomic_min(shard.min, value);
+        atomic_max(shard.max, value);
+        // count is updated last, so a reader that sees the count sees the rest of the data point as well
+        shard.count.fetch_add(samples_count, std::memory_order_release);
+    }
+
+    virtual AccumulatorResults get() const override
+    {
+        return results(take_snapshot(true, false));
+    }
+
+    virtual AccumulatorResults get_and_clear() override
+    {
+        return results(take_snapshot(true, true));
+    }
+
+    virtual Expected<size_t> count() const override
+    {
+        return Expected<size_t>(static_cast<size_t>(take_snapshot(false, false).count));
+    }
+
+    virtual Expected<double> min() const override
+    {
+        return min(take_snapshot(false, false));
+    }
+
+    virtual Expected<double> max() const override
+    {
+        return max(take_snapshot(false, false));
+    }
+
+    virtual Expected<double> mean() const override
+    {
+        return mean(take_snapshot(false, false));
+    }
+
+    // Sample variance
+    virtual Expected<double> var() const override
+    {
+        return var(take_snapshot(false, false));
+    }
+
+    // Sample sd
+    virtual Expected<double> sd() const override
+    {
+        return sd(take_snapshot(false, false));
+    }
+
+    // Sample mean sd
+    virtual Expected<double> mean_sd() const override
+    {
+        return mean_sd(take_snapshot(false, false));
+    }
+
+    virtual Expected<double> percentile(double percentile) const override
+    {
+        return this->percentile(take_snapshot(true, false), percentile);
+    }
+
+private:
+    struct Shard {
+        std::atomic<uint64_t> count;
+        std::atomic<double> sum;
+        std::atomic<double> sum_of_squares;
+        std::atomic<double> min;
+        std::atomic<double> max;
+        std::array<std::atomic<uint64_t>, BUCKETS_COUNT> buckets;
+    };
+
+    struct Snapshot {
+        uint64_t count = 0;
+        double sum = 0;
+        double sum_of_squares = 0;
+        double min = std::numeric_limits<double>::max();
+        double max = std::numeric_limits<double>::lowest();
+        std::vector<uint64_t> buckets;
+    };
+
+    static size_t current_thread_shard_index()
+    {
+        static std::atomic<size_t> next_shard_index(0);
+        static thread_local const size_t shard_index = next_shard_index.fetch_add(1, std::memory_order_relaxed) % SHARDS_COUNT;
+        return shard_index;
+    }
+
+    static size_t bucket_index(double value)
+    {
+        if (!(value >= std::ldexp(1.0, MIN_EXPONENT))) {
+            // Zero, negative or NaN
+            return 0;
+        }
+
+        int exponent = 0;
+        // value = mantissa * 2^exponent, where mantissa is in [0.5, 1)
+        const double mantissa = std::frexp(value, &exponent);
+        if (exponent > MAX_EXPONENT) {
+            return BUCKETS_COUNT - 1;
+        }
+        const auto sub_bucket = static_cast<size_t>((mantissa - 0.5) * 2 * SUB_BUCKETS_COUNT);
+        return 1 + (static_cast<size_t>(exponent - 1 - MIN_EXPONENT) * SUB_BUCKETS_COUNT) +
+            std::min(sub_bucket, SUB_BUCKETS_COUNT - 1);
+    }
+
+    // Returns the middle of the range covered by the bucket
+    static double bucket_value(size_t index)
+    {
+        if (0 == index) {
+            return 0;
+        }
+        const auto exponent = static_cast<int>((index - 1) / SUB_BUCKETS_COUNT) + MIN_EXPONENT;
+        const auto sub_bucket = static_cast<double>((index - 1) % SUB_BUCKETS_COUNT);
+        return std::ldexp(1.0 + ((sub_bucket + 0.5) / SUB_BUCKETS_COUNT), exponent);
+    }
+
+    static void atomic_add(std::atomic<double> &target, double value)
+    {
+        auto current = target.load(std::memory_order_relaxed);
+        while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {}
+    }
+
+    static void atomic_min(std::atomic<double> &target, double value)
+    {
+        auto current = target.load(std::memory_order_relaxed);
+        while ((value < current) && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    static void atomic_max(std::atomic<double> &target, double value)
+    {
+        auto current = target.load(std::memory_order_relaxed);
+        while ((value > current) && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    static void clear_shard(Shard &shard)
+    {
+        shard.count.store(0, std::memory_order_relaxed);
+        shard.sum.store(0, std::memory_order_relaxed);
+        shard.sum_of_squares.store(0, std::memory_order_relaxed);
+        shard.min.store(std::numeric_limits<double>::max(), std::memory_order_relaxed);
+        shard.max.store(std::numeric_limits<double>::lowest(), std::memory_order_relaxed);
+        for (auto &bucket : shard.buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    Snapshot take_snapshot(bool with_buckets, bool clear) const
+    {
+        Snapshot snapshot;
+        if (with_buckets) {
+            snapshot.buckets.resize(BUCKETS_COUNT, 0);
+        }
+
+        for (auto &shard : m_shards) {
+            if (clear) {
+                snapshot.count += shard.count.exchange(0, std::memory_order_acquire);
+                snapshot.sum += shard.sum.exchange(0, std::memory_order_relaxed);
+                snapshot.sum_of_squares += shard.sum_of_squares.exchange(0, std::memory_order_relaxed);
+                snapshot.min = std::min(snapshot.min,
+                    shard.min.exchange(std::numeric_limits<double>::max(), std::memory_order_relaxed));
+                snapshot.max = std::max(snapshot.max,
+                    shard.max.exchange(std::numeric_limits<double>::lowest(), std::memory_order_relaxed));
+            } else {
+                snapshot.count += shard.count.load(std::memory_order_acquire);
+                snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+                snapshot.sum_of_squares += shard.sum_of_squares.load(std::memory_order_relaxed);
+                snapshot.min = std::min(snapshot.min, shard.min.load(std::memory_order_relaxed));
+                snapshot.max = std::max(snapshot.max, shard.max.load(std::memory_order_relaxed));
+            }
+
+            if (with_buckets) {
+                for (size_t i = 0; i < BUCKETS_COUNT; i++) {
+                    snapshot.buckets[i] += clear ? shard.buckets[i].exchange(0, std::memory_order_relaxed) :
+                        shard.buckets[i].load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        return snapshot;
+    }
+
+    static AccumulatorResults results(const Snapshot &snapshot)
+    {
+        return AccumulatorResults(Expected<size_t>(static_cast<size_t>(snapshot.count)), min(snapshot), max(snapshot),
+            mean(snapshot), var(snapshot), sd(snapshot), mean_sd(snapshot), percentile(snapshot, 50),
+            percentile(snapshot, 99), percentile(snapshot, 99.9));
+    }
+
+    static Expected<double> min(const Snapshot &snapshot)
+    {
+        if (snapshot.count < 1) {
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+        return Expected<double>(snapshot.min);
+    }
+
+    static Expected<double> max(const Snapshot &snapshot)
+    {
+        if (snapshot.count < 1) {
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+        return Expected<double>(snapshot.max);
+    }
+
+    static Expected<double> mean(const Snapshot &snapshot)
+    {
+        if (snapshot.count < 1) {
+            // Otherwise we'll divide by zero
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+        return Expected<double>(snapshot.sum / static_cast<double>(snapshot.count));
+    }
+
+    static Expected<double> var(const Snapshot &snapshot)
+    {
+        if (snapshot.count < 2) {
+            // Otherwise we'll divide by zero
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+        const auto count = static_cast<double>(snapshot.count);
+        const auto M2 = snapshot.sum_of_squares - ((snapshot.sum * snapshot.sum) / count);
+        // M2 may be slightly negative due to rounding errors
+        return Expected<double>(std::max(M2, 0.0) / (count - 1));
+    }
+
+    static Expected<double> sd(const Snapshot &snapshot)
+    {
+        auto variance = var(snapshot);
+        if (!variance) {
+            return make_unexpected(variance.status());
+        }
+        return Expected<double>(std::sqrt(variance.value()));
+    }
+
+    static Expected<double> mean_sd(const Snapshot &snapshot)
+    {
+        auto standard_deviation = sd(snapshot);
+        if (!standard_deviation) {
+            return make_unexpected(standard_deviation.status());
+        }
+        // Calculation based on: https://en.wikipedia.org/wiki/Standard_deviation#Standard_deviation_of_the_mean
+        return Expected<double>(standard_deviation.value() / std::sqrt(static_cast<double>(snapshot.count)));
+    }
+
+    static Expected<double> percentile(const Snapshot &snapshot, double percentile)
+    {
+        if ((percentile < 0) || (percentile > 100)) {
+            return make_unexpected(HAILO_INVALID_ARGUMENT);
+        }
+
+        uint64_t total_count = 0;
+        for (const auto &bucket_count : snapshot.buckets) {
+            total_count += bucket_count;
+        }
+        if (0 == total_count) {
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+
+        // Nearest-rank method
+        const auto rank = std::max(static_cast<uint64_t>(std::ceil((percentile / 100) * static_cast<double>(total_count))),
+            static_cast<uint64_t>(1));
+        uint64_t accumulated_count = 0;
+        for (size_t i = 0; i < snapshot.buckets.size(); i++) {
+            accumulated_count += snapshot.buckets[i];
+            if (accumulated_count >= rank) {
+                // The exact min/max are known, so we keep the result in range
+                return Expected<double>(std::min(std::max(bucket_value(i), snapshot.min), snapshot.max));
+            }
+        }
+        return Expected<double>(snapshot.max);
+    }
+
+    mutable std::array<Shard, SHARDS_COUNT> m_shards;
+};
+
 template<typename T, std::enable_if_t<std::is_arithmetic<T>::value, int> = 0>
 class AverageFPSAccumulator : public FullAccumulator<T>
 {
@@ -28,9 +28,17 @@ namespace hailort
 #define MIN_UDP_PAYLOAD_SIZE (24)
 #define MAX_UDP_PAYLOAD_SIZE (1456)
 #define MAX_UDP_PADDED_PAYLOAD_SIZE (MAX_UDP_PAYLOAD_SIZE - PADDING_BYTES_SIZE - PADDING_ALIGN_BYTES)
+#define MAX_DATAGRAMS_PER_BATCH (64)
 
 #define CHECK_VALID_SOCKET_AS_EXPECTED(sock) CHECK((sock) != INVALID_SOCKET, make_unexpected(HAILO_ETH_FAILURE), "Invalid socket")
 
+// A single datagram in a batched (multiple datagrams per syscall) socket operation
+struct SocketDatagram {
+    uint8_t *data;
+    // On send - the amount of bytes to send. On receive - the buffer size, updated to the received datagram size.
+    size_t size;
+};
+
 class Socket final {
 public:
     static Expected<Socket> create(int af, int type, int protocol);
@@ -63,6 +71,15 @@ public:
         sockaddr *src_addr, socklen_t src_addr_size, size_t *bytes_received, bool log_timeouts_in_debug = false);
     hailo_status has_data(sockaddr *src_addr, socklen_t src_addr_size, bool log_timeouts_in_debug = false);
 
+    // Batched variants of send_to/recv_from (at most MAX_DATAGRAMS_PER_BATCH datagrams per call).
+    // send_multiple_to prepends prefix (may be null) to each datagram, and may send only the first datagrams_sent
+    // datagrams. recv_multiple_from blocks (up to the socket timeout) only until the first datagram is received.
+    // On platforms without batched syscalls, these fall back to a loop of single datagram operations.
+    hailo_status send_multiple_to(const uint8_t *prefix, size_t prefix_size, const SocketDatagram *datagrams,
+        size_t datagrams_count, int flags, const sockaddr *dest_addr, socklen_t dest_addr_size, size_t *datagrams_sent);
+    hailo_status recv_multiple_from(SocketDatagram *datagrams, size_t datagrams_count, int flags,
+        size_t *datagrams_received);
+
 private:
     class SocketModuleWrapper final {
     public:
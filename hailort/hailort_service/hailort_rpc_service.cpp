@@ -514,7 +514,7 @@ void serialize_vstream_info(const hailo_vstream_info_t &info, ProtoVStreamInfo *
     format_proto->set_flags(info.format.flags);
     format_proto->set_order(info.format.order);
     format_proto->set_type(info.format.type);
-    if (info.format.order == HAILO_FORMAT_ORDER_HAILO_NMS) {
+    if (HailoRTCommon::is_nms(info.format.order)) {
         auto nms_shape_proto = info_proto->mutable_nms_shape();
         nms_shape_proto->set_number_of_classes(info.nms_shape.number_of_classes);
         nms_shape_proto->set_max_bbox_per_class(info.nms_shape.max_bboxes_per_class);
@@ -921,18 +921,24 @@ grpc::Status HailoRtRpcService::OutputVStream_read(grpc::ServerContext*, const O
     OutputVStream_read_Reply *reply)
 {
     std::vector<uint8_t> data(request->size());
-    auto lambda = [](std::shared_ptr<OutputVStream> output_vstream, MemoryView &buffer) {
-            return output_vstream->read(std::move(buffer));
+    auto lambda = [](std::shared_ptr<OutputVStream> output_vstream, MemoryView &buffer) -> Expected<size_t> {
+            auto status = output_vstream->read(buffer);
+            if (HAILO_SUCCESS != status) {
+                return make_unexpected(status);
+            }
+            // Variable-length formats (e.g. HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS) - only the used part is sent.
+            return HailoRTCommon::get_nms_detections_used_size(buffer.data(), buffer.size(),
+                output_vstream->get_user_buffer_format().order);
     };
     auto &manager = ServiceResourceManager<OutputVStream>::get_instance();
-    auto status = manager.execute<hailo_status>(request->identifier().vstream_handle(), lambda, MemoryView(data.data(), data.size()));
-    if (HAILO_STREAM_ABORTED_BY_USER == status) {
+    auto used_size = manager.execute<Expected<size_t>>(request->identifier().vstream_handle(), lambda, MemoryView(data.data(), data.size()));
+    if (HAILO_STREAM_ABORTED_BY_USER == used_size.status()) {
         LOGGER__INFO("User aborted VStream read.");
         reply->set_status(static_cast<uint32_t>(HAILO_STREAM_ABORTED_BY_USER));
         return grpc::Status::OK;
     }
-    CHECK_SUCCESS_AS_RPC_STATUS(status,  reply, "VStream read failed");
-    reply->set_data(data.data(), data.size());
+    CHECK_EXPECTED_AS_RPC_STATUS(used_size, reply, "VStream read failed");
+    reply->set_data(data.data(), used_size.value());
     reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
     return grpc::Status::OK;
 }
@@ -0,0 +1,441 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file convert_trace_command.cpp
+ * @brief Convert a binary trace file (recorded with HAILO_TRACE=binary) to the Chrome/Perfetto trace-event format
+ *
+ * The output (JSON, can be opened with ui.perfetto.dev or chrome://tracing) contains:
+ *  - "Devices" process - a track per device, with a span for each time a core-op was active on the device (from its
+ *    switch until the next switch), and an instant for each scheduler decision.
+ *  - A process per core-op - a track per stream, with a span for each frame waiting in the stream queue (from the
+ *    user write until it was sent to the device for inputs, from the device transfer completion until the user read
+ *    for outputs) and a counter of the frames in the queue. Changes of the scheduler parameters are instants.
+ *  - "Host threads" process - a track per traced thread, with an instant for each frame event the thread recorded
+ *    (transfer launches, transfer-done callbacks, user reads/writes).
+ **/
+
+#include "convert_trace_command.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <fstream>
+
+using ordered_json = nlohmann::ordered_json;
+
+namespace {
+
+// Chrome trace-event "process" ids.
+constexpr uint32_t HOST_THREADS_PID = 1;
+constexpr uint32_t DEVICES_PID = 2;
+constexpr uint32_t CORE_OPS_FIRST_PID = 100;
+
+class TraceEventsConverter final {
+public:
+    TraceEventsConverter(std::ofstream &output, const std::unordered_map<uint32_t, std::string> &strings) :
+        m_output(output),
+        m_strings(strings)
+    {}
+
+    void write_process_names();
+    void convert(const BinaryTraceEvent &event);
+
+    // Closes the spans still open at the end of the trace.
+    void finish();
+
+private:
+    struct Stream {
+        uint32_t tid;
+        std::string name;
+        std::deque<uint64_t> queued_frames_timestamps;
+    };
+
+    struct DeviceTrack {
+        uint32_t tid;
+        bool has_active_core_op = false;
+        uint32_t active_core_op_handle = 0;
+        uint64_t active_since_ns = 0;
+    };
+
+    static double to_us(uint64_t timestamp_ns)
+    {
+        return static_cast<double>(timestamp_ns) / 1000.0;
+    }
+
+    static uint32_t core_op_pid(uint32_t core_op_handle)
+    {
+        return CORE_OPS_FIRST_PID + core_op_handle;
+    }
+
+    std::string get_string(uint32_t id) const;
+    std::string core_op_name(uint32_t core_op_handle) const;
+
+    void write(ordered_json &&event);
+    void write_metadata(const std::string &type, uint32_t pid, uint32_t tid, const std::string &name);
+    void write_instant(const std::string &name, uint32_t pid, uint32_t tid, uint64_t timestamp_ns, ordered_json &&args);
+
+    Stream &get_stream(const BinaryTraceEvent &event, hailo_stream_direction_t direction);
+    DeviceTrack &get_device_track(uint32_t device_id);
+    void write_host_thread_instant(const std::string &name, const BinaryTraceEvent &event);
+
+    void on_frame_queued(const BinaryTraceEvent &event, hailo_stream_direction_t direction);
+    void on_frame_dequeued(const BinaryTraceEvent &event, hailo_stream_direction_t direction,
+        const std::string &span_name);
+    void on_switch_core_op(const BinaryTraceEvent &event);
+    void end_active_core_op(DeviceTrack &device, uint64_t timestamp_ns);
+
+    std::ofstream &m_output;
+    const std::unordered_map<uint32_t, std::string> &m_strings;
+    bool m_is_first_event = true;
+    uint64_t m_last_timestamp_ns = 0;
+    uint64_t m_next_async_id = 0;
+
+    std::unordered_map<uint32_t, std::string> m_core_op_names;
+    // Key is the core-op handle (high 32 bits) and the stream name id.
+    std::unordered_map<uint64_t, Stream> m_streams;
+    std::unordered_map<uint32_t, uint32_t> m_core_op_streams_count;
+    std::unordered_map<uint32_t, DeviceTrack> m_devices;
+    std::unordered_map<uint32_t, bool> m_known_threads;
+};
+
+std::string TraceEventsConverter::get_string(uint32_t id) const
+{
+    if (BINARY_TRACE_INVALID_ID == id) {
+        return "";
+    }
+    auto iter = m_strings.find(id);
+    // The strings table may be missing if the process didn't exit cleanly.
+    return (m_strings.end() != iter) ? iter->second : ("#" + std::to_string(id));
+}
+
+std::string TraceEventsConverter::core_op_name(uint32_t core_op_handle) const
+{
+    auto iter = m_core_op_names.find(core_op_handle);
+    return (m_core_op_names.end() != iter) ? iter->second : ("core-op " + std::to_string(core_op_handle));
+}
+
+void TraceEventsConverter::write(ordered_json &&event)
+{
+    m_output << (m_is_first_event ? "\n" : ",\n") << event.dump();
+    m_is_first_event = false;
+}
+
+void TraceEventsConverter::write_metadata(const std::string &type, uint32_t pid, uint32_t tid, const std::string &name)
+{
+    write({{"name", type}, {"ph", "M"}, {"pid", pid}, {"tid", tid}, {"args", {{"name", name}}}});
+}
+
+void TraceEventsConverter::write_instant(const std::string &name, uint32_t pid, uint32_t tid, uint64_t timestamp_ns,
+    ordered_json &&args)
+{
+    write({{"name", name}, {"ph", "i"}, {"s", "t"}, {"ts", to_us(timestamp_ns)}, {"pid", pid}, {"tid", tid},
+        {"args", std::move(args)}});
+}
+
+TraceEventsConverter::Stream &TraceEventsConverter::get_stream(const BinaryTraceEvent &event,
+    hailo_stream_direction_t direction)
+{
+    const auto key = (static_cast<uint64_t>(event.core_op_handle) << 32) | event.name;
+    auto iter = m_streams.find(key);
+    if (m_streams.end() != iter) {
+        return iter->second;
+    }
+
+    // Track 0 of each core-op is used for the core-op instants.
+    const auto tid = ++m_core_op_streams_count[event.core_op_handle];
+    const auto name = get_string(event.name);
+    write_metadata("thread_name", core_op_pid(event.core_op_handle), tid,
+        name + ((HAILO_H2D_STREAM == direction) ? " (H2D)" : " (D2H)"));
+    return m_streams.emplace(key, Stream{tid, name, {}}).first->second;
+}
+
+TraceEventsConverter::DeviceTrack &TraceEventsConverter::get_device_track(uint32_t device_id)
+{
+    auto iter = m_devices.find(device_id);
+    if (m_devices.end() != iter) {
+        return iter->second;
+    }
+
+    DeviceTrack device{};
+    device.tid = static_cast<uint32_t>(m_devices.size());
+    write_metadata("thread_name", DEVICES_PID, device.tid, get_string(device_id));
+    return m_devices.emplace(device_id, device).first->second;
+}
+
+void TraceEventsConverter::write_host_thread_instant(const std::string &name, const BinaryTraceEvent &event)
+{
+    if (!m_known_threads[event.thread_id]) {
+        m_known_threads[event.thread_id] = true;
+        write_metadata("thread_name", HOST_THREADS_PID, event.thread_id, "thread " + std::to_string(event.thread_id));
+    }
+
+    ordered_json args = {{"core_op", core_op_name(event.core_op_handle)}, {"stream", get_string(event.name)}};
+    if (BINARY_TRACE_INVALID_ID != event.device_id) {
+        args["device"] = get_string(event.device_id);
+    }
+    write_instant(name, HOST_THREADS_PID, event.thread_id, event.timestamp_ns, std::move(args));
+}
+
+void TraceEventsConverter::on_frame_queued(const BinaryTraceEvent &event, hailo_stream_direction_t direction)
+{
+    auto &stream = get_stream(event, direction);
+    stream.queued_frames_timestamps.push_back(event.timestamp_ns);
+    write({{"name", stream.name + " queue"}, {"ph", "C"}, {"ts", to_us(event.timestamp_ns)},
+        {"pid", core_op_pid(event.core_op_handle)}, {"args", {{"frames", stream.queued_frames_timestamps.size()}}}});
+}
+
+void TraceEventsConverter::on_frame_dequeued(const BinaryTraceEvent &event, hailo_stream_direction_t direction,
+    const std::string &span_name)
+{
+    auto &stream = get_stream(event, direction);
+    if (stream.queued_frames_timestamps.empty()) {
+        // The frame was queued before the trace started (or its event was dropped).
+        return;
+    }
+
+    const auto queued_timestamp_ns = stream.queued_frames_timestamps.front();
+    stream.queued_frames_timestamps.pop_front();
+
+    // Frames may wait in the queue concurrently, so we use async spans (which may overlap on the same track).
+    const auto id = m_next_async_id++;
+    const auto pid = core_op_pid(event.core_op_handle);
+    ordered_json args = {{"stream", stream.name}};
+    if (BINARY_TRACE_INVALID_ID != event.device_id) {
+        args["device"] = get_string(event.device_id);
+    }
+    write({{"name", span_name}, {"cat", stream.name}, {"ph", "b"}, {"id", id}, {"ts", to_us(queued_timestamp_ns)},
+        {"pid", pid}, {"tid", stream.tid}, {"args", std::move(args)}});
+    write({{"name", span_name}, {"cat", stream.name}, {"ph", "e"}, {"id", id}, {"ts", to_us(event.timestamp_ns)},
+        {"pid", pid}, {"tid", stream.tid}});
+    write({{"name", stream.name + " queue"}, {"ph", "C"}, {"ts", to_us(event.timestamp_ns)}, {"pid", pid},
+        {"args", {{"frames", stream.queued_frames_timestamps.size()}}}});
+}
+
+void TraceEventsConverter::end_active_core_op(DeviceTrack &device, uint64_t timestamp_ns)
+{
+    if (!device.has_active_core_op) {
+        return;
+    }
+
+    write({{"name", core_op_name(device.active_core_op_handle)}, {"ph", "X"}, {"ts", to_us(device.active_since_ns)},
+        {"dur", to_us(timestamp_ns - device.active_since_ns)}, {"pid", DEVICES_PID}, {"tid", device.tid},
+        {"args", {{"core_op_handle", device.active_core_op_handle}}}});
+    device.has_active_core_op = false;
+}
+
+void TraceEventsConverter::on_switch_core_op(const BinaryTraceEvent &event)
+{
+    auto &device = get_device_track(event.device_id);
+    end_active_core_op(device, event.timestamp_ns);
+    device.has_active_core_op = true;
+    device.active_core_op_handle = event.core_op_handle;
+    device.active_since_ns = event.timestamp_ns;
+}
+
+void TraceEventsConverter::write_process_names()
+{
+    write_metadata("process_name", HOST_THREADS_PID, 0, "Host threads");
+    write_metadata("process_name", DEVICES_PID, 0, "Devices");
+}
+
+void TraceEventsConverter::convert(const BinaryTraceEvent &event)
+{
+    m_last_timestamp_ns = std::max(m_last_timestamp_ns, event.timestamp_ns);
+
+    switch (event.type) {
+    case BinaryTraceEventType::ADD_DEVICE:
+        (void)get_device_track(event.device_id);
+        break;
+    case BinaryTraceEventType::ADD_CORE_OP:
+        m_core_op_names[event.core_op_handle] = get_string(event.name);
+        write_metadata("process_name", core_op_pid(event.core_op_handle), 0, get_string(event.name));
+        break;
+    case BinaryTraceEventType::CREATE_INPUT_STREAM:
+        (void)get_stream(event, HAILO_H2D_STREAM);
+        break;
+    case BinaryTraceEventType::CREATE_OUTPUT_STREAM:
+        (void)get_stream(event, HAILO_D2H_STREAM);
+        break;
+    case BinaryTraceEventType::WRITE_FRAME:
+        write_host_thread_instant("write_frame", event);
+        on_frame_queued(event, HAILO_H2D_STREAM);
+        break;
+    case BinaryTraceEventType::INPUT_VDMA_DEQUEUE:
+        write_host_thread_instant("input_transfer_launch", event);
+        on_frame_dequeued(event, HAILO_H2D_STREAM, "waiting for device");
+        break;
+    case BinaryTraceEventType::OUTPUT_VDMA_ENQUEUE:
+        write_host_thread_instant("output_transfer_done", event);
+        on_frame_queued(event, HAILO_D2H_STREAM);
+        break;
+    case BinaryTraceEventType::READ_FRAME:
+        write_host_thread_instant("read_frame", event);
+        on_frame_dequeued(event, HAILO_D2H_STREAM, "waiting for read");
+        break;
+    case BinaryTraceEventType::SWITCH_CORE_OP:
+        on_switch_core_op(event);
+        break;
+    case BinaryTraceEventType::ORACLE_DECISION:
+        write_instant("switch decision", DEVICES_PID, get_device_track(event.device_id).tid, event.timestamp_ns, {
+            {"next_core_op", core_op_name(event.core_op_handle)},
+            {"reason_idle", 0 != (event.value & BINARY_TRACE_DECISION_REASON_IDLE)},
+            {"over_threshold", 0 != (event.value & BINARY_TRACE_DECISION_OVER_THRESHOLD)},
+            {"over_timeout", 0 != (event.value & BINARY_TRACE_DECISION_OVER_TIMEOUT)}});
+        break;
+    case BinaryTraceEventType::SET_CORE_OP_TIMEOUT:
+        write_instant("set_timeout", core_op_pid(event.core_op_handle), 0, event.timestamp_ns,
+            {{"timeout_ms", event.value}});
+        break;
+    case BinaryTraceEventType::SET_CORE_OP_THRESHOLD:
+        write_instant("set_threshold", core_op_pid(event.core_op_handle), 0, event.timestamp_ns,
+            {{"threshold", event.value}});
+        break;
+    case BinaryTraceEventType::SET_CORE_OP_PRIORITY:
+        write_instant("set_priority", core_op_pid(event.core_op_handle), 0, event.timestamp_ns,
+            {{"priority", event.value}});
+        break;
+    default:
+        LOGGER__WARNING("Unknown binary trace event type {}", static_cast<uint32_t>(event.type));
+        break;
+    }
+}
+
+void TraceEventsConverter::finish()
+{
+    for (auto &device : m_devices) {
+        end_active_core_op(device.second, m_last_timestamp_ns);
+    }
+}
+
+} /* namespace */
+
+ConvertTraceCommand::ConvertTraceCommand(CLI::App &parent_app) :
+    Command(parent_app.add_subcommand("convert-trace",
+        "Convert a binary trace (recorded with HAILO_TRACE=binary) to Chrome/Perfetto trace-event JSON"))
+{
+    m_app->add_option("input", m_input_path, "Binary trace file path")
+        ->check(CLI::ExistingFile)
+        ->required();
+    m_app->add_option("output", m_output_path, "Output JSON file path")
+        ->required();
+}
+
+hailo_status ConvertTraceCommand::execute()
+{
+    auto trace = read_binary_trace(m_input_path);
+    CHECK_EXPECTED_AS_STATUS(trace);
+
+    if (!trace->is_complete) {
+        LOGGER__WARNING("Trace file {} is truncated (the traced process may not have exited cleanly), names won't be resolved",
+            m_input_path);
+    }
+    if (0 != trace->dropped_events_count) {
+        LOGGER__WARNING("{} events were dropped while tracing (rings were full)", trace->dropped_events_count);
+    }
+
+    auto status = write_trace_events(trace.value(), m_output_path);
+    CHECK_SUCCESS(status);
+
+    std::cout << "Converted " << trace->events.size() << " events to " << m_output_path << std::endl;
+    return HAILO_SUCCESS;
+}
+
+Expected<ConvertTraceCommand::BinaryTrace> ConvertTraceCommand::read_binary_trace(const std::string &path)
+{
+    std::ifstream input(path, std::ios::in | std::ios::binary);
+    CHECK_AS_EXPECTED(input.good(), HAILO_OPEN_FILE_FAILURE, "Failed opening file: {}, with errno: {}", path, errno);
+
+    BinaryTrace trace{};
+    input.read(reinterpret_cast<char*>(&trace.header), sizeof(trace.header));
+    CHECK_AS_EXPECTED(sizeof(trace.header) == static_cast<size_t>(input.gcount()), HAILO_INVALID_ARGUMENT,
+        "File {} is too short to be a binary trace", path);
+    CHECK_AS_EXPECTED(0 == std::memcmp(trace.header.magic, BINARY_TRACE_MAGIC, BINARY_TRACE_MAGIC_SIZE),
+        HAILO_INVALID_ARGUMENT, "File {} is not a binary trace", path);
+    CHECK_AS_EXPECTED(BINARY_TRACE_VERSION == trace.header.version, HAILO_INVALID_ARGUMENT,
+        "Unsupported binary trace version {} (expected {})", trace.header.version, BINARY_TRACE_VERSION);
+    CHECK_AS_EXPECTED(sizeof(BinaryTraceEvent) == trace.header.event_size, HAILO_INVALID_ARGUMENT,
+        "Unexpected binary trace event size {}", trace.header.event_size);
+
+    while (true) {
+        BinaryTraceEvent event{};
+        input.read(reinterpret_cast<char*>(&event), sizeof(event));
+        if (sizeof(event) != static_cast<size_t>(input.gcount())) {
+            break; // Truncated file
+        }
+
+        if (BinaryTraceEventType::END == event.type) {
+            trace.dropped_events_count = event.value;
+            trace.is_complete = true;
+            break;
+        }
+        trace.events.push_back(event);
+    }
+
+    if (trace.is_complete) {
+        auto status = read_strings_table(input, path, trace.strings);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    }
+
+    // Each thread's events are written together, so we sort them to get a single timeline.
+    std::stable_sort(trace.events.begin(), trace.events.end(),
+        [](const BinaryTraceEvent &a, const BinaryTraceEvent &b) { return a.timestamp_ns < b.timestamp_ns; });
+
+    return trace;
+}
+
+hailo_status ConvertTraceCommand::read_strings_table(std::ifstream &input, const std::string &path,
+    std::unordered_map<uint32_t, std::string> &strings)
+{
+    // The strings lengths are read from the file, so they are checked against its size before allocating.
+    const auto strings_table_offset = input.tellg();
+    input.seekg(0, std::ios::end);
+    const auto file_size = input.tellg();
+    input.seekg(strings_table_offset);
+    CHECK(input.good() && (file_size >= strings_table_offset), HAILO_FILE_OPERATION_FAILURE,
+        "Failed reading the strings table of {}", path);
+
+    while (true) {
+        uint32_t string_header[2] = {};
+        input.read(reinterpret_cast<char*>(string_header), sizeof(string_header));
+        if (sizeof(string_header) != static_cast<size_t>(input.gcount())) {
+            break;
+        }
+
+        const auto remaining_size = static_cast<uint64_t>(file_size - input.tellg());
+        CHECK(string_header[1] <= remaining_size, HAILO_INVALID_ARGUMENT,
+            "Binary trace string {} length ({}) exceeds the file size", string_header[0], string_header[1]);
+        std::string str(string_header[1], '\0');
+        input.read(&str[0], static_cast<std::streamsize>(str.size()));
+        CHECK(str.size() == static_cast<size_t>(input.gcount()), HAILO_INVALID_ARGUMENT,
+            "Binary trace strings table is truncated");
+        strings.emplace(string_header[0], std::move(str));
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status ConvertTraceCommand::write_trace_events(const BinaryTrace &trace, const std::string &path)
+{
+    std::ofstream output(path, std::ios::out | std::ios::trunc);
+    CHECK(output.good(), HAILO_OPEN_FILE_FAILURE, "Failed opening file: {}, with errno: {}", path, errno);
+
+    output << "{\"displayTimeUnit\": \"ns\", \"otherData\": "
+           << ordered_json({{"start_time_ns_since_epoch", trace.header.start_time_ns_since_epoch},
+                            {"dropped_events", trace.dropped_events_count}}).dump()
+           << ", \"traceEvents\": [";
+
+    TraceEventsConverter converter(output, trace.strings);
+    converter.write_process_names();
+    for (const auto &event : trace.events) {
+        converter.convert(event);
+    }
+    converter.finish();
+
+    output << "\n]}\n";
+    CHECK(output.good(), HAILO_FILE_OPERATION_FAILURE, "Failed writing file: {}, with errno: {}", path, errno);
+    return HAILO_SUCCESS;
+}
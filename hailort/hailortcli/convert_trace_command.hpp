@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file convert_trace_command.hpp
+ * @brief Convert a binary trace file (recorded with HAILO_TRACE=binary) to the Chrome/Perfetto trace-event format
+ **/
+
+#ifndef _HAILO_CONVERT_TRACE_COMMAND_HPP_
+#define _HAILO_CONVERT_TRACE_COMMAND_HPP_
+
+#include "hailortcli.hpp"
+#include "command.hpp"
+
+#include "hailo/hailort.h"
+#include "CLI/CLI.hpp"
+
+#include "utils/profiler/binary_trace_format.hpp"
+
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+
+class ConvertTraceCommand : public Command {
+public:
+    explicit ConvertTraceCommand(CLI::App &parent_app);
+
+    virtual hailo_status execute() override;
+
+private:
+    struct BinaryTrace {
+        BinaryTraceFileHeader header;
+        std::vector<BinaryTraceEvent> events;
+        std::unordered_map<uint32_t, std::string> strings;
+        uint32_t dropped_events_count = 0;
+        bool is_complete = false;
+    };
+
+    static Expected<BinaryTrace> read_binary_trace(const std::string &path);
+    static hailo_status read_strings_table(std::ifstream &input, const std::string &path,
+        std::unordered_map<uint32_t, std::string> &strings);
+    static hailo_status write_trace_events(const BinaryTrace &trace, const std::string &path);
+
+    std::string m_input_path;
+    std::string m_output_path;
+};
+
+#endif /* _HAILO_CONVERT_TRACE_COMMAND_HPP_ */
@@ -130,6 +130,14 @@ DotWriter::HtmlString PipelineGraphNode::format_runtime_stats(const std::vector<
         string_stream << "sd=" << InferResultsFormatUtils::format_statistic(accumulator_result.sd()) << ", ";
         string_stream << "mean_sd=" << InferResultsFormatUtils::format_statistic(accumulator_result.mean_sd());
         lines.emplace_back(string_stream.str());
+
+        if (accumulator_result.p50()) {
+            string_stream.str("");
+            string_stream << "p50=" << InferResultsFormatUtils::format_statistic(accumulator_result.p50()) << ", ";
+            string_stream << "p99=" << InferResultsFormatUtils::format_statistic(accumulator_result.p99()) << ", ";
+            string_stream << "p99.9=" << InferResultsFormatUtils::format_statistic(accumulator_result.p99_9());
+            lines.emplace_back(string_stream.str());
+        }
     }
 
     return create_multiline_label(lines, Align::LEFT);
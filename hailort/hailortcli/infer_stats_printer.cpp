@@ -114,7 +114,7 @@ void InferStatsPrinter::print(const std::vector<std::string> &network_groups_nam
     }
     if (m_pipeline_stats_csv_file.is_open() && (inference_result)) {
         std::cout << "> Writing pipeline statistics to '" << m_pipeline_stats_csv_path << "'... ";
-        m_pipeline_stats_csv_file << "net_name,vstream_name,param_type,element,mean,min,max,var,sd,mean_sd,index" << std::endl;
+        m_pipeline_stats_csv_file << "net_name,vstream_name,param_type,element,mean,min,max,var,sd,mean_sd,p50,p99,p99.9,index" << std::endl;
         for (auto &network_group_results : inference_result->network_group_results()) {
             print_pipeline_elem_stats_csv(network_group_results.network_group_name(), network_group_results.m_fps_accumulators);
             print_pipeline_elem_stats_csv(network_group_results.network_group_name(), network_group_results.m_latency_accumulators);
@@ -495,6 +495,9 @@ void InferStatsPrinter::write_accumulator_results(std::ofstream &output_stream,
     output_stream << InferResultsFormatUtils::format_statistic(accumulator_result.var()) << ",";
     output_stream << InferResultsFormatUtils::format_statistic(accumulator_result.sd()) << ",";
     output_stream << InferResultsFormatUtils::format_statistic(accumulator_result.mean_sd()) << ",";
+    output_stream << InferResultsFormatUtils::format_statistic(accumulator_result.p50()) << ",";
+    output_stream << InferResultsFormatUtils::format_statistic(accumulator_result.p99()) << ",";
+    output_stream << InferResultsFormatUtils::format_statistic(accumulator_result.p99_9()) << ",";
     if (NO_INDEX != index) {
         output_stream << index;
     }
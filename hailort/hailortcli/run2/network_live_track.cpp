@@ -22,6 +22,23 @@ NetworkLiveTrack::NetworkLiveTrack(const std::string &name, std::shared_ptr<Conf
     m_count(0),
     m_last_get_time(),
     m_cng(cng),
+    m_configured_infer_model(nullptr),
+    m_overall_latency_meter(overall_latency_meter),
+    m_measure_fps(measure_fps),
+    m_hef_path(hef_path),
+    m_last_measured_fps(0)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    max_ng_name = std::max(m_name.size(), max_ng_name);
+}
+
+NetworkLiveTrack::NetworkLiveTrack(const std::string &name, std::shared_ptr<ConfiguredInferModel> configured_infer_model,
+                                   LatencyMeterPtr overall_latency_meter, bool measure_fps, const std::string &hef_path) :
+    m_name(name),
+    m_count(0),
+    m_last_get_time(),
+    m_cng(nullptr),
+    m_configured_infer_model(configured_infer_model),
     m_overall_latency_meter(overall_latency_meter),
     m_measure_fps(measure_fps),
     m_hef_path(hef_path),
@@ -48,6 +65,14 @@ double NetworkLiveTrack::get_fps()
     return fps;
 }
 
+Expected<LatencyMeasurementResult> NetworkLiveTrack::get_hw_latency_measurement()
+{
+    if (m_configured_infer_model) {
+        return m_configured_infer_model->get_hw_latency_measurement();
+    }
+    return m_cng->get_latency_measurement();
+}
+
 Expected<double> NetworkLiveTrack::get_last_measured_fps()
 {
     return Expected<double>(m_last_measured_fps);
@@ -70,7 +95,7 @@ uint32_t NetworkLiveTrack::push_text_impl(std::stringstream &ss)
         ss << fmt::format("{}fps: {:.2f}", get_separator(), fps);
     }
 
-    auto hw_latency_measurement = m_cng->get_latency_measurement();
+    auto hw_latency_measurement = get_hw_latency_measurement();
     if (hw_latency_measurement) {
         ss << fmt::format("{}hw latency: {:.2f} ms", get_separator(), InferResultsFormatUtils::latency_result_to_ms(hw_latency_measurement->avg_hw_latency));
     }
@@ -112,7 +137,7 @@ void NetworkLiveTrack::push_json_impl(nlohmann::ordered_json &json)
         network_group_json["FPS"] = std::to_string(fps);
     }
 
-    auto hw_latency_measurement = m_cng->get_latency_measurement();
+    auto hw_latency_measurement = get_hw_latency_measurement();
     if (hw_latency_measurement){
         network_group_json["hw_latency"] = InferResultsFormatUtils::latency_result_to_ms(hw_latency_measurement->avg_hw_latency);
     }
@@ -16,6 +16,10 @@
 
 #include "network_runner.hpp"
 
+#include <queue>
+#include <atomic>
+#include <mutex>
+
 #if defined(_MSC_VER)
 #include <mmsystem.h>
 #endif
@@ -88,8 +92,9 @@ StreamParams::StreamParams() : IoParams(), flags(HAILO_STREAM_FLAGS_NONE)
 
 NetworkParams::NetworkParams() : hef_path(), net_group_name(), vstream_params(), stream_params(),
     scheduling_algorithm(HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN), batch_size(HAILO_DEFAULT_BATCH_SIZE),
-    scheduler_threshold(0), scheduler_timeout_ms(0), framerate(UNLIMITED_FRAMERATE), measure_hw_latency(false),
-    measure_overall_latency(false)
+    scheduler_threshold(0), scheduler_timeout_ms(0), framerate(UNLIMITED_FRAMERATE),
+    async_infer_queue_size(DEFAULT_ASYNC_INFER_QUEUE_SIZE), async_infer_submit_batch_size(1),
+    async_infer_shared_buffers(false), measure_hw_latency(false), measure_overall_latency(false)
 {
 }
 
@@ -99,6 +104,7 @@ NetworkRunner::NetworkRunner(const NetworkParams &params, const std::string &nam
     m_params(params),
     m_name(name),
     m_cng(cng),
+    m_activated_network_group(nullptr),
     m_overall_latency_meter(nullptr),
     m_latency_barrier(nullptr),
     m_last_measured_fps(0)
@@ -121,7 +127,49 @@ Expected<std::shared_ptr<NetworkRunner>> NetworkRunner::create_shared(VDevice &v
         net_group_name = net_groups_names[0];
     }
 
-    auto cfg_params = vdevice.create_configure_params(hef.value(), net_group_name);
+    std::shared_ptr<NetworkRunner> net_runner_ptr = nullptr;
+    if (InferenceMode::FULL_ASYNC == final_net_params.mode) {
+        // The InferModel API configures the whole HEF, hence we only allow a single NetworkGroup
+        CHECK_AS_EXPECTED(1 == hef->get_network_groups_names().size(), HAILO_INVALID_OPERATION,
+            "'--mode=full_async' supports only HEFs with a single NetworkGroup");
+        auto net_runner = FullAsyncNetworkRunner::create_shared(vdevice, final_net_params, net_group_name);
+        CHECK_EXPECTED(net_runner);
+        net_runner_ptr = std::static_pointer_cast<NetworkRunner>(net_runner.release());
+    } else {
+        auto net_runner = create_network_group_runner(vdevice, hef.value(), net_group_name, final_net_params);
+        CHECK_EXPECTED(net_runner);
+        net_runner_ptr = net_runner.release();
+    }
+
+    if (final_net_params.measure_overall_latency || final_net_params.measure_hw_latency) {
+        auto input_names = net_runner_ptr->get_input_names();
+        auto output_names = net_runner_ptr->get_output_names();
+
+        CHECK_AS_EXPECTED((1 == input_names.size()), HAILO_INVALID_OPERATION,
+            "Latency measurement over multiple inputs network is not supported");
+
+        if (final_net_params.measure_overall_latency) {
+            auto overall_latency_meter = make_shared_nothrow<LatencyMeter>(output_names, OVERALL_LATENCY_TIMESTAMPS_LIST_LENGTH);
+            CHECK_NOT_NULL_AS_EXPECTED(overall_latency_meter, HAILO_OUT_OF_HOST_MEMORY);
+            net_runner_ptr->set_overall_latency_meter(overall_latency_meter);
+        }
+
+        // The FULL_ASYNC runner sends one infer request at a time when measuring latency, so no barrier is needed.
+        // For the other modes, we use a barrier for both hw and overall latency
+        if (InferenceMode::FULL_ASYNC != final_net_params.mode) {
+            auto latency_barrier = make_shared_nothrow<Barrier>(input_names.size() + output_names.size());
+            CHECK_NOT_NULL_AS_EXPECTED(latency_barrier, HAILO_OUT_OF_HOST_MEMORY);
+            net_runner_ptr->set_latency_barrier(latency_barrier);
+        }
+    }
+
+    return net_runner_ptr;
+}
+
+Expected<std::shared_ptr<NetworkRunner>> NetworkRunner::create_network_group_runner(VDevice &vdevice, Hef &hef,
+    const std::string &net_group_name, NetworkParams &final_net_params)
+{
+    auto cfg_params = vdevice.create_configure_params(hef, net_group_name);
     CHECK_EXPECTED(cfg_params);
     cfg_params->batch_size = final_net_params.batch_size;
     if (final_net_params.batch_size == HAILO_DEFAULT_BATCH_SIZE) {
@@ -136,7 +184,7 @@ Expected<std::shared_ptr<NetworkRunner>> NetworkRunner::create_shared(VDevice &v
             stream_name_params_pair.second.flags = HAILO_STREAM_FLAGS_ASYNC;
         }
     } 
-    auto cfgr_net_groups = vdevice.configure(hef.value(), {{net_group_name, cfg_params.value()}});
+    auto cfgr_net_groups = vdevice.configure(hef, {{net_group_name, cfg_params.value()}});
     CHECK_EXPECTED(cfgr_net_groups);
     assert(1 == cfgr_net_groups->size());
     auto cfgr_net_group = cfgr_net_groups.value()[0];
@@ -188,25 +236,6 @@ Expected<std::shared_ptr<NetworkRunner>> NetworkRunner::create_shared(VDevice &v
         return make_unexpected(HAILO_INTERNAL_FAILURE);
     }
 
-    if (final_net_params.measure_overall_latency || final_net_params.measure_hw_latency) {
-        auto input_names = net_runner_ptr->get_input_names();
-        auto output_names = net_runner_ptr->get_output_names();
-
-        CHECK_AS_EXPECTED((1 == input_names.size()), HAILO_INVALID_OPERATION,
-            "Latency measurement over multiple inputs network is not supported");
-
-        if (final_net_params.measure_overall_latency) {
-            auto overall_latency_meter = make_shared_nothrow<LatencyMeter>(output_names, OVERALL_LATENCY_TIMESTAMPS_LIST_LENGTH);
-            CHECK_NOT_NULL_AS_EXPECTED(overall_latency_meter, HAILO_OUT_OF_HOST_MEMORY);
-            net_runner_ptr->set_overall_latency_meter(overall_latency_meter);
-        }
-
-        // We use a barrier for both hw and overall latency
-        auto latency_barrier = make_shared_nothrow<Barrier>(input_names.size() + output_names.size());
-        CHECK_NOT_NULL_AS_EXPECTED(latency_barrier, HAILO_OUT_OF_HOST_MEMORY);
-        net_runner_ptr->set_latency_barrier(latency_barrier);
-    }
-
     return net_runner_ptr;
 }
 
@@ -220,19 +249,17 @@ bool NetworkRunner::inference_succeeded(hailo_status status)
 
 hailo_status NetworkRunner::run(EventPtr shutdown_event, LiveStats &live_stats, Barrier &activation_barrier)
 {
-    auto ang = std::unique_ptr<ActivatedNetworkGroup>(nullptr);
     if (HAILO_SCHEDULING_ALGORITHM_NONE == m_params.scheduling_algorithm) {
-        auto ang_exp = m_cng->activate();
-        if (!ang_exp) {
+        auto status = activate();
+        if (HAILO_SUCCESS != status) {
             activation_barrier.terminate();
         }
-        CHECK_EXPECTED_AS_STATUS(ang_exp);
-        ang = ang_exp.release();
+        CHECK_SUCCESS(status);
     }
 
     // If we measure latency (hw or overall) we send frames one at a time. Hence we don't measure fps.
     const auto measure_fps = !m_params.measure_hw_latency && !m_params.measure_overall_latency;
-    auto net_live_track = std::make_shared<NetworkLiveTrack>(m_name, m_cng, m_overall_latency_meter, measure_fps, m_params.hef_path);
+    auto net_live_track = create_network_live_track(measure_fps);
     live_stats.add(net_live_track, 1); //support progress over multiple outputs
 
 #if defined(_MSC_VER)
@@ -241,16 +268,39 @@ hailo_status NetworkRunner::run(EventPtr shutdown_event, LiveStats &live_stats,
 
     activation_barrier.arrive_and_wait();
 
-    if (m_params.mode == InferenceMode::RAW_ASYNC_SINGLE_THREAD) {
-        return run_single_thread_async_infer(shutdown_event, net_live_track);
+    auto status = HAILO_UNINITIALIZED;
+    if ((m_params.mode == InferenceMode::RAW_ASYNC_SINGLE_THREAD) || (m_params.mode == InferenceMode::FULL_ASYNC)) {
+        status = run_single_thread_async_infer(shutdown_event, net_live_track);
     } else {
         auto threads = start_inference_threads(shutdown_event, net_live_track);
         CHECK_EXPECTED_AS_STATUS(threads);
 
         CHECK_SUCCESS(shutdown_event->wait(HAILO_INFINITE_TIMEOUT));
         stop();
-        return wait_for_threads(threads.value());
+        status = wait_for_threads(threads.value());
     }
+
+    deactivate();
+    return status;
+}
+
+hailo_status NetworkRunner::activate()
+{
+    auto ang = m_cng->activate();
+    CHECK_EXPECTED_AS_STATUS(ang);
+    m_activated_network_group = ang.release();
+
+    return HAILO_SUCCESS;
+}
+
+void NetworkRunner::deactivate()
+{
+    m_activated_network_group.reset();
+}
+
+std::shared_ptr<NetworkLiveTrack> NetworkRunner::create_network_live_track(bool measure_fps)
+{
+    return std::make_shared<NetworkLiveTrack>(m_name, m_cng, m_overall_latency_meter, measure_fps, m_params.hef_path);
 }
 
 void NetworkRunner::set_overall_latency_meter(LatencyMeterPtr latency_meter)
@@ -281,7 +331,7 @@ double NetworkRunner::get_last_measured_fps()
 hailo_vstream_params_t update_quantize_flag_in_vstream_param(const hailo_vstream_info_t &vstream_info, const hailo_vstream_params_t &old_vstream_params)
 {
     hailo_vstream_params_t res = old_vstream_params;
-    if ((HAILO_FORMAT_TYPE_FLOAT32 == old_vstream_params.user_buffer_format.type) || (HailoRTCommon::is_nms(vstream_info))) {
+    if (HailoRTCommon::is_float_type(old_vstream_params.user_buffer_format.type) || (HailoRTCommon::is_nms(vstream_info))) {
         res.user_buffer_format.flags &= (~HAILO_FORMAT_FLAGS_QUANTIZED);
     } else {
         res.user_buffer_format.flags |= (HAILO_FORMAT_FLAGS_QUANTIZED);
@@ -606,4 +656,359 @@ StreamParams RawNetworkRunner::get_params(const std::string &name)
         }
     }
     return StreamParams();
-}
\ No newline at end of file
+}
+
+FullAsyncNetworkRunner::FullAsyncNetworkRunner(const NetworkParams &params, const std::string &name, VDevice &vdevice,
+                                               InferModel &&infer_model,
+                                               std::shared_ptr<ConfiguredInferModel> configured_infer_model) :
+    NetworkRunner(params, name, vdevice, nullptr),
+    m_infer_model(std::move(infer_model)),
+    m_configured_infer_model(configured_infer_model),
+    m_is_activated(false)
+{
+}
+
+Expected<std::shared_ptr<FullAsyncNetworkRunner>> FullAsyncNetworkRunner::create_shared(VDevice &vdevice,
+    const NetworkParams &params, const std::string &name)
+{
+    auto infer_model = vdevice.create_infer_model(params.hef_path);
+    CHECK_EXPECTED(infer_model);
+
+    for (const auto &vstream_params : params.vstream_params) {
+        const auto &format = vstream_params.params.user_buffer_format;
+        auto input = infer_model->input(vstream_params.name);
+        if (input) {
+            input->set_format_type(format.type);
+            input->set_format_order(format.order);
+            continue;
+        }
+        auto output = infer_model->output(vstream_params.name);
+        CHECK_EXPECTED(output, "One of the params has an invalid vStream name ({})", vstream_params.name);
+        output->set_format_type(format.type);
+        output->set_format_order(format.order);
+    }
+
+    infer_model->set_batch_size(params.batch_size);
+    if (params.measure_hw_latency) {
+        infer_model->set_hw_latency_measurement_flags(HAILO_LATENCY_MEASURE);
+    }
+
+    auto configured_infer_model = infer_model->configure();
+    CHECK_EXPECTED(configured_infer_model);
+    auto configured_infer_model_ptr = make_shared_nothrow<ConfiguredInferModel>(configured_infer_model.release());
+    CHECK_NOT_NULL_AS_EXPECTED(configured_infer_model_ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    if (HAILO_SCHEDULING_ALGORITHM_NONE != params.scheduling_algorithm) {
+        CHECK_SUCCESS_AS_EXPECTED(configured_infer_model_ptr->set_scheduler_threshold(params.scheduler_threshold));
+        CHECK_SUCCESS_AS_EXPECTED(configured_infer_model_ptr->set_scheduler_timeout(
+            std::chrono::milliseconds(params.scheduler_timeout_ms)));
+        CHECK_SUCCESS_AS_EXPECTED(configured_infer_model_ptr->set_scheduler_priority(params.scheduler_priority));
+    }
+
+    CHECK_AS_EXPECTED(params.async_infer_submit_batch_size <= params.async_infer_queue_size, HAILO_INVALID_ARGUMENT,
+        "Async submit batch ({}) must not exceed the async queue size ({})",
+        params.async_infer_submit_batch_size, params.async_infer_queue_size);
+
+    auto net_runner = make_shared_nothrow<FullAsyncNetworkRunner>(params, name, vdevice, infer_model.release(),
+        configured_infer_model_ptr);
+    CHECK_NOT_NULL_AS_EXPECTED(net_runner, HAILO_OUT_OF_HOST_MEMORY);
+
+    return net_runner;
+}
+
+hailo_status FullAsyncNetworkRunner::activate()
+{
+    auto status = m_configured_infer_model->activate();
+    CHECK_SUCCESS(status);
+    m_is_activated = true;
+
+    return HAILO_SUCCESS;
+}
+
+void FullAsyncNetworkRunner::deactivate()
+{
+    if (m_is_activated) {
+        m_configured_infer_model->deactivate();
+        m_is_activated = false;
+    }
+}
+
+std::shared_ptr<NetworkLiveTrack> FullAsyncNetworkRunner::create_network_live_track(bool measure_fps)
+{
+    return std::make_shared<NetworkLiveTrack>(m_name, m_configured_infer_model, m_overall_latency_meter, measure_fps,
+        m_params.hef_path);
+}
+
+Expected<std::map<std::string, std::vector<BufferPtr>>> FullAsyncNetworkRunner::create_input_datasets()
+{
+    std::map<std::string, std::vector<BufferPtr>> datasets;
+    for (const auto &input : m_infer_model.inputs()) {
+        const auto frame_size = input.get_frame_size();
+        const auto params = get_params(input.name());
+
+        std::vector<BufferPtr> dataset;
+        if (params.input_file_path.empty()) {
+            const uint8_t const_byte = 0xAB;
+            auto constant_buffer = Buffer::create_shared(frame_size, const_byte, BufferStorageParams::create_dma());
+            CHECK_EXPECTED(constant_buffer);
+            dataset.emplace_back(constant_buffer.release());
+        } else {
+            auto buffer = read_binary_file(params.input_file_path);
+            CHECK_EXPECTED(buffer);
+            CHECK_AS_EXPECTED(0 == (buffer->size() % frame_size), HAILO_INVALID_ARGUMENT,
+                "Input file ({}) size {} must be a multiple of the frame size {}",
+                params.input_file_path, buffer->size(), frame_size);
+
+            const size_t frames_count = buffer->size() / frame_size;
+            dataset.reserve(frames_count);
+            for (size_t i = 0; i < frames_count; i++) {
+                auto frame_buffer = Buffer::create_shared(buffer->data() + (frame_size * i), frame_size,
+                    BufferStorageParams::create_dma());
+                CHECK_EXPECTED(frame_buffer);
+                dataset.emplace_back(frame_buffer.release());
+            }
+        }
+        datasets.emplace(input.name(), std::move(dataset));
+    }
+
+    return datasets;
+}
+
+Expected<std::vector<ConfiguredInferModel::Bindings>> FullAsyncNetworkRunner::create_bindings(size_t count)
+{
+    const auto buffers_sets_count = m_params.async_infer_shared_buffers ? 1 : count;
+    m_output_buffers.clear();
+    for (size_t i = 0; i < buffers_sets_count; i++) {
+        for (const auto &output : m_infer_model.outputs()) {
+            auto buffer = Buffer::create_shared(output.get_frame_size(), BufferStorageParams::create_dma());
+            CHECK_EXPECTED(buffer);
+            m_output_buffers.emplace_back(buffer.release());
+        }
+    }
+
+    const auto outputs_count = m_infer_model.outputs().size();
+    std::vector<ConfiguredInferModel::Bindings> bindings_list;
+    bindings_list.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        auto bindings = m_configured_infer_model->create_bindings();
+        CHECK_EXPECTED(bindings);
+
+        const auto buffers_set_offset = (i % buffers_sets_count) * outputs_count;
+        for (size_t output_index = 0; output_index < outputs_count; output_index++) {
+            const auto &output = m_infer_model.outputs()[output_index];
+            auto output_stream = bindings->output(output.name());
+            CHECK_EXPECTED(output_stream);
+            auto status = output_stream->set_buffer(MemoryView(*m_output_buffers[buffers_set_offset + output_index]));
+            CHECK_SUCCESS_AS_EXPECTED(status);
+        }
+        bindings_list.emplace_back(bindings.release());
+    }
+
+    return bindings_list;
+}
+
+// Shared between the inference loop and the completion callbacks (which may be called after the loop has exited)
+struct AsyncInferRequestsState final
+{
+    std::mutex mutex;
+    std::queue<size_t> free_bindings;
+    SemaphorePtr free_bindings_semaphore;
+    std::atomic_size_t ongoing_requests;
+    // Status of the first infer request that failed (protected by mutex)
+    hailo_status failure_status;
+
+    hailo_status get_failure_status()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return failure_status;
+    }
+
+    // Waits for the in-flight requests, so the bindings' buffers will not be released while in use
+    hailo_status wait_for_ongoing_requests()
+    {
+        while (ongoing_requests > 0) {
+            auto status = free_bindings_semaphore->wait(HAILORTCLI_DEFAULT_TIMEOUT);
+            CHECK_SUCCESS(status, "Failed waiting for in-flight infer requests");
+        }
+        return HAILO_SUCCESS;
+    }
+};
+
+// Makes sure that on every exit path of the inference loop (including errors), the in-flight requests are drained
+// before the buffers they point to are released, and the network is deactivated afterwards.
+class AsyncInferRequestsDrainGuard final
+{
+public:
+    AsyncInferRequestsDrainGuard(AsyncInferRequestsState &state, FullAsyncNetworkRunner &runner) :
+        m_state(state), m_runner(runner)
+    {}
+
+    ~AsyncInferRequestsDrainGuard()
+    {
+        auto status = m_state.wait_for_ongoing_requests();
+        if (HAILO_SUCCESS != status) {
+            LOGGER__CRITICAL("Failed draining {} in-flight infer requests", m_state.ongoing_requests.load());
+        }
+        m_runner.deactivate();
+    }
+
+    AsyncInferRequestsDrainGuard(const AsyncInferRequestsDrainGuard &) = delete;
+    AsyncInferRequestsDrainGuard &operator=(const AsyncInferRequestsDrainGuard &) = delete;
+
+private:
+    AsyncInferRequestsState &m_state;
+    FullAsyncNetworkRunner &m_runner;
+};
+
+hailo_status FullAsyncNetworkRunner::run_single_thread_async_infer(EventPtr shutdown_event,
+    std::shared_ptr<NetworkLiveTrack> net_live_track)
+{
+    // When measuring latency we want to send one infer request at a time (to avoid back-pressure)
+    const bool measure_latency = m_params.measure_hw_latency || m_params.measure_overall_latency;
+    const uint32_t queue_size = measure_latency ? 1 : m_params.async_infer_queue_size;
+    const uint32_t submit_batch_size = std::min(m_params.async_infer_submit_batch_size, queue_size);
+
+    auto input_datasets = create_input_datasets();
+    CHECK_EXPECTED_AS_STATUS(input_datasets);
+    std::map<std::string, size_t> next_frame_index;
+    for (const auto &name_dataset_pair : input_datasets.value()) {
+        next_frame_index.emplace(name_dataset_pair.first, 0);
+    }
+
+    auto bindings_list = create_bindings(queue_size);
+    CHECK_EXPECTED_AS_STATUS(bindings_list);
+
+    auto state = make_shared_nothrow<AsyncInferRequestsState>();
+    CHECK_NOT_NULL(state, HAILO_OUT_OF_HOST_MEMORY);
+    for (size_t i = 0; i < queue_size; i++) {
+        state->free_bindings.push(i);
+    }
+    state->free_bindings_semaphore = Semaphore::create_shared(queue_size);
+    CHECK_NOT_NULL(state->free_bindings_semaphore, HAILO_OUT_OF_HOST_MEMORY);
+    state->ongoing_requests = 0;
+    state->failure_status = HAILO_SUCCESS;
+
+    // Declared after the input datasets and the bindings, so it is destructed (and drains the requests) before them
+    AsyncInferRequestsDrainGuard drain_guard(*state, *this);
+
+    const size_t shutdown_index = 0;
+    std::vector<std::reference_wrapper<Waitable>> waitables;
+    waitables.emplace_back(std::ref(*shutdown_event));
+    waitables.emplace_back(std::ref(*state->free_bindings_semaphore));
+    WaitableGroup wait_group(std::move(waitables));
+
+    const auto output_names = get_output_names();
+    FramerateThrottle framerate_throttle(m_params.framerate);
+    std::vector<size_t> acquired_bindings;
+    acquired_bindings.reserve(submit_batch_size);
+
+    auto status = HAILO_SUCCESS;
+    bool shutdown = false;
+    while (!shutdown) {
+        // Acquire 'submit_batch_size' free bindings, then submit all of the requests back-to-back
+        acquired_bindings.clear();
+        while (acquired_bindings.size() < submit_batch_size) {
+            auto wait_index = wait_group.wait_any(HAILORTCLI_DEFAULT_TIMEOUT);
+            CHECK_EXPECTED_AS_STATUS(wait_index);
+            if (*wait_index == shutdown_index) {
+                shutdown = true;
+                break;
+            }
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            acquired_bindings.push_back(state->free_bindings.front());
+            state->free_bindings.pop();
+        }
+        if (shutdown) {
+            break;
+        }
+
+        status = state->get_failure_status();
+        CHECK_SUCCESS(status, "Async infer request failed");
+
+        for (const auto bindings_index : acquired_bindings) {
+            auto &bindings = bindings_list.value()[bindings_index];
+            for (auto &name_dataset_pair : input_datasets.value()) {
+                auto &frame_index = next_frame_index[name_dataset_pair.first];
+                auto input_stream = bindings.input(name_dataset_pair.first);
+                CHECK_EXPECTED_AS_STATUS(input_stream);
+                status = input_stream->set_buffer(MemoryView(*name_dataset_pair.second[frame_index]));
+                CHECK_SUCCESS(status);
+                frame_index = (frame_index + 1) % name_dataset_pair.second.size();
+            }
+
+            framerate_throttle.throttle();
+
+            status = m_configured_infer_model->wait_for_async_ready(HAILORTCLI_DEFAULT_TIMEOUT);
+            CHECK_SUCCESS(status);
+
+            if (m_overall_latency_meter) {
+                m_overall_latency_meter->add_start_sample(std::chrono::steady_clock::now().time_since_epoch());
+            }
+
+            state->ongoing_requests++;
+            auto job = m_configured_infer_model->run_async(bindings,
+                [state, bindings_index, net_live_track, output_names, latency_meter=m_overall_latency_meter]
+                (const CompletionInfoAsyncInfer &completion_info) {
+                    if (HAILO_SUCCESS == completion_info.status) {
+                        if (latency_meter) {
+                            const auto now = std::chrono::steady_clock::now().time_since_epoch();
+                            for (const auto &output_name : output_names) {
+                                latency_meter->add_end_sample(output_name, now);
+                            }
+                        }
+                        net_live_track->progress();
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(state->mutex);
+                        if ((HAILO_SUCCESS != completion_info.status) && (HAILO_SUCCESS == state->failure_status)) {
+                            state->failure_status = completion_info.status;
+                        }
+                        state->free_bindings.push(bindings_index);
+                    }
+                    state->ongoing_requests--;
+                    (void)state->free_bindings_semaphore->signal();
+                });
+            if (!job) {
+                state->ongoing_requests--;
+            }
+            CHECK_EXPECTED_AS_STATUS(job);
+            job->detach();
+        }
+    }
+
+    status = state->wait_for_ongoing_requests();
+    CHECK_SUCCESS(status);
+
+    status = state->get_failure_status();
+    CHECK_SUCCESS(status, "Async infer request failed");
+    return HAILO_SUCCESS;
+}
+
+void FullAsyncNetworkRunner::stop()
+{
+    // Nothing to abort - run_single_thread_async_infer exits on the shutdown event and drains the in-flight requests
+}
+
+std::set<std::string> FullAsyncNetworkRunner::get_input_names()
+{
+    const auto &names = m_infer_model.get_input_names();
+    return std::set<std::string>(names.begin(), names.end());
+}
+
+std::set<std::string> FullAsyncNetworkRunner::get_output_names()
+{
+    const auto &names = m_infer_model.get_output_names();
+    return std::set<std::string>(names.begin(), names.end());
+}
+
+VStreamParams FullAsyncNetworkRunner::get_params(const std::string &name)
+{
+    for (const auto &params : m_params.vstream_params) {
+        if (name == params.name) {
+            return params;
+        }
+    }
+    return VStreamParams();
+}
@@ -33,10 +33,12 @@
 using namespace hailort;
 
 constexpr std::chrono::milliseconds SYNC_EVENT_TIMEOUT(1000);
+constexpr uint32_t DEFAULT_ASYNC_INFER_QUEUE_SIZE = 4;
 
 
 enum class InferenceMode {
     FULL,
+    FULL_ASYNC,
 
     RAW,
     RAW_ASYNC,
@@ -84,6 +86,11 @@ struct NetworkParams
     // Run parameters
     uint32_t framerate;
 
+    // Async infer (InferModel) parameters
+    uint32_t async_infer_queue_size;
+    uint32_t async_infer_submit_batch_size;
+    bool async_infer_shared_buffers;
+
     bool measure_hw_latency;
     bool measure_overall_latency;
     InferenceMode mode;
@@ -125,6 +132,9 @@ public:
 
     hailo_status run(EventPtr shutdown_event, LiveStats &live_stats, Barrier &activation_barrier);
     virtual void stop() = 0;
+    virtual hailo_status activate();
+    virtual void deactivate();
+    virtual std::shared_ptr<NetworkLiveTrack> create_network_live_track(bool measure_fps);
     // Must be called prior to run
     void set_overall_latency_meter(LatencyMeterPtr latency_meter);
     void set_latency_barrier(BarrierPtr latency_barrier);
@@ -133,6 +143,8 @@ public:
     double get_last_measured_fps();
 
 protected:
+    static Expected<std::shared_ptr<NetworkRunner>> create_network_group_runner(VDevice &vdevice, Hef &hef,
+        const std::string &net_group_name, NetworkParams &final_net_params);
     static bool inference_succeeded(hailo_status status);
     // Use 'inference_succeeded(async_thread->get())' to check for a thread's success
     virtual Expected<std::vector<AsyncThreadPtr<hailo_status>>> start_inference_threads(EventPtr shutdown_event,
@@ -304,6 +316,7 @@ protected:
     const NetworkParams m_params;
     std::string m_name;
     std::shared_ptr<ConfiguredNetworkGroup> m_cng;
+    std::unique_ptr<ActivatedNetworkGroup> m_activated_network_group;
     LatencyMeterPtr m_overall_latency_meter;
     BarrierPtr m_latency_barrier;
     double m_last_measured_fps;
@@ -362,4 +375,44 @@ private:
     OutputStreamRefVector m_output_streams;
 };
 
+// Runs the network via the InferModel API (ConfiguredInferModel::run_async).
+// A single thread submits the infer requests, keeping up to 'async_infer_queue_size' requests in flight.
+class FullAsyncNetworkRunner : public NetworkRunner
+{
+public:
+    static Expected<std::shared_ptr<FullAsyncNetworkRunner>> create_shared(VDevice &vdevice, const NetworkParams &params,
+        const std::string &name);
+
+    FullAsyncNetworkRunner(const NetworkParams &params, const std::string &name, VDevice &vdevice,
+        InferModel &&infer_model, std::shared_ptr<ConfiguredInferModel> configured_infer_model);
+
+    virtual Expected<std::vector<AsyncThreadPtr<hailo_status>>> start_inference_threads(EventPtr,
+        std::shared_ptr<NetworkLiveTrack>) override
+    {
+        return make_unexpected(HAILO_NOT_IMPLEMENTED);
+    };
+    virtual hailo_status run_single_thread_async_infer(EventPtr shutdown_event,
+        std::shared_ptr<NetworkLiveTrack> net_live_track) override;
+
+    virtual void stop() override;
+    virtual hailo_status activate() override;
+    virtual void deactivate() override;
+    virtual std::shared_ptr<NetworkLiveTrack> create_network_live_track(bool measure_fps) override;
+    virtual std::set<std::string> get_input_names() override;
+    virtual std::set<std::string> get_output_names() override;
+    VStreamParams get_params(const std::string &name);
+
+private:
+    // Each in-flight infer request uses its own bindings. The output buffers are allocated per bindings, unless
+    // 'async_infer_shared_buffers' is set (in which case all of the bindings share the same output buffers).
+    Expected<std::vector<ConfiguredInferModel::Bindings>> create_bindings(size_t count);
+    Expected<std::map<std::string, std::vector<BufferPtr>>> create_input_datasets();
+
+    std::vector<BufferPtr> m_output_buffers;
+
+    InferModel m_infer_model;
+    std::shared_ptr<ConfiguredInferModel> m_configured_infer_model;
+    bool m_is_activated;
+};
+
 #endif /* _HAILO_HAILORTCLI_RUN2_NETWORK_RUNNER_HPP_ */
\ No newline at end of file
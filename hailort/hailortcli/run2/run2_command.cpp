@@ -184,7 +184,9 @@ VStreamApp::VStreamApp(const std::string &description, const std::string &name,
             { "auto", HAILO_FORMAT_TYPE_AUTO },
             { "uint8", HAILO_FORMAT_TYPE_UINT8 },
             { "uint16", HAILO_FORMAT_TYPE_UINT16 },
-            { "float32", HAILO_FORMAT_TYPE_FLOAT32 }
+            { "float32", HAILO_FORMAT_TYPE_FLOAT32 },
+            { "float16", HAILO_FORMAT_TYPE_FLOAT16 },
+            { "bfloat16", HAILO_FORMAT_TYPE_BFLOAT16 }
         }))
         ->default_val("auto");
 
@@ -294,6 +296,19 @@ NetworkApp::NetworkApp(const std::string &description, const std::string &name)
     auto run_params = add_option_group("Run Parameters");
     run_params->add_option("--framerate", m_params.framerate, "Input vStreams framerate")->default_val(UNLIMITED_FRAMERATE);
 
+    auto async_infer_params = add_option_group("Async Infer Parameters (--mode=full_async)");
+    async_infer_params->add_option("--async-queue-size", m_params.async_infer_queue_size,
+        "Max number of in-flight infer requests")
+        ->default_val(DEFAULT_ASYNC_INFER_QUEUE_SIZE)
+        ->check(CLI::PositiveNumber);
+    async_infer_params->add_option("--async-submit-batch", m_params.async_infer_submit_batch_size,
+        "Number of infer requests submitted back-to-back (must not exceed --async-queue-size)")
+        ->default_val(1)
+        ->check(CLI::PositiveNumber);
+    async_infer_params->add_flag("--async-shared-buffers", m_params.async_infer_shared_buffers,
+        "Use a single set of output buffers for all in-flight infer requests")
+        ->default_val(false);
+
     // TODO: support multiple scheduling algorithms
     m_params.scheduling_algorithm = HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN;
 
@@ -373,6 +388,7 @@ Run2::Run2() : CLI::App("Run networks", "run2")
     add_option("-m,--mode", m_mode, "Inference mode")
         ->transform(HailoCheckedTransformer<InferenceMode>({
             { "full", InferenceMode::FULL },
+            { "full_async", InferenceMode::FULL_ASYNC },
             { "raw", InferenceMode::RAW },
             { "raw_async", InferenceMode::RAW_ASYNC },
             { "raw_async_single_thread", InferenceMode::RAW_ASYNC_SINGLE_THREAD, OptionVisibility::HIDDEN }
@@ -614,6 +630,8 @@ std::string get_str_infer_mode(const InferenceMode& infer_mode)
     switch(infer_mode){
     case InferenceMode::FULL:
         return "full";
+    case InferenceMode::FULL_ASYNC:
+        return "full_async";
     case InferenceMode::RAW:
         return "raw";
     case InferenceMode::RAW_ASYNC:
@@ -190,7 +190,9 @@ static void add_run_command_params(CLI::App *run_subcommand, inference_runner_pa
             { "auto", HAILO_FORMAT_TYPE_AUTO },
             { "uint8", HAILO_FORMAT_TYPE_UINT8 },
             { "uint16", HAILO_FORMAT_TYPE_UINT16 },
-            { "float32", HAILO_FORMAT_TYPE_FLOAT32 }
+            { "float32", HAILO_FORMAT_TYPE_FLOAT32 },
+            { "float16", HAILO_FORMAT_TYPE_FLOAT16 },
+            { "bfloat16", HAILO_FORMAT_TYPE_BFLOAT16 }
         }))
         ->default_val("auto");
 
@@ -202,6 +204,8 @@ static void add_run_command_params(CLI::App *run_subcommand, inference_runner_pa
         ->group(""); // --elem-latency will be hidden in the --help print.
     CLI::Option *elem_queue_size_option = measure_stats_subcommand->add_flag("--elem-queue-size", params.pipeline_stats.measure_elem_queue_size,
         "Measure the queue size of each pipeline element separately");
+    measure_stats_subcommand->add_flag("--percentiles", params.pipeline_stats.measure_percentiles,
+        "Collect the latency and queue size measurements into histograms, adding p50/p99/p99.9 to the statistics");
 
     // TODO (HRT-4522): Remove comment-out
     // measure_stats_subcommand->add_flag("--vstream-fps", params.pipeline_stats.measure_vstream_fps,
@@ -324,6 +328,10 @@ std::string format_type_to_string(hailo_format_type_t format_type) {
         return "uint16";
     case HAILO_FORMAT_TYPE_FLOAT32:
         return "float32";
+    case HAILO_FORMAT_TYPE_FLOAT16:
+        return "float16";
+    case HAILO_FORMAT_TYPE_BFLOAT16:
+        return "bfloat16";
     default:
         return "<INVALID_TYPE>";
     }
@@ -356,6 +364,9 @@ static hailo_pipeline_elem_stats_flags_t inference_runner_params_to_pipeline_ele
     if (params.measure_elem_queue_size) {
         result |= HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE;
     }
+    if (params.measure_percentiles) {
+        result |= HAILO_PIPELINE_ELEM_STATS_MEASURE_PERCENTILES;
+    }
 
     return result;
 }
@@ -474,7 +485,7 @@ Expected<std::map<std::string, std::vector<InputVStream>>> create_input_vstreams
     auto network_infos = configured_net_group.get_network_infos();
     CHECK_EXPECTED(network_infos);
     for (auto &network_info : network_infos.value()) {
-        auto quantized = (params.transform.format_type != HAILO_FORMAT_TYPE_FLOAT32);
+        auto quantized = !HailoRTCommon::is_float_type(params.transform.format_type);
         auto input_vstreams_params = configured_net_group.make_input_vstream_params(quantized,
             params.transform.format_type, HAILORTCLI_DEFAULT_VSTREAM_TIMEOUT_MS, HAILO_DEFAULT_VSTREAM_QUEUE_SIZE, network_info.name);
         CHECK_EXPECTED(input_vstreams_params);
@@ -504,7 +515,7 @@ Expected<std::map<std::string, std::vector<OutputVStream>>> create_output_vstrea
         auto nms_output = std::any_of(vstream_infos->begin(), vstream_infos->end(), [] (const hailo_vstream_info_t &output_info) {
             return HailoRTCommon::is_nms(output_info);
         });
-        auto quantized = ((params.transform.format_type != HAILO_FORMAT_TYPE_FLOAT32) && !nms_output);
+        auto quantized = (!HailoRTCommon::is_float_type(params.transform.format_type) && !nms_output);
         auto output_vstreams_params = configured_net_group.make_output_vstream_params(quantized,
             params.transform.format_type, HAILORTCLI_DEFAULT_VSTREAM_TIMEOUT_MS, HAILO_DEFAULT_VSTREAM_QUEUE_SIZE, network_info.name);
         CHECK_EXPECTED(output_vstreams_params);
@@ -40,6 +40,7 @@ struct pipeline_stats_measurement_params {
     bool measure_elem_fps;
     bool measure_elem_latency;
     bool measure_elem_queue_size;
+    bool measure_percentiles;
     bool measure_vstream_fps;
     bool measure_vstream_latency;
     std::string pipeline_stats_output_path;
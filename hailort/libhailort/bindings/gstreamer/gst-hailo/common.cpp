@@ -25,4 +25,49 @@ HailoElemProperty<gchar*>::~HailoElemProperty()
     if (nullptr != m_value) {
         g_free(m_value);
     }
-}
\ No newline at end of file
+}
+
+GType
+gst_scheduling_algorithm_get_type (void)
+{
+    static GType scheduling_algorithm_type = 0;
+
+    /* Tightly coupled to hailo_scheduling_algorithm_e */
+
+    if (!scheduling_algorithm_type) {
+        static GEnumValue algorithm_types[] = {
+            { HAILO_SCHEDULING_ALGORITHM_NONE,         "Scheduler is not active", "HAILO_SCHEDULING_ALGORITHM_NONE" },
+            { HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN,  "Round robin",             "HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN" },
+            { HAILO_SCHEDULING_ALGORITHM_MAX_ENUM,     NULL,                      NULL },
+        };
+
+        scheduling_algorithm_type =
+            g_enum_register_static ("GstHailoSchedulingAlgorithms", algorithm_types);
+    }
+
+    return scheduling_algorithm_type;
+}
+
+GType
+gst_hailo_format_type_get_type (void)
+{
+    static GType format_type_enum = 0;
+
+    /* Tightly coupled to hailo_format_type_t */
+    
+    if (!format_type_enum) {
+        static GEnumValue format_types[] = {
+            { HAILO_FORMAT_TYPE_AUTO,     "auto",     "HAILO_FORMAT_TYPE_AUTO"},
+            { HAILO_FORMAT_TYPE_UINT8,    "uint8",    "HAILO_FORMAT_TYPE_UINT8"},
+            { HAILO_FORMAT_TYPE_UINT16,   "uint16",   "HAILO_FORMAT_TYPE_UINT16"},
+            { HAILO_FORMAT_TYPE_FLOAT32,  "float32",  "HAILO_FORMAT_TYPE_FLOAT32"},
+            { HAILO_FORMAT_TYPE_FLOAT16,  "float16",  "HAILO_FORMAT_TYPE_FLOAT16"},
+            { HAILO_FORMAT_TYPE_BFLOAT16, "bfloat16", "HAILO_FORMAT_TYPE_BFLOAT16"},
+            { HAILO_FORMAT_TYPE_MAX_ENUM,  NULL,      NULL },
+        };
+
+        format_type_enum = g_enum_register_static ("GstHailoFormatTypes", format_types);
+    }
+
+    return format_type_enum;
+}
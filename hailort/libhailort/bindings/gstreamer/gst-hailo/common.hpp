@@ -144,4 +144,10 @@ private:
 template<>
 HailoElemProperty<gchar*>::~HailoElemProperty();
 
+#define GST_TYPE_SCHEDULING_ALGORITHM (gst_scheduling_algorithm_get_type ())
+GType gst_scheduling_algorithm_get_type (void);
+
+#define GST_TYPE_HAILO_FORMAT_TYPE (gst_hailo_format_type_get_type ())
+GType gst_hailo_format_type_get_type (void);
+
 #endif /* _GST_HAILO_COMMON_HPP_ */
\ No newline at end of file
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021-2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#include "dmabuf_allocator.hpp"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <linux/udmabuf.h>
+
+GST_DEBUG_CATEGORY_STATIC(gst_hailo_dmabuf_allocator_debug_category);
+#define GST_CAT_DEFAULT gst_hailo_dmabuf_allocator_debug_category
+
+#define UDMABUF_DEVICE_PATH ("/dev/udmabuf")
+#define INVALID_FD (-1)
+
+static GstMemory *gst_hailo_dmabuf_allocator_alloc(GstAllocator *allocator, gsize size, GstAllocationParams *params);
+static void gst_hailo_dmabuf_allocator_finalize(GObject *object);
+
+G_DEFINE_TYPE(GstHailoDmaBufAllocator, gst_hailo_dmabuf_allocator, GST_TYPE_DMABUF_ALLOCATOR);
+
+static void gst_hailo_dmabuf_allocator_class_init(GstHailoDmaBufAllocatorClass *klass)
+{
+    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+    GstAllocatorClass *allocator_class = GST_ALLOCATOR_CLASS(klass);
+
+    gobject_class->finalize = gst_hailo_dmabuf_allocator_finalize;
+    allocator_class->alloc = gst_hailo_dmabuf_allocator_alloc;
+
+    GST_DEBUG_CATEGORY_INIT(gst_hailo_dmabuf_allocator_debug_category, "hailodmabufallocator", 0, "debug category for hailo dmabuf allocator");
+}
+
+static void gst_hailo_dmabuf_allocator_init(GstHailoDmaBufAllocator *self)
+{
+    self->udmabuf_fd = INVALID_FD;
+}
+
+static void gst_hailo_dmabuf_allocator_finalize(GObject *object)
+{
+    GstHailoDmaBufAllocator *self = GST_HAILO_DMABUF_ALLOCATOR(object);
+    if (INVALID_FD != self->udmabuf_fd) {
+        close(self->udmabuf_fd);
+        self->udmabuf_fd = INVALID_FD;
+    }
+
+    G_OBJECT_CLASS(gst_hailo_dmabuf_allocator_parent_class)->finalize(object);
+}
+
+GstAllocator *gst_hailo_dmabuf_allocator_new(void)
+{
+    int udmabuf_fd = open(UDMABUF_DEVICE_PATH, O_RDWR | O_CLOEXEC);
+    if (INVALID_FD == udmabuf_fd) {
+        GST_WARNING("Failed opening %s, errno = %d", UDMABUF_DEVICE_PATH, errno);
+        return nullptr;
+    }
+
+    GstHailoDmaBufAllocator *self = GST_HAILO_DMABUF_ALLOCATOR(g_object_new(GST_TYPE_HAILO_DMABUF_ALLOCATOR, NULL));
+    gst_object_ref_sink(self);
+    self->udmabuf_fd = udmabuf_fd;
+
+    return GST_ALLOCATOR(self);
+}
+
+static GstMemory *gst_hailo_dmabuf_allocator_alloc(GstAllocator *allocator, gsize size, GstAllocationParams */*params*/)
+{
+    GstHailoDmaBufAllocator *self = GST_HAILO_DMABUF_ALLOCATOR(allocator);
+
+    // udmabuf works on whole pages, the memory is resized back to the requested size
+    const auto page_size = static_cast<gsize>(sysconf(_SC_PAGESIZE));
+    const gsize aligned_size = ((size + page_size - 1) / page_size) * page_size;
+
+    int memfd = memfd_create("hailo-dmabuf", MFD_ALLOW_SEALING | MFD_CLOEXEC);
+    if (INVALID_FD == memfd) {
+        GST_ERROR("memfd_create failed, errno = %d", errno);
+        return nullptr;
+    }
+
+    // udmabuf requires the memfd to be sealed against shrinking
+    if ((0 != ftruncate(memfd, static_cast<off_t>(aligned_size))) || (0 != fcntl(memfd, F_ADD_SEALS, F_SEAL_SHRINK))) {
+        GST_ERROR("Failed preparing memfd of size %zu, errno = %d", aligned_size, errno);
+        close(memfd);
+        return nullptr;
+    }
+
+    struct udmabuf_create create_params = {};
+    create_params.memfd = static_cast<__u32>(memfd);
+    create_params.flags = UDMABUF_FLAGS_CLOEXEC;
+    create_params.offset = 0;
+    create_params.size = aligned_size;
+    int dmabuf_fd = ioctl(self->udmabuf_fd, UDMABUF_CREATE, &create_params);
+    // The dmabuf holds its own reference to the memfd pages
+    close(memfd);
+    if (0 > dmabuf_fd) {
+        GST_ERROR("UDMABUF_CREATE failed for size %zu, errno = %d", aligned_size, errno);
+        return nullptr;
+    }
+
+    // Takes ownership of dmabuf_fd. The memory stays mapped after it is unmapped, so each frame maps the same address
+    // (otherwise every map would mmap the dmabuf again, and HailoRT would have to map the new address to the device).
+    GstMemory *memory = gst_dmabuf_allocator_alloc_with_flags(allocator, dmabuf_fd, aligned_size, GST_FD_MEMORY_FLAG_KEEP_MAPPED);
+    if (nullptr == memory) {
+        close(dmabuf_fd);
+        return nullptr;
+    }
+    gst_memory_resize(memory, 0, size);
+
+    return memory;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2021-2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#ifndef _GST_HAILO_DMABUF_ALLOCATOR_HPP_
+#define _GST_HAILO_DMABUF_ALLOCATOR_HPP_
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#include <gst/gst.h>
+#include <gst/allocators/gstdmabuf.h>
+#pragma GCC diagnostic pop
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_HAILO_DMABUF_ALLOCATOR (gst_hailo_dmabuf_allocator_get_type())
+#define GST_HAILO_DMABUF_ALLOCATOR(obj) (G_TYPE_CHECK_INSTANCE_CAST((obj), GST_TYPE_HAILO_DMABUF_ALLOCATOR, GstHailoDmaBufAllocator))
+#define GST_IS_HAILO_DMABUF_ALLOCATOR(obj) (G_TYPE_CHECK_INSTANCE_TYPE((obj), GST_TYPE_HAILO_DMABUF_ALLOCATOR))
+
+/**
+ * A DMABuf allocator that creates its buffers with udmabuf (from memfd pages), so it works on any Linux host with
+ * /dev/udmabuf. The memory is regular (pinnable) host memory, so it can be passed to HailoRT through its mapping,
+ * and exported to downstream elements as a dmabuf fd.
+ */
+struct GstHailoDmaBufAllocator
+{
+    GstDmaBufAllocator parent;
+    int udmabuf_fd;
+};
+
+struct GstHailoDmaBufAllocatorClass
+{
+    GstDmaBufAllocatorClass parent;
+};
+
+GType gst_hailo_dmabuf_allocator_get_type(void);
+
+/**
+ * @return A new allocator (owned by the caller), or nullptr if udmabuf isn't available on this host.
+ */
+GstAllocator *gst_hailo_dmabuf_allocator_new(void);
+
+G_END_DECLS
+
+#endif /* _GST_HAILO_DMABUF_ALLOCATOR_HPP_ */
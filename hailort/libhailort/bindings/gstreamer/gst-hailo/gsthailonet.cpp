@@ -31,51 +31,6 @@
 GST_DEBUG_CATEGORY_STATIC(gst_hailonet_debug_category);
 #define GST_CAT_DEFAULT gst_hailonet_debug_category
 
-#define GST_TYPE_SCHEDULING_ALGORITHM (gst_scheduling_algorithm_get_type ())
-static GType
-gst_scheduling_algorithm_get_type (void)
-{
-    static GType scheduling_algorithm_type = 0;
-
-    /* Tightly coupled to hailo_scheduling_algorithm_e */
-
-    if (!scheduling_algorithm_type) {
-        static GEnumValue algorithm_types[] = {
-            { HAILO_SCHEDULING_ALGORITHM_NONE,         "Scheduler is not active", "HAILO_SCHEDULING_ALGORITHM_NONE" },
-            { HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN,  "Round robin",             "HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN" },
-            { HAILO_SCHEDULING_ALGORITHM_MAX_ENUM,     NULL,                      NULL },
-        };
-
-        scheduling_algorithm_type =
-            g_enum_register_static ("GstHailoSchedulingAlgorithms", algorithm_types);
-    }
-
-    return scheduling_algorithm_type;
-}
-
-#define GST_TYPE_HAILO_FORMAT_TYPE (gst_hailo_format_type_get_type ())
-static GType
-gst_hailo_format_type_get_type (void)
-{
-    static GType format_type_enum = 0;
-
-    /* Tightly coupled to hailo_format_type_t */
-    
-    if (!format_type_enum) {
-        static GEnumValue format_types[] = {
-            { HAILO_FORMAT_TYPE_AUTO,     "auto",     "HAILO_FORMAT_TYPE_AUTO"},
-            { HAILO_FORMAT_TYPE_UINT8,    "uint8",    "HAILO_FORMAT_TYPE_UINT8"},
-            { HAILO_FORMAT_TYPE_UINT16,   "uint16",   "HAILO_FORMAT_TYPE_UINT16"},
-            { HAILO_FORMAT_TYPE_FLOAT32,  "float32",  "HAILO_FORMAT_TYPE_FLOAT32"},
-            { HAILO_FORMAT_TYPE_MAX_ENUM,  NULL,      NULL },
-        };
-
-        format_type_enum = g_enum_register_static ("GstHailoFormatTypes", format_types);
-    }
-
-    return format_type_enum;
-}
-
 constexpr std::chrono::milliseconds WAIT_FOR_FLUSH_TIMEOUT_MS(1000);
 
 static void gst_hailonet_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
@@ -97,6 +52,7 @@ enum
     PROP_BATCH_SIZE,
     PROP_OUTPUTS_MIN_POOL_SIZE,
     PROP_OUTPUTS_MAX_POOL_SIZE,
+    PROP_OUTPUTS_DMABUF,
     PROP_IS_ACTIVE,
     PROP_DEVICE_COUNT,
     PROP_VDEVICE_KEY,
@@ -172,6 +128,12 @@ static void gst_hailonet_class_init(GstHailoNetClass *klass)
         g_param_spec_uint("outputs-max-pool-size", "Outputs Maximum Pool Size",
             "The maximum amount of buffers to allocate for each output layer or 0 for unlimited", 0, std::numeric_limits<uint32_t>::max(),
             DEFAULT_OUTPUTS_MAX_POOL_SIZE, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_OUTPUTS_DMABUF,
+        g_param_spec_boolean("outputs-dmabuf", "Export outputs as DMABufs",
+            "Allocate the output buffers as DMABufs (using udmabuf), so downstream elements can import them without copying. "
+            "Only the outputs are exported - DMABuf inputs are mapped and copied to the device by hailosend "
+            "(the HailoRT driver can't import dmabuf fds)", false,
+            (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
     g_object_class_install_property(gobject_class, PROP_IS_ACTIVE,
         g_param_spec_boolean("is-active", "Is Network Activated", "Controls whether this element should be active. "
             "By default, the hailonet element will not be active unless it is the only one. "
@@ -446,6 +408,13 @@ void HailoNetImpl::set_property(GObject *object, guint property_id, const GValue
         }
         g_object_set(m_hailorecv, "outputs-max-pool-size", g_value_get_uint(value), NULL);
         break;
+    case PROP_OUTPUTS_DMABUF:
+        if (m_was_configured) {
+            g_warning("The network was already configured so changing the outputs dmabuf flag will not take place!");
+            break;
+        }
+        g_object_set(m_hailorecv, "outputs-dmabuf", g_value_get_boolean(value), NULL);
+        break;
     case PROP_IS_ACTIVE:
     {
         gboolean new_is_active = g_value_get_boolean(value);
@@ -637,6 +606,13 @@ void HailoNetImpl::get_property(GObject *object, guint property_id, GValue *valu
         g_value_set_uint(value, outputs_max_pool_size);
         break;
     }
+    case PROP_OUTPUTS_DMABUF:
+    {
+        gboolean outputs_dmabuf;
+        g_object_get(m_hailorecv, "outputs-dmabuf", &outputs_dmabuf, nullptr);
+        g_value_set_boolean(value, outputs_dmabuf);
+        break;
+    }
     case PROP_IS_ACTIVE:
         g_value_set_boolean(value, m_props.m_is_active.get());
         break;
@@ -771,10 +747,10 @@ hailo_status HailoNetImpl::configure_network_group()
     }
 
     auto input_quantized = (m_props.m_input_quantized.was_changed()) ? static_cast<bool>(m_props.m_input_quantized.get()) :
-        (m_props.m_input_format_type.get() != HAILO_FORMAT_TYPE_FLOAT32);
+        !HailoRTCommon::is_float_type(m_props.m_input_format_type.get());
 
     auto output_quantized = (m_props.m_output_quantized.was_changed()) ? static_cast<bool>(m_props.m_output_quantized.get()) :
-        (m_props.m_output_format_type.get() != HAILO_FORMAT_TYPE_FLOAT32);
+        !HailoRTCommon::is_float_type(m_props.m_output_format_type.get());
 
     auto vstreams = m_net_group_handle->create_vstreams(m_props.m_network_name.get(), m_props.m_scheduling_algorithm.get(), m_output_formats,
         input_quantized, output_quantized, m_props.m_input_format_type.get(), m_props.m_output_format_type.get());
@@ -0,0 +1,828 @@
+/*
+ * Copyright (c) 2021-2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#include "gsthailonet2.hpp"
+#include "gsthailorecv.hpp"
+#include "dmabuf_allocator.hpp"
+#include "network_group_handle.hpp"
+#include "metadata/tensor_meta.hpp"
+#include "hailo/hailort_common.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+GST_DEBUG_CATEGORY_STATIC(gst_hailonet2_debug_category);
+#define GST_CAT_DEFAULT gst_hailonet2_debug_category
+
+constexpr std::chrono::milliseconds WAIT_FOR_ASYNC_READY_TIMEOUT_MS(HAILO_DEFAULT_VSTREAM_TIMEOUT_MS);
+constexpr std::chrono::milliseconds WAIT_FOR_INFLIGHT_FRAMES_TIMEOUT_MS(HAILO_DEFAULT_VSTREAM_TIMEOUT_MS);
+
+static void gst_hailonet2_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
+static void gst_hailonet2_get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
+static GstStateChangeReturn gst_hailonet2_change_state(GstElement *element, GstStateChange transition);
+static GstFlowReturn gst_hailonet2_chain(GstPad *pad, GstObject *parent, GstBuffer *buffer);
+static gboolean gst_hailonet2_sink_event(GstPad *pad, GstObject *parent, GstEvent *event);
+static void gst_hailonet2_push_loop(gpointer user_data);
+
+enum
+{
+    PROP_0,
+    PROP_DEVICE_ID,
+    PROP_HEF_PATH,
+    PROP_BATCH_SIZE,
+    PROP_OUTPUTS_MIN_POOL_SIZE,
+    PROP_OUTPUTS_MAX_POOL_SIZE,
+    PROP_OUTPUTS_DMABUF,
+    PROP_DEVICE_COUNT,
+    PROP_VDEVICE_KEY,
+    PROP_SCHEDULING_ALGORITHM,
+    PROP_SCHEDULER_TIMEOUT_MS,
+    PROP_SCHEDULER_THRESHOLD,
+    PROP_SCHEDULER_PRIORITY,
+    PROP_MULTI_PROCESS_SERVICE,
+    PROP_INPUT_FORMAT_TYPE,
+    PROP_OUTPUT_FORMAT_TYPE,
+};
+
+G_DEFINE_TYPE(GstHailoNet2, gst_hailonet2, GST_TYPE_ELEMENT);
+
+static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE("sink", GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS_ANY);
+static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE("src", GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS_ANY);
+
+static void gst_hailonet2_class_init(GstHailoNet2Class *klass)
+{
+    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+    GstElementClass *element_class = GST_ELEMENT_CLASS(klass);
+
+    gst_element_class_add_pad_template(element_class, gst_static_pad_template_get(&src_template));
+    gst_element_class_add_pad_template(element_class, gst_static_pad_template_get(&sink_template));
+
+    gst_element_class_set_static_metadata(element_class,
+        "hailonet2 element", "Hailo/Network",
+        "Configure and run a Hailo network using the async inference API. "
+            "Incoming buffers are sent to the device without copying (their size must match the network's input frame size), "
+            "and are pushed with the network's outputs attached as metadata once the inference is done. "
+            "Several frames are kept in flight, so the streaming thread is not blocked on each inference. "
+            "DMABuf-backed input buffers (e.g. udmabuf or V4L2 buffers) are sent through their mapping without copying - "
+            "the dmabuf fd itself isn't imported, since the HailoRT driver can only map user addresses.",
+        PLUGIN_AUTHOR);
+
+    element_class->change_state = GST_DEBUG_FUNCPTR(gst_hailonet2_change_state);
+
+    gobject_class->set_property = gst_hailonet2_set_property;
+    gobject_class->get_property = gst_hailonet2_get_property;
+    g_object_class_install_property(gobject_class, PROP_DEVICE_ID,
+        g_param_spec_string("device-id", "Device ID", "Device ID ([<domain>]:<bus>:<device>.<func>, same as in lspci command). Excludes device-count.", NULL,
+            (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_DEVICE_COUNT,
+        g_param_spec_uint("device-count", "Number of devices to use", "Number of physical devices to use. Excludes device-id.", HAILO_DEFAULT_DEVICE_COUNT,
+            std::numeric_limits<uint16_t>::max(), HAILO_DEFAULT_DEVICE_COUNT, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_VDEVICE_KEY,
+        g_param_spec_uint("vdevice-key",
+            "Indicate whether to re-use or re-create vdevice",
+            "Relevant only when 'device-count' is passed. If not passed, the created vdevice will be unique to this hailonet2." \
+            "if multiple hailonets share 'vdevice-key' and 'device-count', the created vdevice will be shared between those hailonets",
+            MIN_VALID_VDEVICE_KEY, std::numeric_limits<uint32_t>::max(), MIN_VALID_VDEVICE_KEY, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_HEF_PATH,
+        g_param_spec_string("hef-path", "HEF Path Location", "Location of the HEF file to read", NULL,
+            (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_BATCH_SIZE,
+        g_param_spec_uint("batch-size", "Inference Batch", "How many frame to send in one batch", MIN_GSTREAMER_BATCH_SIZE, MAX_GSTREAMER_BATCH_SIZE, HAILO_DEFAULT_BATCH_SIZE,
+            (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_OUTPUTS_MIN_POOL_SIZE,
+        g_param_spec_uint("outputs-min-pool-size", "Outputs Minimun Pool Size", "The minimum amount of buffers to allocate for each output layer",
+            0, std::numeric_limits<uint32_t>::max(), DEFAULT_OUTPUTS_MIN_POOL_SIZE, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_OUTPUTS_MAX_POOL_SIZE,
+        g_param_spec_uint("outputs-max-pool-size", "Outputs Maximum Pool Size",
+            "The maximum amount of buffers to allocate for each output layer or 0 for unlimited", 0, std::numeric_limits<uint32_t>::max(),
+            DEFAULT_OUTPUTS_MAX_POOL_SIZE, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_OUTPUTS_DMABUF,
+        g_param_spec_boolean("outputs-dmabuf", "Export outputs as DMABufs",
+            "Allocate the output buffers as DMABufs (using udmabuf), so the device writes the outputs directly to memory that downstream "
+            "elements can import without copying", false,
+            (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_SCHEDULING_ALGORITHM,
+        g_param_spec_enum("scheduling-algorithm", "Scheduling policy for automatic network group switching", "Controls the Model Scheduler algorithm of HailoRT. "
+            "Gets values from the enum GstHailoSchedulingAlgorithms. "
+            "When using the same VDevice across multiple hailonets, all should have the same 'scheduling-algorithm'. ",
+            GST_TYPE_SCHEDULING_ALGORITHM, HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_SCHEDULER_TIMEOUT_MS,
+        g_param_spec_uint("scheduler-timeout-ms", "Timeout for for scheduler in ms", "The maximum time period that may pass before getting run time from the scheduler,"
+            " as long as at least one send request has been sent.",
+            HAILO_DEFAULT_SCHEDULER_TIMEOUT_MS, std::numeric_limits<uint32_t>::max(), HAILO_DEFAULT_SCHEDULER_TIMEOUT_MS, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_SCHEDULER_THRESHOLD,
+        g_param_spec_uint("scheduler-threshold", "Frames threshold for scheduler", "The minimum number of send requests required before the hailonet is considered ready to get run time from the scheduler.",
+            HAILO_DEFAULT_SCHEDULER_THRESHOLD, std::numeric_limits<uint32_t>::max(), HAILO_DEFAULT_SCHEDULER_THRESHOLD, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_SCHEDULER_PRIORITY,
+        g_param_spec_uint("scheduler-priority", "Priority index for scheduler", "When the scheduler will choose the next hailonet to run, higher priority will be prioritized in the selection. "
+            "Bigger number represent higher priority",
+            HAILO_SCHEDULER_PRIORITY_MIN, HAILO_SCHEDULER_PRIORITY_MAX, HAILO_SCHEDULER_PRIORITY_NORMAL, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_MULTI_PROCESS_SERVICE,
+        g_param_spec_boolean("multi-process-service", "Should run over HailoRT service", "Controls wether to run HailoRT over its service. "
+            "To use this property, the service should be active and scheduling-algorithm should be set. Defaults to false.",
+            HAILO_DEFAULT_MULTI_PROCESS_SERVICE, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_INPUT_FORMAT_TYPE,
+        g_param_spec_enum("input-format-type", "Input format type", "Input format type(auto, float32, uint16, uint8). Default value is auto."
+            "Gets values from the enum GstHailoFormatType. ",
+            GST_TYPE_HAILO_FORMAT_TYPE, HAILO_FORMAT_TYPE_AUTO,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_OUTPUT_FORMAT_TYPE,
+        g_param_spec_enum("output-format-type", "Output format type", "Output format type(auto, float32, uint16, uint8). Default value is auto."
+            "Gets values from the enum GstHailoFormatType. ",
+            GST_TYPE_HAILO_FORMAT_TYPE, HAILO_FORMAT_TYPE_AUTO,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+}
+
+Expected<std::unique_ptr<HailoNet2Impl>> HailoNet2Impl::create(GstHailoNet2 *element)
+{
+    if (nullptr == element) {
+        return make_unexpected(HAILO_INVALID_ARGUMENT);
+    }
+
+    GstPad *sinkpad = gst_pad_new_from_static_template(&sink_template, "sink");
+    gst_pad_set_chain_function(sinkpad, GST_DEBUG_FUNCPTR(gst_hailonet2_chain));
+    gst_pad_set_event_function(sinkpad, GST_DEBUG_FUNCPTR(gst_hailonet2_sink_event));
+    // The input buffers are pushed as is (with the outputs attached), so the caps are negotiated through this element
+    GST_PAD_SET_PROXY_CAPS(sinkpad);
+    gst_element_add_pad(GST_ELEMENT(element), sinkpad);
+
+    GstPad *srcpad = gst_pad_new_from_static_template(&src_template, "src");
+    gst_element_add_pad(GST_ELEMENT(element), srcpad);
+
+    auto ptr = make_unique_nothrow<HailoNet2Impl>(element, sinkpad, srcpad);
+    if (nullptr == ptr) {
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    return ptr;
+}
+
+HailoNet2Impl::HailoNet2Impl(GstHailoNet2 *element, GstPad *sinkpad, GstPad *srcpad) :
+    m_element(element), m_sinkpad(sinkpad), m_srcpad(srcpad), m_props(), m_vdevice(nullptr), m_infer_model(nullptr),
+    m_configured_infer_model(nullptr), m_input_name(), m_input_frame_size(0), m_output_names(), m_output_infos(), m_output_pools(),
+    m_dmabuf_allocator(nullptr), m_was_configured(false), m_inflight_frames(), m_is_pushing(false), m_is_running(false), m_last_flow_result(GST_FLOW_OK)
+{
+    GST_DEBUG_CATEGORY_INIT(gst_hailonet2_debug_category, "hailonet2", 0, "debug category for hailonet2 element");
+}
+
+HailoNet2Impl::~HailoNet2Impl()
+{
+    (void)stop();
+
+    // The configured model is released before the pools, so no transfer is using the pools' buffers
+    m_configured_infer_model.reset();
+    for (auto pool : m_output_pools) {
+        (void)gst_buffer_pool_set_active(pool, FALSE);
+        gst_object_unref(pool);
+    }
+    if (nullptr != m_dmabuf_allocator) {
+        gst_object_unref(m_dmabuf_allocator);
+    }
+}
+
+void HailoNet2Impl::set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec)
+{
+    GST_DEBUG_OBJECT(m_element, "set_property");
+
+    if ((object == nullptr) || (value == nullptr) || (pspec == nullptr)) {
+        g_error("set_property got null parameter!");
+        return;
+    }
+
+    if (m_was_configured) {
+        g_warning("The network was already configured so changing property '%s' will not take place!", g_param_spec_get_name(pspec));
+        return;
+    }
+
+    switch (property_id) {
+    case PROP_DEVICE_ID:
+        if (0 != m_props.m_device_count.get()) {
+            g_error("device-id and device-count excludes eachother. received device-id=%s, device-count=%d",
+                g_value_get_string(value), m_props.m_device_count.get());
+            break;
+        }
+        if (nullptr != m_props.m_device_id.get()) {
+            g_free(m_props.m_device_id.get());
+        }
+        m_props.m_device_id = g_strdup(g_value_get_string(value));
+        break;
+    case PROP_DEVICE_COUNT:
+        if (nullptr != m_props.m_device_id.get()) {
+            g_error("device-id and device-count excludes eachother. received device-id=%s, device-count=%d",
+                m_props.m_device_id.get(), g_value_get_uint(value));
+            break;
+        }
+        m_props.m_device_count = static_cast<guint16>(g_value_get_uint(value));
+        break;
+    case PROP_VDEVICE_KEY:
+        m_props.m_vdevice_key = static_cast<guint32>(g_value_get_uint(value));
+        break;
+    case PROP_HEF_PATH:
+        if (nullptr != m_props.m_hef_path.get()) {
+            g_free(m_props.m_hef_path.get());
+        }
+        m_props.m_hef_path = g_strdup(g_value_get_string(value));
+        break;
+    case PROP_BATCH_SIZE:
+        m_props.m_batch_size = static_cast<guint16>(g_value_get_uint(value));
+        break;
+    case PROP_OUTPUTS_MIN_POOL_SIZE:
+        m_props.m_outputs_min_pool_size = g_value_get_uint(value);
+        break;
+    case PROP_OUTPUTS_MAX_POOL_SIZE:
+        m_props.m_outputs_max_pool_size = g_value_get_uint(value);
+        break;
+    case PROP_OUTPUTS_DMABUF:
+        m_props.m_outputs_dmabuf = g_value_get_boolean(value);
+        break;
+    case PROP_SCHEDULING_ALGORITHM:
+        m_props.m_scheduling_algorithm = static_cast<hailo_scheduling_algorithm_t>(g_value_get_enum(value));
+        break;
+    case PROP_SCHEDULER_TIMEOUT_MS:
+        m_props.m_scheduler_timeout_ms = g_value_get_uint(value);
+        break;
+    case PROP_SCHEDULER_THRESHOLD:
+        m_props.m_scheduler_threshold = g_value_get_uint(value);
+        break;
+    case PROP_SCHEDULER_PRIORITY:
+        m_props.m_scheduler_priority = static_cast<guint8>(g_value_get_uint(value));
+        break;
+    case PROP_MULTI_PROCESS_SERVICE:
+        m_props.m_multi_process_service = g_value_get_boolean(value);
+        break;
+    case PROP_INPUT_FORMAT_TYPE:
+        m_props.m_input_format_type = static_cast<hailo_format_type_t>(g_value_get_enum(value));
+        break;
+    case PROP_OUTPUT_FORMAT_TYPE:
+        m_props.m_output_format_type = static_cast<hailo_format_type_t>(g_value_get_enum(value));
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+        break;
+    }
+}
+
+void HailoNet2Impl::get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec)
+{
+    GST_DEBUG_OBJECT(m_element, "get_property");
+
+    if ((object == nullptr) || (value == nullptr) || (pspec == nullptr)) {
+        g_error("get_property got null parameter!");
+        return;
+    }
+
+    switch (property_id) {
+    case PROP_DEVICE_ID:
+        g_value_set_string(value, m_props.m_device_id.get());
+        break;
+    case PROP_DEVICE_COUNT:
+        g_value_set_uint(value, m_props.m_device_count.get());
+        break;
+    case PROP_VDEVICE_KEY:
+        g_value_set_uint(value, m_props.m_vdevice_key.get());
+        break;
+    case PROP_HEF_PATH:
+        g_value_set_string(value, m_props.m_hef_path.get());
+        break;
+    case PROP_BATCH_SIZE:
+        g_value_set_uint(value, m_props.m_batch_size.get());
+        break;
+    case PROP_OUTPUTS_MIN_POOL_SIZE:
+        g_value_set_uint(value, m_props.m_outputs_min_pool_size.get());
+        break;
+    case PROP_OUTPUTS_MAX_POOL_SIZE:
+        g_value_set_uint(value, m_props.m_outputs_max_pool_size.get());
+        break;
+    case PROP_OUTPUTS_DMABUF:
+        g_value_set_boolean(value, m_props.m_outputs_dmabuf.get());
+        break;
+    case PROP_SCHEDULING_ALGORITHM:
+        g_value_set_enum(value, m_props.m_scheduling_algorithm.get());
+        break;
+    case PROP_SCHEDULER_TIMEOUT_MS:
+        g_value_set_uint(value, m_props.m_scheduler_timeout_ms.get());
+        break;
+    case PROP_SCHEDULER_THRESHOLD:
+        g_value_set_uint(value, m_props.m_scheduler_threshold.get());
+        break;
+    case PROP_SCHEDULER_PRIORITY:
+        g_value_set_uint(value, m_props.m_scheduler_priority.get());
+        break;
+    case PROP_MULTI_PROCESS_SERVICE:
+        g_value_set_boolean(value, m_props.m_multi_process_service.get());
+        break;
+    case PROP_INPUT_FORMAT_TYPE:
+        g_value_set_enum(value, m_props.m_input_format_type.get());
+        break;
+    case PROP_OUTPUT_FORMAT_TYPE:
+        g_value_set_enum(value, m_props.m_output_format_type.get());
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
+        break;
+    }
+}
+
+hailo_status HailoNet2Impl::configure()
+{
+    if (m_was_configured) {
+        return HAILO_SUCCESS;
+    }
+
+    GST_CHECK(nullptr != m_props.m_hef_path.get(), HAILO_INVALID_ARGUMENT, m_element, RESOURCE, "hef-path property must be set!");
+    if (m_props.m_multi_process_service.get()) {
+        GST_CHECK(m_props.m_scheduling_algorithm.get() != HAILO_SCHEDULING_ALGORITHM_NONE,
+            HAILO_INVALID_OPERATION, m_element, RESOURCE, "To use multi-process-service please set scheduling-algorithm.");
+    }
+    GST_CHECK((0 == m_props.m_outputs_max_pool_size.get()) || (m_props.m_outputs_min_pool_size.get() <= m_props.m_outputs_max_pool_size.get()),
+        HAILO_INVALID_ARGUMENT, m_element, RESOURCE, "Minimum pool size (=%d) is bigger than maximum (=%d)!", m_props.m_outputs_min_pool_size.get(),
+        m_props.m_outputs_max_pool_size.get());
+
+    if (m_props.m_outputs_dmabuf.get()) {
+        m_dmabuf_allocator = gst_hailo_dmabuf_allocator_new();
+        GST_CHECK(nullptr != m_dmabuf_allocator, HAILO_NOT_SUPPORTED, m_element, RESOURCE,
+            "outputs-dmabuf is set, but DMABufs can't be allocated (is /dev/udmabuf available?)");
+    }
+
+    auto device_count = (0 == m_props.m_device_count.get()) ? static_cast<uint16_t>(HAILO_DEFAULT_DEVICE_COUNT) : m_props.m_device_count.get();
+    std::string device_id = (nullptr == m_props.m_device_id.get()) ? "" : m_props.m_device_id.get();
+    auto vdevice = NetworkGroupHandle::create_vdevice(m_element, device_id, device_count, m_props.m_vdevice_key.get(),
+        m_props.m_scheduling_algorithm.get(), static_cast<bool>(m_props.m_multi_process_service.get()));
+    GST_CHECK_EXPECTED_AS_STATUS(vdevice, m_element, RESOURCE, "Failed creating vdevice, status = %d", vdevice.status());
+    m_vdevice = vdevice.release();
+
+    auto infer_model = m_vdevice->create_infer_model(m_props.m_hef_path.get());
+    GST_CHECK_EXPECTED_AS_STATUS(infer_model, m_element, RESOURCE, "Failed creating infer model, status = %d", infer_model.status());
+    m_infer_model = make_shared_nothrow<InferModel>(infer_model.release());
+    GST_CHECK(nullptr != m_infer_model, HAILO_OUT_OF_HOST_MEMORY, m_element, RESOURCE, "Allocating memory for infer model has failed!");
+
+    // TODO: HRT-4095
+    GST_CHECK(1 == m_infer_model->get_input_names().size(), HAILO_INVALID_OPERATION, m_element, RESOURCE,
+        "hailonet2 element supports only HEFs with one input for now!");
+
+    m_infer_model->set_batch_size(m_props.m_batch_size.get());
+    m_input_name = m_infer_model->get_input_names()[0];
+    m_output_names = m_infer_model->get_output_names();
+
+    auto input = m_infer_model->input(m_input_name);
+    GST_CHECK_EXPECTED_AS_STATUS(input, m_element, RESOURCE, "Failed getting input %s, status = %d", m_input_name.c_str(), input.status());
+    if (HAILO_FORMAT_TYPE_AUTO != m_props.m_input_format_type.get()) {
+        input->set_format_type(m_props.m_input_format_type.get());
+    }
+    m_input_frame_size = input->get_frame_size();
+
+    // The infos attached to the output buffers (as tensor metadata) are taken from the HEF, with the user's format type
+    auto hef = Hef::create(m_props.m_hef_path.get());
+    GST_CHECK_EXPECTED_AS_STATUS(hef, m_element, RESOURCE, "Failed reading hef file %s, status = %d", m_props.m_hef_path.get(), hef.status());
+    auto output_vstream_infos = hef->get_output_vstream_infos();
+    GST_CHECK_EXPECTED_AS_STATUS(output_vstream_infos, m_element, RESOURCE, "Getting output vstream infos from HEF has failed, status = %d",
+        output_vstream_infos.status());
+
+    for (const auto &output_name : m_output_names) {
+        auto output = m_infer_model->output(output_name);
+        GST_CHECK_EXPECTED_AS_STATUS(output, m_element, RESOURCE, "Failed getting output %s, status = %d", output_name.c_str(), output.status());
+        if (HAILO_FORMAT_TYPE_AUTO != m_props.m_output_format_type.get()) {
+            output->set_format_type(m_props.m_output_format_type.get());
+        }
+
+        auto info = std::find_if(output_vstream_infos->begin(), output_vstream_infos->end(), [&output_name](const hailo_vstream_info_t &vstream_info) {
+            return output_name == vstream_info.name;
+        });
+        GST_CHECK(output_vstream_infos->end() != info, HAILO_NOT_FOUND, m_element, RESOURCE, "Output %s was not found in the HEF!", output_name.c_str());
+        m_output_infos.push_back(*info);
+        if (HAILO_FORMAT_TYPE_AUTO != m_props.m_output_format_type.get()) {
+            m_output_infos.back().format.type = m_props.m_output_format_type.get();
+        }
+
+        auto pool = create_output_pool(output_name, output->get_frame_size());
+        GST_CHECK_EXPECTED_AS_STATUS(pool, m_element, RESOURCE, "Failed creating buffer pool for output %s, status = %d", output_name.c_str(),
+            pool.status());
+        m_output_pools.push_back(pool.release());
+    }
+
+    auto configured_infer_model = m_infer_model->configure();
+    GST_CHECK_EXPECTED_AS_STATUS(configured_infer_model, m_element, RESOURCE, "Failed configuring infer model, status = %d",
+        configured_infer_model.status());
+    m_configured_infer_model = make_shared_nothrow<ConfiguredInferModel>(configured_infer_model.release());
+    GST_CHECK(nullptr != m_configured_infer_model, HAILO_OUT_OF_HOST_MEMORY, m_element, RESOURCE, "Allocating memory for configured infer model has failed!");
+    m_was_configured = true;
+
+    hailo_status status = HAILO_SUCCESS;
+    if (m_props.m_scheduler_timeout_ms.was_changed()) {
+        status = m_configured_infer_model->set_scheduler_timeout(std::chrono::milliseconds(m_props.m_scheduler_timeout_ms.get()));
+        GST_CHECK_SUCCESS(status, m_element, RESOURCE, "Setting scheduler timeout failed, status = %d", status);
+    }
+    if (m_props.m_scheduler_threshold.was_changed()) {
+        status = m_configured_infer_model->set_scheduler_threshold(m_props.m_scheduler_threshold.get());
+        GST_CHECK_SUCCESS(status, m_element, RESOURCE, "Setting scheduler threshold failed, status = %d", status);
+    }
+    if (m_props.m_scheduler_priority.was_changed()) {
+        status = m_configured_infer_model->set_scheduler_priority(m_props.m_scheduler_priority.get());
+        GST_CHECK_SUCCESS(status, m_element, RESOURCE, "Setting scheduler priority failed, status = %d", status);
+    }
+
+    if (HAILO_SCHEDULING_ALGORITHM_NONE == m_props.m_scheduling_algorithm.get()) {
+        status = m_configured_infer_model->activate();
+        GST_CHECK_SUCCESS(status, m_element, RESOURCE, "Failed activating network, status = %d", status);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+Expected<GstBufferPool*> HailoNet2Impl::create_output_pool(const std::string &output_name, size_t frame_size)
+{
+    GstHailoBufferPool *hailo_pool = GST_HAILO_BUFFER_POOL(g_object_new(GST_TYPE_HAILO_BUFFER_POOL, NULL));
+    gst_object_ref_sink(hailo_pool);
+    strncpy(hailo_pool->vstream_name, output_name.c_str(), sizeof(hailo_pool->vstream_name) - 1);
+    hailo_pool->element_name = GST_ELEMENT_NAME(m_element);
+
+    GstBufferPool *pool = GST_BUFFER_POOL(hailo_pool);
+    GstStructure *config = gst_buffer_pool_get_config(pool);
+    gst_buffer_pool_config_set_params(config, nullptr, static_cast<guint>(frame_size), m_props.m_outputs_min_pool_size.get(),
+        m_props.m_outputs_max_pool_size.get());
+    if (nullptr != m_dmabuf_allocator) {
+        gst_buffer_pool_config_set_allocator(config, m_dmabuf_allocator, nullptr);
+    }
+
+    gboolean result = gst_buffer_pool_set_config(pool, config);
+    if (!result) {
+        gst_object_unref(pool);
+        GST_ELEMENT_ERROR(m_element, RESOURCE, FAILED, ("Could not set config for output %s buffer pool", output_name.c_str()), (NULL));
+        return make_unexpected(HAILO_INTERNAL_FAILURE);
+    }
+
+    result = gst_buffer_pool_set_active(pool, TRUE);
+    if (!result) {
+        gst_object_unref(pool);
+        GST_ELEMENT_ERROR(m_element, RESOURCE, FAILED, ("Could not set buffer pool active for output %s", output_name.c_str()), (NULL));
+        return make_unexpected(HAILO_INTERNAL_FAILURE);
+    }
+
+    return pool;
+}
+
+hailo_status HailoNet2Impl::start()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_is_running = true;
+        m_last_flow_result = GST_FLOW_OK;
+    }
+
+    gboolean result = gst_pad_start_task(m_srcpad, gst_hailonet2_push_loop, m_element, nullptr);
+    GST_CHECK(result, HAILO_INTERNAL_FAILURE, m_element, RESOURCE, "Failed starting the push task of hailonet2!");
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status HailoNet2Impl::stop()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_is_running) {
+            return HAILO_SUCCESS;
+        }
+        m_is_running = false;
+    }
+    m_cv.notify_all();
+
+    (void)gst_pad_stop_task(m_srcpad);
+
+    // The frames left are dropped after their inference is done - until then their buffers are used by the device,
+    // and their callbacks use this object. So the wait can't be bounded, the timeout is only reported.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto are_all_done = [this] () {
+        return std::all_of(m_inflight_frames.begin(), m_inflight_frames.end(), [] (const std::shared_ptr<HailoNet2Frame> &frame) {
+            return frame->is_done;
+        });
+    };
+    if (!m_cv.wait_for(lock, WAIT_FOR_INFLIGHT_FRAMES_TIMEOUT_MS, are_all_done)) {
+        GST_WARNING_OBJECT(m_element, "Timeout while waiting for the in-flight frames of hailonet2, still waiting");
+        m_cv.wait(lock, are_all_done);
+    }
+    for (auto &frame : m_inflight_frames) {
+        gst_buffer_unref(frame->buffer);
+    }
+    m_inflight_frames.clear();
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status HailoNet2Impl::bind_output_buffers(ConfiguredInferModel::Bindings &bindings, HailoNet2Frame &frame)
+{
+    for (size_t i = 0; i < m_output_names.size(); i++) {
+        GstBuffer *buffer = nullptr;
+        GstFlowReturn flow_result = gst_buffer_pool_acquire_buffer(m_output_pools[i], &buffer, nullptr);
+        GST_CHECK(GST_FLOW_OK == flow_result, HAILO_INTERNAL_FAILURE, m_element, RESOURCE, "Acquiring buffer for output %s failed with flow status %d!",
+            m_output_names[i].c_str(), flow_result);
+
+        GstMapInfo map_info;
+        // Mapped for reading too - a kept mapping of a dmabuf output is only reused by maps with a subset of its flags,
+        // so downstream elements can read it without mapping it again
+        gboolean result = gst_buffer_map(buffer, &map_info, GST_MAP_READWRITE);
+        if (!result) {
+            gst_buffer_unref(buffer);
+            GST_ELEMENT_ERROR(m_element, RESOURCE, FAILED, ("Failed mapping buffer of output %s!", m_output_names[i].c_str()), (NULL));
+            return HAILO_INTERNAL_FAILURE;
+        }
+        frame.outputs.emplace_back(buffer, map_info);
+
+        auto output = bindings.output(m_output_names[i]);
+        GST_CHECK_EXPECTED_AS_STATUS(output, m_element, RESOURCE, "Failed getting output %s bindings, status = %d", m_output_names[i].c_str(),
+            output.status());
+        auto status = output->set_buffer(MemoryView(map_info.data, map_info.size));
+        GST_CHECK_SUCCESS(status, m_element, RESOURCE, "Failed setting buffer of output %s, status = %d", m_output_names[i].c_str(), status);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+void HailoNet2Impl::release_frame(HailoNet2Frame &frame)
+{
+    if (nullptr != frame.input_map.memory) {
+        gst_buffer_unmap(frame.buffer, &frame.input_map);
+        frame.input_map.memory = nullptr;
+    }
+
+    for (auto &output : frame.outputs) {
+        gst_buffer_unmap(output.first, &output.second);
+        gst_buffer_unref(output.first);
+    }
+    frame.outputs.clear();
+}
+
+void HailoNet2Impl::on_infer_done(std::shared_ptr<HailoNet2Frame> frame, hailo_status status)
+{
+    // Called from the HailoRT completion thread - the outputs are attached to the frame here, so pushing it is all that is left
+    if (HAILO_SUCCESS == status) {
+        for (size_t i = 0; i < frame->outputs.size(); i++) {
+            GstBuffer *output_buffer = frame->outputs[i].first;
+            gst_buffer_unmap(output_buffer, &frame->outputs[i].second);
+
+            GstHailoTensorMeta *buffer_meta = GST_TENSOR_META_ADD(output_buffer);
+            buffer_meta->info = m_output_infos[i];
+            (void)gst_buffer_add_parent_buffer_meta(frame->buffer, output_buffer);
+            gst_buffer_unref(output_buffer);
+        }
+        frame->outputs.clear();
+    }
+    release_frame(*frame);
+
+    // Notified under the lock, since stop() may return (and this object may be destroyed) once the frame is done
+    std::unique_lock<std::mutex> lock(m_mutex);
+    frame->status = status;
+    frame->is_done = true;
+    m_cv.notify_all();
+}
+
+GstFlowReturn HailoNet2Impl::chain(GstBuffer *buffer)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (GST_FLOW_OK != m_last_flow_result) {
+            gst_buffer_unref(buffer);
+            return m_last_flow_result;
+        }
+    }
+
+    if (m_input_frame_size != gst_buffer_get_size(buffer)) {
+        GST_ELEMENT_ERROR(m_element, STREAM, FAILED, ("Buffer size (%zu) does not match the frame size of input %s (%zu)!",
+            gst_buffer_get_size(buffer), m_input_name.c_str(), m_input_frame_size), (NULL));
+        gst_buffer_unref(buffer);
+        return GST_FLOW_ERROR;
+    }
+
+    // The outputs are attached to the buffer once the inference is done. This doesn't copy the buffer when we hold its only reference
+    buffer = gst_buffer_make_writable(buffer);
+
+    auto frame = make_shared_nothrow<HailoNet2Frame>();
+    if (nullptr == frame) {
+        GST_ELEMENT_ERROR(m_element, RESOURCE, FAILED, ("Allocating memory for frame has failed!"), (NULL));
+        gst_buffer_unref(buffer);
+        return GST_FLOW_ERROR;
+    }
+    frame->buffer = buffer;
+    frame->status = HAILO_UNINITIALIZED;
+    frame->is_done = false;
+
+    gboolean result = gst_buffer_map(buffer, &frame->input_map, GST_MAP_READ);
+    if (!result) {
+        GST_ELEMENT_ERROR(m_element, RESOURCE, FAILED, ("Failed mapping input buffer!"), (NULL));
+        gst_buffer_unref(buffer);
+        return GST_FLOW_ERROR;
+    }
+
+    auto status = submit_frame(frame);
+    if (HAILO_SUCCESS != status) {
+        release_frame(*frame);
+        gst_buffer_unref(buffer);
+        return GST_FLOW_ERROR;
+    }
+
+    return GST_FLOW_OK;
+}
+
+hailo_status HailoNet2Impl::submit_frame(std::shared_ptr<HailoNet2Frame> frame)
+{
+    auto bindings = m_configured_infer_model->create_bindings();
+    GST_CHECK_EXPECTED_AS_STATUS(bindings, m_element, RESOURCE, "Failed creating bindings, status = %d", bindings.status());
+
+    auto input = bindings->input(m_input_name);
+    GST_CHECK_EXPECTED_AS_STATUS(input, m_element, RESOURCE, "Failed getting input %s bindings, status = %d", m_input_name.c_str(), input.status());
+    auto status = input->set_buffer(MemoryView(frame->input_map.data, frame->input_map.size));
+    GST_CHECK_SUCCESS(status, m_element, RESOURCE, "Failed setting buffer of input %s, status = %d", m_input_name.c_str(), status);
+
+    status = bind_output_buffers(bindings.value(), *frame);
+    if (HAILO_SUCCESS != status) {
+        return status;
+    }
+
+    // Blocks only when the maximal number of frames is already in flight
+    status = m_configured_infer_model->wait_for_async_ready(WAIT_FOR_ASYNC_READY_TIMEOUT_MS);
+    GST_CHECK_SUCCESS(status, m_element, STREAM, "Waiting for async ready failed, status = %d", status);
+
+    // The frame is queued before it is sent, so the frames are pushed in the order they were received
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_inflight_frames.push_back(frame);
+    }
+
+    auto job = m_configured_infer_model->run_async(bindings.release(), [this, frame] (const CompletionInfoAsyncInfer &completion_info) {
+        on_infer_done(frame, completion_info.status);
+    });
+    if (!job) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_inflight_frames.pop_back();
+        GST_ELEMENT_ERROR(m_element, STREAM, FAILED, ("Failed running async inference, status = %d", job.status()), (NULL));
+        return job.status();
+    }
+    job->detach();
+
+    return HAILO_SUCCESS;
+}
+
+void HailoNet2Impl::push_loop()
+{
+    std::shared_ptr<HailoNet2Frame> frame = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] () {
+            return !m_is_running || (!m_inflight_frames.empty() && m_inflight_frames.front()->is_done);
+        });
+        if (!m_is_running) {
+            (void)gst_pad_pause_task(m_srcpad);
+            return;
+        }
+
+        frame = m_inflight_frames.front();
+        m_inflight_frames.pop_front();
+        m_is_pushing = true;
+    }
+
+    GstFlowReturn flow_result = GST_FLOW_ERROR;
+    if (HAILO_SUCCESS == frame->status) {
+        flow_result = gst_pad_push(m_srcpad, frame->buffer);
+    } else {
+        GST_ELEMENT_ERROR(m_element, STREAM, FAILED, ("Async inference failed, status = %d", frame->status), (NULL));
+        gst_buffer_unref(frame->buffer);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_is_pushing = false;
+        if (GST_FLOW_OK != flow_result) {
+            // The flow result is returned from the next chain call, so upstream stops pushing
+            m_last_flow_result = flow_result;
+        }
+    }
+    m_cv.notify_all();
+}
+
+hailo_status HailoNet2Impl::wait_for_inflight_frames()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    bool was_successful = m_cv.wait_for(lock, WAIT_FOR_INFLIGHT_FRAMES_TIMEOUT_MS, [this] () {
+        // The last frame popped may still be pushed downstream
+        return !m_is_running || (m_inflight_frames.empty() && !m_is_pushing);
+    });
+    GST_CHECK(was_successful, HAILO_TIMEOUT, m_element, RESOURCE, "Timeout while waiting for the in-flight frames of hailonet2!");
+
+    return HAILO_SUCCESS;
+}
+
+gboolean HailoNet2Impl::sink_event(GstEvent *event)
+{
+    switch (GST_EVENT_TYPE(event)) {
+    case GST_EVENT_FLUSH_START:
+    {
+        // In-flight frames are still pushed, and dropped by the downstream elements
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_last_flow_result = GST_FLOW_FLUSHING;
+        break;
+    }
+    case GST_EVENT_FLUSH_STOP:
+    {
+        (void)wait_for_inflight_frames();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_last_flow_result = GST_FLOW_OK;
+        break;
+    }
+    default:
+        // Serialized events (e.g. EOS, caps) must be pushed after all the buffers received before them
+        if (GST_EVENT_IS_SERIALIZED(event)) {
+            (void)wait_for_inflight_frames();
+        }
+        break;
+    }
+
+    return gst_pad_event_default(m_sinkpad, GST_OBJECT_CAST(m_element), event);
+}
+
+static void gst_hailonet2_init(GstHailoNet2 *self)
+{
+    auto hailonet2_impl = HailoNet2Impl::create(self);
+    if (!hailonet2_impl) {
+        GST_ELEMENT_ERROR(self, RESOURCE, FAILED, ("Creating hailonet2 implementation has failed! status = %d", hailonet2_impl.status()), (NULL));
+        return;
+    }
+
+    self->impl = hailonet2_impl.release();
+}
+
+static void gst_hailonet2_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec)
+{
+    GST_HAILONET2(object)->impl->set_property(object, property_id, value, pspec);
+}
+
+static void gst_hailonet2_get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec)
+{
+    GST_HAILONET2(object)->impl->get_property(object, property_id, value, pspec);
+}
+
+static GstFlowReturn gst_hailonet2_chain(GstPad */*pad*/, GstObject *parent, GstBuffer *buffer)
+{
+    return GST_HAILONET2(parent)->impl->chain(buffer);
+}
+
+static gboolean gst_hailonet2_sink_event(GstPad */*pad*/, GstObject *parent, GstEvent *event)
+{
+    return GST_HAILONET2(parent)->impl->sink_event(event);
+}
+
+static void gst_hailonet2_push_loop(gpointer user_data)
+{
+    GST_HAILONET2(user_data)->impl->push_loop();
+}
+
+static GstStateChangeReturn gst_hailonet2_change_state(GstElement *element, GstStateChange transition)
+{
+    auto &hailonet2 = GST_HAILONET2(element)->impl;
+    switch (transition) {
+    case GST_STATE_CHANGE_READY_TO_PAUSED:
+    {
+        hailo_status status = hailonet2->configure();
+        GST_CHECK(HAILO_SUCCESS == status, GST_STATE_CHANGE_FAILURE, element, RESOURCE, "Configuring network failed, status = %d\n", status);
+        status = hailonet2->start();
+        GST_CHECK(HAILO_SUCCESS == status, GST_STATE_CHANGE_FAILURE, element, RESOURCE, "Starting hailonet2 failed, status = %d\n", status);
+        break;
+    }
+    case GST_STATE_CHANGE_PAUSED_TO_READY:
+    {
+        // The push task holds the src pad's stream lock, so it is stopped before the pads are deactivated
+        hailo_status status = hailonet2->stop();
+        GST_CHECK(HAILO_SUCCESS == status, GST_STATE_CHANGE_FAILURE, element, RESOURCE, "Stopping hailonet2 failed, status = %d\n", status);
+        break;
+    }
+    default:
+        break;
+    }
+
+    GstStateChangeReturn ret = GST_ELEMENT_CLASS(gst_hailonet2_parent_class)->change_state(element, transition);
+    if (GST_STATE_CHANGE_FAILURE == ret) {
+        return ret;
+    }
+
+    if (GST_STATE_CHANGE_READY_TO_NULL == transition) {
+        // Cleanup all of hailonet2 memory
+        hailonet2.reset();
+    }
+
+    return ret;
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2021-2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#ifndef _GST_HAILONET2_HPP_
+#define _GST_HAILONET2_HPP_
+
+#include "common.hpp"
+#include "hailo/infer_model.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_HAILONET2 (gst_hailonet2_get_type())
+#define GST_HAILONET2(obj) (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_HAILONET2,GstHailoNet2))
+#define GST_HAILONET2_CLASS(klass) (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_HAILONET2,GstHailoNet2Class))
+#define GST_IS_HAILONET2(obj) (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_HAILONET2))
+#define GST_IS_HAILONET2_CLASS(obj) (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_HAILONET2))
+
+class HailoNet2Impl;
+struct GstHailoNet2
+{
+    GstElement parent;
+    std::unique_ptr<HailoNet2Impl> impl;
+};
+
+struct GstHailoNet2Class
+{
+    GstElementClass parent;
+};
+
+struct HailoNet2Properties final
+{
+public:
+    HailoNet2Properties() : m_device_id(nullptr), m_hef_path(nullptr), m_batch_size(HAILO_DEFAULT_BATCH_SIZE),
+        m_device_count(0), m_vdevice_key(DEFAULT_VDEVICE_KEY), m_scheduling_algorithm(HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN),
+        m_scheduler_timeout_ms(HAILO_DEFAULT_SCHEDULER_TIMEOUT_MS), m_scheduler_threshold(HAILO_DEFAULT_SCHEDULER_THRESHOLD),
+        m_scheduler_priority(HAILO_SCHEDULER_PRIORITY_NORMAL), m_multi_process_service(HAILO_DEFAULT_MULTI_PROCESS_SERVICE),
+        m_input_format_type(HAILO_FORMAT_TYPE_AUTO), m_output_format_type(HAILO_FORMAT_TYPE_AUTO),
+        m_outputs_min_pool_size(DEFAULT_OUTPUTS_MIN_POOL_SIZE), m_outputs_max_pool_size(DEFAULT_OUTPUTS_MAX_POOL_SIZE), m_outputs_dmabuf(false)
+    {}
+
+    HailoElemProperty<gchar*> m_device_id;
+    HailoElemProperty<gchar*> m_hef_path;
+    HailoElemProperty<guint16> m_batch_size;
+    HailoElemProperty<guint16> m_device_count;
+    HailoElemProperty<guint32> m_vdevice_key;
+    HailoElemProperty<hailo_scheduling_algorithm_t> m_scheduling_algorithm;
+    HailoElemProperty<guint32> m_scheduler_timeout_ms;
+    HailoElemProperty<guint32> m_scheduler_threshold;
+    HailoElemProperty<guint8> m_scheduler_priority;
+    HailoElemProperty<gboolean> m_multi_process_service;
+    HailoElemProperty<hailo_format_type_t> m_input_format_type;
+    HailoElemProperty<hailo_format_type_t> m_output_format_type;
+    HailoElemProperty<guint> m_outputs_min_pool_size;
+    HailoElemProperty<guint> m_outputs_max_pool_size;
+    HailoElemProperty<gboolean> m_outputs_dmabuf;
+};
+
+// A frame sent to the async inference, kept in the in-flight queue (in the order it was received) until it is pushed.
+struct HailoNet2Frame final
+{
+    GstBuffer *buffer;
+    GstMapInfo input_map;
+    std::vector<std::pair<GstBuffer*, GstMapInfo>> outputs;
+    hailo_status status;
+    bool is_done;
+};
+
+class HailoNet2Impl final
+{
+public:
+    static Expected<std::unique_ptr<HailoNet2Impl>> create(GstHailoNet2 *element);
+    HailoNet2Impl(GstHailoNet2 *element, GstPad *sinkpad, GstPad *srcpad);
+    ~HailoNet2Impl();
+
+    void set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
+    void get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
+
+    hailo_status configure();
+    hailo_status start();
+    hailo_status stop();
+
+    GstFlowReturn chain(GstBuffer *buffer);
+    gboolean sink_event(GstEvent *event);
+    void push_loop();
+
+private:
+    Expected<GstBufferPool*> create_output_pool(const std::string &output_name, size_t frame_size);
+    hailo_status submit_frame(std::shared_ptr<HailoNet2Frame> frame);
+    hailo_status bind_output_buffers(ConfiguredInferModel::Bindings &bindings, HailoNet2Frame &frame);
+    void on_infer_done(std::shared_ptr<HailoNet2Frame> frame, hailo_status status);
+    void release_frame(HailoNet2Frame &frame);
+    hailo_status wait_for_inflight_frames();
+
+    GstHailoNet2 *m_element;
+    GstPad *m_sinkpad;
+    GstPad *m_srcpad;
+    HailoNet2Properties m_props;
+
+    std::shared_ptr<VDevice> m_vdevice;
+    std::shared_ptr<InferModel> m_infer_model;
+    std::shared_ptr<ConfiguredInferModel> m_configured_infer_model;
+    std::string m_input_name;
+    size_t m_input_frame_size;
+    std::vector<std::string> m_output_names;
+    std::vector<hailo_vstream_info_t> m_output_infos;
+    std::vector<GstBufferPool*> m_output_pools;
+    GstAllocator *m_dmabuf_allocator;
+    bool m_was_configured;
+
+    // Frames sent to the async inference, in the order they are pushed downstream.
+    std::deque<std::shared_ptr<HailoNet2Frame>> m_inflight_frames;
+    // True while a frame popped from m_inflight_frames is pushed downstream
+    bool m_is_pushing;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_is_running;
+    GstFlowReturn m_last_flow_result;
+};
+
+GType gst_hailonet2_get_type(void);
+
+G_END_DECLS
+
+#endif /* _GST_HAILONET2_HPP_ */
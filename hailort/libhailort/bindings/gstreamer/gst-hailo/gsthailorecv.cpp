@@ -61,7 +61,8 @@ enum
     PROP_0,
     PROP_DEBUG,
     PROP_OUTPUTS_MIN_POOL_SIZE,
-    PROP_OUTPUTS_MAX_POOL_SIZE
+    PROP_OUTPUTS_MAX_POOL_SIZE,
+    PROP_OUTPUTS_DMABUF
 };
 
 G_DEFINE_TYPE(GstHailoRecv, gst_hailorecv, GST_TYPE_VIDEO_FILTER);
@@ -98,6 +99,12 @@ static void gst_hailorecv_class_init(GstHailoRecvClass *klass)
         g_param_spec_uint("outputs-max-pool-size", "Outputs Maximum Pool Size",
             "The maximum amount of buffers to allocate for each output layer or 0 for unlimited", 0, std::numeric_limits<uint32_t>::max(), 1,
             (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_OUTPUTS_DMABUF,
+        g_param_spec_boolean("outputs-dmabuf", "Export outputs as DMABufs",
+            "Allocate the output buffers as DMABufs (using udmabuf), so downstream elements can import them without copying. "
+            "Only the outputs are exported - DMABuf inputs are mapped and copied to the device by hailosend "
+            "(the HailoRT driver can't import dmabuf fds)", false,
+            (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
     video_filter_class->transform_frame_ip = GST_DEBUG_FUNCPTR(gst_hailorecv_transform_frame_ip);
 }
 
@@ -115,11 +122,20 @@ Expected<std::unique_ptr<HailoRecvImpl>> HailoRecvImpl::create(GstHailoRecv *ele
     return ptr;
 }
 
-HailoRecvImpl::HailoRecvImpl(GstHailoRecv *element) : m_element(element), m_props()
+HailoRecvImpl::HailoRecvImpl(GstHailoRecv *element) : m_element(element), m_props(), m_dmabuf_allocator(nullptr), m_read_generation(0), m_pending_reads(0),
+    m_should_print_latency(false), m_readers_should_quit(false)
 {
     GST_DEBUG_CATEGORY_INIT(gst_hailorecv_debug_category, "hailorecv", 0, "debug category for hailorecv element");
 }
 
+HailoRecvImpl::~HailoRecvImpl()
+{
+    stop_output_readers();
+    if (nullptr != m_dmabuf_allocator) {
+        gst_object_unref(m_dmabuf_allocator);
+    }
+}
+
 void HailoRecvImpl::set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec)
 {
     GST_DEBUG_OBJECT(m_element, "set_property");
@@ -139,6 +155,9 @@ void HailoRecvImpl::set_property(GObject *object, guint property_id, const GValu
     case PROP_OUTPUTS_MAX_POOL_SIZE:
         m_props.m_outputs_max_pool_size = g_value_get_uint(value);
         break;
+    case PROP_OUTPUTS_DMABUF:
+        m_props.m_outputs_dmabuf = g_value_get_boolean(value);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
         break;
@@ -164,6 +183,9 @@ void HailoRecvImpl::get_property(GObject *object, guint property_id, GValue *val
     case PROP_OUTPUTS_MAX_POOL_SIZE:
         g_value_set_uint(value, m_props.m_outputs_max_pool_size.get());
         break;
+    case PROP_OUTPUTS_DMABUF:
+        g_value_set_boolean(value, m_props.m_outputs_dmabuf.get());
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
         break;
@@ -215,30 +237,32 @@ GstFlowReturn HailoRecvImpl::handle_frame(GstVideoFilter */*filter*/, GstVideoFr
 hailo_status HailoRecvImpl::read_from_vstreams(bool should_print_latency)
 {
     std::chrono::time_point<std::chrono::system_clock> overall_start_time = std::chrono::system_clock::now();
-    std::chrono::system_clock::time_point start_time;
 
-    for (auto &output_info : m_output_infos) {
-        if (should_print_latency) {
-            start_time = std::chrono::system_clock::now();
+    if (m_output_readers.empty()) {
+        for (auto &output_info : m_output_infos) {
+            auto status = read_output(output_info, should_print_latency);
+            if (HAILO_SUCCESS != status) {
+                return status;
+            }
         }
+    } else {
+        {
+            std::unique_lock<std::mutex> lock(m_readers_mutex);
+            m_should_print_latency = should_print_latency;
+            m_pending_reads = m_output_readers.size();
+            m_read_generation++;
+        }
+        m_read_requested_cv.notify_all();
 
-        GstMapInfo buffer_info;
-        auto buffer = output_info.acquire_buffer();
-        GST_CHECK_EXPECTED_AS_STATUS(buffer, m_element, RESOURCE, "Failed to acquire buffer!");
-
-        gboolean result = gst_buffer_map(*buffer, &buffer_info, GST_MAP_WRITE);
-        GST_CHECK(result, HAILO_INTERNAL_FAILURE, m_element, RESOURCE, "Failed mapping buffer!");
+        std::unique_lock<std::mutex> lock(m_readers_mutex);
+        m_read_done_cv.wait(lock, [this] () { return 0 == m_pending_reads; });
 
-        auto status = output_info.vstream().read(MemoryView(buffer_info.data, buffer_info.size));
-        if (should_print_latency) {
-            std::chrono::duration<double, std::milli> latency = std::chrono::system_clock::now() - start_time;
-            GST_DEBUG("%s latency: %f milliseconds", output_info.vstream().name().c_str(), latency.count());
-        }
-        gst_buffer_unmap(*buffer, &buffer_info);
-        if (HAILO_STREAM_ABORTED_BY_USER == status) {
-            return status;
+        // Checked in the outputs' order, so the reported status doesn't depend on which read failed first
+        for (auto status : m_read_statuses) {
+            if (HAILO_SUCCESS != status) {
+                return status;
+            }
         }
-        GST_CHECK_SUCCESS(status, m_element, STREAM, "Reading from vstream failed, status = %d", status);
     }
 
     if (should_print_latency) {
@@ -249,6 +273,92 @@ hailo_status HailoRecvImpl::read_from_vstreams(bool should_print_latency)
     return HAILO_SUCCESS;
 }
 
+hailo_status HailoRecvImpl::read_output(HailoOutputInfo &output_info, bool should_print_latency)
+{
+    std::chrono::system_clock::time_point start_time;
+    if (should_print_latency) {
+        start_time = std::chrono::system_clock::now();
+    }
+
+    GstMapInfo buffer_info;
+    auto buffer = output_info.acquire_buffer();
+    GST_CHECK_EXPECTED_AS_STATUS(buffer, m_element, RESOURCE, "Failed to acquire buffer!");
+
+    // Mapped for reading too - a kept mapping of a dmabuf output is only reused by maps with a subset of its flags,
+    // so downstream elements can read it without mapping it again
+    gboolean result = gst_buffer_map(*buffer, &buffer_info, GST_MAP_READWRITE);
+    GST_CHECK(result, HAILO_INTERNAL_FAILURE, m_element, RESOURCE, "Failed mapping buffer!");
+
+    auto status = output_info.vstream().read(MemoryView(buffer_info.data, buffer_info.size));
+    if (should_print_latency) {
+        std::chrono::duration<double, std::milli> latency = std::chrono::system_clock::now() - start_time;
+        GST_DEBUG("%s latency: %f milliseconds", output_info.vstream().name().c_str(), latency.count());
+    }
+    gst_buffer_unmap(*buffer, &buffer_info);
+    if (HAILO_STREAM_ABORTED_BY_USER == status) {
+        return status;
+    }
+    GST_CHECK_SUCCESS(status, m_element, STREAM, "Reading from vstream failed, status = %d", status);
+
+    return HAILO_SUCCESS;
+}
+
+void HailoRecvImpl::start_output_readers()
+{
+    if (m_output_infos.size() <= 1) {
+        // A single output is read on the streaming thread
+        return;
+    }
+
+    m_read_statuses.assign(m_output_infos.size(), HAILO_SUCCESS);
+    m_readers_should_quit = false;
+    for (size_t i = 0; i < m_output_infos.size(); i++) {
+        m_output_readers.emplace_back(&HailoRecvImpl::output_reader_loop, this, i);
+    }
+}
+
+void HailoRecvImpl::stop_output_readers()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_readers_mutex);
+        m_readers_should_quit = true;
+    }
+    m_read_requested_cv.notify_all();
+
+    for (auto &reader : m_output_readers) {
+        reader.join();
+    }
+    m_output_readers.clear();
+}
+
+void HailoRecvImpl::output_reader_loop(size_t output_index)
+{
+    uint64_t handled_generation = 0;
+    while (true) {
+        bool should_print_latency = false;
+        {
+            std::unique_lock<std::mutex> lock(m_readers_mutex);
+            m_read_requested_cv.wait(lock, [this, handled_generation] () {
+                return m_readers_should_quit || (m_read_generation != handled_generation);
+            });
+            if (m_readers_should_quit) {
+                return;
+            }
+            handled_generation = m_read_generation;
+            should_print_latency = m_should_print_latency;
+        }
+
+        auto status = read_output(m_output_infos[output_index], should_print_latency);
+
+        {
+            std::unique_lock<std::mutex> lock(m_readers_mutex);
+            m_read_statuses[output_index] = status;
+            m_pending_reads--;
+        }
+        m_read_done_cv.notify_one();
+    }
+}
+
 hailo_status HailoRecvImpl::write_tensors_to_metadata(GstVideoFrame *frame, bool should_print_latency)
 {
     std::chrono::time_point<std::chrono::system_clock> start_time = std::chrono::system_clock::now();
@@ -270,6 +380,9 @@ hailo_status HailoRecvImpl::write_tensors_to_metadata(GstVideoFrame *frame, bool
 
 hailo_status HailoRecvImpl::set_output_vstreams(std::vector<OutputVStream> &&output_vstreams, uint32_t batch_size)
 {
+    // The output readers, the pools and the allocator are created once, for the vstreams of the configured network
+    GST_CHECK(m_output_vstreams.empty() && m_output_readers.empty() && (nullptr == m_dmabuf_allocator),
+        HAILO_INVALID_OPERATION, m_element, RESOURCE, "Output vstreams of hailorecv are already set!");
     GST_CHECK((0 == m_props.m_outputs_max_pool_size.get()) || (m_props.m_outputs_min_pool_size.get() <= m_props.m_outputs_max_pool_size.get()),
         HAILO_INVALID_ARGUMENT, m_element, RESOURCE, "Minimum pool size (=%d) is bigger than maximum (=%d)!", m_props.m_outputs_min_pool_size.get(),
         m_props.m_outputs_max_pool_size.get());
@@ -278,6 +391,12 @@ hailo_status HailoRecvImpl::set_output_vstreams(std::vector<OutputVStream> &&out
         g_warning("outputs-max-pool-size is smaller than the batch size! Overall performance might be affected!");
     }
 
+    if (m_props.m_outputs_dmabuf.get()) {
+        m_dmabuf_allocator = gst_hailo_dmabuf_allocator_new();
+        GST_CHECK(nullptr != m_dmabuf_allocator, HAILO_NOT_SUPPORTED, m_element, RESOURCE,
+            "outputs-dmabuf is set, but DMABufs can't be allocated (is /dev/udmabuf available?)");
+    }
+
     m_output_vstreams = std::move(output_vstreams);
 
     for (auto &out_vstream : m_output_vstreams) {
@@ -292,6 +411,9 @@ hailo_status HailoRecvImpl::set_output_vstreams(std::vector<OutputVStream> &&out
 
         gst_buffer_pool_config_set_params(config, nullptr, static_cast<guint>(out_vstream.get_frame_size()), m_props.m_outputs_min_pool_size.get(),
             m_props.m_outputs_max_pool_size.get());
+        if (nullptr != m_dmabuf_allocator) {
+            gst_buffer_pool_config_set_allocator(config, m_dmabuf_allocator, nullptr);
+        }
 
         gboolean result = gst_buffer_pool_set_config(pool, config);
         GST_CHECK(result, HAILO_INTERNAL_FAILURE, m_element, RESOURCE, "Could not set config for vstream %s buffer pool", out_vstream.name().c_str());
@@ -302,6 +424,8 @@ hailo_status HailoRecvImpl::set_output_vstreams(std::vector<OutputVStream> &&out
         m_output_infos.emplace_back(out_vstream, pool);
     }
 
+    start_output_readers();
+
     return HAILO_SUCCESS;
 }
 
@@ -22,11 +22,15 @@
 
 #include "common.hpp"
 #include "hailo_output_info.hpp"
+#include "dmabuf_allocator.hpp"
 
 #include <gst/video/video.h>
 #include <gst/video/gstvideofilter.h>
 
 #include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 G_BEGIN_DECLS
 
@@ -75,18 +79,21 @@ struct GstHailoRecvClass
 struct HailoRecvProperties final
 {
 public:
-    HailoRecvProperties() : m_debug(false), m_outputs_min_pool_size(DEFAULT_OUTPUTS_MIN_POOL_SIZE), m_outputs_max_pool_size(DEFAULT_OUTPUTS_MAX_POOL_SIZE)
+    HailoRecvProperties() : m_debug(false), m_outputs_min_pool_size(DEFAULT_OUTPUTS_MIN_POOL_SIZE), m_outputs_max_pool_size(DEFAULT_OUTPUTS_MAX_POOL_SIZE),
+        m_outputs_dmabuf(false)
     {}
 
     HailoElemProperty<gboolean> m_debug;
     HailoElemProperty<guint> m_outputs_min_pool_size;
     HailoElemProperty<guint> m_outputs_max_pool_size;
+    HailoElemProperty<gboolean> m_outputs_dmabuf;
 };
 
 class HailoRecvImpl final {
 public:
     static Expected<std::unique_ptr<HailoRecvImpl>> create(GstHailoRecv *element);
     HailoRecvImpl(GstHailoRecv *element);
+    ~HailoRecvImpl();
     void set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
     void get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
     GstFlowReturn handle_frame(GstVideoFilter *filter, GstVideoFrame *frame);
@@ -96,12 +103,29 @@ public:
 
 private:
     hailo_status read_from_vstreams(bool should_print_latency);
+    hailo_status read_output(HailoOutputInfo &output_info, bool should_print_latency);
     hailo_status write_tensors_to_metadata(GstVideoFrame *frame, bool should_print_latency);
+    void start_output_readers();
+    void stop_output_readers();
+    void output_reader_loop(size_t output_index);
 
     GstHailoRecv *m_element;
     HailoRecvProperties m_props;
     std::vector<OutputVStream> m_output_vstreams;
     std::vector<HailoOutputInfo> m_output_infos;
+    GstAllocator *m_dmabuf_allocator;
+
+    // When there is more than one output, each output is read by its own thread, so the latency of a frame is the
+    // latency of its slowest output. A read is requested from all readers by advancing m_read_generation.
+    std::vector<std::thread> m_output_readers;
+    std::mutex m_readers_mutex;
+    std::condition_variable m_read_requested_cv;
+    std::condition_variable m_read_done_cv;
+    uint64_t m_read_generation;
+    size_t m_pending_reads;
+    std::vector<hailo_status> m_read_statuses;
+    bool m_should_print_latency;
+    bool m_readers_should_quit;
 };
 
 GType gst_hailorecv_get_type(void);
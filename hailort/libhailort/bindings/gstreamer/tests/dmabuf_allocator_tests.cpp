@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2021-2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * Tests of GstHailoDmaBufAllocator - frames are allocated from a buffer pool configured with the allocator (like the
+ * output pools of hailonet2 and hailorecv), and are accessed both through the GstMemory mapping and through the
+ * dmabuf fd (like a downstream element that imports them).
+ * Runs on any Linux host with /dev/udmabuf, and is skipped otherwise.
+ */
+#include "dmabuf_allocator.hpp"
+
+#include <sys/mman.h>
+
+#define TEST_SKIPPED_RETURN_CODE (77)
+
+#define TEST_CHECK(cond, ...)                   \
+    do {                                        \
+        if (!(cond)) {                          \
+            g_printerr(__VA_ARGS__);            \
+            g_printerr("\n");                   \
+            return FALSE;                       \
+        }                                       \
+    } while (0)
+
+// Not a whole number of pages, so the allocator resizes the memory back to the frame size
+static constexpr gsize FRAME_SIZE = (640 * 480 * 3) + 1;
+static constexpr guint POOL_BUFFERS_COUNT = 2;
+
+static void fill_pattern(guint8 *data, gsize size, guint8 seed)
+{
+    for (gsize i = 0; i < size; i++) {
+        data[i] = static_cast<guint8>(i + seed);
+    }
+}
+
+static gboolean is_pattern(const guint8 *data, gsize size, guint8 seed)
+{
+    for (gsize i = 0; i < size; i++) {
+        if (static_cast<guint8>(i + seed) != data[i]) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static GstBufferPool *create_pool(GstAllocator *allocator)
+{
+    GstBufferPool *pool = gst_buffer_pool_new();
+    GstStructure *config = gst_buffer_pool_get_config(pool);
+    gst_buffer_pool_config_set_params(config, nullptr, static_cast<guint>(FRAME_SIZE), POOL_BUFFERS_COUNT, POOL_BUFFERS_COUNT);
+    gst_buffer_pool_config_set_allocator(config, allocator, nullptr);
+    if (!gst_buffer_pool_set_config(pool, config) || !gst_buffer_pool_set_active(pool, TRUE)) {
+        gst_object_unref(pool);
+        return nullptr;
+    }
+    return pool;
+}
+
+static gboolean round_trip_frame(GstBuffer *buffer)
+{
+    TEST_CHECK(FRAME_SIZE == gst_buffer_get_size(buffer), "Unexpected buffer size %zu", gst_buffer_get_size(buffer));
+    TEST_CHECK(1 == gst_buffer_n_memory(buffer), "Expected a single memory, got %u", gst_buffer_n_memory(buffer));
+    GstMemory *memory = gst_buffer_peek_memory(buffer, 0);
+    TEST_CHECK(gst_is_dmabuf_memory(memory), "Buffer memory isn't a dmabuf");
+
+    // Written by the host (e.g. by HailoRT through the mapping). Mapped like hailonet2 maps its outputs.
+    GstMapInfo map_info;
+    TEST_CHECK(gst_buffer_map(buffer, &map_info, GST_MAP_READWRITE), "Failed mapping the buffer for writing");
+    guint8 *mapped_address = map_info.data;
+    fill_pattern(map_info.data, map_info.size, 1);
+    gst_buffer_unmap(buffer, &map_info);
+
+    // Read and written by an importer of the dmabuf fd
+    const int fd = gst_dmabuf_memory_get_fd(memory);
+    TEST_CHECK(0 <= fd, "Invalid dmabuf fd %d", fd);
+    void *fd_address = mmap(nullptr, FRAME_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    TEST_CHECK(MAP_FAILED != fd_address, "Failed mapping the dmabuf fd");
+    const gboolean was_written = is_pattern(static_cast<guint8*>(fd_address), FRAME_SIZE, 1);
+    fill_pattern(static_cast<guint8*>(fd_address), FRAME_SIZE, 2);
+    (void)munmap(fd_address, FRAME_SIZE);
+    TEST_CHECK(was_written, "Frame written through the mapping doesn't match the dmabuf content");
+
+    // The memory is kept mapped, so the next map returns the same address (and HailoRT can reuse its dma mapping)
+    TEST_CHECK(gst_buffer_map(buffer, &map_info, GST_MAP_READ), "Failed mapping the buffer for reading");
+    const gboolean is_same_address = (mapped_address == map_info.data);
+    const gboolean was_read = is_pattern(map_info.data, map_info.size, 2);
+    gst_buffer_unmap(buffer, &map_info);
+    TEST_CHECK(is_same_address, "Buffer was mapped to another address");
+    TEST_CHECK(was_read, "Frame written through the dmabuf fd doesn't match the mapping content");
+
+    return TRUE;
+}
+
+static gboolean test_pool_round_trip(GstAllocator *allocator)
+{
+    GstBufferPool *pool = create_pool(allocator);
+    TEST_CHECK(nullptr != pool, "Failed creating a buffer pool with the dmabuf allocator");
+
+    gboolean result = TRUE;
+    GstBuffer *buffers[POOL_BUFFERS_COUNT] = {};
+    for (guint i = 0; (i < POOL_BUFFERS_COUNT) && result; i++) {
+        if (GST_FLOW_OK != gst_buffer_pool_acquire_buffer(pool, &buffers[i], nullptr)) {
+            g_printerr("Failed acquiring buffer %u from the pool\n", i);
+            result = FALSE;
+            break;
+        }
+        result = round_trip_frame(buffers[i]);
+    }
+    if (result && (gst_dmabuf_memory_get_fd(gst_buffer_peek_memory(buffers[0], 0)) ==
+            gst_dmabuf_memory_get_fd(gst_buffer_peek_memory(buffers[1], 0)))) {
+        g_printerr("The buffers of the pool share a dmabuf\n");
+        result = FALSE;
+    }
+
+    for (auto buffer : buffers) {
+        if (nullptr != buffer) {
+            gst_buffer_unref(buffer);
+        }
+    }
+    (void)gst_buffer_pool_set_active(pool, FALSE);
+    gst_object_unref(pool);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    gst_init(&argc, &argv);
+
+    GstAllocator *allocator = gst_hailo_dmabuf_allocator_new();
+    if (nullptr == allocator) {
+        g_print("[ SKIPPED  ] /dev/udmabuf isn't available\n");
+        return TEST_SKIPPED_RETURN_CODE;
+    }
+
+    const gboolean result = test_pool_round_trip(allocator);
+    g_print("[  %s  ] dmabuf_allocator.pool_round_trip\n", result ? "PASSED" : "FAILED");
+
+    gst_object_unref(allocator);
+    return result ? 0 : 1;
+}
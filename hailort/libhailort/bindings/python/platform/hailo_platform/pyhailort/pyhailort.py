@@ -39,6 +39,8 @@ PCIE_ANY_DOMAIN = _pyhailort.HailoRTDefaults.PCIE_ANY_DOMAIN()
 HAILO_UNIQUE_VDEVICE_GROUP_ID = _pyhailort.HailoRTDefaults.HAILO_UNIQUE_VDEVICE_GROUP_ID()
 DEFAULT_VSTREAM_TIMEOUT_MS = 10000
 DEFAULT_VSTREAM_QUEUE_SIZE = 2
+NMS_DETECTIONS_ORDERS = (FormatOrder.HAILO_NMS_DETECTIONS, FormatOrder.HAILO_NMS_DETECTIONS_WITH_BYTE_MASK)
+FLOAT_FORMAT_TYPES = (FormatType.FLOAT32, FormatType.FLOAT16, FormatType.BFLOAT16)
 
 class HailoSocket(object):
     MAX_UDP_PAYLOAD_SIZE = HailoSocketDefs.MAX_UDP_PAYLOAD_SIZE()
@@ -932,6 +934,13 @@ class InferVStreams(object):
             self._hw_time = time.perf_counter() - time_before_infer
 
         for name, result_array in output_buffers.items():
+            if output_buffers_info[name].output_order in NMS_DETECTIONS_ORDERS:
+                if self._tf_nms_format:
+                    raise HailoRTException("TF format is not supported with {} format order".format(output_buffers_info[name].output_order))
+                output_buffers[name] = HailoRTTransformUtils._output_raw_buffer_to_nms_detections_format(result_array,
+                    output_buffers_info[name].output_order)
+                continue
+
             # TODO: HRT-11726 - Combine Pyhailort NMS and NMS_WITH_BYTE_MASK decoding function
             if output_buffers_info[name].output_order == FormatOrder.HAILO_NMS_WITH_BYTE_MASK:
                 nms_shape = output_buffers_info[name].vstream_info.nms_shape
@@ -1276,6 +1285,40 @@ class HailoRTTransformUtils(object):
             converted_output_frame.append(classes_boxes)
         return converted_output_frame
 
+    @staticmethod
+    def _output_raw_buffer_to_nms_detections_format(raw_output_buffer, output_order):
+        converted_output_buffer = []
+        for frame in raw_output_buffer:
+            converted_output_buffer.append(
+                HailoRTTransformUtils._output_raw_buffer_to_nms_detections_format_single_frame(frame, output_order))
+        return converted_output_buffer
+
+    @staticmethod
+    def _output_raw_buffer_to_nms_detections_format_single_frame(raw_output_buffer, output_order):
+        # The frame is variable length - detections_count, followed by the detections (sorted by score).
+        # Only the used part of the frame is read.
+        frame_bytes = raw_output_buffer.view(numpy.uint8)
+        detections_count = int(frame_bytes[:4].view(numpy.uint32)[0])
+        with_mask = (output_order == FormatOrder.HAILO_NMS_DETECTIONS_WITH_BYTE_MASK)
+        offset = 4
+        detections = []
+        for _ in range(detections_count):
+            bbox = frame_bytes[offset : offset + (BBOX_PARAMS * 4)].view(numpy.float32)
+            offset += BBOX_PARAMS * 4
+            class_id = int(frame_bytes[offset : offset + 4].view(numpy.uint32)[0])
+            offset += 4
+
+            mask_size = 0
+            mask = None
+            if with_mask:
+                mask_size = int(frame_bytes[offset : offset + 4].view(numpy.uint32)[0])
+                offset += 4
+                mask = frame_bytes[offset : offset + mask_size]
+                offset += mask_size
+
+            detections.append(HailoDetectionBox(bbox, class_id, mask_size, mask))
+        return detections
+
     @staticmethod
     def _output_raw_buffer_to_nms_with_byte_mask_tf_format(raw_output_buffer, number_of_classes, batch_size, image_height, image_width,
             max_bboxes_per_class, output_dtype):
@@ -1352,6 +1395,8 @@ class HailoRTTransformUtils(object):
             return FormatType.UINT16
         elif dtype == numpy.float32:
             return FormatType.FLOAT32
+        elif dtype == numpy.float16:
+            return FormatType.FLOAT16
         raise HailoRTException("unsupported data type {}".format(dtype))
 
 # TODO: HRT-10427 - Remove
@@ -2726,7 +2771,7 @@ class InputVStreamParams(object):
         if format_type is None:
             format_type = FormatType.AUTO
         if quantized is None:
-            quantized = format_type != FormatType.FLOAT32
+            quantized = format_type not in FLOAT_FORMAT_TYPES
         if timeout_ms is None:
             timeout_ms = DEFAULT_VSTREAM_TIMEOUT_MS
         if queue_size is None:
@@ -2795,7 +2840,7 @@ class OutputVStreamParams(object):
         if format_type is None:
             format_type = FormatType.AUTO
         if quantized is None:
-            quantized = format_type != FormatType.FLOAT32
+            quantized = format_type not in FLOAT_FORMAT_TYPES
         if timeout_ms is None:
             timeout_ms = DEFAULT_VSTREAM_TIMEOUT_MS
         if queue_size is None:
@@ -3091,6 +3136,11 @@ class OutputVStream(object):
         with ExceptionWrapper():
             result_array = self._recv_object.recv()
 
+        if self.output_order in NMS_DETECTIONS_ORDERS:
+            if self._tf_nms_format:
+                raise HailoRTException("TF format is not supported with {} format order".format(self.output_order))
+            return HailoRTTransformUtils._output_raw_buffer_to_nms_detections_format_single_frame(result_array, self.output_order)
+
         if self.output_order == FormatOrder.HAILO_NMS_WITH_BYTE_MASK:
             nms_shape = self._vstream_info.nms_shape
             if len(self._input_stream_infos) != 1:
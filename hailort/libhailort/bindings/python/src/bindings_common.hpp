@@ -33,6 +33,11 @@ public:
             return "uint16";
         case HAILO_FORMAT_TYPE_FLOAT32:
             return "float32";
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return "float16";
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            // numpy has no bfloat16 type - the raw bits are exposed
+            return "uint16";
         default:
             throw HailoRTStatusException("Invalid format type.");
         }
@@ -50,6 +55,10 @@ public:
         case HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK: {
             return { HailoRTCommon::get_nms_with_byte_mask_host_shape_size(vstream_info.nms_shape, user_format) };
         }
+        case HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS:
+            return { HailoRTCommon::get_nms_detections_host_shape_size(vstream_info.nms_shape, user_format) };
+        case HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK:
+            return { HailoRTCommon::get_nms_detections_with_byte_mask_host_shape_size(vstream_info.nms_shape, user_format) };
         case HAILO_FORMAT_ORDER_NC:
             return {shape.features};
         case HAILO_FORMAT_ORDER_NHW:
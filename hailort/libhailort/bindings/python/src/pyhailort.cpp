@@ -496,6 +496,8 @@ PYBIND11_MODULE(_pyhailort, m) {
         .value("UINT8", HAILO_FORMAT_TYPE_UINT8)
         .value("UINT16", HAILO_FORMAT_TYPE_UINT16)
         .value("FLOAT32", HAILO_FORMAT_TYPE_FLOAT32)
+        .value("FLOAT16", HAILO_FORMAT_TYPE_FLOAT16)
+        .value("BFLOAT16", HAILO_FORMAT_TYPE_BFLOAT16, "numpy has no bfloat16 type, so the buffers are numpy.uint16 arrays holding the raw bits.")
         ;
 
     py::enum_<hailo_format_order_t>(m, "FormatOrder")
@@ -520,6 +522,8 @@ PYBIND11_MODULE(_pyhailort, m) {
         .value("I420", HAILO_FORMAT_ORDER_I420)
         .value("YYYYUV", HAILO_FORMAT_ORDER_HAILO_YYYYUV)
         .value("HAILO_NMS_WITH_BYTE_MASK", HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK)
+        .value("HAILO_NMS_DETECTIONS", HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS)
+        .value("HAILO_NMS_DETECTIONS_WITH_BYTE_MASK", HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK)
         ;
 
     py::enum_<hailo_format_flags_t>(m, "FormatFlags", py::arithmetic())
@@ -743,6 +747,7 @@ PYBIND11_MODULE(_pyhailort, m) {
         .value("MEASURE_FPS", hailo_pipeline_elem_stats_flags_t::HAILO_PIPELINE_ELEM_STATS_MEASURE_FPS)
         .value("MEASURE_LATENCY", hailo_pipeline_elem_stats_flags_t::HAILO_PIPELINE_ELEM_STATS_MEASURE_LATENCY)
         .value("MEASURE_QUEUE_SIZE", hailo_pipeline_elem_stats_flags_t::HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE)
+        .value("MEASURE_PERCENTILES", hailo_pipeline_elem_stats_flags_t::HAILO_PIPELINE_ELEM_STATS_MEASURE_PERCENTILES)
         ;
 
     py::class_<hailo_vstream_params_t>(m, "VStreamParams")
@@ -762,7 +767,7 @@ PYBIND11_MODULE(_pyhailort, m) {
                     vstream_params.pipeline_elements_stats_flags);
             },
             [](py::tuple t) { // __setstate__
-                hailo_vstream_params_t vstream_params;
+                hailo_vstream_params_t vstream_params{};
                 vstream_params.user_buffer_format = t[0].cast<hailo_format_t>();
                 vstream_params.timeout_ms = t[1].cast<uint32_t>();
                 vstream_params.queue_size = t[2].cast<uint32_t>();
@@ -8,6 +8,7 @@
  **/
 
 #include "hailo/quantization.hpp"
+#include "hailo/float16.hpp"
 
 #include "quantization_api.hpp"
 #include "bindings_common.hpp"
@@ -33,6 +34,14 @@ void QuantizationBindings::dequantize_output_buffer_from_uint8(py::array src_buf
             Quantization::dequantize_output_buffer<float32_t, uint8_t>(static_cast<uint8_t*>(src_buffer.mutable_data()),
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer<Float16, uint8_t>(static_cast<uint8_t*>(src_buffer.mutable_data()),
+                static_cast<Float16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            Quantization::dequantize_output_buffer<BFloat16, uint8_t>(static_cast<uint8_t*>(src_buffer.mutable_data()),
+                static_cast<BFloat16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src format type uint8 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -52,6 +61,14 @@ void QuantizationBindings::dequantize_output_buffer_from_uint16(py::array src_bu
             Quantization::dequantize_output_buffer<float32_t, uint16_t>(static_cast<uint16_t*>(src_buffer.mutable_data()),
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer<Float16, uint16_t>(static_cast<uint16_t*>(src_buffer.mutable_data()),
+                static_cast<Float16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            Quantization::dequantize_output_buffer<BFloat16, uint16_t>(static_cast<uint16_t*>(src_buffer.mutable_data()),
+                static_cast<BFloat16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src dormat type uint16 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -90,6 +107,14 @@ void QuantizationBindings::dequantize_output_buffer_from_uint8_in_place(py::arra
             Quantization::dequantize_output_buffer_in_place<float32_t, uint8_t>(
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer_in_place<Float16, uint8_t>(
+                static_cast<Float16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            Quantization::dequantize_output_buffer_in_place<BFloat16, uint8_t>(
+                static_cast<BFloat16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src format type uint8 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -109,6 +134,14 @@ void QuantizationBindings::dequantize_output_buffer_from_uint16_in_place(py::arr
             Quantization::dequantize_output_buffer_in_place<float32_t, uint16_t>(
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer_in_place<Float16, uint16_t>(
+                static_cast<Float16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            Quantization::dequantize_output_buffer_in_place<BFloat16, uint16_t>(
+                static_cast<BFloat16*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src dormat type uint16 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -205,21 +238,22 @@ void QuantizationBindings::quantize_input_buffer_from_uint16(py::array src_buffe
     }
 }
 
-void QuantizationBindings::quantize_input_buffer_from_float32(py::array src_buffer, py::array dst_buffer, const hailo_format_type_t &dst_dtype,
-    uint32_t shape_size, const hailo_quant_info_t &quant_info)
+template <typename T>
+void QuantizationBindings::quantize_input_buffer_from_float(py::array src_buffer, py::array dst_buffer, const hailo_format_type_t &src_dtype,
+    const hailo_format_type_t &dst_dtype, uint32_t shape_size, const hailo_quant_info_t &quant_info)
 {
     switch (dst_dtype) {
         case HAILO_FORMAT_TYPE_UINT8:
-            Quantization::quantize_input_buffer<float32_t, uint8_t>(static_cast<float32_t*>(src_buffer.mutable_data()),
+            Quantization::quantize_input_buffer<T, uint8_t>(static_cast<T*>(src_buffer.mutable_data()),
                 static_cast<uint8_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
         case HAILO_FORMAT_TYPE_UINT16:
-            Quantization::quantize_input_buffer<float32_t, uint16_t>(static_cast<float32_t*>(src_buffer.mutable_data()),
+            Quantization::quantize_input_buffer<T, uint16_t>(static_cast<T*>(src_buffer.mutable_data()),
                 static_cast<uint16_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
         default:
-            std::cerr << "Input quantization isn't supported from src format type float32 to dst format type = " <<
-                HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
+            std::cerr << "Input quantization isn't supported from src format type " << HailoRTCommon::get_format_type_str(src_dtype) <<
+                " to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
             break;
     }
@@ -236,7 +270,16 @@ void QuantizationBindings::quantize_input_buffer(py::array src_buffer, py::array
             QuantizationBindings::quantize_input_buffer_from_uint16(src_buffer, dst_buffer, dst_dtype, shape_size, quant_info);
             break;
         case HAILO_FORMAT_TYPE_FLOAT32:
-            QuantizationBindings::quantize_input_buffer_from_float32(src_buffer, dst_buffer, dst_dtype, shape_size, quant_info);
+            QuantizationBindings::quantize_input_buffer_from_float<float32_t>(src_buffer, dst_buffer, src_dtype, dst_dtype,
+                shape_size, quant_info);
+            break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            QuantizationBindings::quantize_input_buffer_from_float<Float16>(src_buffer, dst_buffer, src_dtype, dst_dtype,
+                shape_size, quant_info);
+            break;
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            QuantizationBindings::quantize_input_buffer_from_float<BFloat16>(src_buffer, dst_buffer, src_dtype, dst_dtype,
+                shape_size, quant_info);
             break;
         default:
             std::cerr << "Input quantization isn't supported for src format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2020-2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file infer_model_async_example.c
+ * This example demonstrates the usage of HailoRT async inference api (infer model) with a single thread, and
+ * measures the achieved throughput.
+ **/
+
+#include "common.h"
+#include "hailo_thread.h"
+#include "hailo/hailort.h"
+
+#include <string.h>
+
+#if defined(__unix__)
+#include <sys/mman.h>
+#include <time.h>
+#endif
+
+
+#define HEF_FILE ("hefs/shortcut_net.hef")
+#define MAX_EDGE_LAYERS_PER_DIR (16)
+#define MAX_ONGOING_REQUESTS (8)
+#define FRAMES_COUNT (1000)
+#define WAIT_TIMEOUT_MS (10000)
+
+#if defined(__unix__)
+#define INVALID_ADDR (MAP_FAILED)
+#define page_aligned_alloc(size) mmap(NULL, (size), PROT_WRITE | PROT_READ, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0)
+#define page_aligned_free(addr, size) munmap((addr), (size))
+#elif defined(_MSC_VER)
+#define INVALID_ADDR (NULL)
+#define page_aligned_alloc(size) VirtualAlloc(NULL, (size), MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE)
+#define page_aligned_free(addr, size) VirtualFree((addr), 0, MEM_RELEASE)
+#else /* defined(_MSC_VER) */
+#pragma error("Aligned alloc not supported")
+#endif
+
+static double get_time_seconds()
+{
+#if defined(__unix__)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+#elif defined(_MSC_VER)
+    return (double)GetTickCount64() / 1e3;
+#endif
+}
+
+typedef struct {
+    hailo_configured_infer_model_bindings bindings;
+    hailo_async_infer_job job;
+    void *buffers[MAX_EDGE_LAYERS_PER_DIR * 2];
+    size_t buffers_sizes[MAX_EDGE_LAYERS_PER_DIR * 2];
+    size_t buffers_count;
+} infer_request_t;
+
+static hailo_atomic_int completed_frames;
+
+static void infer_done_callback(const hailo_infer_model_async_completion_info_t *completion_info)
+{
+    if (HAILO_SUCCESS != completion_info->status) {
+        fprintf(stderr, "Got an unexpected status on callback. status=%d\n", completion_info->status);
+        return;
+    }
+
+    // Real applications can forward the output buffers (bound to completion_info->bindings) to post-process/display.
+    hailo_atomic_increment(&completed_frames);
+}
+
+static hailo_status add_buffer(infer_request_t *request, size_t size, void **buffer)
+{
+    *buffer = page_aligned_alloc(size);
+    if (INVALID_ADDR == *buffer) {
+        return HAILO_OUT_OF_HOST_MEMORY;
+    }
+
+    request->buffers[request->buffers_count] = *buffer;
+    request->buffers_sizes[request->buffers_count] = size;
+    request->buffers_count++;
+    return HAILO_SUCCESS;
+}
+
+static void release_request(infer_request_t *request)
+{
+    size_t i = 0;
+
+    if (NULL != request->job) {
+        (void) hailo_async_infer_job_wait(request->job, WAIT_TIMEOUT_MS);
+        (void) hailo_release_async_infer_job(request->job);
+        request->job = NULL;
+    }
+    if (NULL != request->bindings) {
+        (void) hailo_release_configured_infer_model_bindings(request->bindings);
+        request->bindings = NULL;
+    }
+    for (i = 0; i < request->buffers_count; i++) {
+        page_aligned_free(request->buffers[i], request->buffers_sizes[i]);
+    }
+    request->buffers_count = 0;
+}
+
+// Each request holds its own bindings. The user buffers are bound once, and the results are written directly into the
+// output buffers (no copies).
+static hailo_status create_request(hailo_infer_model infer_model, hailo_configured_infer_model configured_infer_model,
+    const char **input_names, size_t inputs_count, const char **output_names, size_t outputs_count,
+    infer_request_t *request)
+{
+    hailo_status status = HAILO_UNINITIALIZED;
+    size_t i = 0;
+    size_t frame_size = 0;
+    void *buffer = NULL;
+
+    status = hailo_configured_infer_model_create_bindings(configured_infer_model, &request->bindings);
+    REQUIRE_SUCCESS(status, l_exit, "Failed creating bindings");
+
+    for (i = 0; i < inputs_count; i++) {
+        status = hailo_infer_model_get_input_frame_size(infer_model, input_names[i], &frame_size);
+        REQUIRE_SUCCESS(status, l_exit, "Failed getting input frame size");
+
+        status = add_buffer(request, frame_size, &buffer);
+        REQUIRE_SUCCESS(status, l_exit, "Failed allocating input buffer");
+
+        // Real applications will fill the input buffers with frames before launching the request.
+        memset(buffer, (int)i, frame_size);
+
+        status = hailo_configured_infer_model_bindings_set_input_buffer(request->bindings, input_names[i], buffer,
+            frame_size);
+        REQUIRE_SUCCESS(status, l_exit, "Failed setting input buffer");
+    }
+
+    for (i = 0; i < outputs_count; i++) {
+        status = hailo_infer_model_get_output_frame_size(infer_model, output_names[i], &frame_size);
+        REQUIRE_SUCCESS(status, l_exit, "Failed getting output frame size");
+
+        status = add_buffer(request, frame_size, &buffer);
+        REQUIRE_SUCCESS(status, l_exit, "Failed allocating output buffer");
+
+        status = hailo_configured_infer_model_bindings_set_output_buffer(request->bindings, output_names[i], buffer,
+            frame_size);
+        REQUIRE_SUCCESS(status, l_exit, "Failed setting output buffer");
+    }
+
+    status = HAILO_SUCCESS;
+l_exit:
+    return status;
+}
+
+static hailo_status infer(hailo_configured_infer_model configured_infer_model, infer_request_t *requests,
+    size_t requests_count)
+{
+    hailo_status status = HAILO_UNINITIALIZED;
+    size_t frame_index = 0;
+    infer_request_t *request = NULL;
+    double start_time = 0;
+    double elapsed_time = 0;
+
+    hailo_atomic_init(&completed_frames, 0);
+    start_time = get_time_seconds();
+
+    // The requests are used in a round robin manner - before reusing a request's bindings, we wait for the previous
+    // request launched with them to finish.
+    for (frame_index = 0; frame_index < FRAMES_COUNT; frame_index++) {
+        request = &requests[frame_index % requests_count];
+        if (NULL != request->job) {
+            status = hailo_async_infer_job_wait(request->job, WAIT_TIMEOUT_MS);
+            REQUIRE_SUCCESS(status, l_exit, "Failed waiting for infer job");
+            (void) hailo_release_async_infer_job(request->job);
+            request->job = NULL;
+        }
+
+        status = hailo_configured_infer_model_wait_for_async_ready(configured_infer_model, WAIT_TIMEOUT_MS);
+        REQUIRE_SUCCESS(status, l_exit, "Failed waiting for async ready");
+
+        status = hailo_configured_infer_model_run_async(configured_infer_model, request->bindings, infer_done_callback,
+            NULL, &request->job);
+        REQUIRE_SUCCESS(status, l_exit, "Failed running async infer");
+    }
+
+    // Wait for the last requests
+    for (frame_index = 0; frame_index < requests_count; frame_index++) {
+        request = &requests[frame_index];
+        if (NULL != request->job) {
+            status = hailo_async_infer_job_wait(request->job, WAIT_TIMEOUT_MS);
+            REQUIRE_SUCCESS(status, l_exit, "Failed waiting for infer job");
+            (void) hailo_release_async_infer_job(request->job);
+            request->job = NULL;
+        }
+    }
+
+    elapsed_time = get_time_seconds() - start_time;
+    printf("Inferred %d frames in %.2f seconds (%.2f FPS)\n", hailo_atomic_load(&completed_frames), elapsed_time,
+        (double)hailo_atomic_load(&completed_frames) / elapsed_time);
+
+    status = HAILO_SUCCESS;
+l_exit:
+    return status;
+}
+
+int main()
+{
+    hailo_status status = HAILO_UNINITIALIZED;
+    hailo_vdevice vdevice = NULL;
+    hailo_infer_model infer_model = NULL;
+    hailo_configured_infer_model configured_infer_model = NULL;
+    const char *input_names[MAX_EDGE_LAYERS_PER_DIR] = {NULL};
+    const char *output_names[MAX_EDGE_LAYERS_PER_DIR] = {NULL};
+    size_t inputs_count = MAX_EDGE_LAYERS_PER_DIR;
+    size_t outputs_count = MAX_EDGE_LAYERS_PER_DIR;
+    infer_request_t requests[MAX_ONGOING_REQUESTS];
+    size_t i = 0;
+
+    memset(requests, 0, sizeof(requests));
+
+    status = hailo_create_vdevice(NULL, &vdevice);
+    REQUIRE_SUCCESS(status, l_exit, "Failed to create vdevice");
+
+    status = hailo_create_infer_model(vdevice, HEF_FILE, &infer_model);
+    REQUIRE_SUCCESS(status, l_release_vdevice, "Failed creating infer model");
+
+    status = hailo_infer_model_get_input_names(infer_model, input_names, &inputs_count);
+    REQUIRE_SUCCESS(status, l_release_infer_model, "Failed getting input names");
+
+    status = hailo_infer_model_get_output_names(infer_model, output_names, &outputs_count);
+    REQUIRE_SUCCESS(status, l_release_infer_model, "Failed getting output names");
+
+    status = hailo_infer_model_configure(infer_model, &configured_infer_model);
+    REQUIRE_SUCCESS(status, l_release_infer_model, "Failed configuring infer model");
+
+    for (i = 0; i < MAX_ONGOING_REQUESTS; i++) {
+        status = create_request(infer_model, configured_infer_model, input_names, inputs_count, output_names,
+            outputs_count, &requests[i]);
+        REQUIRE_SUCCESS(status, l_release_requests, "Failed creating infer request");
+    }
+
+    status = infer(configured_infer_model, requests, MAX_ONGOING_REQUESTS);
+    REQUIRE_SUCCESS(status, l_release_requests, "Failed performing inference");
+
+    status = HAILO_SUCCESS;
+    printf("Inference ran successfully\n");
+
+l_release_requests:
+    // release_request waits for the ongoing request (if any) before freeing its buffers.
+    for (i = 0; i < MAX_ONGOING_REQUESTS; i++) {
+        release_request(&requests[i]);
+    }
+    (void) hailo_release_configured_infer_model(configured_infer_model);
+l_release_infer_model:
+    (void) hailo_release_infer_model(infer_model);
+l_release_vdevice:
+    (void) hailo_release_vdevice(vdevice);
+l_exit:
+    return (int)status;
+}
@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2020-2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file infer_pipeline_benchmark_example.cpp
+ * This example measures the throughput of small-batch InferVStreams::infer calls, and compares it with
+ * double buffered InferVStreams::infer_async calls (the next dataset is launched while the previous one is inferred).
+ **/
+
+#include "hailo/hailort.hpp"
+
+#include <iostream>
+#include <chrono>
+
+
+#define HEF_FILE ("hefs/shortcut_net.hef")
+constexpr size_t INFER_CALLS_COUNT = 1000;
+constexpr size_t BUFFER_SETS_COUNT = 2;
+constexpr hailo_format_type_t FORMAT_TYPE = HAILO_FORMAT_TYPE_AUTO;
+const std::vector<size_t> FRAMES_PER_CALL = {1, 2, 4, 8};
+
+using namespace hailort;
+
+Expected<std::shared_ptr<ConfiguredNetworkGroup>> configure_network_group(VDevice &vdevice)
+{
+    auto hef = Hef::create(HEF_FILE);
+    if (!hef) {
+        return make_unexpected(hef.status());
+    }
+
+    auto configure_params = vdevice.create_configure_params(hef.value());
+    if (!configure_params) {
+        return make_unexpected(configure_params.status());
+    }
+
+    auto network_groups = vdevice.configure(hef.value(), configure_params.value());
+    if (!network_groups) {
+        return make_unexpected(network_groups.status());
+    }
+
+    if (1 != network_groups->size()) {
+        std::cerr << "Invalid amount of network groups" << std::endl;
+        return make_unexpected(HAILO_INTERNAL_FAILURE);
+    }
+
+    return std::move(network_groups->at(0));
+}
+
+// Holds the input and output buffers of a single infer call
+struct BufferSet
+{
+    BufferSet(InferVStreams &pipeline, size_t frames_count)
+    {
+        for (const auto &input_vstream : pipeline.get_input_vstreams()) {
+            auto &buffer = buffers.emplace(input_vstream.get().name() + "_in",
+                std::vector<uint8_t>(input_vstream.get().get_frame_size() * frames_count)).first->second;
+            inputs.emplace(input_vstream.get().name(), MemoryView(buffer.data(), buffer.size()));
+        }
+        for (const auto &output_vstream : pipeline.get_output_vstreams()) {
+            auto &buffer = buffers.emplace(output_vstream.get().name() + "_out",
+                std::vector<uint8_t>(output_vstream.get().get_frame_size() * frames_count)).first->second;
+            outputs.emplace(output_vstream.get().name(), MemoryView(buffer.data(), buffer.size()));
+        }
+    }
+
+    std::map<std::string, std::vector<uint8_t>> buffers;
+    std::map<std::string, MemoryView> inputs;
+    std::map<std::string, MemoryView> outputs;
+};
+
+void print_result(const std::string &mode, size_t frames_per_call, std::chrono::duration<double> elapsed)
+{
+    const auto calls_per_sec = static_cast<double>(INFER_CALLS_COUNT) / elapsed.count();
+    std::cout << mode << " - frames per call: " << frames_per_call << ", calls/sec: " << calls_per_sec
+        << ", FPS: " << calls_per_sec * static_cast<double>(frames_per_call) << std::endl;
+}
+
+hailo_status benchmark_infer(InferVStreams &pipeline, size_t frames_per_call)
+{
+    BufferSet buffer_set(pipeline, frames_per_call);
+
+    const auto start_time = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < INFER_CALLS_COUNT; i++) {
+        auto status = pipeline.infer(buffer_set.inputs, buffer_set.outputs, frames_per_call);
+        if (HAILO_SUCCESS != status) {
+            std::cerr << "Failed infer with status " << status << std::endl;
+            return status;
+        }
+    }
+    print_result("infer", frames_per_call, std::chrono::steady_clock::now() - start_time);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status benchmark_infer_async(InferVStreams &pipeline, size_t frames_per_call)
+{
+    std::vector<BufferSet> buffer_sets;
+    buffer_sets.reserve(BUFFER_SETS_COUNT);
+    for (size_t i = 0; i < BUFFER_SETS_COUNT; i++) {
+        buffer_sets.emplace_back(pipeline, frames_per_call);
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < INFER_CALLS_COUNT; i++) {
+        if (i >= BUFFER_SETS_COUNT) {
+            // Before reusing a buffer set, wait for the request launched with it.
+            // Real applications would consume its outputs and fill the next inputs here.
+            auto status = pipeline.wait_for_async_infer();
+            if (HAILO_SUCCESS != status) {
+                std::cerr << "Failed wait_for_async_infer with status " << status << std::endl;
+                return status;
+            }
+        }
+
+        auto &buffer_set = buffer_sets[i % BUFFER_SETS_COUNT];
+        auto status = pipeline.infer_async(buffer_set.inputs, buffer_set.outputs, frames_per_call);
+        if (HAILO_SUCCESS != status) {
+            std::cerr << "Failed infer_async with status " << status << std::endl;
+            return status;
+        }
+    }
+    for (size_t i = 0; i < std::min(INFER_CALLS_COUNT, BUFFER_SETS_COUNT); i++) {
+        auto status = pipeline.wait_for_async_infer();
+        if (HAILO_SUCCESS != status) {
+            std::cerr << "Failed wait_for_async_infer with status " << status << std::endl;
+            return status;
+        }
+    }
+    print_result("infer_async (double buffering)", frames_per_call, std::chrono::steady_clock::now() - start_time);
+
+    return HAILO_SUCCESS;
+}
+
+int main()
+{
+    auto vdevice = VDevice::create();
+    if (!vdevice) {
+        std::cerr << "Failed create vdevice, status = " << vdevice.status() << std::endl;
+        return vdevice.status();
+    }
+
+    auto network_group = configure_network_group(*vdevice.value());
+    if (!network_group) {
+        std::cerr << "Failed to configure network group " << HEF_FILE << std::endl;
+        return network_group.status();
+    }
+
+    auto input_params = network_group.value()->make_input_vstream_params({}, FORMAT_TYPE, HAILO_DEFAULT_VSTREAM_TIMEOUT_MS, HAILO_DEFAULT_VSTREAM_QUEUE_SIZE);
+    if (!input_params) {
+        std::cerr << "Failed make_input_vstream_params " << input_params.status() << std::endl;
+        return input_params.status();
+    }
+
+    auto output_params = network_group.value()->make_output_vstream_params({}, FORMAT_TYPE, HAILO_DEFAULT_VSTREAM_TIMEOUT_MS, HAILO_DEFAULT_VSTREAM_QUEUE_SIZE);
+    if (!output_params) {
+        std::cerr << "Failed make_output_vstream_params " << output_params.status() << std::endl;
+        return output_params.status();
+    }
+
+    auto pipeline = InferVStreams::create(*network_group.value(), input_params.value(), output_params.value());
+    if (!pipeline) {
+        std::cerr << "Failed to create inference pipeline " << pipeline.status() << std::endl;
+        return pipeline.status();
+    }
+
+    for (const auto frames_per_call : FRAMES_PER_CALL) {
+        auto status = benchmark_infer(pipeline.value(), frames_per_call);
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+
+        status = benchmark_infer_async(pipeline.value(), frames_per_call);
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+    }
+
+    std::cout << "Benchmark finished successfully" << std::endl;
+    return HAILO_SUCCESS;
+}
@@ -216,6 +216,11 @@ public:
     // Internal functions
     DmaStorage(vdma::DmaAbleBufferPtr &&dma_able_buffer);
     virtual Expected<vdma::MappedBufferPtr> get_dma_mapped_buffer(const std::string &device_id) override;
+    // True if the storage is backed by a user allocated buffer
+    bool is_user_allocated() const;
+    bool is_dma_mapped(const std::string &device_id) const;
+    // Uses an existing mapping of the buffer (e.g. a cached one) for device_id
+    hailo_status set_dma_mapped_buffer(const std::string &device_id, vdma::MappedBufferPtr mapped_buffer);
 
 private:
     // Creates a backing dma-able buffer (either user or hailort allocated).
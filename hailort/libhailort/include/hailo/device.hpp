@@ -692,6 +692,18 @@ public:
      */
     virtual bool is_stream_interface_supported(const hailo_stream_interface_t &stream_interface) const = 0;
 
+    /**
+     * Releases the cached dma mappings of user buffers overlapping [address, address + size).
+     * When the dma mapping cache is enabled (by setting the HAILO_DMA_MAPPING_CACHE_SIZE_MB environment variable),
+     * user buffers passed to async transfers stay mapped after the transfer is done, so they won't be mapped again on
+     * their next transfer. Such buffers must be invalidated before they are freed.
+     *
+     * @param[in] address   The address of the buffer.
+     * @param[in] size      The size of the buffer.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    virtual hailo_status invalidate_dma_mapping_cache(void *address, size_t size);
+
     virtual hailo_status direct_write_memory(uint32_t address, const void *buffer, uint32_t size);
     virtual hailo_status direct_read_memory(uint32_t address, void *buffer, uint32_t size);
     hailo_status set_overcurrent_state(bool should_activate);
@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file float16.hpp
+ * @brief Host side half precision types - ::HAILO_FORMAT_TYPE_FLOAT16 and ::HAILO_FORMAT_TYPE_BFLOAT16.
+ **/
+
+#ifndef _HAILO_FLOAT16_HPP_
+#define _HAILO_FLOAT16_HPP_
+
+#include "hailo/hailort.h"
+
+#include <cstring>
+#include <type_traits>
+
+/** hailort namespace */
+namespace hailort
+{
+
+/**
+ * IEEE 754 half precision float (1 sign bit, 5 exponent bits, 10 mantissa bits).
+ * Used as the element type of buffers with ::HAILO_FORMAT_TYPE_FLOAT16 format type.
+ *
+ * Converting from float32 rounds to the nearest even value. The single value conversions use branchless bit
+ * manipulations, so loops over the values can be vectorized by the compiler. The bulk conversions (convert()) use the
+ * hardware instructions when available (F16C on x86, checked at runtime, and the fp16 conversions of ARMv8).
+ */
+class HAILORTAPI Float16 final
+{
+public:
+    Float16() = default;
+    explicit Float16(float32_t value) : m_bits(from_float32(value)) {}
+    // Integral values (e.g. argmax indices) are converted through float32
+    template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    explicit Float16(T value) : Float16(static_cast<float32_t>(value)) {}
+
+    operator float32_t() const
+    {
+        return to_float32(m_bits);
+    }
+
+    static Float16 from_bits(uint16_t bits)
+    {
+        Float16 value;
+        value.m_bits = bits;
+        return value;
+    }
+
+    uint16_t bits() const
+    {
+        return m_bits;
+    }
+
+    /**
+     * Converts @a count float32 values from @a src to @a dst.
+     */
+    static void convert(const float32_t *src, Float16 *dst, size_t count);
+
+    /**
+     * Converts @a count float16 values from @a src to @a dst.
+     */
+    static void convert(const Float16 *src, float32_t *dst, size_t count);
+
+private:
+    static uint16_t from_float32(float32_t value)
+    {
+        // All the cases are computed and then selected, so the conversion has no branches.
+        constexpr uint32_t FLOAT32_INF_BITS = 0xFFu << 23;
+        // Smallest float32 that overflows float16 (65520 rounds to infinity)
+        constexpr uint32_t FLOAT16_OVERFLOW_BITS = (127u + 16u) << 23;
+        // Smallest float32 that is a normal float16 (2^-14)
+        constexpr uint32_t FLOAT16_MIN_NORMAL_BITS = 113u << 23;
+        // Adding 0.5 shifts the float16 denormals to the bottom mantissa bits of a float32 (rounded to nearest even)
+        constexpr uint32_t DENORMAL_MAGIC_BITS = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        const uint32_t sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        const uint32_t overflow_result = select_bits(bits > FLOAT32_INF_BITS, 0x7E00u, 0x7C00u);
+
+        float32_t denormal_magic = 0;
+        std::memcpy(&denormal_magic, &DENORMAL_MAGIC_BITS, sizeof(denormal_magic));
+        float32_t abs_value = 0;
+        std::memcpy(&abs_value, &bits, sizeof(abs_value));
+        const float32_t denormal_sum = abs_value + denormal_magic;
+        uint32_t denormal_sum_bits = 0;
+        std::memcpy(&denormal_sum_bits, &denormal_sum, sizeof(denormal_sum_bits));
+        const uint32_t denormal_result = denormal_sum_bits - DENORMAL_MAGIC_BITS;
+
+        // Rebias the exponent and round the mantissa to nearest even
+        const uint32_t mantissa_odd = (bits >> 13) & 1u;
+        const uint32_t normal_result = (bits + (static_cast<uint32_t>(15 - 127) << 23) + 0xFFFu + mantissa_odd) >> 13;
+
+        uint32_t result = select_bits(bits < FLOAT16_MIN_NORMAL_BITS, denormal_result, normal_result);
+        result = select_bits(bits >= FLOAT16_OVERFLOW_BITS, overflow_result, result);
+        return static_cast<uint16_t>(result | (sign >> 16));
+    }
+
+    static float32_t to_float32(uint16_t bits)
+    {
+        constexpr uint32_t SHIFTED_EXPONENT_MASK = 0x7C00u << 13;
+        constexpr uint32_t EXPONENT_REBIAS = static_cast<uint32_t>(127 - 15) << 23;
+        // 2^-14 - the float16 denormals are renormalized by subtracting it
+        constexpr uint32_t DENORMAL_MAGIC_BITS = 113u << 23;
+
+        const uint32_t shifted = static_cast<uint32_t>(bits & 0x7FFFu) << 13;
+        const uint32_t exponent = shifted & SHIFTED_EXPONENT_MASK;
+        const uint32_t normal_result = shifted + EXPONENT_REBIAS;
+
+        // Inf/NaN keep the maximal exponent
+        const uint32_t inf_nan_result = normal_result + (static_cast<uint32_t>(128 - 16) << 23);
+
+        const uint32_t denormal_bits = normal_result + (1u << 23);
+        float32_t denormal_value = 0;
+        std::memcpy(&denormal_value, &denormal_bits, sizeof(denormal_value));
+        float32_t denormal_magic = 0;
+        std::memcpy(&denormal_magic, &DENORMAL_MAGIC_BITS, sizeof(denormal_magic));
+        denormal_value -= denormal_magic;
+        uint32_t denormal_result = 0;
+        std::memcpy(&denormal_result, &denormal_value, sizeof(denormal_result));
+
+        uint32_t result = select_bits(exponent == SHIFTED_EXPONENT_MASK, inf_nan_result, normal_result);
+        result = select_bits(exponent == 0, denormal_result, result);
+        result |= static_cast<uint32_t>(bits & 0x8000u) << 16;
+
+        float32_t value = 0;
+        std::memcpy(&value, &result, sizeof(value));
+        return value;
+    }
+
+    // Selects with masks - chained conditional expressions are turned into branches by the compiler.
+    static uint32_t select_bits(bool condition, uint32_t if_true, uint32_t if_false)
+    {
+        const uint32_t mask = 0u - static_cast<uint32_t>(condition);
+        return (if_true & mask) | (if_false & ~mask);
+    }
+
+    uint16_t m_bits;
+};
+
+/**
+ * Brain floating point (1 sign bit, 8 exponent bits, 7 mantissa bits) - the upper half of a float32.
+ * Used as the element type of buffers with ::HAILO_FORMAT_TYPE_BFLOAT16 format type.
+ *
+ * Converting from float32 rounds to the nearest even value (NaNs stay NaNs).
+ */
+class BFloat16 final
+{
+public:
+    BFloat16() = default;
+    explicit BFloat16(float32_t value) : m_bits(from_float32(value)) {}
+    // Integral values (e.g. argmax indices) are converted through float32
+    template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    explicit BFloat16(T value) : BFloat16(static_cast<float32_t>(value)) {}
+
+    operator float32_t() const
+    {
+        const uint32_t bits = static_cast<uint32_t>(m_bits) << 16;
+        float32_t value = 0;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    static BFloat16 from_bits(uint16_t bits)
+    {
+        BFloat16 value;
+        value.m_bits = bits;
+        return value;
+    }
+
+    uint16_t bits() const
+    {
+        return m_bits;
+    }
+
+    /**
+     * Converts @a count float32 values from @a src to @a dst.
+     */
+    static void convert(const float32_t *src, BFloat16 *dst, size_t count)
+    {
+        for (size_t i = 0; i < count; i++) {
+            dst[i] = BFloat16(src[i]);
+        }
+    }
+
+    /**
+     * Converts @a count bfloat16 values from @a src to @a dst.
+     */
+    static void convert(const BFloat16 *src, float32_t *dst, size_t count)
+    {
+        for (size_t i = 0; i < count; i++) {
+            dst[i] = static_cast<float32_t>(src[i]);
+        }
+    }
+
+private:
+    static uint16_t from_float32(float32_t value)
+    {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        const uint32_t rounded = bits + 0x7FFFu + ((bits >> 16) & 1u);
+        // Rounding may turn a NaN into an Inf - keep NaNs quiet NaNs instead
+        const bool is_nan = (bits & 0x7FFFFFFFu) > 0x7F800000u;
+        return static_cast<uint16_t>(is_nan ? ((bits >> 16) | 0x40u) : (rounded >> 16));
+    }
+
+    uint16_t m_bits;
+};
+
+static_assert(sizeof(Float16) == sizeof(uint16_t), "Float16 must be 2 bytes");
+static_assert(sizeof(BFloat16) == sizeof(uint16_t), "BFloat16 must be 2 bytes");
+static_assert(std::is_trivially_copyable<Float16>::value && std::is_trivially_copyable<BFloat16>::value,
+    "Half precision types must be trivially copyable");
+
+} /* namespace hailort */
+
+#endif /* _HAILO_FLOAT16_HPP_ */
@@ -224,6 +224,18 @@ typedef struct _hailo_input_vstream *hailo_input_vstream;
 /** Output virtual stream */
 typedef struct _hailo_output_vstream *hailo_output_vstream;
 
+/** Model that can be configured on a ::hailo_vdevice and inferred using the async inference API */
+typedef struct _hailo_infer_model *hailo_infer_model;
+
+/** Configured infer model, used to launch async inference requests */
+typedef struct _hailo_configured_infer_model *hailo_configured_infer_model;
+
+/** Binding of user buffers to the inputs and outputs of a ::hailo_configured_infer_model */
+typedef struct _hailo_configured_infer_model_bindings *hailo_configured_infer_model_bindings;
+
+/** Async inference request, returned by ::hailo_configured_infer_model_run_async */
+typedef struct _hailo_async_infer_job *hailo_async_infer_job;
+
 /** Enum that represents the type of devices that would be measured */
 typedef enum hailo_dvm_options_e {
     /** VDD_CORE DVM */
@@ -545,6 +557,18 @@ typedef enum {
     /** Data format type float32_t - used only on host side (Translated in the quantization process) */
     HAILO_FORMAT_TYPE_FLOAT32               = 3,
 
+    /**
+     * Data format type ::hailort::Float16 (IEEE 754 half precision) - 2 bytes per item, used only on host side
+     * (Translated in the quantization process)
+     */
+    HAILO_FORMAT_TYPE_FLOAT16               = 4,
+
+    /**
+     * Data format type ::hailort::BFloat16 (brain floating point - the upper 16 bits of a float32) - 2 bytes per
+     * item, used only on host side (Translated in the quantization process)
+     */
+    HAILO_FORMAT_TYPE_BFLOAT16              = 5,
+
     /** Max enum value to maintain ABI Integrity */
     HAILO_FORMAT_TYPE_MAX_ENUM              = HAILO_MAX_ENUM
 } hailo_format_type_t;
@@ -735,6 +759,57 @@ typedef enum {
      */
     HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK         = 20,
 
+    /**
+     * NMS detections - a compact, variable-length alternative to ::HAILO_FORMAT_ORDER_HAILO_NMS
+     * - Host side
+     *
+     *      The layout is
+     *          \code
+     *          struct (packed) {
+     *              uint32_t detections_count;
+     *              hailo_detection_t detections[detections_count];
+     *          };
+     *          \endcode
+     *
+     *      The detections of all classes are sorted by score (highest first), so only the first
+     *      sizeof(uint32_t) + detections_count * sizeof(hailo_detection_t) bytes of the frame need to be read.
+     *
+     *      The host format type supported ::HAILO_FORMAT_TYPE_FLOAT32.
+     *
+     *      Maximum amount of detections is ::hailo_nms_shape_t.number_of_classes * ::hailo_nms_shape_t.max_bboxes_per_class.
+     *
+     * - Not used for device side
+     */
+    HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS             = 21,
+
+    /**
+     * NMS detections with byte mask - a compact, variable-length alternative to ::HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK
+     * - Host side
+     *
+     *      The layout is
+     *          \code
+     *          struct (packed) {
+     *              uint32_t detections_count;
+     *              struct (packed) {
+     *                  hailo_detection_t detection;
+     *                  uint32_t mask_size;
+     *                  uint8_t mask[mask_size];
+     *              } detections[detections_count];
+     *          };
+     *          \endcode
+     *
+     *      The detections of all classes are sorted by score (highest first).
+     *      The mask holds one byte per pixel of the bbox (1 if the pixel is part of the detected object, 0 otherwise),
+     *      row major, padded to a multiple of 8 bytes. mask_size is the padded size in bytes.
+     *
+     *      The host format type supported ::HAILO_FORMAT_TYPE_FLOAT32.
+     *
+     *      Maximum amount of detections is ::hailo_nms_shape_t.number_of_classes * ::hailo_nms_shape_t.max_bboxes_per_class.
+     *
+     * - Not used for device side
+     */
+    HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK = 22,
+
     /** Max enum value to maintain ABI Integrity */
     HAILO_FORMAT_ORDER_MAX_ENUM             = HAILO_MAX_ENUM
 } hailo_format_order_t;
@@ -1189,11 +1264,74 @@ typedef enum {
     HAILO_PIPELINE_ELEM_STATS_MEASURE_FPS           = 1 << 0,   /*!< Measure element FPS */
     HAILO_PIPELINE_ELEM_STATS_MEASURE_LATENCY       = 1 << 1,   /*!< Measure element latency */
     HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE    = 1 << 2,   /*!< Measure element queue size */
+    HAILO_PIPELINE_ELEM_STATS_MEASURE_PERCENTILES   = 1 << 3,   /*!< Collect latency and queue size stats (of the elements and of the
+                                                                     entire vstream) into a lock-free histogram, enabling percentiles */
 
     /** Max enum value to maintain ABI Integrity */
     HAILO_PIPELINE_ELEM_STATS_MAX_ENUM              = HAILO_MAX_ENUM
 } hailo_pipeline_elem_stats_flags_t;
 
+/** Color formats of source images for the host image pre-process (see ::hailo_image_preprocess_params_t) */
+typedef enum {
+    HAILO_IMAGE_COLOR_FORMAT_NONE   = 0,    /*!< No image pre-process - the input buffer is in the input's user buffer format */
+    HAILO_IMAGE_COLOR_FORMAT_RGB,           /*!< Packed 8 bit R, G, B */
+    HAILO_IMAGE_COLOR_FORMAT_BGR,           /*!< Packed 8 bit B, G, R */
+    HAILO_IMAGE_COLOR_FORMAT_NV12,          /*!< Y plane, followed by an interleaved U, V plane subsampled by 2 in both axes */
+    HAILO_IMAGE_COLOR_FORMAT_I420,          /*!< Y plane, followed by U and V planes subsampled by 2 in both axes */
+    HAILO_IMAGE_COLOR_FORMAT_YUY2,          /*!< Packed Y0, U, Y1, V - U and V subsampled by 2 horizontally */
+
+    /** Max enum value to maintain ABI Integrity */
+    HAILO_IMAGE_COLOR_FORMAT_MAX_ENUM = HAILO_MAX_ENUM
+} hailo_image_color_format_t;
+
+/** Ways to fit the (cropped) source image into the network's input shape */
+typedef enum {
+    HAILO_IMAGE_RESIZE_MODE_STRETCH     = 0,    /*!< Resize to the input shape, ignoring the aspect ratio */
+    HAILO_IMAGE_RESIZE_MODE_LETTERBOX,          /*!< Resize keeping the aspect ratio, and pad the margins (centered) */
+
+    /** Max enum value to maintain ABI Integrity */
+    HAILO_IMAGE_RESIZE_MODE_MAX_ENUM    = HAILO_MAX_ENUM
+} hailo_image_resize_mode_t;
+
+/** Interpolation used by the host image pre-process resize */
+typedef enum {
+    HAILO_IMAGE_INTERPOLATION_BILINEAR  = 0,
+    HAILO_IMAGE_INTERPOLATION_NEAREST,
+
+    /** Max enum value to maintain ABI Integrity */
+    HAILO_IMAGE_INTERPOLATION_MAX_ENUM  = HAILO_MAX_ENUM
+} hailo_image_interpolation_t;
+
+/** Rectangle inside an image, in pixels */
+typedef struct {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+} hailo_image_rectangle_t;
+
+/**
+ * Host image pre-process parameters of an input, set with ::hailo_infer_model_set_input_image_preprocess.
+ * When @a color_format isn't ::HAILO_IMAGE_COLOR_FORMAT_NONE, the input buffers are source images of this format and
+ * size (instead of frames in the input's user buffer format). Each image is cropped, resized to the input shape,
+ * color converted to RGB and written to the device's input layout in a single pass.
+ * The input must be an 8 bit, 3 features (RGB) image input.
+ */
+typedef struct {
+    hailo_image_color_format_t color_format;
+    uint32_t width;
+    uint32_t height;
+    /** Bytes between the starts of consecutive rows of the first plane. 0 for rows without padding. The rows of the
+        chroma planes are @a row_stride bytes apart (NV12), or half of it (I420). */
+    uint32_t row_stride;
+    /** Part of the image to use. A rectangle with 0 width or height selects the whole image. */
+    hailo_image_rectangle_t crop;
+    hailo_image_resize_mode_t resize_mode;
+    hailo_image_interpolation_t interpolation;
+    /** Value of all channels in the margins added by ::HAILO_IMAGE_RESIZE_MODE_LETTERBOX */
+    uint8_t pad_value;
+} hailo_image_preprocess_params_t;
+
 /** Virtual stream params */
 typedef struct {
     hailo_format_t user_buffer_format;
@@ -1320,6 +1458,14 @@ typedef struct {
     // TODO: HRT-11413 - Add documentation on byte mask
     uint8_t *mask;
 } hailo_bbox_with_byte_mask_t;
+
+/** Detection of ::HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS and ::HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK */
+typedef struct {
+    hailo_bbox_float32_t bbox;
+
+    /** Class id of the detection */
+    uint32_t class_id;
+} hailo_detection_t;
 #pragma pack(pop)
 
 /**
@@ -1378,6 +1524,31 @@ typedef struct {
  */
 typedef void (*hailo_stream_read_async_callback_t)(const hailo_stream_read_async_completion_info_t *info);
 
+/**
+ * Completion info struct passed to the ::hailo_infer_model_async_callback_t after the async inference request is
+ * done or has failed.
+ */
+typedef struct {
+    /**
+     * Status of the async inference request:
+     *  - ::HAILO_SUCCESS - The inference request is complete, the output buffers contain the results.
+     *  - ::HAILO_STREAM_ABORTED_BY_USER - The inference request was canceled (can happen after deactivation).
+     *  - Any other ::hailo_status on unexpected errors.
+     */
+    hailo_status status;
+
+    /** The bindings passed to ::hailo_configured_infer_model_run_async */
+    hailo_configured_infer_model_bindings bindings;
+
+    /** User specific data. Can be used as a context for the callback. */
+    void *opaque;
+} hailo_infer_model_async_completion_info_t;
+
+/**
+ * Async inference request complete callback prototype.
+ */
+typedef void (*hailo_infer_model_async_callback_t)(const hailo_infer_model_async_completion_info_t *info);
+
 /**
  * Input or output stream information. In case of multiple inputs or outputs, each one has
  * its own stream.
@@ -2909,6 +3080,13 @@ HAILORTAPI hailo_status hailo_free_buffer(void *buffer);
 // If buffer has already been mapped to device, then HAILO_DMA_MAPPING_ALREADY_EXISTS shall be returned
 HAILORTAPI hailo_status hailo_dma_map_buffer_to_device(void *buffer, size_t size, hailo_device device, hailo_dma_buffer_direction_t direction);
 HAILORTAPI hailo_status hailo_dma_unmap_buffer_from_device(void *buffer, hailo_device device, hailo_dma_buffer_direction_t direction);
+// When the dma mapping cache is enabled (HAILO_DMA_MAPPING_CACHE_SIZE_MB environment variable), user buffers passed to
+// async transfers stay mapped after the transfer is done. These functions release the cached mappings overlapping
+// [buffer, buffer + size), and must be called before such a buffer is freed (hailo_free_buffer and
+// hailo_dma_unmap_buffer_from_device release them on their own).
+// hailo_vdevice_invalidate_dma_mapping_cache returns HAILO_NOT_SUPPORTED when working with the HailoRT service.
+HAILORTAPI hailo_status hailo_device_invalidate_dma_mapping_cache(hailo_device device, void *buffer, size_t size);
+HAILORTAPI hailo_status hailo_vdevice_invalidate_dma_mapping_cache(hailo_vdevice vdevice, void *buffer, size_t size);
 // ************************************** NOTE - END ************************************** //
 // Dma buffer allocation isn't currently supported and is for internal use only             //
 // **************************************************************************************** //
@@ -3792,6 +3970,270 @@ HAILORTAPI hailo_status hailo_infer(hailo_configured_network_group configured_ne
 
 /** @} */ // end of group_vstream_functions
 
+/** @defgroup group_infer_model_functions Async inference functions
+ *  @{
+ */
+
+/**
+ * Creates an infer model from a HEF file, to be configured on @a vdevice.
+ *
+ * @param[in]  vdevice          A ::hailo_vdevice object the model will be configured on.
+ * @param[in]  hef_path         Path of the HEF file. The HEF must contain a single network group.
+ * @param[out] infer_model      A pointer to a ::hailo_infer_model that receives the allocated infer model.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note To release an infer model, call the ::hailo_release_infer_model function with the returned ::hailo_infer_model.
+ */
+HAILORTAPI hailo_status hailo_create_infer_model(hailo_vdevice vdevice, const char *hef_path,
+    hailo_infer_model *infer_model);
+
+/**
+ * Gets the names of the model's inputs.
+ *
+ * @param[in]  infer_model      A ::hailo_infer_model object.
+ * @param[out] names            Array of names. The strings are owned by @a infer_model.
+ * @param[inout] names_count    As input - the size of @a names array. As output - the number of inputs.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_infer_model_get_input_names(hailo_infer_model infer_model, const char **names,
+    size_t *names_count);
+
+/**
+ * Gets the names of the model's outputs.
+ *
+ * @param[in]  infer_model      A ::hailo_infer_model object.
+ * @param[out] names            Array of names. The strings are owned by @a infer_model.
+ * @param[inout] names_count    As input - the size of @a names array. As output - the number of outputs.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_infer_model_get_output_names(hailo_infer_model infer_model, const char **names,
+    size_t *names_count);
+
+/**
+ * Sets the user buffer format of a model's input.
+ *
+ * @param[in] infer_model       A ::hailo_infer_model object.
+ * @param[in] name              The input's name.
+ * @param[in] type              The format type of the user buffer.
+ * @param[in] order             The format order of the user buffer.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Must be called before ::hailo_infer_model_configure.
+ */
+HAILORTAPI hailo_status hailo_infer_model_set_input_format(hailo_infer_model infer_model, const char *name,
+    hailo_format_type_t type, hailo_format_order_t order);
+
+/**
+ * Sets the user buffer format of a model's output.
+ *
+ * @param[in] infer_model       A ::hailo_infer_model object.
+ * @param[in] name              The output's name.
+ * @param[in] type              The format type of the user buffer.
+ * @param[in] order             The format order of the user buffer.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Must be called before ::hailo_infer_model_configure.
+ */
+HAILORTAPI hailo_status hailo_infer_model_set_output_format(hailo_infer_model infer_model, const char *name,
+    hailo_format_type_t type, hailo_format_order_t order);
+
+/**
+ * Sets the host image pre-process of a model's input - the input buffers are then source images, as described by
+ * @a params, which are converted to the network's input (see ::hailo_image_preprocess_params_t).
+ *
+ * @param[in] infer_model       A ::hailo_infer_model object.
+ * @param[in] name              The input's name.
+ * @param[in] params            The source images parameters. ::HAILO_IMAGE_COLOR_FORMAT_NONE disables the pre-process.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Must be called before ::hailo_infer_model_configure.
+ */
+HAILORTAPI hailo_status hailo_infer_model_set_input_image_preprocess(hailo_infer_model infer_model, const char *name,
+    const hailo_image_preprocess_params_t *params);
+
+/**
+ * Gets the size in bytes of a single frame of a model's input, according to the user buffer format.
+ *
+ * @param[in]  infer_model      A ::hailo_infer_model object.
+ * @param[in]  name             The input's name.
+ * @param[out] frame_size       The frame size.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_infer_model_get_input_frame_size(hailo_infer_model infer_model, const char *name,
+    size_t *frame_size);
+
+/**
+ * Gets the size in bytes of a single frame of a model's output, according to the user buffer format.
+ *
+ * @param[in]  infer_model      A ::hailo_infer_model object.
+ * @param[in]  name             The output's name.
+ * @param[out] frame_size       The frame size.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_infer_model_get_output_frame_size(hailo_infer_model infer_model, const char *name,
+    size_t *frame_size);
+
+/**
+ * Sets the batch size the model will be configured with.
+ *
+ * @param[in] infer_model       A ::hailo_infer_model object.
+ * @param[in] batch_size        The batch size. ::HAILO_DEFAULT_BATCH_SIZE means automatic batch size.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Must be called before ::hailo_infer_model_configure.
+ */
+HAILORTAPI hailo_status hailo_infer_model_set_batch_size(hailo_infer_model infer_model, uint16_t batch_size);
+
+/**
+ * Configures the model on the vdevice it was created with.
+ *
+ * @param[in]  infer_model              A ::hailo_infer_model object.
+ * @param[out] configured_infer_model   A pointer to a ::hailo_configured_infer_model that receives the configured
+ *                                      infer model.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note To release a configured infer model, call the ::hailo_release_configured_infer_model function with the
+ *       returned ::hailo_configured_infer_model.
+ */
+HAILORTAPI hailo_status hailo_infer_model_configure(hailo_infer_model infer_model,
+    hailo_configured_infer_model *configured_infer_model);
+
+/**
+ * Releases an infer model.
+ *
+ * @param[in] infer_model       A ::hailo_infer_model object to be released.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Configured infer models created from @a infer_model remain valid after it is released.
+ */
+HAILORTAPI hailo_status hailo_release_infer_model(hailo_infer_model infer_model);
+
+/**
+ * Activates a configured infer model.
+ *
+ * @param[in] configured_infer_model    A ::hailo_configured_infer_model object.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Should be called only when the model scheduler is disabled (::HAILO_SCHEDULING_ALGORITHM_NONE).
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_activate(hailo_configured_infer_model configured_infer_model);
+
+/**
+ * Deactivates a configured infer model activated by ::hailo_configured_infer_model_activate.
+ *
+ * @param[in] configured_infer_model    A ::hailo_configured_infer_model object.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_deactivate(hailo_configured_infer_model configured_infer_model);
+
+/**
+ * Creates bindings for a configured infer model. Bindings hold the user buffers of a single inference request.
+ *
+ * @param[in]  configured_infer_model   A ::hailo_configured_infer_model object.
+ * @param[out] bindings                 A pointer to a ::hailo_configured_infer_model_bindings that receives the
+ *                                      allocated bindings.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note To release the bindings, call the ::hailo_release_configured_infer_model_bindings function with the returned
+ *       ::hailo_configured_infer_model_bindings.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_create_bindings(hailo_configured_infer_model configured_infer_model,
+    hailo_configured_infer_model_bindings *bindings);
+
+/**
+ * Binds a user buffer to an input. The buffer is not copied - it must remain valid and unchanged until the
+ * completion callback of every inference request launched with @a bindings is called.
+ *
+ * @param[in] bindings      A ::hailo_configured_infer_model_bindings object.
+ * @param[in] name          The input's name.
+ * @param[in] buffer        The input buffer. For best performance, the buffer should be aligned to the system page
+ *                          size (or allocated by ::hailo_allocate_buffer).
+ * @param[in] size          The size of @a buffer, expected to be the result of ::hailo_infer_model_get_input_frame_size.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_bindings_set_input_buffer(hailo_configured_infer_model_bindings bindings,
+    const char *name, const void *buffer, size_t size);
+
+/**
+ * Binds a user buffer to an output. The buffer is not copied - the results are written directly to it, and it must
+ * remain valid until the completion callback of every inference request launched with @a bindings is called.
+ *
+ * @param[in] bindings      A ::hailo_configured_infer_model_bindings object.
+ * @param[in] name          The output's name.
+ * @param[in] buffer        The output buffer. For best performance, the buffer should be aligned to the system page
+ *                          size (or allocated by ::hailo_allocate_buffer).
+ * @param[in] size          The size of @a buffer, expected to be the result of ::hailo_infer_model_get_output_frame_size.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_bindings_set_output_buffer(hailo_configured_infer_model_bindings bindings,
+    const char *name, void *buffer, size_t size);
+
+/**
+ * Releases bindings created by ::hailo_configured_infer_model_create_bindings.
+ *
+ * @param[in] bindings      A ::hailo_configured_infer_model_bindings object to be released.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note The bindings must not be released while an inference request launched with them is ongoing.
+ */
+HAILORTAPI hailo_status hailo_release_configured_infer_model_bindings(hailo_configured_infer_model_bindings bindings);
+
+/**
+ * Waits until the configured infer model is ready to launch a new ::hailo_configured_infer_model_run_async request.
+ *
+ * @param[in] configured_infer_model    A ::hailo_configured_infer_model object.
+ * @param[in] timeout_ms                Amount of time to wait until the model is ready in milliseconds.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise:
+ *           - If @a timeout_ms has passed and the model is not ready, returns ::HAILO_TIMEOUT.
+ *           - In any other error case, returns ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_wait_for_async_ready(hailo_configured_infer_model configured_infer_model,
+    uint32_t timeout_ms);
+
+/**
+ * Launches an async inference request on the buffers bound to @a bindings.
+ * - If the function call succeeds, the request has been launched. @a user_callback is called once the inference of
+ *   all of the inputs and outputs is done or has failed.
+ * - If the function call fails, the request will not be launched and @a user_callback will not be invoked.
+ *
+ * @param[in]  configured_infer_model   A ::hailo_configured_infer_model object.
+ * @param[in]  bindings                 A ::hailo_configured_infer_model_bindings object holding the user buffers.
+ * @param[in]  user_callback            The callback that will be called when the request is complete or has failed.
+ * @param[in]  opaque                   Optional pointer to user-defined context (may be NULL if not desired).
+ * @param[out] job                      Optional pointer to a ::hailo_async_infer_job that receives the launched request
+ *                                      (may be NULL if not desired).
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ *
+ * @note @a user_callback should run as quickly as possible.
+ * @note Call ::hailo_configured_infer_model_wait_for_async_ready before launching a request, to make sure the
+ *       model's queues have room for it.
+ * @note To release the job, call the ::hailo_release_async_infer_job function with the returned ::hailo_async_infer_job.
+ */
+HAILORTAPI hailo_status hailo_configured_infer_model_run_async(hailo_configured_infer_model configured_infer_model,
+    hailo_configured_infer_model_bindings bindings, hailo_infer_model_async_callback_t user_callback, void *opaque,
+    hailo_async_infer_job *job);
+
+/**
+ * Releases a configured infer model.
+ *
+ * @param[in] configured_infer_model    A ::hailo_configured_infer_model object to be released.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note All of the inference requests launched on @a configured_infer_model must be done before it is released.
+ */
+HAILORTAPI hailo_status hailo_release_configured_infer_model(hailo_configured_infer_model configured_infer_model);
+
+/**
+ * Waits until an async inference request is done.
+ *
+ * @param[in] job           A ::hailo_async_infer_job object.
+ * @param[in] timeout_ms    Amount of time to wait until the request is done in milliseconds.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise:
+ *           - If @a timeout_ms has passed and the request is not done, returns ::HAILO_TIMEOUT.
+ *           - In any other error case, returns ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_async_infer_job_wait(hailo_async_infer_job job, uint32_t timeout_ms);
+
+/**
+ * Releases an async inference job.
+ *
+ * @param[in] job           A ::hailo_async_infer_job object to be released.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ * @note Releasing the job doesn't wait for the request, nor cancel it - the completion callback will still be called.
+ */
+HAILORTAPI hailo_status hailo_release_async_infer_job(hailo_async_infer_job job);
+
+/** @} */ // end of group_infer_model_functions
+
 /** @defgroup multi_network_functions multi network functions
  *  @{
  */
@@ -29,6 +29,7 @@
 #include "hailo/runtime_statistics.hpp"
 #include "hailo/network_rate_calculator.hpp"
 #include "hailo/quantization.hpp"
+#include "hailo/float16.hpp"
 #include "hailo/hailort_defaults.hpp"
 
 #endif /* _HAILORT_HPP_ */
@@ -35,6 +35,9 @@ public:
         "Mismatch bbox params size");
     static const uint32_t BBOX_PARAMS = sizeof(hailo_bbox_t) / sizeof(uint16_t);
     static const uint32_t MASK_PARAMS = 1; // mask_size
+    static_assert(sizeof(hailo_detection_t) % sizeof(float32_t) == 0, "Detection size must be a multiple of float32_t");
+    static const uint32_t DETECTION_PARAMS = sizeof(hailo_detection_t) / sizeof(float32_t);
+    static const uint32_t DETECTIONS_MASK_ALIGNMENT = 8;
     static const uint32_t MAX_DEFUSED_LAYER_COUNT = 9;
     static const size_t HW_DATA_ALIGNMENT = 8;
     static const uint32_t MUX_INFO_COUNT = 32;
@@ -111,7 +114,8 @@ public:
     {
         if (type == HAILO_FORMAT_TYPE_FLOAT32) {
             return 4;
-        } else if (type == HAILO_FORMAT_TYPE_UINT16) {
+        } else if ((type == HAILO_FORMAT_TYPE_UINT16) || (type == HAILO_FORMAT_TYPE_FLOAT16) ||
+            (type == HAILO_FORMAT_TYPE_BFLOAT16)) {
             return 2;
         } else if (type == HAILO_FORMAT_TYPE_UINT8) {
             return 1;
@@ -120,6 +124,19 @@ public:
         return 1;
     }
 
+    /**
+     * Indicates whether the given format type is a floating point type. Floating point types are host only types -
+     * the data is quantized before it is sent to the device, and de-quantized after it is received from the device.
+     *
+     * @param[in] type             A ::hailo_format_type_t object.
+     * @return true if @a type is a floating point type, false otherwise.
+     */
+    static constexpr bool is_float_type(hailo_format_type_t type)
+    {
+        return (type == HAILO_FORMAT_TYPE_FLOAT32) || (type == HAILO_FORMAT_TYPE_FLOAT16) ||
+            (type == HAILO_FORMAT_TYPE_BFLOAT16);
+    }
+
     /**
      * Gets the format type of a stream by the hw data bytes parameter.
      *
@@ -155,6 +172,10 @@ public:
             return "UINT16";
         case HAILO_FORMAT_TYPE_FLOAT32:
             return "FLOAT32";
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return "FLOAT16";
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            return "BFLOAT16";
         case HAILO_FORMAT_TYPE_AUTO:
             return "AUTO";
         default:
@@ -237,6 +258,10 @@ public:
             return "YYYYUV";
         case HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK:
             return "HAILO NMS WITH METADATA";
+        case HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS:
+            return "HAILO NMS DETECTIONS";
+        case HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK:
+            return "HAILO NMS DETECTIONS WITH BYTE MASK";
         default:
             return "Nan";
         }
@@ -294,6 +319,69 @@ public:
         }
     }
 
+    /**
+     * Gets the maximum amount of detections in a ::HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS or
+     * ::HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK frame.
+     *
+     * @param[in] nms_shape             The NMS shape to get the maximum amount of detections from.
+     * @return The maximum amount of detections.
+     */
+    static constexpr uint32_t get_nms_max_detections(const hailo_nms_shape_t &nms_shape)
+    {
+        return nms_shape.number_of_classes * nms_shape.max_bboxes_per_class;
+    }
+
+    /**
+     * Gets HAILO_NMS_DETECTIONS host shape size (number of elements) by nms_shape and buffer format.
+     *
+     * @param[in] nms_shape             The NMS shape to get size from.
+     * @param[in] format                A ::hailo_format_t object.
+     * @return The HAILO_NMS_DETECTIONS host shape size.
+     */
+    static constexpr uint32_t get_nms_detections_host_shape_size(const hailo_nms_shape_t &nms_shape, const hailo_format_t &format)
+    {
+        // detections_count + detections
+        double shape_size = 1 + (static_cast<double>(DETECTION_PARAMS) * get_nms_max_detections(nms_shape));
+        if ((shape_size * get_format_data_bytes(format)) < UINT32_MAX) {
+            return static_cast<uint32_t>(shape_size);
+        } else {
+            return UINT32_MAX / get_format_data_bytes(format);
+        }
+    }
+
+    /**
+     * Gets HAILO_NMS_DETECTIONS_WITH_BYTE_MASK host shape size (number of elements) by nms_shape and buffer format.
+     *
+     * @param[in] nms_shape             The NMS shape to get size from.
+     * @param[in] format                A ::hailo_format_t object.
+     * @return The HAILO_NMS_DETECTIONS_WITH_BYTE_MASK host shape size.
+     */
+    static constexpr uint32_t get_nms_detections_with_byte_mask_host_shape_size(const hailo_nms_shape_t &nms_shape,
+        const hailo_format_t &format)
+    {
+        // The mask is 1 byte per pixel, padded to DETECTIONS_MASK_ALIGNMENT
+        const uint32_t mask_params = align_to(nms_shape.max_mask_size, DETECTIONS_MASK_ALIGNMENT) /
+            static_cast<uint32_t>(sizeof(float32_t));
+        const uint32_t detection_size = DETECTION_PARAMS + MASK_PARAMS + mask_params;
+        double shape_size = 1 + (static_cast<double>(detection_size) * get_nms_max_detections(nms_shape));
+        if ((shape_size * get_format_data_bytes(format)) < UINT32_MAX) {
+            return static_cast<uint32_t>(shape_size);
+        } else {
+            return UINT32_MAX / get_format_data_bytes(format);
+        }
+    }
+
+    /**
+     * Gets the amount of bytes used by the detections in a ::HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS or
+     * ::HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK frame (the rest of the frame is not written).
+     *
+     * @param[in] buffer                The frame.
+     * @param[in] buffer_size           The frame size in bytes.
+     * @param[in] order                 The frame format order.
+     * @return The amount of bytes used by the detections, or buffer_size for any other format order.
+     */
+    static size_t get_nms_detections_used_size(const uint8_t *buffer, size_t buffer_size, hailo_format_order_t order);
+
     /**
      * Gets NMS hw frame size in bytes by nms info.
      *
@@ -369,6 +457,56 @@ public:
         }
     }
 
+    /**
+     * Gets the row stride in bytes of the first plane of a source image of the host image pre-process.
+     *
+     * @param[in] params         A ::hailo_image_preprocess_params_t object.
+     * @return The row stride in bytes, or 0 if @a params has no (or invalid) color format.
+     */
+    static constexpr uint32_t get_image_row_stride(const hailo_image_preprocess_params_t &params)
+    {
+        if (0 != params.row_stride) {
+            return params.row_stride;
+        }
+        switch (params.color_format) {
+        case HAILO_IMAGE_COLOR_FORMAT_RGB:
+        case HAILO_IMAGE_COLOR_FORMAT_BGR:
+            return params.width * 3;
+        case HAILO_IMAGE_COLOR_FORMAT_YUY2:
+            return params.width * 2;
+        case HAILO_IMAGE_COLOR_FORMAT_NV12:
+        case HAILO_IMAGE_COLOR_FORMAT_I420:
+            return params.width;
+        default:
+            return 0;
+        }
+    }
+
+    /**
+     * Gets the size in bytes of a source image of the host image pre-process - the size of the input buffers of an
+     * input with an image pre-process set.
+     *
+     * @param[in] params         A ::hailo_image_preprocess_params_t object.
+     * @return The image's size in bytes, or 0 if @a params has no (or invalid) color format.
+     */
+    static constexpr uint32_t get_image_frame_size(const hailo_image_preprocess_params_t &params)
+    {
+        const uint32_t row_stride = get_image_row_stride(params);
+        const uint32_t chroma_height = (params.height + 1) / 2;
+        switch (params.color_format) {
+        case HAILO_IMAGE_COLOR_FORMAT_RGB:
+        case HAILO_IMAGE_COLOR_FORMAT_BGR:
+        case HAILO_IMAGE_COLOR_FORMAT_YUY2:
+            return row_stride * params.height;
+        case HAILO_IMAGE_COLOR_FORMAT_NV12:
+            return (row_stride * params.height) + (row_stride * chroma_height);
+        case HAILO_IMAGE_COLOR_FORMAT_I420:
+            return (row_stride * params.height) + (2 * ((row_stride + 1) / 2) * chroma_height);
+        default:
+            return 0;
+        }
+    }
+
     static constexpr bool is_vdma_stream_interface(hailo_stream_interface_t stream_interface)
     {
         return (HAILO_STREAM_INTERFACE_PCIE == stream_interface) || (HAILO_STREAM_INTERFACE_INTEGRATED == stream_interface);
@@ -386,7 +524,14 @@ public:
 
     static constexpr bool is_nms(const hailo_format_order_t &order)
     {
-        return ((HAILO_FORMAT_ORDER_HAILO_NMS == order) || (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == order));
+        return ((HAILO_FORMAT_ORDER_HAILO_NMS == order) || (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == order) ||
+            is_nms_detections(order));
+    }
+
+    static constexpr bool is_nms_detections(const hailo_format_order_t &order)
+    {
+        return ((HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS == order) ||
+            (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK == order));
     }
 
     static Expected<hailo_device_id_t> to_device_id(const std::string &device_id);
@@ -42,7 +42,7 @@ private:
     class Impl;
     AsyncInferJob(std::shared_ptr<Impl> pimpl);
     std::shared_ptr<Impl> m_pimpl;
-    bool m_should_wait_in_dtor;
+    bool m_should_wait_in_dtor = false;
 };
 
 struct CompletionInfoAsyncInfer;
@@ -88,6 +88,10 @@ public:
     hailo_status run(Bindings bindings, std::chrono::milliseconds timeout);
     Expected<AsyncInferJob> run_async(Bindings bindings,
         std::function<void(const CompletionInfoAsyncInfer &)> callback = [] (const CompletionInfoAsyncInfer &) {});
+    Expected<LatencyMeasurementResult> get_hw_latency_measurement(const std::string &network_name = "");
+    hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout);
+    hailo_status set_scheduler_threshold(uint32_t threshold);
+    hailo_status set_scheduler_priority(uint8_t priority);
 
 private:
     friend class InferModel;
@@ -120,6 +124,13 @@ public:
         void set_format_type(hailo_format_type_t type);
         void set_format_order(hailo_format_order_t order);
 
+        /**
+         * Sets the host image pre-process of an input stream - the buffers set to the stream are then source images,
+         * as described by @a params, which are converted to the network's input (see ::hailo_image_preprocess_params_t).
+         * Setting ::HAILO_IMAGE_COLOR_FORMAT_NONE disables the pre-process.
+         */
+        void set_image_preprocess(const hailo_image_preprocess_params_t &params);
+
     private:
         friend class InferModel;
         friend class VDeviceBase;
@@ -127,6 +138,7 @@ public:
         class Impl;
         InferStream(std::shared_ptr<Impl> pimpl);
         hailo_format_t get_user_buffer_format();
+        hailo_image_preprocess_params_t get_image_preprocess();
 
         std::shared_ptr<Impl> m_pimpl;
     };
@@ -140,6 +152,8 @@ public:
     const std::vector<InferStream> &outputs() const;
     const std::vector<std::string> &get_input_names() const;
     const std::vector<std::string> &get_output_names() const;
+    void set_batch_size(uint16_t batch_size);
+    void set_hw_latency_measurement_flags(hailo_latency_measurement_flags_t latency);
     
     InferModel(InferModel &&);
 
@@ -157,6 +171,8 @@ private:
     std::vector<InferStream> m_outputs_vector;
     std::vector<std::string> m_input_names;
     std::vector<std::string> m_output_names;
+    uint16_t m_batch_size;
+    hailo_latency_measurement_flags_t m_latency_flags;
 };
 
 } /* namespace hailort */
@@ -17,6 +17,8 @@
 namespace hailort
 {
 
+class InferVStreamsWorkers;
+
 /*! Pipeline used to run inference */
 // TODO: HRT-3157 - Fix doc after multi-network support.
 class HAILORTAPI InferVStreams final
@@ -56,6 +58,33 @@ public:
     hailo_status infer(const std::map<std::string, MemoryView>& input_data,
                        std::map<std::string, MemoryView>& output_data, size_t frames_count);
 
+    /**
+     * Launches inference on dataset @a input_data, without waiting for it to finish. The inference is done by
+     * persistent worker threads (one per vstream), that are reused across calls.
+     * Consecutive requests are queued and run back-to-back, so the user can prepare the next dataset while the
+     * previous one is inferred (double buffering). Each launched request must be waited for using
+     * InferVStreams::wait_for_async_infer().
+     *
+     * @param[in] input_data                    A mapping of vstream name to MemoryView containing input dataset for inference.
+     * @param[in] output_data                   A mapping of vstream name to MemoryView the inference output data will be
+     *                                          written to.
+     * @param[in] frames_count                  The amount of inferred frames.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note The buffers pointed by @a input_data and @a output_data must remain valid until the matching
+     *       InferVStreams::wait_for_async_infer() call returns.
+     * @note Same requirements as InferVStreams::infer() apply.
+     */
+    hailo_status infer_async(const std::map<std::string, MemoryView>& input_data,
+                             const std::map<std::string, MemoryView>& output_data, size_t frames_count);
+
+    /**
+     * Waits for the oldest request launched by InferVStreams::infer_async() to finish.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns the ::hailo_status error of the request.
+     */
+    hailo_status wait_for_async_infer();
+
     /**
      * Get InputVStream by name.
      *
@@ -110,18 +139,11 @@ public:
      */
     hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class);
 
+    ~InferVStreams();
     InferVStreams(const InferVStreams &other) = delete;
     InferVStreams &operator=(const InferVStreams &other) = delete;
     InferVStreams &operator=(InferVStreams &&other) = delete;
-    InferVStreams(InferVStreams &&other) :
-        m_inputs(std::move(other.m_inputs)),
-        m_outputs(std::move(other.m_outputs)),
-        m_is_multi_context(std::move(other.m_is_multi_context)),
-        m_is_scheduled(std::move(other.m_is_scheduled)),
-        m_network_name_to_input_count(std::move(other.m_network_name_to_input_count)),
-        m_network_name_to_output_count(std::move(other.m_network_name_to_output_count)),
-        m_batch_size(std::move(other.m_batch_size))
-        {};
+    InferVStreams(InferVStreams &&other);
 private:
     InferVStreams(std::vector<InputVStream> &&inputs, std::vector<OutputVStream> &&outputs, bool is_multi_context,
         bool is_scheduled, uint16_t batch_size);
@@ -139,6 +161,8 @@ private:
     std::map<std::string, size_t> m_network_name_to_input_count;
     std::map<std::string, size_t> m_network_name_to_output_count;
     uint16_t m_batch_size;
+    // Declared last, so the workers will be stopped before the vstreams are destroyed
+    std::unique_ptr<InferVStreamsWorkers> m_workers;
 };
 
 } /* namespace hailort */
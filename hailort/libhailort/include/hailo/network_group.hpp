@@ -393,6 +393,8 @@ public:
     virtual AccumulatorPtr get_deactivation_time_accumulator() const = 0;
 
     virtual Expected<std::vector<InputVStream>> create_input_vstreams(const std::map<std::string, hailo_vstream_params_t> &inputs_params) = 0;
+    virtual Expected<std::vector<InputVStream>> create_input_vstreams(const std::map<std::string, hailo_vstream_params_t> &inputs_params,
+        const std::map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params) = 0;
     virtual Expected<std::vector<OutputVStream>> create_output_vstreams(const std::map<std::string, hailo_vstream_params_t> &outputs_params) = 0;
 
     virtual Expected<HwInferResults> run_hw_infer_estimator() = 0;
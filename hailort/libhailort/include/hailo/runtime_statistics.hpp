@@ -26,14 +26,20 @@ class AccumulatorResults final
 public:
     AccumulatorResults(const Expected<size_t> &count, const Expected<double> &min, const Expected<double> &max,
                        const Expected<double> &mean, const Expected<double> &var, const Expected<double> &sd,
-                       const Expected<double> &mean_sd) :
+                       const Expected<double> &mean_sd,
+                       const Expected<double> &p50 = make_unexpected(HAILO_NOT_SUPPORTED),
+                       const Expected<double> &p99 = make_unexpected(HAILO_NOT_SUPPORTED),
+                       const Expected<double> &p99_9 = make_unexpected(HAILO_NOT_SUPPORTED)) :
         m_count(count),
         m_min(min),
         m_max(max),
         m_mean(mean),
         m_var(var),
         m_sd(sd),
-        m_mean_sd(mean_sd)
+        m_mean_sd(mean_sd),
+        m_p50(p50),
+        m_p99(p99),
+        m_p99_9(p99_9)
     {}
 
     AccumulatorResults(AccumulatorResults &&) = default;
@@ -83,6 +89,27 @@ public:
      */
     Expected<double> mean_sd() const { return m_mean_sd; }
 
+    /**
+     * @return Returns Expected of the median (50th percentile) of the values added to the Accumulator,
+     *         Unexpected of ::HAILO_UNINITIALIZED if no data has been added,
+     *         or Unexpected of ::HAILO_NOT_SUPPORTED if the Accumulator doesn't track percentiles.
+     */
+    Expected<double> p50() const { return m_p50; }
+
+    /**
+     * @return Returns Expected of the 99th percentile of the values added to the Accumulator,
+     *         Unexpected of ::HAILO_UNINITIALIZED if no data has been added,
+     *         or Unexpected of ::HAILO_NOT_SUPPORTED if the Accumulator doesn't track percentiles.
+     */
+    Expected<double> p99() const { return m_p99; }
+
+    /**
+     * @return Returns Expected of the 99.9th percentile of the values added to the Accumulator,
+     *         Unexpected of ::HAILO_UNINITIALIZED if no data has been added,
+     *         or Unexpected of ::HAILO_NOT_SUPPORTED if the Accumulator doesn't track percentiles.
+     */
+    Expected<double> p99_9() const { return m_p99_9; }
+
 private:
     const Expected<size_t> m_count;
     const Expected<double> m_min;
@@ -91,6 +118,9 @@ private:
     const Expected<double> m_var;
     const Expected<double> m_sd;
     const Expected<double> m_mean_sd;
+    const Expected<double> m_p50;
+    const Expected<double> m_p99;
+    const Expected<double> m_p99_9;
 };
 
 /*! The Accumulator interface supports the measurement of various statistics incrementally. I.e. upon each addition of
@@ -185,6 +215,18 @@ public:
      */
     virtual Expected<double> mean_sd() const = 0;
 
+    /**
+     * @param[in] percentile        The requested percentile, in the range [0, 100].
+     * @return Returns Expected of the @a percentile percentile of the values added to the Accumulator,
+     *         Unexpected of ::HAILO_UNINITIALIZED if no data has been added,
+     *         or Unexpected of ::HAILO_NOT_SUPPORTED if the Accumulator doesn't track percentiles.
+     * @note Percentiles are tracked only by accumulators created with the flag ::HAILO_PIPELINE_ELEM_STATS_MEASURE_PERCENTILES.
+     */
+    virtual Expected<double> percentile(double /*percentile*/) const
+    {
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+    }
+
 private:
     const std::string m_data_type;
 };
@@ -18,6 +18,7 @@
 #include <chrono>
 #include <atomic>
 #include <functional>
+#include <vector>
 
 
 /** hailort namespace */
@@ -424,6 +425,36 @@ public:
      */
     virtual Expected<size_t> get_async_max_queue_size() const;
 
+    /**
+     * Registers a ring of buffers that will be passed to read_async() in order (buffers[0], buffers[1], ...,
+     * buffers[0], ...). The buffers are mapped to the device and bound to the stream descriptors ahead of time, so
+     * reading into them doesn't need to map or bind them on each frame.
+     * Reading into other buffers (or out of order) is still allowed, but loses the benefit of the registration.
+     *
+     * @param[in] buffers       The buffers of the ring. Each buffer must be get_frame_size() bytes, and aligned to
+     *                          the system page size. The buffers must stay valid until the stream is released, a
+     *                          new ring is registered or the ring is unregistered (see unregister_buffers_ring()).
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise:
+     *         - If the number of buffers doesn't divide the number of frames that fill the stream descriptors
+     *           (usually get_async_max_queue_size() + 1), returns ::HAILO_INVALID_ARGUMENT.
+     *         - If there are ongoing reads on the stream, returns ::HAILO_INVALID_OPERATION.
+     *         - In any other error case, returns a ::hailo_status error.
+     * @note Must be called before the first read_async() call, or when no read is ongoing.
+     */
+    virtual hailo_status register_buffers_ring(const std::vector<MemoryView> &buffers);
+
+    /**
+     * Unregisters the ring registered by register_buffers_ring(), releasing the mappings of its buffers. Must be
+     * called before the buffers of the ring are freed (or reused for other memory), if the stream is still used.
+     *
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise:
+     *         - If there are ongoing reads on the stream, returns ::HAILO_INVALID_OPERATION.
+     *         - In any other error case, returns a ::hailo_status error.
+     * @note Must be called when no read is ongoing.
+     */
+    virtual hailo_status unregister_buffers_ring();
+
     /**
      * Reads into @a buffer from the stream asynchronously, initiating a deferred operation that will be completed
      * later.
@@ -173,6 +173,8 @@ private:
         MemoryView transpose_buffer);
 
     hailo_status quantize_stream(const void *src_ptr, void *quant_buffer);
+    template <typename T>
+    hailo_status quantize_float_stream(T *src_ptr, void *quant_buffer, uint32_t shape_size);
 
     const size_t m_src_frame_size;
     const hailo_3d_image_shape_t m_src_image_shape;
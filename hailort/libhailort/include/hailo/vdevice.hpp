@@ -111,6 +111,18 @@ public:
      */
     Expected<ConfigureNetworkParams> create_configure_params(Hef &hef, const std::string &network_group_name) const;
 
+    /**
+     * Releases the cached dma mappings of user buffers overlapping [address, address + size), on all the underlying
+     * physical devices. See Device::invalidate_dma_mapping_cache.
+     *
+     * @param[in] address   The address of the buffer.
+     * @param[in] size      The size of the buffer.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note Not supported when working with the HailoRT service (multi-process), where user buffers are never mapped
+     *       on the client side - ::HAILO_NOT_SUPPORTED is returned.
+     */
+    virtual hailo_status invalidate_dma_mapping_cache(void *address, size_t size);
+
     virtual hailo_status before_fork();
     virtual hailo_status after_fork_in_parent();
     virtual hailo_status after_fork_in_child();
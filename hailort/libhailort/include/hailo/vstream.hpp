@@ -163,6 +163,8 @@ public:
      * @return A shared pointer to the vstream's latency accumulator.
      * @note A pipeline-wide latency accumulator is created for the vstream, if the vstream is created with the flag
      *       ::HAILO_VSTREAM_STATS_MEASURE_LATENCY set under the @a vstream_stats_flags field of ::hailo_vstream_params_t.
+     * @note If ::HAILO_PIPELINE_ELEM_STATS_MEASURE_PERCENTILES is set under the @a pipeline_elements_stats_flags field of
+     *       ::hailo_vstream_params_t, the latency and queue size accumulators track percentiles as well (see Accumulator::percentile).
      */
     AccumulatorPtr get_pipeline_latency_accumulator() const;
     
@@ -320,6 +322,8 @@ public:
      * @return A shared pointer to the vstream's latency accumulator.
      * @note A pipeline-wide latency accumulator is created for the vstream, if the vstream is created with the flag
      *       ::HAILO_VSTREAM_STATS_MEASURE_LATENCY set under the @a vstream_stats_flags field of ::hailo_vstream_params_t.
+     * @note If ::HAILO_PIPELINE_ELEM_STATS_MEASURE_PERCENTILES is set under the @a pipeline_elements_stats_flags field of
+     *       ::hailo_vstream_params_t, the latency and queue size accumulators track percentiles as well (see Accumulator::percentile).
      */
     AccumulatorPtr get_pipeline_latency_accumulator() const;
     
@@ -433,6 +437,22 @@ public:
     static Expected<std::vector<InputVStream>> create_input_vstreams(ConfiguredNetworkGroup &net_group,
         const std::map<std::string, hailo_vstream_params_t> &inputs_params);
 
+    /**
+     * Creates input virtual streams, with a host image pre-process on some of them - the buffers written to these
+     * vstreams are source images, as described by their ::hailo_image_preprocess_params_t, which are converted to the
+     * network's input.
+     *
+     * @param[in] net_group                   Configured network group that owns the streams.
+     * @param[in] inputs_params               Map of input vstreams <name, params> to create input vstreams from.
+     * @param[in] inputs_preprocess_params    Map of input vstreams <name, image pre-process params>. Input vstreams
+     *                                        that aren't in the map are created without a pre-process.
+     * @return Upon success, returns Expected of a vector of input virtual streams.
+     *         Otherwise, returns Unexpected of ::hailo_status error.
+     */
+    static Expected<std::vector<InputVStream>> create_input_vstreams(ConfiguredNetworkGroup &net_group,
+        const std::map<std::string, hailo_vstream_params_t> &inputs_params,
+        const std::map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params);
+
     /**
      * Creates output virtual streams.
      *
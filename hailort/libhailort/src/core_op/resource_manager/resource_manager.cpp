@@ -263,6 +263,7 @@ ResourcesManager::ResourcesManager(VdmaDevice &vdma_device, HailoRTDriver &drive
     m_channel_allocator(std::move(channel_allocator)),
     m_vdma_device(vdma_device),
     m_driver(driver),
+    m_trace_dev_id(TraceStrings::get_id(vdma_device.get_dev_id())),
     m_config_params(config_params),
     m_intermediate_buffers(),
     m_core_op_metadata(std::move(core_op_metadata)),
@@ -282,6 +283,7 @@ ResourcesManager::ResourcesManager(ResourcesManager &&other) noexcept :
     m_channel_allocator(std::move(other.m_channel_allocator)),
     m_vdma_device(other.m_vdma_device),
     m_driver(other.m_driver),
+    m_trace_dev_id(other.m_trace_dev_id),
     m_config_params(other.m_config_params),
     m_intermediate_buffers(std::move(other.m_intermediate_buffers)),
     m_core_op_metadata(std::move(other.m_core_op_metadata)),
@@ -644,7 +646,7 @@ hailo_status ResourcesManager::cancel_pending_transfers()
     return HAILO_SUCCESS;
 }
 
-hailo_status ResourcesManager::start_vdma_interrupts_dispatcher()
+hailo_status ResourcesManager::start_vdma_interrupts_dispatcher(bool is_running)
 {
     auto interrupts_dispatcher = m_vdma_device.get_vdma_interrupts_dispatcher();
     CHECK_EXPECTED_AS_STATUS(interrupts_dispatcher);
@@ -656,9 +658,13 @@ hailo_status ResourcesManager::start_vdma_interrupts_dispatcher()
     }
 
     const bool enable_timestamp_measure = !m_latency_meters.empty();
-    return interrupts_dispatcher->get().start(channels_bitmap, enable_timestamp_measure, [this](IrqData &&irq_data){
+    auto process_irq = [this](IrqData &&irq_data) {
         process_interrupts(std::move(irq_data));
-    });
+    };
+    if (is_running) {
+        return interrupts_dispatcher->get().switch_context(channels_bitmap, enable_timestamp_measure, process_irq);
+    }
+    return interrupts_dispatcher->get().start(channels_bitmap, enable_timestamp_measure, process_irq);
 }
 
 hailo_status ResourcesManager::stop_vdma_interrupts_dispatcher()
@@ -668,6 +674,13 @@ hailo_status ResourcesManager::stop_vdma_interrupts_dispatcher()
     return interrupts_dispatcher->get().stop();
 }
 
+Expected<bool> ResourcesManager::is_vdma_interrupts_dispatcher_running()
+{
+    auto interrupts_dispatcher = m_vdma_device.get_vdma_interrupts_dispatcher();
+    CHECK_EXPECTED(interrupts_dispatcher);
+    return interrupts_dispatcher->get().is_running();
+}
+
 Expected<uint16_t> ResourcesManager::program_desc_for_hw_only_flow(std::shared_ptr<vdma::DescriptorList> desc_list,
     const uint32_t single_transfer_size, const uint16_t dynamic_batch_size, const uint16_t batch_count)
 {
@@ -35,6 +35,7 @@
 #include "device_common/control_protocol.hpp"
 #include "vdma/channel/boundary_channel.hpp"
 #include "vdma/pcie/pcie_device.hpp"
+#include "utils/profiler/trace_strings.hpp"
 
 
 namespace hailort
@@ -171,6 +172,12 @@ public:
         return m_vdma_device.get_dev_id();
     }
 
+    // The interned device id, for the traces (see TraceStrings)
+    trace_string_id_t get_trace_dev_id() const
+    {
+        return m_trace_dev_id;
+    }
+
     LatencyMetersMap &get_latency_meters()
     {
         return m_latency_meters;
@@ -190,8 +197,11 @@ public:
         uint16_t batch_count = CONTROL_PROTOCOL__INIFINITE_BATCH_COUNT);
     hailo_status reset_state_machine();
     hailo_status cancel_pending_transfers();
-    hailo_status start_vdma_interrupts_dispatcher();
+    // When is_running (the dispatcher was kept running when switching from the previous core-op), the dispatcher
+    // switches to this core-op's channels without stopping (see InterruptsDispatcher::switch_context).
+    hailo_status start_vdma_interrupts_dispatcher(bool is_running = false);
     hailo_status stop_vdma_interrupts_dispatcher();
+    Expected<bool> is_vdma_interrupts_dispatcher_running();
     Expected<uint16_t> get_network_batch_size(const std::string &network_name) const;
     Expected<vdma::BoundaryChannelPtr> get_boundary_vdma_channel_by_stream_name(const std::string &stream_name);
     Expected<std::shared_ptr<const vdma::BoundaryChannel>> get_boundary_vdma_channel_by_stream_name(const std::string &stream_name) const;
@@ -221,6 +231,7 @@ private:
     ChannelAllocator m_channel_allocator;
     VdmaDevice &m_vdma_device;
     HailoRTDriver &m_driver;
+    const trace_string_id_t m_trace_dev_id;
     const ConfigureNetworkParams m_config_params;
     std::map<IntermediateBufferKey, IntermediateBuffer> m_intermediate_buffers;
     std::shared_ptr<CoreOpMetadata> m_core_op_metadata;
@@ -387,6 +387,14 @@ hailo_status Device::set_sleep_state(hailo_sleep_state_t sleep_state)
     return Control::set_sleep_state(*this, sleep_state);
 }
 
+hailo_status Device::invalidate_dma_mapping_cache(void *address, size_t size)
+{
+    // No dma mappings are cached by default
+    (void) address;
+    (void) size;
+    return HAILO_SUCCESS;
+}
+
 hailo_status Device::direct_write_memory(uint32_t address, const void *buffer, uint32_t size)
 {
     (void) address;
@@ -143,6 +143,25 @@ Expected<size_t> EthernetInputStream::sync_write_raw_buffer(const MemoryView &bu
     return size;
 }
 
+Expected<size_t> EthernetInputStream::sync_write_raw_buffer_batch(const MemoryView &buffer)
+{
+    hailo_status status = HAILO_UNINITIALIZED;
+
+    status = get_core_op_activated_event()->wait(std::chrono::milliseconds(0));
+    CHECK_AS_EXPECTED(HAILO_TIMEOUT != status, HAILO_NETWORK_GROUP_NOT_ACTIVATED, "Trying to write on stream before its network_group is activated");
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    size_t size = buffer.size();
+    status = m_udp.send_multiple(buffer.data(), &size, this->configuration.use_dataflow_padding, this->configuration.max_payload_size);
+    if (HAILO_STREAM_ABORTED_BY_USER == status) {
+        LOGGER__INFO("Udp send was aborted!");
+        return make_unexpected(status);
+    }
+    CHECK_SUCCESS_AS_EXPECTED(status, "{} (H2D) failed with status={}", name(), status);
+
+    return size;
+}
+
 hailo_status EthernetInputStream::write_impl(const MemoryView &buffer)
 {
     hailo_status status = HAILO_UNINITIALIZED;
@@ -190,9 +209,9 @@ hailo_status EthernetInputStream::eth_stream__write_with_remainder(const void *b
 
     while (offset < offset_end_without_remainder) {
         transfer_size = offset_end_without_remainder - offset;
-        auto expected_bytes_written = sync_write_raw_buffer(MemoryView::create_const(static_cast<const uint8_t*>(buffer) + offset, transfer_size));
+        auto expected_bytes_written = sync_write_raw_buffer_batch(MemoryView::create_const(static_cast<const uint8_t*>(buffer) + offset, transfer_size));
         if (HAILO_STREAM_ABORTED_BY_USER == expected_bytes_written.status()) {
-            LOGGER__INFO("sync_write_raw_buffer was aborted!");
+            LOGGER__INFO("sync_write_raw_buffer_batch was aborted!");
             return expected_bytes_written.status();
         }
         CHECK_EXPECTED_AS_STATUS(expected_bytes_written);
@@ -231,6 +250,7 @@ hailo_status TokenBucketEthernetInputStream::eth_stream__write_with_remainder(co
     assert(remainder_size <= MAX_CONSUME_SIZE);
     static_assert(MAX_CONSUME_SIZE <= BURST_SIZE, "We are asking to consume more bytes than the size of the token bucket, this will fail");
 
+    // Packets are sent one by one (not batched), so that each packet waits for its tokens
     while (offset < offset_end_without_remainder) {
         (void)token_bucket.consumeWithBorrowAndWait(MAX_CONSUME_SIZE, rate_bytes_per_sec, BURST_SIZE);
     
@@ -548,10 +568,16 @@ hailo_status EthernetOutputStream::read_all_with_sync(void *buffer, size_t offse
         this->leftover_size = 0;
     }
 
+    const size_t packet_size = get_max_packet_size();
     while (offset < offset_end) {
         size_t transfer_size = offset_end - offset;
         MemoryView buffer_view(static_cast<uint8_t*>(buffer) + offset, transfer_size);
-        auto expected_bytes_read = this->sync_read_raw_buffer(buffer_view);
+        // The batch is limited to the end of the current frame, and a packet that may be a sync packet is received
+        // alone - so the packets that follow the sync don't need to be moved to their place.
+        const size_t bytes_to_frame_end = frame_size - ((offset - initial_offset) % frame_size);
+        const size_t max_packets = is_sync_expected(offset, initial_offset, frame_size) ? 1 :
+            DIV_ROUND_UP(bytes_to_frame_end, packet_size);
+        auto expected_bytes_read = this->sync_read_raw_buffer(buffer_view, max_packets);
         status = expected_bytes_read.status();
         if (HAILO_TIMEOUT == status) {
             return handle_timeout(buffer, offset, initial_offset, frame_size);
@@ -578,6 +604,9 @@ hailo_status EthernetOutputStream::read_all_with_sync(void *buffer, size_t offse
             } else {
                 size_t number_of_missing_bytes = (frame_size - ((offset - initial_offset) % frame_size));
                 LOGGER__WARNING("Some bytes are missing at frame, padding {} bytes with zeros", number_of_missing_bytes);
+                // The rest of the batch may be placed in the padded area
+                status = stash_batch();
+                CHECK_SUCCESS(status);
                 memset((uint8_t*)buffer + offset, 0, number_of_missing_bytes);
                 offset += number_of_missing_bytes;
                 if (offset == offset_end) {
@@ -591,7 +620,9 @@ hailo_status EthernetOutputStream::read_all_with_sync(void *buffer, size_t offse
         }
     }
 
-    status = HAILO_SUCCESS;
+    // The last sync is read to the leftover buffer
+    status = stash_batch();
+    CHECK_SUCCESS(status);
 
     if (!got_last_sync_early) {
         status = get_last_sync();
@@ -621,6 +652,70 @@ hailo_status EthernetOutputStream::get_last_sync() {
     return HAILO_SUCCESS;
 }
 
+size_t EthernetOutputStream::get_max_packet_size() const
+{
+    return ((0 == this->configuration.max_payload_size) || (this->configuration.max_payload_size > MAX_UDP_PAYLOAD_SIZE)) ?
+        MAX_UDP_PAYLOAD_SIZE : this->configuration.max_payload_size;
+}
+
+hailo_status EthernetOutputStream::recv_batch(MemoryView &buffer, size_t max_packets)
+{
+    const size_t packet_size = get_max_packet_size();
+    const size_t max_batch_size = std::min(max_packets, m_batch.size());
+    size_t batch_size = 0;
+    size_t offset = 0;
+
+    while ((offset < buffer.size()) && (batch_size < max_batch_size)) {
+        if ((buffer.size() - offset) < packet_size) {
+            // A packet may be larger than what's left in the buffer, so it can't be received in place
+            m_batch[batch_size].data = m_batch_tail_buffer;
+            m_batch[batch_size].size = packet_size;
+            batch_size++;
+            break;
+        }
+        m_batch[batch_size].data = buffer.data() + offset;
+        m_batch[batch_size].size = packet_size;
+        offset += packet_size;
+        batch_size++;
+    }
+
+    m_batch_size = 0;
+    m_batch_index = 0;
+    m_is_batch_stashed = false;
+
+    size_t packets_received = 0;
+    auto status = m_udp.recv_multiple(m_batch.data(), batch_size, &packets_received);
+    if ((HAILO_STREAM_ABORTED_BY_USER == status) || (HAILO_TIMEOUT == status)) {
+        return status;
+    }
+    CHECK_SUCCESS(status);
+
+    m_batch_size = packets_received;
+    return HAILO_SUCCESS;
+}
+
+hailo_status EthernetOutputStream::stash_batch()
+{
+    if (m_is_batch_stashed || (m_batch_index == m_batch_size)) {
+        return HAILO_SUCCESS;
+    }
+
+    if (0 == m_batch_stash.size()) {
+        auto stash = Buffer::create(MAX_DATAGRAMS_PER_BATCH * MAX_UDP_PAYLOAD_SIZE);
+        CHECK_EXPECTED_AS_STATUS(stash);
+        m_batch_stash = stash.release();
+    }
+
+    for (size_t i = m_batch_index; i < m_batch_size; i++) {
+        auto stashed_packet = m_batch_stash.data() + (i * MAX_UDP_PAYLOAD_SIZE);
+        memcpy(stashed_packet, m_batch[i].data, m_batch[i].size);
+        m_batch[i].data = stashed_packet;
+    }
+    m_is_batch_stashed = true;
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status EthernetOutputStream::handle_timeout(const void* buffer, size_t offset,
                                                        size_t initial_offset, const size_t frame_size) {
     // In case data a timeout has occurred, and data was received, try filling missing in frame
@@ -664,25 +759,40 @@ hailo_status EthernetOutputStream::read_impl(MemoryView buffer)
     }
     CHECK_SUCCESS(status);
 
+    // Packets left in the batch can't stay in the user buffer after the read ends
+    status = stash_batch();
+    CHECK_SUCCESS(status);
+
     return HAILO_SUCCESS;
 }
 
-Expected<size_t> EthernetOutputStream::sync_read_raw_buffer(MemoryView &buffer)
+Expected<size_t> EthernetOutputStream::sync_read_raw_buffer(MemoryView &buffer, size_t max_packets)
 {
     auto status = get_core_op_activated_event()->wait(std::chrono::milliseconds(0));
     CHECK_AS_EXPECTED(HAILO_TIMEOUT != status, HAILO_NETWORK_GROUP_NOT_ACTIVATED, 
         "Trying to read on stream before its network_group is activated");
     CHECK_SUCCESS_AS_EXPECTED(status);
 
-    auto buffer_size = buffer.size();
-    status = m_udp.recv((uint8_t*)buffer.data(),&buffer_size);
-    if (HAILO_STREAM_ABORTED_BY_USER == status) {
-        LOGGER__INFO("Udp recv was aborted!");
-        return make_unexpected(status);
+    if (m_batch_index == m_batch_size) {
+        status = recv_batch(buffer, max_packets);
+        if (HAILO_STREAM_ABORTED_BY_USER == status) {
+            LOGGER__INFO("Udp recv was aborted!");
+            return make_unexpected(status);
+        }
+        CHECK_SUCCESS_AS_EXPECTED(status, "{} (D2H) failed with status={}", name(), status);
+    }
+
+    // Usually the packet was received directly to its place in the buffer. Otherwise (a previous packet in the batch
+    // was shorter than expected, or the packet was stashed) it is moved there.
+    const auto &packet = m_batch[m_batch_index++];
+    CHECK_AS_EXPECTED(packet.size <= buffer.size(), HAILO_ETH_RECV_FAILURE,
+        "{} (D2H) received a packet of {} bytes, but only {} bytes are left in the buffer", name(), packet.size,
+        buffer.size());
+    if (packet.data != buffer.data()) {
+        memmove(buffer.data(), packet.data, packet.size);
     }
-    CHECK_SUCCESS_AS_EXPECTED(status, "{} (D2H) failed with status={}", name(), status);
 
-    return buffer_size;
+    return Expected<size_t>(packet.size);
 }
 
 hailo_status EthernetOutputStream::fill_output_stream_ptr_with_info(const hailo_eth_output_stream_params_t &params, EthernetOutputStream *stream)
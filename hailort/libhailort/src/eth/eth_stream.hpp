@@ -16,6 +16,7 @@
 #include "hailo/hef.hpp"
 #include "hailo/device.hpp"
 #include "hailo/event.hpp"
+#include "hailo/buffer.hpp"
 
 #include "eth/token_bucket.hpp"
 #include "eth/udp.hpp"
@@ -25,6 +26,8 @@
 #include "common/os/posix/traffic_control.hpp"
 #endif
 
+#include <array>
+
 
 namespace hailort
 {
@@ -62,6 +65,8 @@ private:
 protected:
     virtual hailo_status eth_stream__write_with_remainder(const void *buffer, size_t offset, size_t size, size_t remainder_size);
     Expected<size_t> sync_write_raw_buffer(const MemoryView &buffer);
+    // Same as sync_write_raw_buffer, but sends up to MAX_DATAGRAMS_PER_BATCH packets in a single syscall
+    Expected<size_t> sync_write_raw_buffer_batch(const MemoryView &buffer);
     virtual hailo_status write_impl(const MemoryView &buffer) override;
 
 public:
@@ -138,6 +143,18 @@ class EthernetOutputStream : public OutputStreamBase {
 private:
     uint8_t leftover_buffer[MAX_UDP_PAYLOAD_SIZE];
     size_t leftover_size = 0;
+    // Packets are received in batches, directly into their expected place in the read buffer (packet i of a batch is
+    // placed max_payload_size * i bytes after the first). Packets that were received but not consumed yet are
+    // consumed by the following sync_read_raw_buffer calls. If they can't stay in the read buffer (for example, on
+    // packet loss or when the read ends), they are copied to the stash buffer.
+    // Each packet gets a full max_payload_size slot - if less is left in the read buffer, the last packet of the batch
+    // is received to the tail buffer instead.
+    std::array<SocketDatagram, MAX_DATAGRAMS_PER_BATCH> m_batch;
+    uint8_t m_batch_tail_buffer[MAX_UDP_PAYLOAD_SIZE];
+    size_t m_batch_size;
+    size_t m_batch_index;
+    bool m_is_batch_stashed;
+    Buffer m_batch_stash;
     uint32_t last_seen_sync_index;
     bool encountered_timeout;
     hailo_stream_eth_output_configuration_t configuration;
@@ -149,6 +166,11 @@ private:
         OutputStreamBase(edge_layer, HAILO_STREAM_INTERFACE_ETH, std::move(core_op_activated_event), status),
         leftover_buffer(),
         leftover_size(0),
+        m_batch(),
+        m_batch_size(0),
+        m_batch_index(0),
+        m_is_batch_stashed(false),
+        m_batch_stash(),
         // Firmware starts sending sync sequence from 0, so treating the first previous as max value (that will be overflowed to 0)
         last_seen_sync_index(std::numeric_limits<uint32_t>::max()),
         encountered_timeout(false),
@@ -173,13 +195,16 @@ private:
     hailo_status handle_timeout(const void* buffer, size_t offset, size_t initial_offset, size_t frame_size);
     hailo_status set_timeout(std::chrono::milliseconds timeout);
     hailo_status get_last_sync();
+    size_t get_max_packet_size() const;
+    hailo_status recv_batch(MemoryView &buffer, size_t max_packets);
+    hailo_status stash_batch();
 
     static hailo_status fill_output_stream_ptr_with_info(const hailo_eth_output_stream_params_t &params, EthernetOutputStream *stream);
 
 public:
     virtual ~EthernetOutputStream();
 
-    Expected<size_t> sync_read_raw_buffer(MemoryView &buffer);
+    Expected<size_t> sync_read_raw_buffer(MemoryView &buffer, size_t max_packets = MAX_DATAGRAMS_PER_BATCH);
 
     static Expected<std::unique_ptr<EthernetOutputStream>> create(Device &device, const LayerInfo &edge_layer,
         const hailo_eth_output_stream_params_t &params, EventPtr core_op_activated_event);
@@ -18,6 +18,7 @@
 #include <stdint.h>
 #include <errno.h>
 #include <string.h>
+#include <array>
 
 
 namespace hailort
@@ -28,6 +29,7 @@ namespace hailort
 
 //initialize with padding
 uint8_t g_padded_buffer[MAX_UDP_PAYLOAD_SIZE] = {0,};
+static const uint8_t PADDING_BYTES[PADDING_BYTES_SIZE] = {0,};
 
 hailo_status Udp::bind(struct in_addr host_ip, uint16_t host_port)
 {
@@ -171,6 +173,60 @@ hailo_status Udp::recv(uint8_t *buffer, size_t *size)
     return HAILO_SUCCESS;
 }
 
+hailo_status Udp::send_multiple(const uint8_t *buffer, size_t *size, bool use_padding, size_t max_payload_size)
+{
+    std::array<SocketDatagram, MAX_DATAGRAMS_PER_BATCH> datagrams{};
+    size_t datagrams_count = 0;
+    size_t datagrams_sent = 0;
+    size_t offset = 0;
+
+    /* Validate arguments */
+    CHECK_ARG_NOT_NULL(buffer);
+    CHECK_ARG_NOT_NULL(size);
+
+    // When padding is used, the padding bytes are sent as a prefix of each packet (no need to copy the data)
+    const size_t packet_size = use_padding ? (max_payload_size - PADDING_BYTES_SIZE - PADDING_ALIGN_BYTES) :
+        max_payload_size;
+    while ((offset < *size) && (datagrams_count < datagrams.size())) {
+        const auto datagram_size = std::min(packet_size, *size - offset);
+        datagrams[datagrams_count].data = const_cast<uint8_t*>(buffer + offset);
+        datagrams[datagrams_count].size = datagram_size;
+        datagrams_count++;
+        offset += datagram_size;
+    }
+
+    auto status = m_socket.send_multiple_to(use_padding ? PADDING_BYTES : nullptr, use_padding ? PADDING_BYTES_SIZE : 0,
+        datagrams.data(), datagrams_count, MSG_CONFIRM, (const struct sockaddr *) &m_device_address,
+        m_device_address_length, &datagrams_sent);
+    if (HAILO_STREAM_ABORTED_BY_USER == status) {
+        LOGGER__INFO("Socket send_multiple_to was aborted!");
+        return status;
+    }
+    CHECK_SUCCESS(status);
+
+    *size = 0;
+    for (size_t i = 0; i < datagrams_sent; i++) {
+        *size += datagrams[i].size;
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status Udp::recv_multiple(SocketDatagram *datagrams, size_t datagrams_count, size_t *datagrams_received)
+{
+    auto status = m_socket.recv_multiple_from(datagrams, datagrams_count, 0, datagrams_received);
+    if (HAILO_STREAM_ABORTED_BY_USER == status) {
+        LOGGER__INFO("Socket recv_multiple_from was aborted!");
+        return status;
+    }
+    if (HAILO_TIMEOUT == status) {
+        return status;
+    }
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status Udp::abort()
 {
     return m_socket.abort();
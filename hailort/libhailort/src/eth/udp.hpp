@@ -30,6 +30,11 @@ public:
     hailo_status set_timeout(const std::chrono::milliseconds timeout_ms);
     hailo_status send(uint8_t *buffer, size_t *size, bool use_padding, size_t max_payload_size);
     hailo_status recv(uint8_t *buffer, size_t *size);
+    // Sends the buffer as up to MAX_DATAGRAMS_PER_BATCH consecutive packets (of max_payload_size each) in a single
+    // syscall. On return, size holds the amount of bytes actually sent (without padding).
+    hailo_status send_multiple(const uint8_t *buffer, size_t *size, bool use_padding, size_t max_payload_size);
+    // Receives up to datagrams_count packets in a single syscall. Blocks only until the first packet arrives.
+    hailo_status recv_multiple(SocketDatagram *datagrams, size_t datagrams_count, size_t *datagrams_received);
     hailo_status abort();
     hailo_status has_data(bool log_timeouts_in_debug = false);
     hailo_status fw_interact(uint8_t *request_buffer, size_t request_size, uint8_t *response_buffer,
@@ -16,6 +16,7 @@
 #include "hailo/stream.hpp"
 #include "hailo/device.hpp"
 #include "hailo/vdevice.hpp"
+#include "hailo/infer_model.hpp"
 #include "hailo/transform.hpp"
 #include "hailo/vstream.hpp"
 #include "hailo/event.hpp"
@@ -30,6 +31,7 @@
 #include "eth/eth_device.hpp"
 #include "eth/eth_stream.hpp"
 #include "vdma/pcie/pcie_device.hpp"
+#include "vdma/memory/dma_mapping_cache.hpp"
 #include "utils/sensor_config_utils.hpp"
 #include "utils/hailort_logger.hpp"
 #include "utils/shared_resource_manager.hpp"
@@ -1123,7 +1125,17 @@ hailo_status hailo_allocate_buffer(size_t size, const hailo_buffer_parameters_t
 hailo_status hailo_free_buffer(void *buffer)
 {
     CHECK_ARG_NOT_NULL(buffer);
-    return ExportedBufferManager::unregister_resource(buffer);
+
+    auto hailort_allocated_buffer = ExportedBufferManager::get_resource(buffer);
+    CHECK_EXPECTED_AS_STATUS(hailort_allocated_buffer);
+    const auto size = hailort_allocated_buffer->get()->size();
+
+    auto status = ExportedBufferManager::unregister_resource(buffer);
+    CHECK_SUCCESS(status);
+
+    // The address may be reused by the next allocation, so cached mappings of it must not be used again
+    vdma::DmaMappingCache::invalidate_all(buffer, size);
+    return HAILO_SUCCESS;
 }
 
 static Expected<DmaMappingKey> get_mapping_key(void *buffer, hailo_device device, hailo_dma_buffer_direction_t direction)
@@ -1195,7 +1207,32 @@ hailo_status hailo_dma_unmap_buffer_from_device(void *buffer, hailo_device devic
 
     auto key = get_mapping_key(buffer, device, direction);
     CHECK_EXPECTED_AS_STATUS(key);
-    return DmaMappingManager::unregister_resource(key.release());
+    auto dma_mapped_buffer = DmaMappingManager::get_resource(key.value());
+    CHECK_EXPECTED_AS_STATUS(dma_mapped_buffer);
+    const auto size = dma_mapped_buffer->get()->size();
+
+    auto status = DmaMappingManager::unregister_resource(key.release());
+    CHECK_SUCCESS(status);
+
+    // The buffer may be freed once it is unmapped, so cached mappings of it must not be used again
+    vdma::DmaMappingCache::invalidate_all(buffer, size);
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_device_invalidate_dma_mapping_cache(hailo_device device, void *buffer, size_t size)
+{
+    CHECK_ARG_NOT_NULL(device);
+    CHECK_ARG_NOT_NULL(buffer);
+
+    return reinterpret_cast<Device*>(device)->invalidate_dma_mapping_cache(buffer, size);
+}
+
+hailo_status hailo_vdevice_invalidate_dma_mapping_cache(hailo_vdevice vdevice, void *buffer, size_t size)
+{
+    CHECK_ARG_NOT_NULL(vdevice);
+    CHECK_ARG_NOT_NULL(buffer);
+
+    return reinterpret_cast<VDevice*>(vdevice)->invalidate_dma_mapping_cache(buffer, size);
 }
 
 hailo_status hailo_calculate_eth_input_rate_limits(hailo_hef hef, const char *network_group_name, uint32_t fps,
@@ -2547,6 +2584,290 @@ hailo_status hailo_infer(hailo_configured_network_group network_group,
     return HAILO_SUCCESS;
 }
 
+/* Async inference (InferModel) API functions */
+hailo_status hailo_create_infer_model(hailo_vdevice vdevice, const char *hef_path, hailo_infer_model *infer_model)
+{
+    CHECK_ARG_NOT_NULL(vdevice);
+    CHECK_ARG_NOT_NULL(hef_path);
+    CHECK_ARG_NOT_NULL(infer_model);
+
+    auto infer_model_exp = (reinterpret_cast<VDevice*>(vdevice))->create_infer_model(hef_path);
+    CHECK_EXPECTED_AS_STATUS(infer_model_exp);
+
+    auto allocated_infer_model = new (std::nothrow) InferModel(infer_model_exp.release());
+    CHECK_NOT_NULL(allocated_infer_model, HAILO_OUT_OF_HOST_MEMORY);
+
+    *infer_model = reinterpret_cast<hailo_infer_model>(allocated_infer_model);
+    return HAILO_SUCCESS;
+}
+
+static hailo_status convert_names_vector_to_array(const std::vector<std::string> &names_vec, const char **names,
+    size_t *names_count)
+{
+    CHECK(names_vec.size() <= *names_count, HAILO_INSUFFICIENT_BUFFER,
+        "Can't return all names. There are {} names, but the output array is of size {}", names_vec.size(), *names_count);
+
+    for (size_t i = 0; i < names_vec.size(); i++) {
+        names[i] = names_vec[i].c_str();
+    }
+    *names_count = names_vec.size();
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_infer_model_get_input_names(hailo_infer_model infer_model, const char **names, size_t *names_count)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(names);
+    CHECK_ARG_NOT_NULL(names_count);
+
+    return convert_names_vector_to_array(reinterpret_cast<InferModel*>(infer_model)->get_input_names(), names,
+        names_count);
+}
+
+hailo_status hailo_infer_model_get_output_names(hailo_infer_model infer_model, const char **names, size_t *names_count)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(names);
+    CHECK_ARG_NOT_NULL(names_count);
+
+    return convert_names_vector_to_array(reinterpret_cast<InferModel*>(infer_model)->get_output_names(), names,
+        names_count);
+}
+
+hailo_status hailo_infer_model_set_input_format(hailo_infer_model infer_model, const char *name,
+    hailo_format_type_t type, hailo_format_order_t order)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(name);
+
+    auto input = reinterpret_cast<InferModel*>(infer_model)->input(name);
+    CHECK_EXPECTED_AS_STATUS(input);
+    input->set_format_type(type);
+    input->set_format_order(order);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_infer_model_set_input_image_preprocess(hailo_infer_model infer_model, const char *name,
+    const hailo_image_preprocess_params_t *params)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(name);
+    CHECK_ARG_NOT_NULL(params);
+
+    auto input = reinterpret_cast<InferModel*>(infer_model)->input(name);
+    CHECK_EXPECTED_AS_STATUS(input);
+    input->set_image_preprocess(*params);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_infer_model_set_output_format(hailo_infer_model infer_model, const char *name,
+    hailo_format_type_t type, hailo_format_order_t order)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(name);
+
+    auto output = reinterpret_cast<InferModel*>(infer_model)->output(name);
+    CHECK_EXPECTED_AS_STATUS(output);
+    output->set_format_type(type);
+    output->set_format_order(order);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_infer_model_get_input_frame_size(hailo_infer_model infer_model, const char *name,
+    size_t *frame_size)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(name);
+    CHECK_ARG_NOT_NULL(frame_size);
+
+    auto input = reinterpret_cast<InferModel*>(infer_model)->input(name);
+    CHECK_EXPECTED_AS_STATUS(input);
+    *frame_size = input->get_frame_size();
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_infer_model_get_output_frame_size(hailo_infer_model infer_model, const char *name,
+    size_t *frame_size)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(name);
+    CHECK_ARG_NOT_NULL(frame_size);
+
+    auto output = reinterpret_cast<InferModel*>(infer_model)->output(name);
+    CHECK_EXPECTED_AS_STATUS(output);
+    *frame_size = output->get_frame_size();
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_infer_model_set_batch_size(hailo_infer_model infer_model, uint16_t batch_size)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+
+    reinterpret_cast<InferModel*>(infer_model)->set_batch_size(batch_size);
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_infer_model_configure(hailo_infer_model infer_model,
+    hailo_configured_infer_model *configured_infer_model)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+
+    auto configured_infer_model_exp = reinterpret_cast<InferModel*>(infer_model)->configure();
+    CHECK_EXPECTED_AS_STATUS(configured_infer_model_exp);
+
+    auto allocated_configured_infer_model = new (std::nothrow) ConfiguredInferModel(configured_infer_model_exp.release());
+    CHECK_NOT_NULL(allocated_configured_infer_model, HAILO_OUT_OF_HOST_MEMORY);
+
+    *configured_infer_model = reinterpret_cast<hailo_configured_infer_model>(allocated_configured_infer_model);
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_release_infer_model(hailo_infer_model infer_model)
+{
+    CHECK_ARG_NOT_NULL(infer_model);
+    delete reinterpret_cast<InferModel*>(infer_model);
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_configured_infer_model_activate(hailo_configured_infer_model configured_infer_model)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    return reinterpret_cast<ConfiguredInferModel*>(configured_infer_model)->activate();
+}
+
+hailo_status hailo_configured_infer_model_deactivate(hailo_configured_infer_model configured_infer_model)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    reinterpret_cast<ConfiguredInferModel*>(configured_infer_model)->deactivate();
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_configured_infer_model_create_bindings(hailo_configured_infer_model configured_infer_model,
+    hailo_configured_infer_model_bindings *bindings)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    CHECK_ARG_NOT_NULL(bindings);
+
+    auto bindings_exp = reinterpret_cast<ConfiguredInferModel*>(configured_infer_model)->create_bindings();
+    CHECK_EXPECTED_AS_STATUS(bindings_exp);
+
+    auto allocated_bindings = new (std::nothrow) ConfiguredInferModel::Bindings(bindings_exp.release());
+    CHECK_NOT_NULL(allocated_bindings, HAILO_OUT_OF_HOST_MEMORY);
+
+    *bindings = reinterpret_cast<hailo_configured_infer_model_bindings>(allocated_bindings);
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_configured_infer_model_bindings_set_input_buffer(hailo_configured_infer_model_bindings bindings,
+    const char *name, const void *buffer, size_t size)
+{
+    CHECK_ARG_NOT_NULL(bindings);
+    CHECK_ARG_NOT_NULL(name);
+    CHECK_ARG_NOT_NULL(buffer);
+
+    auto input = reinterpret_cast<ConfiguredInferModel::Bindings*>(bindings)->input(name);
+    CHECK_EXPECTED_AS_STATUS(input);
+
+    // The input buffer is only read by the inference, the const_cast is needed since MemoryView isn't const
+    return input->set_buffer(MemoryView(const_cast<void*>(buffer), size));
+}
+
+hailo_status hailo_configured_infer_model_bindings_set_output_buffer(hailo_configured_infer_model_bindings bindings,
+    const char *name, void *buffer, size_t size)
+{
+    CHECK_ARG_NOT_NULL(bindings);
+    CHECK_ARG_NOT_NULL(name);
+    CHECK_ARG_NOT_NULL(buffer);
+
+    auto output = reinterpret_cast<ConfiguredInferModel::Bindings*>(bindings)->output(name);
+    CHECK_EXPECTED_AS_STATUS(output);
+
+    return output->set_buffer(MemoryView(buffer, size));
+}
+
+hailo_status hailo_release_configured_infer_model_bindings(hailo_configured_infer_model_bindings bindings)
+{
+    CHECK_ARG_NOT_NULL(bindings);
+    delete reinterpret_cast<ConfiguredInferModel::Bindings*>(bindings);
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_configured_infer_model_wait_for_async_ready(hailo_configured_infer_model configured_infer_model,
+    uint32_t timeout_ms)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    return reinterpret_cast<ConfiguredInferModel*>(configured_infer_model)->wait_for_async_ready(
+        std::chrono::milliseconds(timeout_ms));
+}
+
+hailo_status hailo_configured_infer_model_run_async(hailo_configured_infer_model configured_infer_model,
+    hailo_configured_infer_model_bindings bindings, hailo_infer_model_async_callback_t user_callback, void *opaque,
+    hailo_async_infer_job *job)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    CHECK_ARG_NOT_NULL(bindings);
+    CHECK_ARG_NOT_NULL(user_callback);
+
+    // The C++ completion info holds a copy of the bindings, so we pass the user's handle to the callback instead.
+    auto callback = [user_callback, opaque, bindings](const CompletionInfoAsyncInfer &completion_info) {
+        hailo_infer_model_async_completion_info_t c_completion_info{};
+        c_completion_info.status = completion_info.status;
+        c_completion_info.bindings = bindings;
+        c_completion_info.opaque = opaque;
+        user_callback(&c_completion_info);
+    };
+
+    // The job handle is allocated before launching the request, so a failure means nothing was launched.
+    std::unique_ptr<AsyncInferJob> allocated_job;
+    if (nullptr != job) {
+        allocated_job.reset(new (std::nothrow) AsyncInferJob());
+        CHECK_NOT_NULL(allocated_job, HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    auto job_exp = reinterpret_cast<ConfiguredInferModel*>(configured_infer_model)->run_async(
+        *reinterpret_cast<ConfiguredInferModel::Bindings*>(bindings), callback);
+    CHECK_EXPECTED_AS_STATUS(job_exp);
+
+    if (nullptr == job) {
+        job_exp->detach();
+        return HAILO_SUCCESS;
+    }
+
+    *allocated_job = job_exp.release();
+    *job = reinterpret_cast<hailo_async_infer_job>(allocated_job.release());
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_release_configured_infer_model(hailo_configured_infer_model configured_infer_model)
+{
+    CHECK_ARG_NOT_NULL(configured_infer_model);
+    delete reinterpret_cast<ConfiguredInferModel*>(configured_infer_model);
+    return HAILO_SUCCESS;
+}
+
+hailo_status hailo_async_infer_job_wait(hailo_async_infer_job job, uint32_t timeout_ms)
+{
+    CHECK_ARG_NOT_NULL(job);
+    return reinterpret_cast<AsyncInferJob*>(job)->wait(std::chrono::milliseconds(timeout_ms));
+}
+
+hailo_status hailo_release_async_infer_job(hailo_async_infer_job job)
+{
+    CHECK_ARG_NOT_NULL(job);
+
+    auto job_ptr = reinterpret_cast<AsyncInferJob*>(job);
+    job_ptr->detach();
+    delete job_ptr;
+    return HAILO_SUCCESS;
+}
+
 /* Multi network API functions */
 static hailo_status convert_network_infos_vector_to_array(std::vector<hailo_network_info_t> &&network_infos_vec, 
     hailo_network_info_t *network_infos, size_t *number_of_networks)
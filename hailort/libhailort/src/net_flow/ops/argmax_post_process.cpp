@@ -10,6 +10,8 @@
 #include "argmax_post_process.hpp"
 #include "hailo/hailort.h"
 #include "hailo/hailort_common.hpp"
+#include "hailo/quantization.hpp"
+#include "hailo/float16.hpp"
 #include "common/utils.hpp"
 
 #include <limits>
@@ -22,6 +24,9 @@ namespace net_flow
 
 // Source https://stackoverflow.com/questions/3793838/which-is-the-first-integer-that-an-ieee-754-float-is-incapable-of-representing-e
 #define FLOAT_LAST_CONSECUTIVE_REPRESENTABLE_INT (1 << std::numeric_limits<float32_t>::digits)
+// Same for the half precision types (11 and 8 significand bits)
+#define FLOAT16_LAST_CONSECUTIVE_REPRESENTABLE_INT (1 << 11)
+#define BFLOAT16_LAST_CONSECUTIVE_REPRESENTABLE_INT (1 << 8)
 
 hailo_status ArgmaxPostProcessOp::execute_not_supported(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
     const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs)
@@ -35,7 +40,7 @@ hailo_status ArgmaxPostProcessOp::execute_not_supported(const BufferMetaData &in
         return HAILO_INVALID_ARGUMENT;
     }
 
-ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES]
+ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][ARGMAX_NUM_OF_POSSIBLE_INPUT_FORMAT_TYPES][ARGMAX_NUM_OF_POSSIBLE_OUTPUT_FORMAT_TYPES]
 {
     {
         {
@@ -44,6 +49,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         },
         {
@@ -51,22 +58,27 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
             ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, uint8_t>,
             ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, uint16_t>,
-            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, float32_t>
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, float32_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, Float16>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, BFloat16>
         },
         {
             // NHCW x UINT16
             ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
             ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, uint8_t>,
             ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, uint16_t>,
-            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, float32_t>
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, float32_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, Float16>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, BFloat16>
         },
         {
-            // NHCW x FLOAT32
-            // We don't support input_format_type to be float32
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported
+            // NHCW x FLOAT32 (dequantized input)
+            ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<float32_t, uint8_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<float32_t, uint16_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<float32_t, float32_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<float32_t, Float16>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<float32_t, BFloat16>
         }
     },
     {
@@ -76,6 +88,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         },
         {
@@ -83,7 +97,9 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
             ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, uint8_t>,
             ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, uint16_t>,
-            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, float32_t>
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, float32_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, Float16>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, BFloat16>
         },
         {
             // NHWC x UINT16
@@ -91,13 +107,17 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint16_t, uint8_t>,
             ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint16_t, uint16_t>,
             ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint16_t, float32_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint16_t, Float16>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint16_t, BFloat16>
         },
         {
-            // NHWC x FLOAT32
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported
+            // NHWC x FLOAT32 (dequantized input)
+            ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<float32_t, uint8_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<float32_t, uint16_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<float32_t, float32_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<float32_t, Float16>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<float32_t, BFloat16>
         }
     },
     {
@@ -107,6 +127,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         },
         {
@@ -115,6 +137,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::NC_to_N<uint8_t, uint8_t>,
             ArgmaxPostProcessOp::NC_to_N<uint8_t, uint16_t>,
             ArgmaxPostProcessOp::NC_to_N<uint8_t, float32_t>,
+            ArgmaxPostProcessOp::NC_to_N<uint8_t, Float16>,
+            ArgmaxPostProcessOp::NC_to_N<uint8_t, BFloat16>
         },
         {
             // NC x UINT16
@@ -122,14 +146,17 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::NC_to_N<uint16_t, uint8_t>,
             ArgmaxPostProcessOp::NC_to_N<uint16_t, uint16_t>,
             ArgmaxPostProcessOp::NC_to_N<uint16_t, float32_t>,
+            ArgmaxPostProcessOp::NC_to_N<uint16_t, Float16>,
+            ArgmaxPostProcessOp::NC_to_N<uint16_t, BFloat16>
         },
         {
-            // NC x FLOAT32
-            // We don't support input_format_type to be float32
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported,
-            ArgmaxPostProcessOp::execute_not_supported
+            // NC x FLOAT32 (dequantized input)
+            ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
+            ArgmaxPostProcessOp::NC_to_N<float32_t, uint8_t>,
+            ArgmaxPostProcessOp::NC_to_N<float32_t, uint16_t>,
+            ArgmaxPostProcessOp::NC_to_N<float32_t, float32_t>,
+            ArgmaxPostProcessOp::NC_to_N<float32_t, Float16>,
+            ArgmaxPostProcessOp::NC_to_N<float32_t, BFloat16>
         }
     }
 };
@@ -160,7 +187,30 @@ hailo_status ArgmaxPostProcessOp::execute(const std::map<std::string, MemoryView
                 HailoRTCommon::get_format_order_str(input_metadata.format.order));
             return HAILO_INVALID_ARGUMENT;
     }
-    return ArgmaxPostProcessOp::m_argmax_function_array[format_index][input_metadata.format.type][output_metadata.format.type](input_metadata, output_metadata, inputs, outputs);
+
+    if (0 == m_dequantized_input.size()) {
+        return ArgmaxPostProcessOp::m_argmax_function_array[format_index][input_metadata.format.type][output_metadata.format.type](input_metadata, output_metadata, inputs, outputs);
+    }
+
+    // The QP doesn't preserve the order of the values - dequantize the input and run the argmax on the float values
+    const auto elements_count = HailoRTCommon::get_shape_size(input_metadata.padded_shape);
+    auto dequantized_ptr = reinterpret_cast<float32_t*>(m_dequantized_input.data());
+    if (HAILO_FORMAT_TYPE_UINT8 == input_metadata.format.type) {
+        Quantization::dequantize_output_buffer<float32_t, uint8_t>((uint8_t*)inputs.begin()->second.data(), dequantized_ptr,
+            elements_count, input_metadata.quant_info);
+    } else if (HAILO_FORMAT_TYPE_UINT16 == input_metadata.format.type) {
+        Quantization::dequantize_output_buffer<float32_t, uint16_t>((uint16_t*)inputs.begin()->second.data(), dequantized_ptr,
+            elements_count, input_metadata.quant_info);
+    } else {
+        LOGGER__ERROR("Argmax post-process received invalid input type {}", HailoRTCommon::get_format_type_str(input_metadata.format.type));
+        return HAILO_INVALID_ARGUMENT;
+    }
+
+    auto dequantized_input_metadata = input_metadata;
+    dequantized_input_metadata.format.type = HAILO_FORMAT_TYPE_FLOAT32;
+    const std::map<std::string, MemoryView> dequantized_inputs = {{input_name, MemoryView(m_dequantized_input)}};
+    return ArgmaxPostProcessOp::m_argmax_function_array[format_index][HAILO_FORMAT_TYPE_FLOAT32][output_metadata.format.type](
+        dequantized_input_metadata, output_metadata, dequantized_inputs, outputs);
 }
 
 Expected<std::shared_ptr<OpMetadata>> ArgmaxOpMetadata::create(const std::unordered_map<std::string, BufferMetaData> &inputs_metadata,
@@ -211,7 +261,9 @@ hailo_status ArgmaxOpMetadata::validate_format_info()
     CHECK((
         ((output_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) && (input_metadata.shape.features <= std::numeric_limits<uint8_t>::max())) ||
         ((output_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) && (input_metadata.shape.features <= std::numeric_limits<uint16_t>::max())) ||
-        ((output_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32) && (input_metadata.shape.features <= FLOAT_LAST_CONSECUTIVE_REPRESENTABLE_INT))),
+        ((output_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32) && (input_metadata.shape.features <= FLOAT_LAST_CONSECUTIVE_REPRESENTABLE_INT)) ||
+        ((output_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT16) && (input_metadata.shape.features <= FLOAT16_LAST_CONSECUTIVE_REPRESENTABLE_INT)) ||
+        ((output_metadata.format.type == HAILO_FORMAT_TYPE_BFLOAT16) && (input_metadata.shape.features <= BFLOAT16_LAST_CONSECUTIVE_REPRESENTABLE_INT))),
         HAILO_INVALID_OPERATION, "Output format type {} can't represent possible range {} for Argmax op",
         HailoRTCommon::get_format_type_str(output_metadata.format.type), input_metadata.shape.features);
     CHECK(
@@ -274,7 +326,18 @@ Expected<std::shared_ptr<Op>> ArgmaxPostProcessOp::create(std::shared_ptr<Argmax
     auto status = metadata->validate_format_info();
     CHECK_SUCCESS_AS_EXPECTED(status);
 
-    auto op = std::shared_ptr<ArgmaxPostProcessOp>(new (std::nothrow) ArgmaxPostProcessOp(metadata));
+    Buffer dequantized_input;
+    assert(1 == metadata->inputs_metadata().size());
+    const auto &input_metadata = metadata->inputs_metadata().begin()->second;
+    if (!is_quantized_argmax_valid(input_metadata.quant_info)) {
+        LOGGER__INFO("{} input qp_scale is {}, argmax will run on the dequantized input", metadata->get_name(),
+            input_metadata.quant_info.qp_scale);
+        auto buffer = Buffer::create(HailoRTCommon::get_shape_size(input_metadata.padded_shape) * sizeof(float32_t));
+        CHECK_EXPECTED(buffer);
+        dequantized_input = buffer.release();
+    }
+
+    auto op = std::shared_ptr<ArgmaxPostProcessOp>(new (std::nothrow) ArgmaxPostProcessOp(metadata, std::move(dequantized_input)));
     CHECK_AS_EXPECTED(op != nullptr, HAILO_OUT_OF_HOST_MEMORY);
 
     return std::shared_ptr<Op>(std::move(op));
@@ -18,6 +18,8 @@
 #include "hailo/hailort.h"
 #include "net_flow/ops/op.hpp"
 #include "net_flow/ops/op_metadata.hpp"
+#include "net_flow/ops/vectorized_kernels.hpp"
+#include "hailo/buffer.hpp"
 #include "common/utils.hpp"
 
 #include <iostream>
@@ -28,7 +30,8 @@ namespace net_flow
 {
 
 #define ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS (3)
-#define ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES (4)
+#define ARGMAX_NUM_OF_POSSIBLE_INPUT_FORMAT_TYPES (4) // Auto, UINT8, UINT16, FLOAT32
+#define ARGMAX_NUM_OF_POSSIBLE_OUTPUT_FORMAT_TYPES (6) // Auto, UINT8, UINT16, FLOAT32, FLOAT16, BFLOAT16
 
 constexpr std::size_t ARGMAX_OUTPUT_FEATURES_SIZE {1};
 constexpr std::size_t ARGMAX_NUMBER_OF_SRCS {1};
@@ -64,36 +67,23 @@ class ArgmaxPostProcessOp : public Op
 {
 
 private:
-    ArgmaxPostProcessOp(std::shared_ptr<ArgmaxOpMetadata> metadata)
-        : Op(static_cast<std::shared_ptr<OpMetadata>>(metadata))
+    ArgmaxPostProcessOp(std::shared_ptr<ArgmaxOpMetadata> metadata, Buffer &&dequantized_input)
+        : Op(static_cast<std::shared_ptr<OpMetadata>>(metadata)),
+          m_dequantized_input(std::move(dequantized_input))
     {}
 
     template<typename SrcType, typename DstType>
     static hailo_status NHCW_to_NHW_feature_axis(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
         const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs)
     {
-        auto src_ptr = (SrcType*)inputs.begin()->second.data();
+        auto src_ptr = (const SrcType*)inputs.begin()->second.data();
         auto dst_ptr = (DstType*)outputs.begin()->second.data();
         const auto src_row_size = input_metadata.padded_shape.width * input_metadata.padded_shape.features;
         const auto dst_row_size = output_metadata.shape.width;
 
         for (uint32_t r = 0; r < input_metadata.shape.height; r++) {
-            const SrcType *src_row = src_ptr + (r * src_row_size);
-            DstType *dst_row = dst_ptr + (r * dst_row_size);
-            for (uint32_t w = 0; w < input_metadata.shape.width; w++) {
-                const SrcType *offset_in_row = src_row + w;
-                DstType max_index = 0;
-                auto max_value = *offset_in_row;
-                for (uint32_t c = 1; c < input_metadata.shape.features; c++) {
-                    offset_in_row += input_metadata.padded_shape.width;
-                    const auto &current_value = *offset_in_row;
-                    if (current_value > max_value) {
-                        max_index = static_cast<DstType>(c);
-                        max_value = current_value;
-                    }
-                }
-                dst_row[w] = max_index;
-            }
+            VectorizedKernels::planar_argmax(src_ptr + (r * src_row_size), input_metadata.padded_shape.width,
+                input_metadata.shape.features, input_metadata.shape.width, dst_ptr + (r * dst_row_size));
         }
         return HAILO_SUCCESS;
     }
@@ -102,7 +92,7 @@ private:
     static hailo_status NHWC_to_NHW_feature_axis(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
         const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs)
     {
-        auto src_ptr = (SrcType*)inputs.begin()->second.data();
+        auto src_ptr = (const SrcType*)inputs.begin()->second.data();
         auto dst_ptr = (DstType*)outputs.begin()->second.data();
         const auto src_row_size = input_metadata.padded_shape.width * input_metadata.padded_shape.features;
         const auto dst_row_size = output_metadata.shape.width;
@@ -111,17 +101,8 @@ private:
             const SrcType *src_row = src_ptr + (r * src_row_size);
             DstType *dst_row = dst_ptr + (r * dst_row_size);
             for (uint32_t w = 0; w < input_metadata.shape.width; w++) {
-                const SrcType *offset_in_row = src_row + (w * input_metadata.padded_shape.features);
-                DstType max_index = 0;
-                auto max_value = *offset_in_row;
-                for (uint32_t c = 1; c < input_metadata.shape.features; c++) {
-                    const auto &current_value = *(offset_in_row + c);
-                    if (current_value > max_value) {
-                        max_index = static_cast<DstType>(c);
-                        max_value = current_value;
-                    }
-                }
-                dst_row[w] = max_index;
+                dst_row[w] = static_cast<DstType>(VectorizedKernels::argmax(src_row + (w * input_metadata.padded_shape.features),
+                    input_metadata.shape.features));
             }
         }
         return HAILO_SUCCESS;
@@ -132,22 +113,22 @@ private:
         const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs)
     {
         (void) output_metadata; // only reason to have output_metadata is so that the function array will work
-        auto src_ptr = (SrcType*)inputs.begin()->second.data();
+        auto src_ptr = (const SrcType*)inputs.begin()->second.data();
         auto dst_ptr = (DstType*)outputs.begin()->second.data();
-        DstType max_index = 0;
-        SrcType max_value = 0;
-
-        for (uint32_t c = 0; c < input_metadata.shape.features; c++) {
-            const auto &current_value = *(src_ptr + c);
-            if (current_value > max_value) {
-                max_index = static_cast<DstType>(c);
-                max_value = current_value;
-            }
-        }
-        *dst_ptr = max_index;
+        *dst_ptr = static_cast<DstType>(VectorizedKernels::argmax(src_ptr, input_metadata.shape.features));
         return HAILO_SUCCESS;
     }
 
+    // Dequantization with a positive scale preserves the order of the values, so the argmax can run directly on the
+    // quantized data. A zero scale means the QP isn't set, and the quantized data is used as is.
+    static bool is_quantized_argmax_valid(const hailo_quant_info_t &quant_info)
+    {
+        return quant_info.qp_scale >= 0;
+    }
+
+    // Used only when the argmax can't run on the quantized input (see is_quantized_argmax_valid())
+    Buffer m_dequantized_input;
+
     static hailo_status execute_not_supported(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
         const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs);
 
@@ -158,10 +139,10 @@ public:
 
     // A 3D array of argmax functions to call:
     // 1st dim represent the data format order
-    // 2nd dim represent the input data type (only uint8 or uint16 are valid)
+    // 2nd dim represent the input data type (uint8 or uint16, float32 is used on dequantized input)
     // 3rd dim represent the output data type
     // Note: Assumption here the ordering of the enum hailo_format_type_t doesn't change
-    static ArgmaxFunction m_argmax_function_array[ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES];
+    static ArgmaxFunction m_argmax_function_array[ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][ARGMAX_NUM_OF_POSSIBLE_INPUT_FORMAT_TYPES][ARGMAX_NUM_OF_POSSIBLE_OUTPUT_FORMAT_TYPES];
 
 };
 
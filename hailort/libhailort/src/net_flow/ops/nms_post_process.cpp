@@ -39,8 +39,10 @@ std::string NmsOpMetadata::get_op_description()
 hailo_status NmsOpMetadata::validate_format_info()
 {
     for (const auto& output_metadata : m_outputs_metadata) {
-        CHECK(HAILO_FORMAT_ORDER_HAILO_NMS == output_metadata.second.format.order, HAILO_INVALID_ARGUMENT, "The given output format order {} is not supported, "
-            "should be HAILO_FORMAT_ORDER_HAILO_NMS", HailoRTCommon::get_format_order_str(output_metadata.second.format.order));
+        CHECK((HAILO_FORMAT_ORDER_HAILO_NMS == output_metadata.second.format.order) ||
+            (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS == output_metadata.second.format.order), HAILO_INVALID_ARGUMENT,
+            "The given output format order {} is not supported, should be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS",
+            HailoRTCommon::get_format_order_str(output_metadata.second.format.order));
 
         CHECK(HAILO_FORMAT_TYPE_FLOAT32 == output_metadata.second.format.type, HAILO_INVALID_ARGUMENT, "The given output format type {} is not supported, "
             "should be HAILO_FORMAT_TYPE_FLOAT32", HailoRTCommon::get_format_type_str(output_metadata.second.format.type));
@@ -113,7 +115,7 @@ void NmsPostProcessOp::remove_overlapping_boxes(std::vector<DetectionBbox> &dete
     double iou_th)
 {
     std::sort(detections.begin(), detections.end(),
-            [](DetectionBbox a, DetectionBbox b)
+            [](const DetectionBbox &a, const DetectionBbox &b)
             { return a.m_bbox.score > b.m_bbox.score; });
 
     for (size_t i = 0; i < detections.size(); i++) {
@@ -142,9 +144,17 @@ void NmsPostProcessOp::remove_overlapping_boxes(std::vector<DetectionBbox> &dete
 
 void NmsPostProcessOp::fill_nms_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
     std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config)
+{
+    std::vector<uint32_t> num_of_detections_before;
+    fill_nms_format_buffer(buffer, detections, classes_detections_count, nms_config, num_of_detections_before);
+}
+
+void NmsPostProcessOp::fill_nms_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+    std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config,
+    std::vector<uint32_t> &num_of_detections_before)
 {
     // Calculate the number of detections before each class, to help us later calculate the buffer_offset for it's detections.
-    std::vector<uint32_t> num_of_detections_before(nms_config.number_of_classes, 0);
+    num_of_detections_before.assign(nms_config.number_of_classes, 0);
     uint32_t ignored_detections_count = 0;
     for (size_t class_idx = 0; class_idx < nms_config.number_of_classes; class_idx++) {
         if (classes_detections_count[class_idx] > nms_config.max_proposals_per_class) {
@@ -191,11 +201,53 @@ void NmsPostProcessOp::fill_nms_format_buffer(MemoryView &buffer, const std::vec
     }
 }
 
+void NmsPostProcessOp::fill_nms_detections_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+    std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config)
+{
+    uint32_t ignored_detections_count = 0;
+    for (size_t class_idx = 0; class_idx < nms_config.number_of_classes; class_idx++) {
+        if (classes_detections_count[class_idx] > nms_config.max_proposals_per_class) {
+            ignored_detections_count += (classes_detections_count[class_idx] - nms_config.max_proposals_per_class);
+            classes_detections_count[class_idx] = nms_config.max_proposals_per_class;
+        }
+    }
+
+    uint32_t detections_count = 0;
+    auto dst_detections = reinterpret_cast<hailo_detection_t*>(buffer.data() + sizeof(detections_count));
+    for (auto &detection : detections) {
+        if (REMOVED_CLASS_SCORE == detection.m_bbox.score) {
+            // Detection overlapped with a higher score detection and removed in remove_overlapping_boxes()
+            continue;
+        }
+        if (0 == classes_detections_count[detection.m_class_id]) {
+            // This class' detections count is higher then m_nms_config.max_proposals_per_class.
+            // This detection is ignored due to having lower score (detections vector is sorted by score).
+            continue;
+        }
+
+        assert((sizeof(detections_count) + ((detections_count + 1) * sizeof(hailo_detection_t))) <= buffer.size());
+        dst_detections[detections_count] = hailo_detection_t{detection.m_bbox, detection.m_class_id};
+        detections_count++;
+        classes_detections_count[detection.m_class_id]--;
+    }
+    memcpy(buffer.data(), &detections_count, sizeof(detections_count));
+
+    if (0 != ignored_detections_count) {
+        LOGGER__INFO("{} Detections were ignored, due to `max_bboxes_per_class` defined as {}.",
+            ignored_detections_count, nms_config.max_proposals_per_class);
+    }
+}
+
 hailo_status NmsPostProcessOp::hailo_nms_format(std::vector<DetectionBbox> &&detections,
     MemoryView dst_view, std::vector<uint32_t> &classes_detections_count)
 {
     remove_overlapping_boxes(detections, classes_detections_count, m_nms_metadata->nms_config().nms_iou_th);
-    fill_nms_format_buffer(dst_view, detections, classes_detections_count, m_nms_metadata->nms_config());
+    assert(1 == m_nms_metadata->outputs_metadata().size());
+    if (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS == m_nms_metadata->outputs_metadata().begin()->second.format.order) {
+        fill_nms_detections_format_buffer(dst_view, detections, classes_detections_count, m_nms_metadata->nms_config());
+    } else {
+        fill_nms_format_buffer(dst_view, detections, classes_detections_count, m_nms_metadata->nms_config());
+    }
     return HAILO_SUCCESS;
 }
 
@@ -199,15 +199,19 @@ public:
         dst->score = (uint16_t)((*((uint64_t*)proposal) & 0xffff000000000000) >> 48);
     }
 
-    static std::pair<std::vector<net_flow::DetectionBbox>, std::vector<uint32_t>>
-        transform__d2h_NMS_DETECTIONS(const uint8_t *src_ptr, const hailo_nms_info_t &nms_info)
+    /**
+     * Parses a frame in HAILO_NMS format (float32) into @a detections and @a classes_detection_count.
+     * The vectors are cleared before parsing, so they can be reused between frames without allocating (as long as
+     * their capacity fits the frame).
+     */
+    static void transform__d2h_NMS_DETECTIONS(const uint8_t *src_ptr, const hailo_nms_info_t &nms_info,
+        std::vector<net_flow::DetectionBbox> &detections, std::vector<uint32_t> &classes_detection_count)
     {
         /* Validate arguments */
         assert(NULL != src_ptr);
 
-        std::vector<net_flow::DetectionBbox> detections;
-        std::vector<uint32_t> classes_detection_count(nms_info.number_of_classes, 0);
-        detections.reserve(nms_info.max_bboxes_per_class * nms_info.number_of_classes);
+        detections.clear();
+        classes_detection_count.assign(nms_info.number_of_classes, 0);
 
         const uint32_t bbox_size = sizeof(hailo_bbox_float32_t);
 
@@ -215,20 +219,16 @@ public:
 
         size_t current_offset = 0;
         // Now, the merge itself
-        for (size_t class_index = 0; class_index < nms_info.number_of_classes ; class_index++) {
+        for (uint32_t class_index = 0; class_index < nms_info.number_of_classes ; class_index++) {
             class_bboxes_count = *(reinterpret_cast<const float32_t*>(src_ptr + current_offset));
             classes_detection_count[class_index] += (uint32_t)class_bboxes_count;
             current_offset += sizeof(float32_t);
             for (nms_bbox_counter_t bbox_count = 0; bbox_count < class_bboxes_count; bbox_count++) {
-                hailo_bbox_float32_t bbox = *(reinterpret_cast<const hailo_bbox_float32_t*>(src_ptr + current_offset));
-                DetectionBbox detection_bbox;
-                detection_bbox.m_class_id = (uint32_t)class_index;
-                detection_bbox.m_bbox = bbox;
-                detections.push_back(detection_bbox);
+                const auto &bbox = *(reinterpret_cast<const hailo_bbox_float32_t*>(src_ptr + current_offset));
+                detections.emplace_back(bbox, class_index);
                 current_offset += bbox_size;
             }
         }
-        return std::make_pair(std::move(detections), std::move(classes_detection_count));
     }
 
     /*
@@ -242,6 +242,23 @@ public:
     */
     static void fill_nms_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
         std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config);
+    // Same as above, using @a num_of_detections_before as a scratch buffer (to avoid allocating it on each frame).
+    static void fill_nms_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+        std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config,
+        std::vector<uint32_t> &num_of_detections_before);
+
+    /*
+    * Fill @a buffer with the detections in HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS format:
+    *       \code
+    *       struct (packed) {
+    *           uint32_t detections_count;
+    *           hailo_detection_t detections[detections_count];
+    *       };
+    *       \endcode
+    * @a detections must be sorted by score. Only the used part of @a buffer is written.
+    */
+    static void fill_nms_detections_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+        std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config);
 
 protected:
     NmsPostProcessOp(std::shared_ptr<NmsOpMetadata> metadata)
@@ -34,11 +34,11 @@ hailo_status SoftmaxPostProcessOp::execute_not_supported(const BufferMetaData &i
         return HAILO_INVALID_ARGUMENT;
     }
 
-SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][SOFTMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][SOFTMAX_NUM_OF_POSSIBLE_FORMAT_TYPES]
+SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][SOFTMAX_NUM_OF_POSSIBLE_INPUT_FORMAT_TYPES][SOFTMAX_NUM_OF_POSSIBLE_OUTPUT_FORMAT_TYPES]
 {
     // Currently supported on:
-    // NC, float_32 to NC, float_32
-    // NHWC, float_32 to NHWC, float_32
+    // NC, float_32 to NC, float_32/float_16/bfloat_16
+    // NHWC, float_32 to NHWC, float_32/float_16/bfloat_16
     {
         {
             // NHWC x AUTO
@@ -46,6 +46,8 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported
         },
         {
@@ -54,6 +56,8 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported
         },
         {
@@ -62,6 +66,8 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported
         },
         {
@@ -69,7 +75,9 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of AUTO
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT8
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT16
-            SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis<float32_t, float32_t>
+            SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis<float32_t, float32_t>,
+            SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis<float32_t, Float16>,
+            SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis<float32_t, BFloat16>
         }
     },
     {
@@ -79,6 +87,8 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported
         },
         {
@@ -88,6 +98,8 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported
         },
         {
             // NC x UINT16
@@ -96,6 +108,8 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
             SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported,
+            SoftmaxPostProcessOp::execute_not_supported
         },
         {
             // NC x FLOAT32
@@ -103,6 +117,8 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT8
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT16
             SoftmaxPostProcessOp::NC_to_NC<float32_t, float32_t>,
+            SoftmaxPostProcessOp::NC_to_NC<float32_t, Float16>,
+            SoftmaxPostProcessOp::NC_to_NC<float32_t, BFloat16>
         }
     }
 };
@@ -191,10 +207,12 @@ hailo_status SoftmaxOpMetadata::validate_format_info()
         HAILO_INVALID_OPERATION, "The given input format type {} is not supported, should be {}",
         HailoRTCommon::get_format_type_str(input_metadata.format.type),
         HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
-    CHECK(output_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32,
-        HAILO_INVALID_OPERATION, "The given output format type {} is not valid, should be {}",
+    CHECK(HailoRTCommon::is_float_type(output_metadata.format.type),
+        HAILO_INVALID_OPERATION, "The given output format type {} is not valid, should be {}, {} or {}",
         HailoRTCommon::get_format_type_str(output_metadata.format.type),
-        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
+        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32),
+        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT16),
+        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_BFLOAT16));
     CHECK(!(HAILO_FORMAT_FLAGS_HOST_ARGMAX & output_metadata.format.flags), HAILO_INVALID_ARGUMENT, "Output {} is marked as argmax, which is not supported for this model.",
         m_outputs_metadata.begin()->first);
     CHECK(!(HAILO_FORMAT_FLAGS_QUANTIZED & output_metadata.format.flags), HAILO_INVALID_ARGUMENT, "Output {} is marked as quantized, which is not supported for this model.",
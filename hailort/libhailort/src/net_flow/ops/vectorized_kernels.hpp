@@ -0,0 +1,239 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file vectorized_kernels.hpp
+ * @brief Softmax and argmax kernels used by the post-process ops and transformations.
+ *
+ * The kernels are written so the compiler vectorizes their inner loops (SSE/AVX on x86, NEON on ARM) without using
+ * intrinsics: the hot loops run over contiguous memory, have no data dependent branches (selects only), and
+ * reductions are split into VECTOR_LANES independent accumulators.
+ **/
+
+#ifndef _HAILO_VECTORIZED_KERNELS_HPP_
+#define _HAILO_VECTORIZED_KERNELS_HPP_
+
+#include "hailo/hailort.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+
+namespace hailort
+{
+namespace net_flow
+{
+
+class VectorizedKernels final
+{
+public:
+    VectorizedKernels() = delete;
+
+    static constexpr uint32_t VECTOR_LANES = 8;
+
+    /**
+     * Branchless expf approximation (Cephes polynomial), max relative error ~2e-7.
+     * Inputs are clamped to [EXP_MIN_INPUT, EXP_MAX_INPUT], so the result is always a normal float.
+     */
+    static inline float32_t fast_exp(float32_t x)
+    {
+        constexpr float32_t EXP_MIN_INPUT = -87.33654f;
+        constexpr float32_t EXP_MAX_INPUT = 88.37626f;
+        constexpr float32_t LOG2E = 1.44269504088896341f;
+        constexpr float32_t LN2_HI = 0.693359375f;
+        constexpr float32_t LN2_LO = -2.12194440e-4f;
+        // Adding and subtracting 1.5 * 2^23 rounds to the nearest integer
+        constexpr float32_t ROUND_MAGIC = 12582912.0f;
+
+        // Both bounds are computed and then selected, so the compiler keeps a single path (sequential clamps are
+        // split into branches, which prevents vectorizing the calling loop).
+        const float32_t clamped_min = (x < EXP_MIN_INPUT) ? EXP_MIN_INPUT : x;
+        const float32_t clamped_max = (x > EXP_MAX_INPUT) ? EXP_MAX_INPUT : x;
+        x = (x < 0) ? clamped_min : clamped_max;
+
+        // exp(x) = 2^n * exp(r), where n = round(x / ln(2)) and |r| <= ln(2) / 2
+        const float32_t n = ((x * LOG2E) + ROUND_MAGIC) - ROUND_MAGIC;
+        const float32_t r = (x - (n * LN2_HI)) - (n * LN2_LO);
+
+        float32_t p = 1.9875691500e-4f;
+        p = (p * r) + 1.3981999507e-3f;
+        p = (p * r) + 8.3334519073e-3f;
+        p = (p * r) + 4.1665795894e-2f;
+        p = (p * r) + 1.6666665459e-1f;
+        p = (p * r) + 5.0000001201e-1f;
+        const float32_t exp_r = (p * r * r) + r + 1.0f;
+
+        const uint32_t pow2n_bits = static_cast<uint32_t>(static_cast<int32_t>(n) + 127) << 23;
+        float32_t pow2n = 0;
+        std::memcpy(&pow2n, &pow2n_bits, sizeof(pow2n));
+        return exp_r * pow2n;
+    }
+
+    template<typename T>
+    static inline T max_value(const T *src, uint32_t count)
+    {
+        if (std::is_floating_point<T>::value) {
+            // Floating point reductions aren't reordered by the compiler, so the max is split into independent lanes
+            T partial_max[VECTOR_LANES];
+            std::fill_n(partial_max, VECTOR_LANES, src[0]);
+            uint32_t i = 0;
+            for (; (i + VECTOR_LANES) <= count; i += VECTOR_LANES) {
+                for (uint32_t lane = 0; lane < VECTOR_LANES; lane++) {
+                    partial_max[lane] = (src[i + lane] > partial_max[lane]) ? src[i + lane] : partial_max[lane];
+                }
+            }
+            for (; i < count; i++) {
+                partial_max[0] = (src[i] > partial_max[0]) ? src[i] : partial_max[0];
+            }
+            return *std::max_element(partial_max, partial_max + VECTOR_LANES);
+        }
+
+        // Written as a select (not std::max) so the compiler recognizes the max reduction
+        T max_val = src[0];
+        for (uint32_t i = 1; i < count; i++) {
+            max_val = (src[i] > max_val) ? src[i] : max_val;
+        }
+        return max_val;
+    }
+
+    /**
+     * Softmax over @a count contiguous values. @a src is not modified (it may not alias @a dst).
+     */
+    static inline void softmax(const float32_t *src, float32_t *dst, uint32_t count)
+    {
+        // Subtracting the max value preserves the softmax values and prevents overflows
+        const auto max_val = max_value(src, count);
+        for (uint32_t i = 0; i < count; i++) {
+            dst[i] = fast_exp(src[i] - max_val);
+        }
+
+        float32_t partial_sum[VECTOR_LANES] = {};
+        uint32_t i = 0;
+        for (; (i + VECTOR_LANES) <= count; i += VECTOR_LANES) {
+            for (uint32_t lane = 0; lane < VECTOR_LANES; lane++) {
+                partial_sum[lane] += dst[i + lane];
+            }
+        }
+        for (; i < count; i++) {
+            partial_sum[0] += dst[i];
+        }
+        float32_t sum_exp = 0;
+        for (uint32_t lane = 0; lane < VECTOR_LANES; lane++) {
+            sum_exp += partial_sum[lane];
+        }
+
+        const float32_t inv_sum_exp = 1.0f / sum_exp;
+        for (i = 0; i < count; i++) {
+            dst[i] *= inv_sum_exp;
+        }
+    }
+
+    /**
+     * Softmax over @a count contiguous values into a half precision destination (::hailort::Float16 or
+     * ::hailort::BFloat16). The exponents are computed in float32 in chunks - once for the sum and once for the
+     * result - and each chunk of results is converted with DstType::convert.
+     */
+    template<typename DstType>
+    static inline void softmax(const float32_t *src, DstType *dst, uint32_t count)
+    {
+        constexpr uint32_t CHUNK_SIZE = 256;
+        float32_t exps[CHUNK_SIZE];
+
+        const auto max_val = max_value(src, count);
+        float32_t partial_sum[VECTOR_LANES] = {};
+        for (uint32_t chunk_start = 0; chunk_start < count; chunk_start += CHUNK_SIZE) {
+            const uint32_t chunk_size = std::min(CHUNK_SIZE, count - chunk_start);
+            for (uint32_t i = 0; i < chunk_size; i++) {
+                exps[i] = fast_exp(src[chunk_start + i] - max_val);
+            }
+            // Unused lanes of the last chunk are zeroed, so the whole chunk is summed in VECTOR_LANES steps
+            const uint32_t aligned_chunk_size = ((chunk_size + VECTOR_LANES - 1) / VECTOR_LANES) * VECTOR_LANES;
+            std::fill(exps + chunk_size, exps + aligned_chunk_size, 0.0f);
+            for (uint32_t i = 0; i < aligned_chunk_size; i += VECTOR_LANES) {
+                for (uint32_t lane = 0; lane < VECTOR_LANES; lane++) {
+                    partial_sum[lane] += exps[i + lane];
+                }
+            }
+        }
+        float32_t sum_exp = 0;
+        for (uint32_t lane = 0; lane < VECTOR_LANES; lane++) {
+            sum_exp += partial_sum[lane];
+        }
+
+        const float32_t inv_sum_exp = 1.0f / sum_exp;
+        for (uint32_t chunk_start = 0; chunk_start < count; chunk_start += CHUNK_SIZE) {
+            const uint32_t chunk_size = std::min(CHUNK_SIZE, count - chunk_start);
+            for (uint32_t i = 0; i < chunk_size; i++) {
+                exps[i] = fast_exp(src[chunk_start + i] - max_val) * inv_sum_exp;
+            }
+            DstType::convert(exps, dst + chunk_start, chunk_size);
+        }
+    }
+
+    /**
+     * Index of the (first) max value of @a count contiguous values.
+     */
+    template<typename T>
+    static inline uint32_t argmax(const T *src, uint32_t count)
+    {
+        // For short vectors a single pass is faster than the max reduction followed by a search
+        constexpr uint32_t MIN_COUNT_FOR_REDUCTION = 64;
+        if (count < MIN_COUNT_FOR_REDUCTION) {
+            T max_val = src[0];
+            uint32_t max_index = 0;
+            for (uint32_t i = 1; i < count; i++) {
+                if (src[i] > max_val) {
+                    max_val = src[i];
+                    max_index = i;
+                }
+            }
+            return max_index;
+        }
+
+        const auto max_val = max_value(src, count);
+        const auto max_index = static_cast<uint32_t>(std::find(src, src + count, max_val) - src);
+        // Not found only if the max value is NaN
+        return (max_index < count) ? max_index : 0;
+    }
+
+    /**
+     * Argmax over planar features - feature c of element w is src[c * feature_stride + w]. For each of the @a width
+     * elements, the index of the (first) max feature is written to @a dst.
+     * The running max is kept per element, so every feature plane is scanned contiguously.
+     */
+    template<typename SrcType, typename DstType>
+    static inline void planar_argmax(const SrcType *src, uint32_t feature_stride, uint32_t features, uint32_t width,
+        DstType *dst)
+    {
+        constexpr uint32_t CHUNK_SIZE = 256;
+        SrcType max_values[CHUNK_SIZE];
+        uint32_t max_indices[CHUNK_SIZE];
+
+        for (uint32_t chunk_start = 0; chunk_start < width; chunk_start += CHUNK_SIZE) {
+            const uint32_t chunk_size = std::min(CHUNK_SIZE, width - chunk_start);
+            std::copy_n(src + chunk_start, chunk_size, max_values);
+            std::fill_n(max_indices, chunk_size, 0);
+
+            for (uint32_t c = 1; c < features; c++) {
+                const SrcType *plane = src + (c * feature_stride) + chunk_start;
+                for (uint32_t i = 0; i < chunk_size; i++) {
+                    const bool is_greater = plane[i] > max_values[i];
+                    max_values[i] = is_greater ? plane[i] : max_values[i];
+                    max_indices[i] = is_greater ? c : max_indices[i];
+                }
+            }
+
+            for (uint32_t i = 0; i < chunk_size; i++) {
+                dst[chunk_start + i] = static_cast<DstType>(max_indices[i]);
+            }
+        }
+    }
+};
+
+} /* namespace net_flow */
+} /* namespace hailort */
+
+#endif /* _HAILO_VECTORIZED_KERNELS_HPP_ */
@@ -48,9 +48,10 @@ Expected<std::shared_ptr<OpMetadata>> Yolov5SegOpMetadata::create(const std::uno
 hailo_status Yolov5SegOpMetadata::validate_format_info()
 {
     for (const auto& output_metadata : m_outputs_metadata) {
-        CHECK(HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == output_metadata.second.format.order, HAILO_INVALID_ARGUMENT,
-            "The given output format order {} is not supported, should be `HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK`",
-            HailoRTCommon::get_format_order_str(output_metadata.second.format.order));
+        CHECK((HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == output_metadata.second.format.order) ||
+            (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK == output_metadata.second.format.order), HAILO_INVALID_ARGUMENT,
+            "The given output format order {} is not supported, should be `HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK` or "
+            "`HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK`", HailoRTCommon::get_format_order_str(output_metadata.second.format.order));
 
         CHECK(HAILO_FORMAT_TYPE_FLOAT32 == output_metadata.second.format.type, HAILO_INVALID_ARGUMENT,
             "The given output format type {} is not supported, should be `HAILO_FORMAT_TYPE_FLOAT32`",
@@ -172,7 +173,13 @@ hailo_status Yolov5SegPostProcess::execute(const std::map<std::string, MemoryVie
     }
 
     remove_overlapping_boxes(detections, classes_detections_count, m_metadata->nms_config().nms_iou_th);
-    auto status = fill_nms_with_byte_mask_format(outputs.begin()->second, detections, classes_detections_count);
+    hailo_status status = HAILO_UNINITIALIZED;
+    assert(1 == m_metadata->outputs_metadata().size());
+    if (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK == m_metadata->outputs_metadata().begin()->second.format.order) {
+        status = fill_nms_detections_with_byte_mask_format(outputs.begin()->second, detections, classes_detections_count);
+    } else {
+        status = fill_nms_with_byte_mask_format(outputs.begin()->second, detections, classes_detections_count);
+    }
     CHECK_SUCCESS(status);
 
     return HAILO_SUCCESS;
@@ -199,6 +206,7 @@ void Yolov5SegPostProcess::mult_mask_vector_and_proto_matrix(const DetectionBbox
     }
 }
 
+template<typename DstType>
 hailo_status Yolov5SegPostProcess::crop_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset)
 {
     auto &yolov5_config = m_metadata->yolov5_config();
@@ -213,22 +221,27 @@ hailo_status Yolov5SegPostProcess::crop_and_copy_mask(const DetectionBbox &detec
         static_cast<uint32_t>(yolov5_config.image_height), 0, 1, STBIR_ALPHA_CHANNEL_NONE, 0,
         STBIR_EDGE_CLAMP, STBIR_FILTER_TRIANGLE, STBIR_COLORSPACE_LINEAR, NULL);
 
+    auto image_width = static_cast<uint32_t>(yolov5_config.image_width);
+    auto image_height = static_cast<uint32_t>(yolov5_config.image_height);
     auto x_min = static_cast<uint32_t>(std::round(detection.m_bbox.x_min * yolov5_config.image_width));
-    auto x_max = static_cast<uint32_t>(std::round(detection.m_bbox.x_max * yolov5_config.image_width));
     auto y_min = static_cast<uint32_t>(std::round(detection.m_bbox.y_min * yolov5_config.image_height));
-    auto y_max = static_cast<uint32_t>(std::round(detection.m_bbox.y_max * yolov5_config.image_height));
     auto box_width = detection.get_bbox_rounded_width(yolov5_config.image_width);
+    auto box_height = detection.get_bbox_rounded_height(yolov5_config.image_height);
 
-    float32_t *dst_mask = (float32_t*)(buffer.data() + buffer_offset);
-    for (uint32_t i = y_min; i <= y_max; i++) {
-        for (uint32_t j = x_min; j <= x_max; j++) {
-            auto image_mask_idx = (i * static_cast<uint32_t>(yolov5_config.image_width)) + j;
+    // The mask is written in the bbox dimensions (the size returned from get_mask_size()), clamped to the image.
+    auto x_end = std::min(x_min + box_width, image_width);
+    auto y_end = std::min(y_min + box_height, image_height);
+    assert((buffer_offset + (box_width * box_height * sizeof(DstType))) <= buffer.size());
+    DstType *dst_mask = (DstType*)(buffer.data() + buffer_offset);
+    for (uint32_t i = y_min; i < y_end; i++) {
+        for (uint32_t j = x_min; j < x_end; j++) {
+            auto image_mask_idx = (i * image_width) + j;
             auto cropped_mask_idx = ((i-y_min) * box_width) + (j-x_min);
 
             if (resized_mask_to_image_dim_ptr[image_mask_idx] > mask_threshold) {
-                dst_mask[cropped_mask_idx] = 1.0f;
+                dst_mask[cropped_mask_idx] = static_cast<DstType>(1);
             } else {
-                dst_mask[cropped_mask_idx] = 0.0f;
+                dst_mask[cropped_mask_idx] = static_cast<DstType>(0);
             }
         }
     }
@@ -236,10 +249,11 @@ hailo_status Yolov5SegPostProcess::crop_and_copy_mask(const DetectionBbox &detec
     return HAILO_SUCCESS;
 }
 
+template<typename DstType>
 hailo_status Yolov5SegPostProcess::calc_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset)
 {
     mult_mask_vector_and_proto_matrix(detection);
-    auto status = crop_and_copy_mask(detection, buffer, buffer_offset);
+    auto status = crop_and_copy_mask<DstType>(detection, buffer, buffer_offset);
     CHECK_SUCCESS(status);
 
     return HAILO_SUCCESS;
@@ -280,7 +294,7 @@ Expected<uint32_t> Yolov5SegPostProcess::copy_detection_to_result_buffer(MemoryV
     detection_byte_size += size_to_copy;
 
     // Calc and copy mask
-    auto status = calc_and_copy_mask(detection, buffer, buffer_offset);
+    auto status = calc_and_copy_mask<float32_t>(detection, buffer, buffer_offset);
     CHECK_SUCCESS_AS_EXPECTED(status);
     detection_byte_size += static_cast<uint32_t>(mask_size_bytes);
 
@@ -370,5 +384,56 @@ hailo_status Yolov5SegPostProcess::fill_nms_with_byte_mask_format(MemoryView &bu
     return HAILO_SUCCESS;
 }
 
+hailo_status Yolov5SegPostProcess::fill_nms_detections_with_byte_mask_format(MemoryView &buffer,
+    const std::vector<DetectionBbox> &detections, std::vector<uint32_t> &classes_detections_count)
+{
+    const auto &nms_config = m_metadata->nms_config();
+    uint32_t ignored_detections_count = 0;
+    for (size_t class_idx = 0; class_idx < nms_config.number_of_classes; class_idx++) {
+        if (classes_detections_count[class_idx] > nms_config.max_proposals_per_class) {
+            ignored_detections_count += (classes_detections_count[class_idx] - nms_config.max_proposals_per_class);
+            classes_detections_count[class_idx] = nms_config.max_proposals_per_class;
+        }
+    }
+
+    uint32_t detections_count = 0;
+    uint32_t buffer_offset = sizeof(detections_count);
+    for (const auto &detection : detections) {
+        if (REMOVED_CLASS_SCORE == detection.m_bbox.score) {
+            // Detection was removed in remove_overlapping_boxes()
+            continue;
+        }
+        if (0 == classes_detections_count[detection.m_class_id]) {
+            // This class' detections count is higher then m_nms_config.max_proposals_per_class.
+            // This detection is ignored due to having lower score (detections vector is sorted by score).
+            continue;
+        }
+
+        const hailo_detection_t dst_detection{detection.m_bbox, detection.m_class_id};
+        const uint32_t mask_size = get_mask_size(detection);
+        CHECK((buffer_offset + sizeof(dst_detection) + sizeof(mask_size) + mask_size) <= buffer.size(), HAILO_INTERNAL_FAILURE,
+            "Detection mask exceeds the output buffer (buffer size {})", buffer.size());
+
+        memcpy(buffer.data() + buffer_offset, &dst_detection, sizeof(dst_detection));
+        buffer_offset += static_cast<uint32_t>(sizeof(dst_detection));
+        memcpy(buffer.data() + buffer_offset, &mask_size, sizeof(mask_size));
+        buffer_offset += static_cast<uint32_t>(sizeof(mask_size));
+        auto status = calc_and_copy_mask<uint8_t>(detection, buffer, buffer_offset);
+        CHECK_SUCCESS(status);
+        buffer_offset += mask_size;
+
+        detections_count++;
+        classes_detections_count[detection.m_class_id]--;
+    }
+    memcpy(buffer.data(), &detections_count, sizeof(detections_count));
+
+    if (0 != ignored_detections_count) {
+        LOGGER__INFO("{} Detections were ignored, due to `max_bboxes_per_class` defined as {}.",
+            ignored_detections_count, nms_config.max_proposals_per_class);
+    }
+
+    return HAILO_SUCCESS;
+}
+
 } /* namespace net_flow */
 } /* namespace hailort */
@@ -100,10 +100,17 @@ private:
 
     hailo_status fill_nms_with_byte_mask_format(MemoryView &buffer, std::vector<DetectionBbox> &detections,
         std::vector<uint32_t> &classes_detections_count);
+    // Fills HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK - the detections are kept in score order (no sort
+    // by class is needed), and each mask pixel is written as a single byte.
+    hailo_status fill_nms_detections_with_byte_mask_format(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+        std::vector<uint32_t> &classes_detections_count);
     void mult_mask_vector_and_proto_matrix(const DetectionBbox &detection);
     uint32_t get_mask_size(const DetectionBbox &detection);
 
+    // DstType is the type of each mask pixel in the result buffer (float32_t or uint8_t)
+    template<typename DstType>
     hailo_status calc_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset);
+    template<typename DstType>
     hailo_status crop_and_copy_mask(const DetectionBbox &detection, MemoryView &buffer, uint32_t buffer_offset);
     uint32_t copy_zero_bbox_count(MemoryView &buffer, uint32_t classes_with_zero_detections_count, uint32_t buffer_offset);
     uint32_t copy_bbox_count_to_result_buffer(MemoryView &buffer, uint32_t class_detection_count, uint32_t buffer_offset);
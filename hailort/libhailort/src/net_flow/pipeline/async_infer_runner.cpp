@@ -98,9 +98,9 @@ AsyncInferRunnerInternal::AsyncInferRunnerInternal() :
 
 Expected<std::shared_ptr<AsyncInferRunnerImpl>> AsyncInferRunnerImpl::create(ConfiguredNetworkGroupBase &net_group,
     const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
-    const uint32_t timeout)
+    const std::unordered_map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params, const uint32_t timeout)
 {
-    auto async_pipeline_expected = create_pipeline(net_group, inputs_formats, outputs_formats, timeout);
+    auto async_pipeline_expected = create_pipeline(net_group, inputs_formats, outputs_formats, inputs_preprocess_params, timeout);
     CHECK_EXPECTED(async_pipeline_expected);
 
     auto async_infer_runner_ptr = make_shared_nothrow<AsyncInferRunnerImpl>(async_pipeline_expected.release());
@@ -324,7 +324,8 @@ Expected<std::unordered_map<std::string, std::shared_ptr<OutputStream>>> AsyncIn
 
 hailo_status AsyncInferRunnerImpl::create_pre_async_hw_elements(ConfiguredNetworkGroupBase &net_group,
         std::unordered_map<std::string, std::shared_ptr<InputStream>> &input_streams,
-        const std::unordered_map<std::string, hailo_format_t> &inputs_formats, AsyncPipeline &async_pipeline)
+        const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
+        const std::unordered_map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params, AsyncPipeline &async_pipeline)
 {
     bool is_dma_able = true;
     for (auto &input_stream_pair : input_streams) {
@@ -338,6 +339,16 @@ hailo_status AsyncInferRunnerImpl::create_pre_async_hw_elements(ConfiguredNetwor
         auto sink_index = async_pipeline.get_async_hw_element()->get_sink_index_from_input_stream_name(input_stream_name);
         CHECK_EXPECTED_AS_STATUS(sink_index);
 
+        hailo_image_preprocess_params_t preprocess_params{};
+        for (const auto &vstream_name : vstream_names.value()) {
+            if (contains(inputs_preprocess_params, vstream_name)) {
+                preprocess_params = inputs_preprocess_params.at(vstream_name);
+            }
+        }
+        const bool has_image_preprocess = (HAILO_IMAGE_COLOR_FORMAT_NONE != preprocess_params.color_format);
+        CHECK(!has_image_preprocess || (1 == vstream_names->size()), HAILO_NOT_SUPPORTED,
+            "Image pre-process is not supported for multi-planar input {}", input_stream_name);
+
         auto should_transform = InputTransformContext::is_transformation_required(input_stream_info.shape,
             inputs_formats.at(input_stream_name), input_stream_info.hw_shape, input_stream_info.format,
             input_stream_base->get_quant_infos());
@@ -347,17 +358,28 @@ hailo_status AsyncInferRunnerImpl::create_pre_async_hw_elements(ConfiguredNetwor
             async_pipeline, nullptr);
         CHECK_EXPECTED_AS_STATUS(entry_queue_elem);
 
-        if (should_transform.value()) {
-            auto pre_infer_elem = PreInferElement::create(input_stream_info.shape, inputs_formats.at(input_stream_name),
-                input_stream_info.hw_shape, input_stream_info.format, input_stream_base->get_quant_infos(),
-                PipelineObject::create_element_name("PreInferElement", input_stream_info.name, input_stream_info.index),
-                async_pipeline.get_build_params(), PipelineDirection::PUSH, is_dma_able);
-            CHECK_EXPECTED_AS_STATUS(pre_infer_elem);
-            async_pipeline.add_element_to_pipeline(pre_infer_elem.value());
-            CHECK_SUCCESS(PipelinePad::link_pads(entry_queue_elem.value(), pre_infer_elem.value()));
+        if (has_image_preprocess || should_transform.value()) {
+            std::shared_ptr<FilterElement> pre_infer_elem;
+            if (has_image_preprocess) {
+                auto image_preprocess_elem = ImagePreprocessElement::create(preprocess_params, input_stream_info.shape,
+                    input_stream_info.hw_shape, input_stream_info.format, input_stream_base->get_quant_infos(),
+                    PipelineObject::create_element_name("ImagePreprocessElement", input_stream_info.name, input_stream_info.index),
+                    async_pipeline.get_build_params(), PipelineDirection::PUSH, is_dma_able);
+                CHECK_EXPECTED_AS_STATUS(image_preprocess_elem);
+                pre_infer_elem = image_preprocess_elem.release();
+            } else {
+                auto transform_elem = PreInferElement::create(input_stream_info.shape, inputs_formats.at(input_stream_name),
+                    input_stream_info.hw_shape, input_stream_info.format, input_stream_base->get_quant_infos(),
+                    PipelineObject::create_element_name("PreInferElement", input_stream_info.name, input_stream_info.index),
+                    async_pipeline.get_build_params(), PipelineDirection::PUSH, is_dma_able);
+                CHECK_EXPECTED_AS_STATUS(transform_elem);
+                pre_infer_elem = transform_elem.release();
+            }
+            async_pipeline.add_element_to_pipeline(pre_infer_elem);
+            CHECK_SUCCESS(PipelinePad::link_pads(entry_queue_elem.value(), pre_infer_elem));
 
             auto queue_elem = add_push_queue_element(PipelineObject::create_element_name("PushQueueElement", input_stream_info.name, input_stream_info.index),
-                async_pipeline, pre_infer_elem.value());
+                async_pipeline, pre_infer_elem);
             CHECK_EXPECTED_AS_STATUS(queue_elem);
 
             CHECK_SUCCESS(PipelinePad::link_pads(queue_elem.value(), async_pipeline.get_async_hw_element(), 0, sink_index.value()));
@@ -411,58 +433,22 @@ Expected<std::shared_ptr<AsyncPushQueueElement>> AsyncInferRunnerImpl::add_push_
     return push_queue_elem.release();
 }
 
-Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> AsyncInferRunnerImpl::add_nms_to_detections_convert_element(AsyncPipeline &async_pipeline,
-    std::shared_ptr<OutputStream> output_stream, const std::string &element_name, const net_flow::PostProcessOpMetadataPtr &op_metadata,
-    const bool is_last_copy_element, std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_index)
-{
-    auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
-    assert(nullptr != metadata);
-
-    auto nms_to_detections_element = ConvertNmsToDetectionsElement::create(metadata->nms_info(),
-        PipelineObject::create_element_name(element_name, output_stream->name(), output_stream->get_info().index),
-        async_pipeline.get_build_params(), PipelineDirection::PUSH, is_last_copy_element);
-    CHECK_EXPECTED(nms_to_detections_element);
-
-    async_pipeline.add_element_to_pipeline(nms_to_detections_element.value());
-
-    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(final_elem, nms_to_detections_element.value(), final_elem_index, 0));
-    return nms_to_detections_element.release();
-}
-
-Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> AsyncInferRunnerImpl::add_remove_overlapping_bboxes_element(AsyncPipeline &async_pipeline,
-    std::shared_ptr<OutputStream> output_stream, const std::string &element_name, const net_flow::PostProcessOpMetadataPtr &op_metadata,
-    const bool is_last_copy_element, std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_index)
-{
-    auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
-    assert(nullptr != metadata);
-
-    auto remove_overlapping_bboxes_element = RemoveOverlappingBboxesElement::create(metadata->nms_config(),
-        PipelineObject::create_element_name(element_name, output_stream->name(), output_stream->get_info().index),
-        async_pipeline.get_build_params(), PipelineDirection::PUSH, is_last_copy_element);
-    CHECK_EXPECTED(remove_overlapping_bboxes_element);
-
-    async_pipeline.add_element_to_pipeline(remove_overlapping_bboxes_element.value());
-
-    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(final_elem, remove_overlapping_bboxes_element.value(), final_elem_index, 0));
-    return remove_overlapping_bboxes_element;
-}
-
-Expected<std::shared_ptr<FillNmsFormatElement>> AsyncInferRunnerImpl::add_fill_nms_format_element(AsyncPipeline &async_pipeline,
+Expected<std::shared_ptr<HostNmsElement>> AsyncInferRunnerImpl::add_host_nms_element(AsyncPipeline &async_pipeline,
     std::shared_ptr<OutputStream> output_stream, const std::string &element_name, const net_flow::PostProcessOpMetadataPtr &op_metadata,
     const hailo_format_t &output_format, const bool is_last_copy_element, std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_index)
 {
     auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
     assert(nullptr != metadata);
 
-    auto fill_nms_format_element = FillNmsFormatElement::create(metadata->nms_info(), output_format, metadata->nms_config(),
+    auto host_nms_element = HostNmsElement::create(metadata->nms_info(), output_format, metadata->nms_config(),
         PipelineObject::create_element_name(element_name, output_stream->name(), output_stream->get_info().index),
         async_pipeline.get_build_params(), PipelineDirection::PUSH, is_last_copy_element);
-    CHECK_EXPECTED(fill_nms_format_element);
+    CHECK_EXPECTED(host_nms_element);
 
-    async_pipeline.add_element_to_pipeline(fill_nms_format_element.value());
+    async_pipeline.add_element_to_pipeline(host_nms_element.value());
 
-    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(final_elem, fill_nms_format_element.value(), final_elem_index, 0));
-    return fill_nms_format_element;
+    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(final_elem, host_nms_element.value(), final_elem_index, 0));
+    return host_nms_element;
 }
 
 Expected<std::shared_ptr<LastAsyncElement>> AsyncInferRunnerImpl::add_last_async_element(AsyncPipeline &async_pipeline,
@@ -729,7 +715,8 @@ hailo_status AsyncInferRunnerImpl::add_nms_flow(AsyncPipeline &async_pipeline, O
     CHECK(output_format.second.type == HAILO_FORMAT_TYPE_FLOAT32, HAILO_INVALID_ARGUMENT,
         "NMS output format type must be HAILO_FORMAT_TYPE_FLOAT32");
     CHECK(HailoRTCommon::is_nms(output_format.second.order), HAILO_INVALID_ARGUMENT,
-        "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK");
+        "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS, HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK, "
+        "HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS or HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK");
 
     std::unordered_map<std::string, net_flow::BufferMetaData> inputs_metadata;
     std::unordered_map<std::string, net_flow::BufferMetaData> outputs_metadata;
@@ -816,27 +803,11 @@ hailo_status AsyncInferRunnerImpl::add_iou_flow( AsyncPipeline &async_pipeline,
         async_pipeline, post_infer_element.value());
     CHECK_EXPECTED_AS_STATUS(pre_nms_convert_queue_element);
 
-    auto nms_to_detections_element = add_nms_to_detections_convert_element(async_pipeline, output_stream, "NmsFormatToDetectionsElement", iou_op_metadata,
-        false, pre_nms_convert_queue_element.value());
-    CHECK_EXPECTED_AS_STATUS(nms_to_detections_element);
-
-    auto pre_remove_overlapping_bboxes_element_queue_element = add_push_queue_element(PipelineObject::create_element_name("PullQueueElement_pre_bboxes_removing", output_stream->name(), output_stream->get_info().index),
-        async_pipeline, nms_to_detections_element.value());
-    CHECK_EXPECTED_AS_STATUS(pre_remove_overlapping_bboxes_element_queue_element);
-
-    auto remove_overlapping_bboxes_element = add_remove_overlapping_bboxes_element(async_pipeline, output_stream, "RemoveOverlappingBboxesElement", iou_op_metadata,
-        false, pre_remove_overlapping_bboxes_element_queue_element.value());
-    CHECK_EXPECTED_AS_STATUS(remove_overlapping_bboxes_element);
-
-    auto pre_fill_nms_format_element_queue_element = add_push_queue_element(PipelineObject::create_element_name("PullQueueElement_pre_fill_nms_format", output_stream->name(), output_stream->get_info().index),
-        async_pipeline, remove_overlapping_bboxes_element.value());
-    CHECK_EXPECTED_AS_STATUS(pre_fill_nms_format_element_queue_element);
-
-    auto fill_nms_format_element = add_fill_nms_format_element(async_pipeline, output_stream, "FillNmsFormatElement", iou_op_metadata,
-        output_format.second, true, pre_fill_nms_format_element_queue_element.value());
-    CHECK_EXPECTED_AS_STATUS(fill_nms_format_element);
+    auto host_nms_element = add_host_nms_element(async_pipeline, output_stream, "HostNmsElement", iou_op_metadata,
+        output_format.second, true, pre_nms_convert_queue_element.value());
+    CHECK_EXPECTED_AS_STATUS(host_nms_element);
 
-    auto last_async_element = add_last_async_element(async_pipeline, output_format.first, fill_nms_format_element.value());
+    auto last_async_element = add_last_async_element(async_pipeline, output_format.first, host_nms_element.value());
     CHECK_EXPECTED_AS_STATUS(last_async_element);
 
     return HAILO_SUCCESS;
@@ -1006,6 +977,7 @@ hailo_status AsyncInferRunnerImpl::create_post_async_hw_elements(ConfiguredNetwo
 Expected<AsyncPipeline> AsyncInferRunnerImpl::create_pipeline(ConfiguredNetworkGroupBase &net_group,
     const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
     const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
+    const std::unordered_map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params,
     const uint32_t timeout)
 {
     std::unordered_map<std::string, std::shared_ptr<PipelineElement>> entry_elements;
@@ -1073,7 +1045,7 @@ Expected<AsyncPipeline> AsyncInferRunnerImpl::create_pipeline(ConfiguredNetworkG
 
     // TODO: HRT-11759
     hailo_status status = create_pre_async_hw_elements(net_group, input_streams_expected.value(), input_expanded_format.value(),
-        async_pipeline);
+        inputs_preprocess_params, async_pipeline);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     status = create_post_async_hw_elements(net_group, output_expanded_format.value(), outputs_original_formats, async_pipeline);
@@ -76,6 +76,7 @@ class AsyncInferRunnerImpl : public AsyncInferRunnerInternal
 public:
     static Expected<std::shared_ptr<AsyncInferRunnerImpl>> create(ConfiguredNetworkGroupBase &net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
+        const std::unordered_map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params = {},
         const uint32_t timeout = HAILO_DEFAULT_VSTREAM_TIMEOUT_MS);
     AsyncInferRunnerImpl(AsyncInferRunnerImpl &&) = delete;
     AsyncInferRunnerImpl(const AsyncInferRunnerImpl &) = delete;
@@ -104,7 +105,8 @@ public:
 
 protected:
     static Expected<AsyncPipeline> create_pipeline(ConfiguredNetworkGroupBase &net_group, const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
-        const std::unordered_map<std::string, hailo_format_t> &outputs_formats, const uint32_t timeout);
+        const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
+        const std::unordered_map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params, const uint32_t timeout);
 
     hailo_status start_pipeline();
     hailo_status stop_pipeline();
@@ -122,7 +124,8 @@ protected:
 
     static hailo_status create_pre_async_hw_elements(ConfiguredNetworkGroupBase &net_group,
         std::unordered_map<std::string, std::shared_ptr<InputStream>> &input_streams,
-        const std::unordered_map<std::string, hailo_format_t> &inputs_formats, AsyncPipeline &async_pipeline);
+        const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
+        const std::unordered_map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params, AsyncPipeline &async_pipeline);
     static hailo_status create_post_async_hw_elements(ConfiguredNetworkGroupBase &net_group,
         const std::unordered_map<std::string, hailo_format_t> &expanded_outputs_formats, std::unordered_map<std::string, hailo_format_t> &original_outputs_formats,
         AsyncPipeline &async_pipeline);
@@ -156,13 +159,7 @@ protected:
         const std::string &output_format_name, std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index = 0);
     static Expected<std::shared_ptr<AsyncPushQueueElement>> add_push_queue_element(const std::string &queue_name, AsyncPipeline &async_pipeline,
         std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index = 0);
-    static Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> add_nms_to_detections_convert_element(AsyncPipeline &async_pipeline,
-        std::shared_ptr<OutputStream> output_stream, const std::string &element_name, const net_flow::PostProcessOpMetadataPtr &op_metadata,
-        const bool is_last_copy_element, std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index = 0);
-    static Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> add_remove_overlapping_bboxes_element(AsyncPipeline &async_pipeline,
-        std::shared_ptr<OutputStream> output_stream, const std::string &element_name, const net_flow::PostProcessOpMetadataPtr &op_metadata,
-        const bool is_last_copy_element, std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index = 0);
-    static Expected<std::shared_ptr<FillNmsFormatElement>> add_fill_nms_format_element(AsyncPipeline &async_pipeline,
+    static Expected<std::shared_ptr<HostNmsElement>> add_host_nms_element(AsyncPipeline &async_pipeline,
         std::shared_ptr<OutputStream> output_stream, const std::string &element_name, const net_flow::PostProcessOpMetadataPtr &op_metadata,
         const hailo_format_t &output_format, const bool is_last_copy_element, std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index = 0);
 
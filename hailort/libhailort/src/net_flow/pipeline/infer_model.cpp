@@ -28,13 +28,16 @@ std::string InferModel::InferStream::Impl::name() const
 
 size_t InferModel::InferStream::Impl::get_frame_size() const
 {
+    if (HAILO_IMAGE_COLOR_FORMAT_NONE != m_image_preprocess.color_format) {
+        return HailoRTCommon::get_image_frame_size(m_image_preprocess);
+    }
     return HailoRTCommon::get_frame_size(m_vstream_info, m_user_buffer_format);
 }
 
 void InferModel::InferStream::Impl::set_format_type(hailo_format_type_t type)
 {
     m_user_buffer_format.type = type;
-    if (HAILO_FORMAT_TYPE_FLOAT32 == type) {
+    if (HailoRTCommon::is_float_type(type)) {
         m_user_buffer_format.flags = HAILO_FORMAT_FLAGS_NONE;
     } else {
         m_user_buffer_format.flags = HAILO_FORMAT_FLAGS_QUANTIZED;
@@ -51,6 +54,16 @@ hailo_format_t InferModel::InferStream::Impl::get_user_buffer_format()
     return m_user_buffer_format;
 }
 
+void InferModel::InferStream::Impl::set_image_preprocess(const hailo_image_preprocess_params_t &params)
+{
+    m_image_preprocess = params;
+}
+
+hailo_image_preprocess_params_t InferModel::InferStream::Impl::get_image_preprocess()
+{
+    return m_image_preprocess;
+}
+
 InferModel::InferStream::InferStream(std::shared_ptr<InferModel::InferStream::Impl> pimpl) : m_pimpl(pimpl)
 {
 }
@@ -75,14 +88,25 @@ void InferModel::InferStream::set_format_order(hailo_format_order_t order)
     m_pimpl->set_format_order(order);
 }
 
+void InferModel::InferStream::set_image_preprocess(const hailo_image_preprocess_params_t &params)
+{
+    m_pimpl->set_image_preprocess(params);
+}
+
 hailo_format_t InferModel::InferStream::get_user_buffer_format()
 {
     return m_pimpl->get_user_buffer_format();
 }
 
+hailo_image_preprocess_params_t InferModel::InferStream::get_image_preprocess()
+{
+    return m_pimpl->get_image_preprocess();
+}
+
 InferModel::InferModel(VDevice &vdevice, Hef &&hef, std::unordered_map<std::string, InferModel::InferStream> &&inputs,
         std::unordered_map<std::string, InferModel::InferStream> &&outputs)
-    : m_vdevice(vdevice), m_hef(std::move(hef)), m_inputs(std::move(inputs)), m_outputs(std::move(outputs))
+    : m_vdevice(vdevice), m_hef(std::move(hef)), m_inputs(std::move(inputs)), m_outputs(std::move(outputs)),
+    m_batch_size(HAILO_DEFAULT_BATCH_SIZE), m_latency_flags(HAILO_LATENCY_NONE)
 {
     m_inputs_vector.reserve(m_inputs.size());
     m_input_names.reserve(m_inputs.size());
@@ -107,7 +131,9 @@ InferModel::InferModel(InferModel &&other) :
     m_inputs_vector(std::move(other.m_inputs_vector)),
     m_outputs_vector(std::move(other.m_outputs_vector)),
     m_input_names(std::move(other.m_input_names)),
-    m_output_names(std::move(other.m_output_names))
+    m_output_names(std::move(other.m_output_names)),
+    m_batch_size(other.m_batch_size),
+    m_latency_flags(other.m_latency_flags)
 {
 }
 
@@ -120,6 +146,8 @@ Expected<ConfiguredInferModel> InferModel::configure(const std::string &network_
     CHECK_EXPECTED(configure_params);
 
     for (auto &network_group_name_params_pair : *configure_params) {
+        network_group_name_params_pair.second.batch_size = m_batch_size;
+        network_group_name_params_pair.second.latency = m_latency_flags;
         for (auto &stream_params_name_pair : network_group_name_params_pair.second.stream_params_by_name) {
             stream_params_name_pair.second.flags = HAILO_STREAM_FLAGS_ASYNC;
         }
@@ -130,12 +158,14 @@ Expected<ConfiguredInferModel> InferModel::configure(const std::string &network_
 
     std::unordered_map<std::string, hailo_format_t> inputs_formats;
     std::unordered_map<std::string, hailo_format_t> outputs_formats;
+    std::unordered_map<std::string, hailo_image_preprocess_params_t> inputs_preprocess_params;
 
     auto input_vstream_infos = network_groups.value()[0]->get_input_vstream_infos();
     CHECK_EXPECTED(input_vstream_infos);
 
     for (const auto &vstream_info : input_vstream_infos.value()) {
         inputs_formats[vstream_info.name] = m_inputs.at(vstream_info.name).get_user_buffer_format();
+        inputs_preprocess_params[vstream_info.name] = m_inputs.at(vstream_info.name).get_image_preprocess();
     }
 
     auto output_vstream_infos = network_groups.value()[0]->get_output_vstream_infos();
@@ -149,7 +179,8 @@ Expected<ConfiguredInferModel> InferModel::configure(const std::string &network_
     std::shared_ptr<ConfiguredNetworkGroupBase> configured_net_group_base = std::dynamic_pointer_cast<ConfiguredNetworkGroupBase>(network_groups.value()[0]);
     CHECK_NOT_NULL_AS_EXPECTED(configured_net_group_base, HAILO_INTERNAL_FAILURE);
 
-    auto async_infer_runner = AsyncInferRunnerImpl::create(*configured_net_group_base, inputs_formats, outputs_formats);
+    auto async_infer_runner = AsyncInferRunnerImpl::create(*configured_net_group_base, inputs_formats, outputs_formats,
+        inputs_preprocess_params);
     CHECK_EXPECTED(async_infer_runner);
 
     auto configured_infer_model_pimpl = make_shared_nothrow<ConfiguredInferModelImpl>(network_groups.value()[0], async_infer_runner.release(),
@@ -207,6 +238,16 @@ const std::vector<std::string> &InferModel::get_output_names() const
     return m_output_names;
 }
 
+void InferModel::set_batch_size(uint16_t batch_size)
+{
+    m_batch_size = batch_size;
+}
+
+void InferModel::set_hw_latency_measurement_flags(hailo_latency_measurement_flags_t latency)
+{
+    m_latency_flags = latency;
+}
+
 ConfiguredInferModel::ConfiguredInferModel(std::shared_ptr<ConfiguredInferModelImpl> pimpl) : m_pimpl(pimpl)
 {
 }
@@ -242,6 +283,26 @@ Expected<AsyncInferJob> ConfiguredInferModel::run_async(ConfiguredInferModel::Bi
     return m_pimpl->run_async(bindings, callback);
 }
 
+Expected<LatencyMeasurementResult> ConfiguredInferModel::get_hw_latency_measurement(const std::string &network_name)
+{
+    return m_pimpl->get_hw_latency_measurement(network_name);
+}
+
+hailo_status ConfiguredInferModel::set_scheduler_timeout(const std::chrono::milliseconds &timeout)
+{
+    return m_pimpl->set_scheduler_timeout(timeout);
+}
+
+hailo_status ConfiguredInferModel::set_scheduler_threshold(uint32_t threshold)
+{
+    return m_pimpl->set_scheduler_threshold(threshold);
+}
+
+hailo_status ConfiguredInferModel::set_scheduler_priority(uint8_t priority)
+{
+    return m_pimpl->set_scheduler_priority(priority);
+}
+
 ConfiguredInferModelImpl::ConfiguredInferModelImpl(std::shared_ptr<ConfiguredNetworkGroup> cng,
     std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner, 
     const std::vector<std::string> &input_names,
@@ -366,6 +427,26 @@ Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async(ConfiguredInferModel
     return job;
 }
 
+Expected<LatencyMeasurementResult> ConfiguredInferModelImpl::get_hw_latency_measurement(const std::string &network_name)
+{
+    return m_cng->get_latency_measurement(network_name);
+}
+
+hailo_status ConfiguredInferModelImpl::set_scheduler_timeout(const std::chrono::milliseconds &timeout)
+{
+    return m_cng->set_scheduler_timeout(timeout);
+}
+
+hailo_status ConfiguredInferModelImpl::set_scheduler_threshold(uint32_t threshold)
+{
+    return m_cng->set_scheduler_threshold(threshold);
+}
+
+hailo_status ConfiguredInferModelImpl::set_scheduler_priority(uint8_t priority)
+{
+    return m_cng->set_scheduler_priority(priority);
+}
+
 AsyncInferJob::AsyncInferJob(std::shared_ptr<Impl> pimpl) : m_pimpl(pimpl), m_should_wait_in_dtor(true)
 {
 }
@@ -38,6 +38,7 @@ public:
         m_user_buffer_format.order = HAILO_FORMAT_ORDER_AUTO;
         m_user_buffer_format.type = HAILO_FORMAT_TYPE_AUTO;
         m_user_buffer_format.flags = HAILO_FORMAT_FLAGS_QUANTIZED;
+        m_image_preprocess = {};
     }
 
     std::string name() const;
@@ -45,10 +46,13 @@ public:
     void set_format_type(hailo_format_type_t type);
     void set_format_order(hailo_format_order_t order);
     hailo_format_t get_user_buffer_format();
+    void set_image_preprocess(const hailo_image_preprocess_params_t &params);
+    hailo_image_preprocess_params_t get_image_preprocess();
 
 private:
     hailo_vstream_info_t m_vstream_info;
     hailo_format_t m_user_buffer_format;
+    hailo_image_preprocess_params_t m_image_preprocess;
 };
 
 class AsyncInferJob::Impl
@@ -78,6 +82,10 @@ public:
     hailo_status run(ConfiguredInferModel::Bindings bindings, std::chrono::milliseconds timeout);
     Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings,
         std::function<void(const CompletionInfoAsyncInfer &)> callback);
+    Expected<LatencyMeasurementResult> get_hw_latency_measurement(const std::string &network_name);
+    hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout);
+    hailo_status set_scheduler_threshold(uint32_t threshold);
+    hailo_status set_scheduler_priority(uint8_t priority);
 
 private:
     std::shared_ptr<ConfiguredNetworkGroup> m_cng;
@@ -10,25 +10,142 @@
 #include "hailo/inference_pipeline.hpp"
 #include "hailo/hailort_defaults.hpp"
 
-#include "common/async_thread.hpp"
+#include "common/os_utils.hpp"
 
 #include "net_flow/pipeline/vstream_internal.hpp"
 #include "network_group/network_group_internal.hpp"
 #include "core_op/resource_manager/resource_manager.hpp"
 
 #include <sstream>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 
 
 namespace hailort
 {
 
+// Executes tasks on a single persistent thread, in the order they were submitted.
+class SerialTaskWorker final
+{
+public:
+    using Task = std::function<hailo_status()>;
+
+    SerialTaskWorker(const std::string &name) :
+        m_should_stop(false),
+        m_thread([this, name]() {
+            OsUtils::set_current_thread_name(name);
+            worker_loop();
+        })
+    {}
+
+    ~SerialTaskWorker()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_should_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+
+    SerialTaskWorker(const SerialTaskWorker &) = delete;
+    SerialTaskWorker &operator=(const SerialTaskWorker &) = delete;
+    SerialTaskWorker(SerialTaskWorker &&) = delete;
+    SerialTaskWorker &operator=(SerialTaskWorker &&) = delete;
+
+    void submit(Task &&task)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_pending_tasks.emplace_back(std::move(task));
+        }
+        m_cv.notify_all();
+    }
+
+    // Waits for the oldest submitted task whose result wasn't collected yet, and returns its result
+    hailo_status collect()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return !m_results.empty(); });
+        const auto status = m_results.front();
+        m_results.pop_front();
+        return status;
+    }
+
+private:
+    void worker_loop()
+    {
+        while (true) {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this]() { return m_should_stop || !m_pending_tasks.empty(); });
+                if (m_should_stop) {
+                    // Pending tasks are dropped - their buffers may not be valid anymore
+                    return;
+                }
+                task = std::move(m_pending_tasks.front());
+                m_pending_tasks.pop_front();
+            }
+
+            const auto status = task();
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_results.push_back(status);
+            }
+            m_cv.notify_all();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_should_stop;
+    std::deque<Task> m_pending_tasks;
+    std::deque<hailo_status> m_results;
+    // Must be last, the thread uses the other members
+    std::thread m_thread;
+};
+
+// A vstream of an infer request, with the worker that transfers its buffer
+template<typename VStreamType>
+struct RequestVStream {
+    std::reference_wrapper<VStreamType> vstream;
+    std::reference_wrapper<SerialTaskWorker> worker;
+    MemoryView buffer;
+};
+
+// Persistent worker per vstream, created on the first inference and reused by the following ones.
+class InferVStreamsWorkers final
+{
+public:
+    ExpectedRef<SerialTaskWorker> get_worker(const std::string &vstream_name, const std::string &thread_name)
+    {
+        auto it = m_workers.find(vstream_name);
+        if (m_workers.end() == it) {
+            auto worker = make_unique_nothrow<SerialTaskWorker>(thread_name);
+            CHECK_NOT_NULL_AS_EXPECTED(worker, HAILO_OUT_OF_HOST_MEMORY);
+            it = m_workers.emplace(vstream_name, std::move(worker)).first;
+        }
+        return std::ref(*it->second);
+    }
+
+    // The workers used by each ongoing request, ordered from the oldest request
+    std::deque<std::vector<std::reference_wrapper<SerialTaskWorker>>> ongoing_requests;
+
+private:
+    std::map<std::string, std::unique_ptr<SerialTaskWorker>> m_workers;
+};
+
 InferVStreams::InferVStreams(std::vector<InputVStream> &&inputs, std::vector<OutputVStream> &&outputs, bool is_multi_context,
     bool is_scheduled, uint16_t batch_size) :
     m_inputs(std::move(inputs)),
     m_outputs(std::move(outputs)),
     m_is_multi_context(is_multi_context),
     m_is_scheduled(is_scheduled),
-    m_batch_size(batch_size)
+    m_batch_size(batch_size),
+    m_workers(nullptr)
 {
     for (auto &input : m_inputs) {
         if (contains(m_network_name_to_input_count, input.network_name())) {
@@ -191,8 +308,33 @@ Expected<InferVStreams> InferVStreams::create(ConfiguredNetworkGroup &net_group,
         batch_size);
 }
 
+InferVStreams::InferVStreams(InferVStreams &&other) :
+    m_inputs(std::move(other.m_inputs)),
+    m_outputs(std::move(other.m_outputs)),
+    m_is_multi_context(std::move(other.m_is_multi_context)),
+    m_is_scheduled(std::move(other.m_is_scheduled)),
+    m_network_name_to_input_count(std::move(other.m_network_name_to_input_count)),
+    m_network_name_to_output_count(std::move(other.m_network_name_to_output_count)),
+    m_batch_size(std::move(other.m_batch_size)),
+    m_workers(std::move(other.m_workers))
+{}
+
+InferVStreams::~InferVStreams() = default;
+
 hailo_status InferVStreams::infer(const std::map<std::string, MemoryView>& input_data,
     std::map<std::string, MemoryView>& output_data, size_t frames_count)
+{
+    CHECK((nullptr == m_workers) || m_workers->ongoing_requests.empty(), HAILO_INVALID_OPERATION,
+        "Can't call infer while there are ongoing infer_async requests");
+
+    auto status = infer_async(input_data, output_data, frames_count);
+    CHECK_SUCCESS(status);
+
+    return wait_for_async_infer();
+}
+
+hailo_status InferVStreams::infer_async(const std::map<std::string, MemoryView>& input_data,
+    const std::map<std::string, MemoryView>& output_data, size_t frames_count)
 {
     auto status = verify_network_inputs_and_outputs(input_data, output_data);
     CHECK_SUCCESS(status);
@@ -203,52 +345,87 @@ hailo_status InferVStreams::infer(const std::map<std::string, MemoryView>& input
     status = verify_frames_count(frames_count);
     CHECK_SUCCESS(status);
 
-    std::vector<AsyncThreadPtr<hailo_status>> results;
+    if (nullptr == m_workers) {
+        m_workers = make_unique_nothrow<InferVStreamsWorkers>();
+        CHECK_NOT_NULL(m_workers, HAILO_OUT_OF_HOST_MEMORY);
+    }
 
-    // Launch async read/writes
-    for (auto &input_name_to_data_pair : input_data) {
-        auto input_vstream_exp = get_input_by_name(input_name_to_data_pair.first);
-        CHECK_EXPECTED_AS_STATUS(input_vstream_exp);
-        auto &input_vstream = input_vstream_exp.release().get();
-        results.emplace_back(std::make_unique<AsyncThread<hailo_status>>(
-            [&input_vstream, &input_name_to_data_pair, frames_count]() -> hailo_status {
-                const auto &input_buffer = input_name_to_data_pair.second;
-                for (uint32_t i = 0; i < frames_count; i++) {
-                    const size_t offset = i * input_vstream.get_frame_size();
-                    auto status = input_vstream.write(MemoryView::create_const(
-                        input_buffer.data() + offset,
-                        input_vstream.get_frame_size()));
-                    if (HAILO_STREAM_ABORTED_BY_USER == status) {
-                        LOGGER__DEBUG("Input stream was aborted!");
-                        return status;
-                    }
-                    CHECK_SUCCESS(status);
+    // The vstreams and their workers are resolved before any task is submitted, so a failure doesn't leave results
+    // of a request that isn't in ongoing_requests (they would be collected by the next request).
+    std::vector<RequestVStream<InputVStream>> inputs;
+    inputs.reserve(input_data.size());
+    for (const auto &input_name_to_data_pair : input_data) {
+        auto input_vstream = get_input_by_name(input_name_to_data_pair.first);
+        CHECK_EXPECTED_AS_STATUS(input_vstream);
+        auto worker = m_workers->get_worker(input_vstream->get().name(), "INFER_WRITE");
+        CHECK_EXPECTED_AS_STATUS(worker);
+        inputs.emplace_back(RequestVStream<InputVStream>{input_vstream.release(), worker.release(),
+            input_name_to_data_pair.second});
+    }
+    std::vector<RequestVStream<OutputVStream>> outputs;
+    outputs.reserve(output_data.size());
+    for (const auto &output_name_to_data_pair : output_data) {
+        auto output_vstream = get_output_by_name(output_name_to_data_pair.first);
+        CHECK_EXPECTED_AS_STATUS(output_vstream);
+        auto worker = m_workers->get_worker(output_vstream->get().name(), "INFER_READ");
+        CHECK_EXPECTED_AS_STATUS(worker);
+        outputs.emplace_back(RequestVStream<OutputVStream>{output_vstream.release(), worker.release(),
+            output_name_to_data_pair.second});
+    }
+
+    std::vector<std::reference_wrapper<SerialTaskWorker>> request_workers;
+    request_workers.reserve(inputs.size() + outputs.size());
+
+    // Launch async read/writes on the workers. Each worker handles the requests in order, so consecutive requests
+    // are inferred back-to-back.
+    for (const auto &input : inputs) {
+        auto &input_vstream = input.vstream.get();
+        input.worker.get().submit([&input_vstream, input_buffer = input.buffer, frames_count]() -> hailo_status {
+            for (uint32_t i = 0; i < frames_count; i++) {
+                const size_t offset = i * input_vstream.get_frame_size();
+                auto status = input_vstream.write(MemoryView::create_const(
+                    input_buffer.data() + offset,
+                    input_vstream.get_frame_size()));
+                if (HAILO_STREAM_ABORTED_BY_USER == status) {
+                    LOGGER__DEBUG("Input stream was aborted!");
+                    return status;
                 }
-                return HAILO_SUCCESS;
+                CHECK_SUCCESS(status);
             }
-        ));
+            return HAILO_SUCCESS;
+        });
+        request_workers.emplace_back(input.worker);
     }
-    for (auto &output_name_to_data_pair : output_data) {
-        auto output_vstream_exp = get_output_by_name(output_name_to_data_pair.first);
-        CHECK_EXPECTED_AS_STATUS(output_vstream_exp);
-        auto &output_vstream = output_vstream_exp.release().get();
-        results.emplace_back(std::make_unique<AsyncThread<hailo_status>>(
-            [&output_vstream, &output_name_to_data_pair, frames_count]() {
-                for (size_t i = 0; i < frames_count; i++) {
-                    auto status = output_vstream.read(MemoryView(output_name_to_data_pair.second.data() + i * output_vstream.get_frame_size(), output_vstream.get_frame_size()));
-                    if (HAILO_SUCCESS != status) {
-                        return status;
-                    }
+    for (const auto &output : outputs) {
+        auto &output_vstream = output.vstream.get();
+        output.worker.get().submit([&output_vstream, output_buffer = output.buffer, frames_count]() mutable {
+            for (size_t i = 0; i < frames_count; i++) {
+                auto status = output_vstream.read(MemoryView(output_buffer.data() + i * output_vstream.get_frame_size(), output_vstream.get_frame_size()));
+                if (HAILO_SUCCESS != status) {
+                    return status;
                 }
-                return HAILO_SUCCESS;
             }
-        ));
+            return HAILO_SUCCESS;
+        });
+        request_workers.emplace_back(output.worker);
     }
 
+    m_workers->ongoing_requests.emplace_back(std::move(request_workers));
+    return HAILO_SUCCESS;
+}
+
+hailo_status InferVStreams::wait_for_async_infer()
+{
+    CHECK((nullptr != m_workers) && !m_workers->ongoing_requests.empty(), HAILO_INVALID_OPERATION,
+        "There are no ongoing infer_async requests");
+
+    auto request_workers = std::move(m_workers->ongoing_requests.front());
+    m_workers->ongoing_requests.pop_front();
+
     // Wait for all results
     auto error_status = HAILO_SUCCESS;
-    for (auto& result : results) {
-        status = result->get();
+    for (auto &worker : request_workers) {
+        auto status = worker.get().collect();
         if (HAILO_STREAM_ABORTED_BY_USER == status) {
             continue;
         }
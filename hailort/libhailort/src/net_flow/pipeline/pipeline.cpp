@@ -254,8 +254,9 @@ Expected<BufferPoolPtr> BufferPool::create(size_t buffer_size, size_t buffer_cou
 {
     AccumulatorPtr queue_size_accumulator = nullptr;
     if ((elem_flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE) != 0) {
-        queue_size_accumulator = make_shared_nothrow<FullAccumulator<double>>("queue_size");
-        CHECK_AS_EXPECTED(nullptr != queue_size_accumulator, HAILO_OUT_OF_HOST_MEMORY);
+        auto accumulator = create_pipeline_stats_accumulator("queue_size", elem_flags);
+        CHECK_EXPECTED(accumulator);
+        queue_size_accumulator = accumulator.release();
     }
     const bool measure_vstream_latency = (vstream_flags & HAILO_VSTREAM_STATS_MEASURE_LATENCY) != 0;
 
@@ -465,14 +466,28 @@ hailo_status BufferPool::release_buffer(MemoryView mem_view)
     return m_free_mem_views.enqueue(std::move(mem_view), true);
 }
 
+Expected<AccumulatorPtr> create_pipeline_stats_accumulator(const std::string &data_type, hailo_pipeline_elem_stats_flags_t flags)
+{
+    AccumulatorPtr accumulator = nullptr;
+    if ((flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_PERCENTILES) != 0) {
+        accumulator = make_shared_nothrow<HistogramAccumulator<double>>(data_type);
+    } else {
+        accumulator = make_shared_nothrow<FullAccumulator<double>>(data_type);
+    }
+    CHECK_AS_EXPECTED(nullptr != accumulator, HAILO_OUT_OF_HOST_MEMORY);
+
+    return accumulator;
+}
+
 Expected<DurationCollector> DurationCollector::create(hailo_pipeline_elem_stats_flags_t flags,
     uint32_t num_frames_before_collection_start)
 {
     AccumulatorPtr latency_accumulator = nullptr;
     const auto measure_latency = should_measure_latency(flags);
     if (measure_latency) {
-        latency_accumulator = make_shared_nothrow<FullAccumulator<double>>("latency");
-        CHECK_AS_EXPECTED(nullptr != latency_accumulator, HAILO_OUT_OF_HOST_MEMORY);
+        auto accumulator = create_pipeline_stats_accumulator("latency", flags);
+        CHECK_EXPECTED(accumulator);
+        latency_accumulator = accumulator.release();
     }
 
     AccumulatorPtr average_fps_accumulator = nullptr;
@@ -1307,8 +1322,9 @@ Expected<std::shared_ptr<PushQueueElement>> PushQueueElement::create(const std::
 
     AccumulatorPtr queue_size_accumulator = nullptr;
     if ((flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE) != 0) {
-        queue_size_accumulator = make_shared_nothrow<FullAccumulator<double>>("queue_size");
-        CHECK_AS_EXPECTED(nullptr != queue_size_accumulator, HAILO_OUT_OF_HOST_MEMORY);
+        auto accumulator = create_pipeline_stats_accumulator("queue_size", flags);
+        CHECK_EXPECTED(accumulator);
+        queue_size_accumulator = accumulator.release();
     }
 
     auto queue_ptr = make_shared_nothrow<PushQueueElement>(queue.release(), shutdown_event, name, timeout,
@@ -1457,8 +1473,9 @@ Expected<std::shared_ptr<AsyncPushQueueElement>> AsyncPushQueueElement::create(c
 
     AccumulatorPtr queue_size_accumulator = nullptr;
     if ((flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE) != 0) {
-        queue_size_accumulator = make_shared_nothrow<FullAccumulator<double>>("queue_size");
-        CHECK_AS_EXPECTED(nullptr != queue_size_accumulator, HAILO_OUT_OF_HOST_MEMORY);
+        auto accumulator = create_pipeline_stats_accumulator("queue_size", flags);
+        CHECK_EXPECTED(accumulator);
+        queue_size_accumulator = accumulator.release();
     }
 
     auto queue_ptr = make_shared_nothrow<AsyncPushQueueElement>(queue.release(), shutdown_event, name, timeout,
@@ -1586,8 +1603,9 @@ Expected<std::shared_ptr<PullQueueElement>> PullQueueElement::create(const std::
 
     AccumulatorPtr queue_size_accumulator = nullptr;
     if ((flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE) != 0) {
-        queue_size_accumulator = make_shared_nothrow<FullAccumulator<double>>("queue_size");
-        CHECK_AS_EXPECTED(nullptr != queue_size_accumulator, HAILO_OUT_OF_HOST_MEMORY);
+        auto accumulator = create_pipeline_stats_accumulator("queue_size", flags);
+        CHECK_EXPECTED(accumulator);
+        queue_size_accumulator = accumulator.release();
     }
 
     auto queue_ptr = make_shared_nothrow<PullQueueElement>(queue.release(), shutdown_event, name, timeout,
@@ -1719,8 +1737,9 @@ Expected<std::shared_ptr<UserBufferQueueElement>> UserBufferQueueElement::create
 
     AccumulatorPtr queue_size_accumulator = nullptr;
     if ((flags & HAILO_PIPELINE_ELEM_STATS_MEASURE_QUEUE_SIZE) != 0) {
-        queue_size_accumulator = make_shared_nothrow<FullAccumulator<double>>("queue_size");
-        CHECK_AS_EXPECTED(nullptr != queue_size_accumulator, HAILO_OUT_OF_HOST_MEMORY);
+        auto accumulator = create_pipeline_stats_accumulator("queue_size", flags);
+        CHECK_EXPECTED(accumulator);
+        queue_size_accumulator = accumulator.release();
     }
 
     auto queue_ptr = make_shared_nothrow<UserBufferQueueElement>(pending_buffer_queue.release(),
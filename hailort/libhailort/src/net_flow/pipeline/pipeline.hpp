@@ -55,19 +55,6 @@ using PipelineTimePoint = std::chrono::steady_clock::time_point;
 
 struct AdditionalData {};
 
-struct IouPipelineData : AdditionalData
-{
-    IouPipelineData(std::vector<net_flow::DetectionBbox> &&detections, std::vector<uint32_t> &&detections_classes_count)
-        : m_detections(std::move(detections)),
-          m_detections_classes_count(std::move(detections_classes_count)) {}
-    std::vector<net_flow::DetectionBbox> m_detections;
-    std::vector<uint32_t> m_detections_classes_count;
-
-    bool operator==(const IouPipelineData &other) const {
-        return m_detections == other.m_detections && m_detections_classes_count == other.m_detections_classes_count;
-    }
-};
-
 struct PixBufferPipelineData : AdditionalData
 {
     PixBufferPipelineData(const hailo_pix_buffer_t &buffer) : m_pix_buffer(buffer) {};
@@ -199,6 +186,10 @@ private:
     friend class PipelineBuffer;
 };
 
+// Creates an accumulator for the pipeline stats (latency, queue size). If HAILO_PIPELINE_ELEM_STATS_MEASURE_PERCENTILES
+// is set in flags, a lock-free HistogramAccumulator is created (reporting percentiles as well), otherwise a FullAccumulator.
+Expected<AccumulatorPtr> create_pipeline_stats_accumulator(const std::string &data_type, hailo_pipeline_elem_stats_flags_t flags);
+
 class DurationCollector final
 {
 public:
@@ -152,98 +152,172 @@ Expected<PipelineBuffer> PreInferElement::action(PipelineBuffer &&input, Pipelin
     return transformed_buffer.release();
 }
 
-Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> ConvertNmsToDetectionsElement::create(
-        const hailo_nms_info_t &nms_info, const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags,
-        std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::chrono::milliseconds timeout,
-        hailo_vstream_stats_flags_t vstream_flags, EventPtr shutdown_event, size_t buffer_pool_size,
-        PipelineDirection pipeline_direction, bool is_last_copy_element)
-{
-    // The actual data will be in the metadata
-    auto frame_size = 0;
-    auto buffer_pool_expected = BufferPool::create(frame_size, buffer_pool_size, shutdown_event, elem_flags, vstream_flags, is_last_copy_element);
-    CHECK_EXPECTED(buffer_pool_expected, "Failed creating BufferPool for {}", name);
-    auto buffer_pool = buffer_pool_expected.release();
+Expected<std::shared_ptr<ImagePreprocessElement>> ImagePreprocessElement::create(const hailo_image_preprocess_params_t &preprocess_params,
+    const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &dst_hw_shape, const hailo_format_t &dst_format,
+    const std::vector<hailo_quant_info_t> &dst_quant_infos, const std::string &name, std::chrono::milliseconds timeout,
+    size_t buffer_pool_size, hailo_pipeline_elem_stats_flags_t elem_flags, hailo_vstream_stats_flags_t vstream_flags,
+    EventPtr shutdown_event, std::shared_ptr<std::atomic<hailo_status>> pipeline_status, PipelineDirection pipeline_direction,
+    bool is_dma_able)
+{
+    std::unique_ptr<ImagePreprocessContext> preprocess_context;
+    std::unique_ptr<InputTransformContext> transform_context;
+    Buffer rgb_frame;
+    if (ImagePreprocessContext::is_dst_layout_supported(dst_image_shape, dst_hw_shape, dst_format)) {
+        auto expected_preprocess_context = ImagePreprocessContext::create(preprocess_params, dst_image_shape, dst_hw_shape, dst_format);
+        CHECK_EXPECTED(expected_preprocess_context, "Failed Creating ImagePreprocessContext");
+        preprocess_context = expected_preprocess_context.release();
+    } else {
+        const hailo_format_t rgb_format = {HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC, HAILO_FORMAT_FLAGS_QUANTIZED};
+        auto expected_preprocess_context = ImagePreprocessContext::create(preprocess_params, dst_image_shape, dst_image_shape, rgb_format);
+        CHECK_EXPECTED(expected_preprocess_context, "Failed Creating ImagePreprocessContext");
+        preprocess_context = expected_preprocess_context.release();
+
+        auto expected_transform_context = InputTransformContext::create(dst_image_shape, rgb_format, dst_hw_shape, dst_format,
+            dst_quant_infos);
+        CHECK_EXPECTED(expected_transform_context, "Failed Creating InputTransformContext");
+        transform_context = expected_transform_context.release();
+
+        auto expected_rgb_frame = Buffer::create(preprocess_context->get_dst_frame_size());
+        CHECK_EXPECTED(expected_rgb_frame);
+        rgb_frame = expected_rgb_frame.release();
+    }
+
+    bool is_empty = false;
+    auto buffer_pool = BufferPool::create(HailoRTCommon::get_frame_size(dst_hw_shape, dst_format), buffer_pool_size, shutdown_event,
+        elem_flags, vstream_flags, is_empty, is_dma_able);
+    CHECK_EXPECTED(buffer_pool, "Failed creating BufferPool for {}", name);
 
     auto duration_collector = DurationCollector::create(elem_flags);
     CHECK_EXPECTED(duration_collector);
 
-    auto convert_nms_to_detections_elem_ptr = make_shared_nothrow<ConvertNmsToDetectionsElement>(std::move(nms_info),
-        name, duration_collector.release(), std::move(pipeline_status), buffer_pool, timeout, pipeline_direction);
-    CHECK_AS_EXPECTED(nullptr != convert_nms_to_detections_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
+    auto preprocess_elem_ptr = make_shared_nothrow<ImagePreprocessElement>(std::move(preprocess_context), std::move(transform_context),
+        std::move(rgb_frame), buffer_pool.release(), name, timeout, duration_collector.release(), std::move(pipeline_status),
+        pipeline_direction);
+    CHECK_AS_EXPECTED(nullptr != preprocess_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
 
-    LOGGER__INFO("Created {}", convert_nms_to_detections_elem_ptr->name());
+    LOGGER__INFO("Created {}", preprocess_elem_ptr->name());
 
-    return convert_nms_to_detections_elem_ptr;
+    return preprocess_elem_ptr;
 }
 
-Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> ConvertNmsToDetectionsElement::create(
-        const hailo_nms_info_t &nms_info, const std::string &name, const ElementBuildParams &build_params,
-        PipelineDirection pipeline_direction, bool is_last_copy_element)
+Expected<std::shared_ptr<ImagePreprocessElement>> ImagePreprocessElement::create(const hailo_image_preprocess_params_t &preprocess_params,
+    const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &dst_hw_shape, const hailo_format_t &dst_format,
+    const std::vector<hailo_quant_info_t> &dst_quant_infos, const std::string &name, const hailo_vstream_params_t &vstream_params,
+    EventPtr shutdown_event, std::shared_ptr<std::atomic<hailo_status>> pipeline_status, PipelineDirection pipeline_direction,
+    bool is_dma_able)
 {
-    return ConvertNmsToDetectionsElement::create(nms_info, name, build_params.elem_stats_flags, build_params.pipeline_status,
-        build_params.timeout, build_params.vstream_stats_flags, build_params.shutdown_event, build_params.buffer_pool_size,
-        pipeline_direction, is_last_copy_element);
+    return ImagePreprocessElement::create(preprocess_params, dst_image_shape, dst_hw_shape, dst_format, dst_quant_infos,
+        name, std::chrono::milliseconds(vstream_params.timeout_ms), vstream_params.queue_size, vstream_params.pipeline_elements_stats_flags,
+        vstream_params.vstream_stats_flags, shutdown_event, pipeline_status, pipeline_direction, is_dma_able);
 }
 
-ConvertNmsToDetectionsElement::ConvertNmsToDetectionsElement(const hailo_nms_info_t &&nms_info, const std::string &name,
-                                   DurationCollector &&duration_collector,
-                                   std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
-                                   BufferPoolPtr buffer_pool, std::chrono::milliseconds timeout, PipelineDirection pipeline_direction) :
+Expected<std::shared_ptr<ImagePreprocessElement>> ImagePreprocessElement::create(const hailo_image_preprocess_params_t &preprocess_params,
+    const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &dst_hw_shape, const hailo_format_t &dst_format,
+    const std::vector<hailo_quant_info_t> &dst_quant_infos, const std::string &name, const ElementBuildParams &build_params,
+    PipelineDirection pipeline_direction, bool is_dma_able)
+{
+    return ImagePreprocessElement::create(preprocess_params, dst_image_shape, dst_hw_shape, dst_format, dst_quant_infos, name,
+        build_params.timeout, build_params.buffer_pool_size, build_params.elem_stats_flags, build_params.vstream_stats_flags,
+        build_params.shutdown_event, build_params.pipeline_status, pipeline_direction, is_dma_able);
+}
+
+ImagePreprocessElement::ImagePreprocessElement(std::unique_ptr<ImagePreprocessContext> &&preprocess_context,
+                                               std::unique_ptr<InputTransformContext> &&transform_context, Buffer &&rgb_frame,
+                                               BufferPoolPtr buffer_pool, const std::string &name, std::chrono::milliseconds timeout,
+                                               DurationCollector &&duration_collector,
+                                               std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
+                                               PipelineDirection pipeline_direction) :
     FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, buffer_pool, timeout),
-    m_nms_info(std::move(nms_info))
+    m_preprocess_context(std::move(preprocess_context)),
+    m_transform_context(std::move(transform_context)),
+    m_rgb_frame(std::move(rgb_frame))
 {}
 
-hailo_status ConvertNmsToDetectionsElement::run_push(PipelineBuffer &&buffer, const PipelinePad &sink)
+Expected<PipelineBuffer> ImagePreprocessElement::run_pull(PipelineBuffer &&/*optional*/, const PipelinePad &/*source*/)
 {
-    CHECK(PipelineDirection::PUSH == m_pipeline_direction, HAILO_INVALID_OPERATION,
-        "ConvertNmsToDetectionsElement {} does not support run_push operation", name());
-    return FilterElement::run_push(std::move(buffer), sink);
+    LOGGER__ERROR("ImagePreprocessElement does not support run_pull operation");
+    return make_unexpected(HAILO_INVALID_OPERATION);
 }
 
-PipelinePad &ConvertNmsToDetectionsElement::next_pad()
+PipelinePad &ImagePreprocessElement::next_pad()
 {
-    if (PipelineDirection::PUSH == m_pipeline_direction){
-        return *m_sources[0].next();
-    }
-    return *m_sinks[0].prev();
+    // Note: The next elem to be run is downstream from this elem (i.e. buffers are pushed)
+    return *m_sources[0].next();
+}
+
+size_t ImagePreprocessElement::get_src_frame_size() const
+{
+    return m_preprocess_context->get_src_frame_size();
 }
 
-std::string ConvertNmsToDetectionsElement::description() const
+std::string ImagePreprocessElement::description() const
 {
     std::stringstream element_description;
-    element_description << "(" << this->name() << ")";
+    element_description << "(" << this->name() << " | " << m_preprocess_context->description();
+    if (nullptr != m_transform_context) {
+        element_description << " | " << m_transform_context->description();
+    }
+    element_description << ")";
     return element_description.str();
 }
 
-Expected<PipelineBuffer> ConvertNmsToDetectionsElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
+hailo_status ImagePreprocessElement::preprocess(const MemoryView src, MemoryView dst)
 {
-    auto buffer = m_pool->get_available_buffer(std::move(optional), m_timeout);
-    if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer.status()) {
-        return make_unexpected(buffer.status());
+    if (nullptr == m_transform_context) {
+        return m_preprocess_context->process(src, dst);
     }
-    CHECK_EXPECTED(buffer, "{} (D2H) failed with status={}", name(), buffer.status());
 
-    buffer->set_metadata(input.get_metadata());
+    auto status = m_preprocess_context->process(src, MemoryView(m_rgb_frame));
+    CHECK_SUCCESS(status);
+    return m_transform_context->transform(MemoryView(m_rgb_frame), dst);
+}
 
-    m_duration_collector.start_measurement();
+Expected<PipelineBuffer> ImagePreprocessElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
+{
+    if (PipelineBuffer::Type::FLUSH == input.get_type()) {
+        return std::move(input);
+    }
 
-    auto detections_pair = net_flow::NmsPostProcessOp::transform__d2h_NMS_DETECTIONS(input.data(), m_nms_info);
-    auto detections_pipeline_data = make_shared_nothrow<IouPipelineData>
-        (std::move(detections_pair.first),std::move(detections_pair.second));
-    buffer->set_additional_data(detections_pipeline_data);
+    auto transformed_buffer = m_pool->get_available_buffer(std::move(optional), m_timeout);
+    if (HAILO_SHUTDOWN_EVENT_SIGNALED == transformed_buffer.status()) {
+        return make_unexpected(transformed_buffer.status());
+    }
+    CHECK_AS_EXPECTED(HAILO_TIMEOUT != transformed_buffer.status(), HAILO_TIMEOUT,
+        "{} (H2D) failed with status={} (timeout={}ms)", name(), HAILO_TIMEOUT, m_timeout.count());
+    CHECK_EXPECTED(transformed_buffer);
 
+    auto dst = transformed_buffer->as_view();
+    m_duration_collector.start_measurement();
+    const auto status = preprocess(input.as_view(), dst);
     m_duration_collector.complete_measurement();
+    auto exec_done_cb = input.get_exec_done_cb();
+    CompletionInfoAsyncInferInternal completion_info {status};
+    exec_done_cb(completion_info);
+    CHECK_SUCCESS_AS_EXPECTED(status);
 
-    return buffer.release();
+    // Note: The latency to be measured starts as the input buffer is sent to the InputVStream (via write())
+    transformed_buffer->set_metadata(input.get_metadata());
+
+    return transformed_buffer.release();
 }
 
-Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(const hailo_nms_info_t nms_info,
-        const hailo_format_t &dst_format, const net_flow::NmsPostProcessConfig nms_config, const std::string &name,
+Expected<std::shared_ptr<HostNmsElement>> HostNmsElement::create(const hailo_nms_info_t &nms_info,
+        const hailo_format_t &dst_format, const net_flow::NmsPostProcessConfig &nms_config, const std::string &name,
         hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
         std::chrono::milliseconds timeout, hailo_vstream_stats_flags_t vstream_flags, EventPtr shutdown_event,
         size_t buffer_pool_size, PipelineDirection pipeline_direction, bool is_last_copy_element)
 {
-    auto frame_size = HailoRTCommon::get_nms_host_frame_size(nms_info, dst_format);
+    CHECK_AS_EXPECTED((HAILO_FORMAT_ORDER_HAILO_NMS == dst_format.order) || (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS == dst_format.order),
+        HAILO_INVALID_ARGUMENT, "{} output format order must be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS", name);
+
+    uint32_t frame_size = 0;
+    if (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS == dst_format.order) {
+        // Detections above max_proposals_per_class are dropped by the element
+        const hailo_nms_shape_t nms_shape{nms_config.number_of_classes, nms_config.max_proposals_per_class, 0};
+        frame_size = HailoRTCommon::get_nms_host_frame_size(nms_shape, dst_format);
+    } else {
+        frame_size = HailoRTCommon::get_nms_host_frame_size(nms_info, dst_format);
+    }
     auto buffer_pool_expected = BufferPool::create(frame_size, buffer_pool_size, shutdown_event, elem_flags, vstream_flags, is_last_copy_element);
     CHECK_EXPECTED(buffer_pool_expected, "Failed creating BufferPool for {}", name);
     auto buffer_pool = buffer_pool_expected.release();
@@ -251,40 +325,46 @@ Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(con
     auto duration_collector = DurationCollector::create(elem_flags);
     CHECK_EXPECTED(duration_collector);
 
-    auto fill_nms_format_element = make_shared_nothrow<FillNmsFormatElement>(std::move(nms_config),
+    auto host_nms_elem_ptr = make_shared_nothrow<HostNmsElement>(nms_info, dst_format, nms_config,
         name, duration_collector.release(), std::move(pipeline_status), buffer_pool, timeout, pipeline_direction);
-    CHECK_AS_EXPECTED(nullptr != fill_nms_format_element, HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_AS_EXPECTED(nullptr != host_nms_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
 
-    LOGGER__INFO("Created {}", fill_nms_format_element->name());
+    LOGGER__INFO("Created {}", host_nms_elem_ptr->name());
 
-    return fill_nms_format_element;
+    return host_nms_elem_ptr;
 }
 
-Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(const hailo_nms_info_t nms_info,
-        const hailo_format_t &dst_format, const net_flow::NmsPostProcessConfig nms_config, const std::string &name,
+Expected<std::shared_ptr<HostNmsElement>> HostNmsElement::create(const hailo_nms_info_t &nms_info,
+        const hailo_format_t &dst_format, const net_flow::NmsPostProcessConfig &nms_config, const std::string &name,
         const ElementBuildParams &build_params, PipelineDirection pipeline_direction, bool is_last_copy_element)
 {
-    return FillNmsFormatElement::create(nms_info, dst_format, nms_config, name, build_params.elem_stats_flags,
+    return HostNmsElement::create(nms_info, dst_format, nms_config, name, build_params.elem_stats_flags,
         build_params.pipeline_status, build_params.timeout, build_params.vstream_stats_flags,
         build_params.shutdown_event, build_params.buffer_pool_size, pipeline_direction, is_last_copy_element);
 }
 
-FillNmsFormatElement::FillNmsFormatElement(const net_flow::NmsPostProcessConfig &&nms_config, const std::string &name,
-                                   DurationCollector &&duration_collector,
-                                   std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
-                                   BufferPoolPtr buffer_pool, std::chrono::milliseconds timeout, PipelineDirection pipeline_direction) :
+HostNmsElement::HostNmsElement(const hailo_nms_info_t &nms_info, const hailo_format_t &dst_format,
+                               const net_flow::NmsPostProcessConfig &nms_config, const std::string &name, DurationCollector &&duration_collector,
+                               std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
+                               BufferPoolPtr buffer_pool, std::chrono::milliseconds timeout, PipelineDirection pipeline_direction) :
     FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, buffer_pool, timeout),
-    m_nms_config(std::move(nms_config))
-{}
+    m_nms_info(nms_info),
+    m_dst_format(dst_format),
+    m_nms_config(nms_config),
+    m_classes_detections_count(nms_info.number_of_classes, 0),
+    m_num_of_detections_before(nms_config.number_of_classes, 0)
+{
+    m_detections.reserve(nms_info.max_bboxes_per_class * nms_info.number_of_classes);
+}
 
-hailo_status FillNmsFormatElement::run_push(PipelineBuffer &&buffer, const PipelinePad &sink)
+hailo_status HostNmsElement::run_push(PipelineBuffer &&buffer, const PipelinePad &sink)
 {
     CHECK(PipelineDirection::PUSH == m_pipeline_direction, HAILO_INVALID_OPERATION,
-        "FillNmsFormatElement {} does not support run_push operation", name());
+        "HostNmsElement {} does not support run_push operation", name());
     return FilterElement::run_push(std::move(buffer), sink);
 }
 
-PipelinePad &FillNmsFormatElement::next_pad()
+PipelinePad &HostNmsElement::next_pad()
 {
     if (PipelineDirection::PUSH == m_pipeline_direction){
         return *m_sources[0].next();
@@ -292,34 +372,41 @@ PipelinePad &FillNmsFormatElement::next_pad()
     return *m_sinks[0].prev();
 }
 
-std::string FillNmsFormatElement::description() const
+std::string HostNmsElement::description() const
 {
     std::stringstream element_description;
-    element_description << "(" << this->name() << ")";
+    element_description << "(" << this->name() << " | IoU threshold: " << m_nms_config.nms_iou_th << ")";
     return element_description.str();
 }
 
-Expected<PipelineBuffer> FillNmsFormatElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
+Expected<PipelineBuffer> HostNmsElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
 {
-    auto buffer_expected = m_pool->get_available_buffer(std::move(optional), m_timeout);
-    if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer_expected.status()) {
-        return make_unexpected(buffer_expected.status());
+    auto buffer = m_pool->get_available_buffer(std::move(optional), m_timeout);
+    if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer.status()) {
+        return make_unexpected(buffer.status());
     }
-    CHECK_EXPECTED(buffer_expected, "{} (D2H) failed with status={}", name(), buffer_expected.status());
-    auto buffer = buffer_expected.release();
+    CHECK_EXPECTED(buffer, "{} (D2H) failed with status={}", name(), buffer.status());
 
-    buffer.set_metadata(input.get_metadata());
+    buffer->set_metadata(input.get_metadata());
 
     m_duration_collector.start_measurement();
 
-    auto detections = input.get_metadata().get_additional_data<IouPipelineData>();
-    auto dst = buffer.as_view();
-    net_flow::NmsPostProcessOp::fill_nms_format_buffer(dst, detections->m_detections, detections->m_detections_classes_count,
-        m_nms_config);
+    net_flow::NmsPostProcessOp::transform__d2h_NMS_DETECTIONS(input.data(), m_nms_info, m_detections,
+        m_classes_detections_count);
+    net_flow::NmsPostProcessOp::remove_overlapping_boxes(m_detections, m_classes_detections_count,
+        m_nms_config.nms_iou_th);
+    auto dst = buffer->as_view();
+    if (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS == m_dst_format.order) {
+        net_flow::NmsPostProcessOp::fill_nms_detections_format_buffer(dst, m_detections, m_classes_detections_count,
+            m_nms_config);
+    } else {
+        net_flow::NmsPostProcessOp::fill_nms_format_buffer(dst, m_detections, m_classes_detections_count, m_nms_config,
+            m_num_of_detections_before);
+    }
 
     m_duration_collector.complete_measurement();
 
-    return buffer;
+    return buffer.release();
 }
 
 Expected<std::shared_ptr<PostInferElement>> PostInferElement::create(const hailo_3d_image_shape_t &src_image_shape,
@@ -445,88 +532,6 @@ static hailo_nms_info_t fuse_nms_info(const std::vector<hailo_nms_info_t> &nms_i
     return fused_info;
 }
 
-Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> RemoveOverlappingBboxesElement::create(
-        const net_flow::NmsPostProcessConfig nms_config, const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags,
-        std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::chrono::milliseconds timeout, hailo_vstream_stats_flags_t vstream_flags,
-        EventPtr shutdown_event, size_t buffer_pool_size, PipelineDirection pipeline_direction, bool is_last_copy_element)
-{
-    // The actual data will be in the metadata
-    auto frame_size = 0;
-    auto buffer_pool_expected = BufferPool::create(frame_size, buffer_pool_size, shutdown_event, elem_flags, vstream_flags, is_last_copy_element);
-    CHECK_EXPECTED(buffer_pool_expected, "Failed creating BufferPool for {}", name);
-    auto buffer_pool = buffer_pool_expected.release();
-
-    auto duration_collector = DurationCollector::create(elem_flags);
-    CHECK_EXPECTED(duration_collector);
-
-    auto convert_nms_removed_overlapping_elem_ptr = make_shared_nothrow<RemoveOverlappingBboxesElement>(std::move(nms_config),
-        name, duration_collector.release(), std::move(pipeline_status), buffer_pool, timeout, pipeline_direction);
-    CHECK_AS_EXPECTED(nullptr != convert_nms_removed_overlapping_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
-
-    LOGGER__INFO("Created {}", convert_nms_removed_overlapping_elem_ptr->name());
-
-    return convert_nms_removed_overlapping_elem_ptr;
-}
-
-Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> RemoveOverlappingBboxesElement::create(const net_flow::NmsPostProcessConfig nms_config,
-    const std::string &name, const ElementBuildParams &build_params, PipelineDirection pipeline_direction, bool is_last_copy_element)
-{
-    return RemoveOverlappingBboxesElement::create(nms_config, name,
-        build_params.elem_stats_flags, build_params.pipeline_status, build_params.timeout, build_params.vstream_stats_flags,
-        build_params.shutdown_event, build_params.buffer_pool_size, pipeline_direction, is_last_copy_element);
-}
-
-RemoveOverlappingBboxesElement::RemoveOverlappingBboxesElement(const net_flow::NmsPostProcessConfig &&nms_config, const std::string &name,
-                                   DurationCollector &&duration_collector,
-                                   std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
-                                   BufferPoolPtr buffer_pool, std::chrono::milliseconds timeout,
-                                   PipelineDirection pipeline_direction) :
-    FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, buffer_pool, timeout),
-    m_nms_config(std::move(nms_config))
-{}
-
-hailo_status RemoveOverlappingBboxesElement::run_push(PipelineBuffer &&buffer, const PipelinePad &sink)
-{
-    CHECK(PipelineDirection::PUSH == m_pipeline_direction, HAILO_INVALID_OPERATION,
-        "RemoveOverlappingBboxesElement {} does not support run_push operation", name());
-    return FilterElement::run_push(std::move(buffer), sink);
-}
-
-PipelinePad &RemoveOverlappingBboxesElement::next_pad()
-{
-    if (PipelineDirection::PUSH == m_pipeline_direction){
-        return *m_sources[0].next();
-    }
-    return *m_sinks[0].prev();
-}
-
-std::string RemoveOverlappingBboxesElement::description() const
-{
-    std::stringstream element_description;
-    element_description << "(" << this->name() << ")";
-    return element_description.str();
-}
-
-Expected<PipelineBuffer> RemoveOverlappingBboxesElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
-{
-    auto buffer = m_pool->get_available_buffer(std::move(optional), m_timeout);
-    if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer.status()) {
-        return make_unexpected(buffer.status());
-    }
-    CHECK_EXPECTED(buffer, "{} (D2H) failed with status={}", name(), buffer.status());
-
-    buffer->set_metadata(input.get_metadata());
-
-    m_duration_collector.start_measurement();
-    auto detections_pipeline_data = input.get_metadata().get_additional_data<IouPipelineData>();
-
-    net_flow::NmsPostProcessOp::remove_overlapping_boxes(detections_pipeline_data->m_detections,
-        detections_pipeline_data->m_detections_classes_count, m_nms_config.nms_iou_th);
-    m_duration_collector.complete_measurement();
-
-    return buffer.release();
-}
-
 Expected<std::shared_ptr<NmsPostProcessMuxElement>> NmsPostProcessMuxElement::create(std::shared_ptr<net_flow::Op> nms_op,
     const std::string &name, std::chrono::milliseconds timeout, size_t buffer_pool_size,
     hailo_pipeline_elem_stats_flags_t elem_flags, hailo_vstream_stats_flags_t vstream_flags, EventPtr shutdown_event,
@@ -1690,6 +1695,8 @@ InputVStreamImpl::InputVStreamImpl(const hailo_vstream_info_t &vstream_info, con
 {
     // TODO: propagate a flag instead of using dynamic_pointer_cast (will be disabled when we'll disable RTTI)
     m_is_multi_planar = (nullptr != std::dynamic_pointer_cast<PixBufferElement>(pipeline_entry));
+    auto image_preprocess_elem = std::dynamic_pointer_cast<ImagePreprocessElement>(pipeline_entry);
+    m_image_frame_size = (nullptr != image_preprocess_elem) ? image_preprocess_elem->get_src_frame_size() : 0;
 
     if (HAILO_SUCCESS != output_status) {
         return;
@@ -1703,6 +1710,15 @@ InputVStreamImpl::~InputVStreamImpl()
     (void)stop_vstream();
 }
 
+size_t InputVStreamImpl::get_frame_size() const
+{
+    // With an image pre-process, the written buffers are source images rather than frames of the user buffer format
+    if (0 != m_image_frame_size) {
+        return m_image_frame_size;
+    }
+    return InputVStreamInternal::get_frame_size();
+}
+
 hailo_status InputVStreamImpl::write(const MemoryView &buffer)
 {
     if (nullptr != m_core_op_activated_event) {
@@ -3074,6 +3090,13 @@ Expected<std::vector<InputVStream>> VStreamsBuilder::create_input_vstreams(Confi
     return net_group.create_input_vstreams(inputs_params);
 }
 
+Expected<std::vector<InputVStream>> VStreamsBuilder::create_input_vstreams(ConfiguredNetworkGroup &net_group,
+    const std::map<std::string, hailo_vstream_params_t> &inputs_params,
+    const std::map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params)
+{
+    return net_group.create_input_vstreams(inputs_params, inputs_preprocess_params);
+}
+
 Expected<std::vector<OutputVStream>> VStreamsBuilder::create_output_vstreams(ConfiguredNetworkGroup &net_group,
     const std::map<std::string, hailo_vstream_params_t> &outputs_params)
 {
@@ -3082,7 +3105,7 @@ Expected<std::vector<OutputVStream>> VStreamsBuilder::create_output_vstreams(Con
 
 Expected<std::vector<InputVStream>> VStreamsBuilderUtils::create_inputs(
     std::vector<std::shared_ptr<InputStream>> input_streams, const hailo_vstream_info_t &vstream_info,
-    const hailo_vstream_params_t &vstream_params)
+    const hailo_vstream_params_t &vstream_params, const hailo_image_preprocess_params_t &preprocess_params)
 {
     CHECK_AS_EXPECTED(!input_streams.empty(), HAILO_INVALID_ARGUMENT, "input streams can't be empty");
     // if input streams has more than 1 value, it will be handled by handle_pix_buffer_splitter_flow. For all other purposes,
@@ -3113,7 +3136,10 @@ Expected<std::vector<InputVStream>> VStreamsBuilderUtils::create_inputs(
 
     auto user_timeout = std::chrono::milliseconds(vstream_params.timeout_ms);
 
+    const bool has_image_preprocess = (HAILO_IMAGE_COLOR_FORMAT_NONE != preprocess_params.color_format);
     if(input_streams.size() > 1) {
+        CHECK_AS_EXPECTED(!has_image_preprocess, HAILO_NOT_SUPPORTED,
+            "Image pre-process is not supported for multi-planar input {}", vstream_info.name);
         CHECK_SUCCESS_AS_EXPECTED(handle_pix_buffer_splitter_flow(input_streams, vstream_info,
             std::move(elements), vstreams, vstream_params, shutdown_event, pipeline_status, core_op_activated_event,
             pipeline_latency_accumulator.value()));
@@ -3130,7 +3156,7 @@ Expected<std::vector<InputVStream>> VStreamsBuilderUtils::create_inputs(
             input_stream_base->get_quant_infos());
         CHECK_EXPECTED(should_transform);
 
-        if (should_transform.value()) {
+        if (has_image_preprocess || should_transform.value()) {
             std::shared_ptr<SinkElement> elem_after_post_infer = hw_write_elem.value();
             auto queue_elem = PushQueueElement::create(
                 PipelineObject::create_element_name("PushQueueElement", input_stream->get_info().name, input_stream->get_info().index),
@@ -3139,16 +3165,27 @@ Expected<std::vector<InputVStream>> VStreamsBuilderUtils::create_inputs(
             elements.insert(elements.begin(), queue_elem.value());
             CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(queue_elem.value(), hw_write_elem.value()));
 
-            auto pre_infer_elem = PreInferElement::create(input_stream->get_info().shape, vstream_params.user_buffer_format,
-                input_stream->get_info().hw_shape, input_stream->get_info().format, input_stream_base->get_quant_infos(),
-                PipelineObject::create_element_name("PreInferElement", input_stream->get_info().name, input_stream->get_info().index),
-                vstream_params, shutdown_event, pipeline_status);
-            CHECK_EXPECTED(pre_infer_elem);
-            elements.insert(elements.begin(), pre_infer_elem.value());
-            CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(pre_infer_elem.value(), queue_elem.value()));
+            std::shared_ptr<FilterElement> pre_infer_elem;
+            if (has_image_preprocess) {
+                auto image_preprocess_elem = ImagePreprocessElement::create(preprocess_params, input_stream->get_info().shape,
+                    input_stream->get_info().hw_shape, input_stream->get_info().format, input_stream_base->get_quant_infos(),
+                    PipelineObject::create_element_name("ImagePreprocessElement", input_stream->get_info().name, input_stream->get_info().index),
+                    vstream_params, shutdown_event, pipeline_status);
+                CHECK_EXPECTED(image_preprocess_elem);
+                pre_infer_elem = image_preprocess_elem.release();
+            } else {
+                auto transform_elem = PreInferElement::create(input_stream->get_info().shape, vstream_params.user_buffer_format,
+                    input_stream->get_info().hw_shape, input_stream->get_info().format, input_stream_base->get_quant_infos(),
+                    PipelineObject::create_element_name("PreInferElement", input_stream->get_info().name, input_stream->get_info().index),
+                    vstream_params, shutdown_event, pipeline_status);
+                CHECK_EXPECTED(transform_elem);
+                pre_infer_elem = transform_elem.release();
+            }
+            elements.insert(elements.begin(), pre_infer_elem);
+            CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(pre_infer_elem, queue_elem.value()));
 
             input_stream->set_timeout(user_timeout);
-            auto vstream = InputVStream::create(vstream_info, input_stream_base->get_quant_infos(), vstream_params, pre_infer_elem.release(), hw_write_elem.release(), std::move(elements),
+            auto vstream = InputVStream::create(vstream_info, input_stream_base->get_quant_infos(), vstream_params, pre_infer_elem, hw_write_elem.release(), std::move(elements),
                 std::move(pipeline_status), shutdown_event, core_op_activated_event, pipeline_latency_accumulator.release());
             CHECK_EXPECTED(vstream);
             vstreams.emplace_back(vstream.release());
@@ -3310,32 +3347,14 @@ Expected<std::vector<OutputVStream>> VStreamsBuilderUtils::create_output_post_pr
         shutdown_event, vstream_params);
     CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(post_infer_element.value(), pre_nms_convert_queue_element.value()));
 
-    auto nms_to_detections_element = add_nms_to_detections_convert_element(output_stream, pipeline_status, elements, "NmsFormatToDetectionsElement",
-        vstream_params, iou_op_metadata, vstream_params.queue_size, std::chrono::milliseconds(HAILO_INFINITE), vstream_params.vstream_stats_flags, shutdown_event);
-    CHECK_EXPECTED(nms_to_detections_element);
-    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(pre_nms_convert_queue_element.value(), nms_to_detections_element.value()));
-
-    auto pre_remove_overlapping_bboxes_element_queue_element = add_pull_queue_element(output_stream, pipeline_status, elements, "PullQueueElement_pre_bboxes_removing",
-        shutdown_event, vstream_params);
-    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(nms_to_detections_element.value(), pre_remove_overlapping_bboxes_element_queue_element.value()));
-
-    auto remove_overlapping_bboxes_element = add_remove_overlapping_bboxes_element(output_stream, pipeline_status, elements, "RemoveOverlappingBboxesElement",
+    auto host_nms_element = add_host_nms_element(output_stream, pipeline_status, elements, "HostNmsElement",
         vstream_params, iou_op_metadata, vstream_params.queue_size, std::chrono::milliseconds(HAILO_INFINITE), vstream_params.vstream_stats_flags, shutdown_event);
-    CHECK_EXPECTED(remove_overlapping_bboxes_element);
-    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(pre_remove_overlapping_bboxes_element_queue_element.value(), remove_overlapping_bboxes_element.value()));
-
-    auto pre_fill_nms_format_element_queue_element = add_pull_queue_element(output_stream, pipeline_status, elements, "PullQueueElement_pre_fill_nms_format",
-        shutdown_event, vstream_params);
-    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(remove_overlapping_bboxes_element.value(), pre_fill_nms_format_element_queue_element.value()));
-
-    auto fill_nms_format_element = add_fill_nms_format_element(output_stream, pipeline_status, elements, "FillNmsFormatElement",
-        vstream_params, iou_op_metadata, vstream_params.queue_size, std::chrono::milliseconds(HAILO_INFINITE), vstream_params.vstream_stats_flags, shutdown_event);
-    CHECK_EXPECTED(fill_nms_format_element);
-    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(pre_fill_nms_format_element_queue_element.value(), fill_nms_format_element.value()));
+    CHECK_EXPECTED(host_nms_element);
+    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(pre_nms_convert_queue_element.value(), host_nms_element.value()));
 
     auto user_buffer_queue_element = add_user_buffer_queue_element(output_stream, pipeline_status, elements,
         "UserBufferQueueElement", shutdown_event, vstream_params);
-    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(fill_nms_format_element.value(), user_buffer_queue_element.value()));
+    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(host_nms_element.value(), user_buffer_queue_element.value()));
     output_stream->set_timeout(std::chrono::milliseconds(HAILO_INFINITE));
 
     auto output_vstream_info = iou_op_metadata->get_output_vstream_info();
@@ -3728,39 +3747,7 @@ Expected<std::shared_ptr<SoftmaxPostProcessElement>> VStreamsBuilderUtils::add_s
     return softmax_element;
 }
 
-Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> VStreamsBuilderUtils::add_nms_to_detections_convert_element(std::shared_ptr<OutputStream> &output_stream,
-    std::shared_ptr<std::atomic<hailo_status>> &pipeline_status, std::vector<std::shared_ptr<PipelineElement>> &elements,
-    const std::string &element_name, hailo_vstream_params_t &vstream_params, const net_flow::PostProcessOpMetadataPtr &op_metadata,
-    size_t buffer_pool_size, std::chrono::milliseconds timeout, const hailo_vstream_stats_flags_t &vstream_flags, EventPtr &shutdown_event)
-{
-    auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
-    assert(nullptr != metadata);
-
-    auto nms_to_detections_element = ConvertNmsToDetectionsElement::create(metadata->nms_info(),
-        PipelineObject::create_element_name(element_name, output_stream->name(), output_stream->get_info().index),
-        vstream_params.pipeline_elements_stats_flags, pipeline_status, timeout, vstream_flags, shutdown_event, buffer_pool_size);
-    CHECK_EXPECTED(nms_to_detections_element);
-    elements.push_back(nms_to_detections_element.value());
-    return nms_to_detections_element;
-}
-
-Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> VStreamsBuilderUtils::add_remove_overlapping_bboxes_element(std::shared_ptr<OutputStream> &output_stream,
-    std::shared_ptr<std::atomic<hailo_status>> &pipeline_status, std::vector<std::shared_ptr<PipelineElement>> &elements,
-    const std::string &element_name, hailo_vstream_params_t &vstream_params, const net_flow::PostProcessOpMetadataPtr &op_metadata,
-    size_t buffer_pool_size, std::chrono::milliseconds timeout, const hailo_vstream_stats_flags_t &vstream_flags, EventPtr &shutdown_event)
-{
-    auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
-    assert(nullptr != metadata);
-
-    auto remove_overlapping_bboxes_element = RemoveOverlappingBboxesElement::create(metadata->nms_config(),
-        PipelineObject::create_element_name(element_name, output_stream->name(), output_stream->get_info().index),
-        vstream_params.pipeline_elements_stats_flags, pipeline_status, timeout, vstream_flags, shutdown_event, buffer_pool_size);
-    CHECK_EXPECTED(remove_overlapping_bboxes_element);
-    elements.push_back(remove_overlapping_bboxes_element.value());
-    return remove_overlapping_bboxes_element;
-}
-
-Expected<std::shared_ptr<FillNmsFormatElement>> VStreamsBuilderUtils::add_fill_nms_format_element(std::shared_ptr<OutputStream> &output_stream,
+Expected<std::shared_ptr<HostNmsElement>> VStreamsBuilderUtils::add_host_nms_element(std::shared_ptr<OutputStream> &output_stream,
     std::shared_ptr<std::atomic<hailo_status>> &pipeline_status, std::vector<std::shared_ptr<PipelineElement>> &elements,
     const std::string &element_name, hailo_vstream_params_t &vstream_params, const net_flow::PostProcessOpMetadataPtr &op_metadata,
     size_t buffer_pool_size, std::chrono::milliseconds timeout, const hailo_vstream_stats_flags_t &vstream_flags, EventPtr &shutdown_event)
@@ -3768,12 +3755,12 @@ Expected<std::shared_ptr<FillNmsFormatElement>> VStreamsBuilderUtils::add_fill_n
     auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
     assert(nullptr != metadata);
 
-    auto fill_nms_format_element = FillNmsFormatElement::create(metadata->nms_info(), vstream_params.user_buffer_format, metadata->nms_config(),
+    auto host_nms_element = HostNmsElement::create(metadata->nms_info(), vstream_params.user_buffer_format, metadata->nms_config(),
         PipelineObject::create_element_name(element_name, output_stream->name(), output_stream->get_info().index),
         vstream_params.pipeline_elements_stats_flags, pipeline_status, timeout, vstream_flags, shutdown_event, buffer_pool_size);
-    CHECK_EXPECTED(fill_nms_format_element);
-    elements.push_back(fill_nms_format_element.value());
-    return fill_nms_format_element;
+    CHECK_EXPECTED(host_nms_element);
+    elements.push_back(host_nms_element.value());
+    return host_nms_element;
 }
 
 Expected<std::shared_ptr<UserBufferQueueElement>> VStreamsBuilderUtils::add_user_buffer_queue_element(std::shared_ptr<OutputStream> &output_stream,
@@ -4187,7 +4174,8 @@ hailo_status VStreamsBuilderUtils::add_nms_post_process(OutputStreamPtrVector &o
     CHECK(vstreams_params.user_buffer_format.type == HAILO_FORMAT_TYPE_FLOAT32, HAILO_INVALID_ARGUMENT,
         "NMS output format type must be HAILO_FORMAT_TYPE_FLOAT32");
     CHECK(HailoRTCommon::is_nms(vstreams_params.user_buffer_format.order), HAILO_INVALID_ARGUMENT,
-        "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK");
+        "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS, HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK, "
+        "HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS or HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK");
 
     std::unordered_map<std::string, net_flow::BufferMetaData> inputs_metadata;
     std::unordered_map<std::string, net_flow::BufferMetaData> outputs_metadata;
@@ -4280,8 +4268,9 @@ Expected<AccumulatorPtr> VStreamsBuilderUtils::create_pipeline_latency_accumulat
     AccumulatorPtr pipeline_latency_accumulator = nullptr;
     const auto measure_latency = ((vstreams_params.vstream_stats_flags & HAILO_VSTREAM_STATS_MEASURE_LATENCY) != 0);
     if (measure_latency) {
-        pipeline_latency_accumulator = make_shared_nothrow<FullAccumulator<double>>("latency");
-        CHECK_AS_EXPECTED(nullptr != pipeline_latency_accumulator, HAILO_OUT_OF_HOST_MEMORY);
+        auto accumulator = create_pipeline_stats_accumulator("latency", vstreams_params.pipeline_elements_stats_flags);
+        CHECK_EXPECTED(accumulator);
+        pipeline_latency_accumulator = accumulator.release();
     }
 
     return pipeline_latency_accumulator;
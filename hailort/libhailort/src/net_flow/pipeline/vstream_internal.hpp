@@ -32,6 +32,7 @@
 
 #include "hef/hef_internal.hpp"
 #include "net_flow/pipeline/pipeline.hpp"
+#include "transform/image_preprocess.hpp"
 #include "net_flow/ops/yolov5_post_process.hpp"
 #include "network_group/network_group_internal.hpp"
 
@@ -172,6 +173,7 @@ public:
     InputVStreamImpl &operator=(const InputVStreamImpl &) = delete;
     virtual ~InputVStreamImpl();
 
+    virtual size_t get_frame_size() const override;
     virtual hailo_status write(const MemoryView &buffer) override;
     virtual hailo_status write(const hailo_pix_buffer_t &buffer) override;
     virtual hailo_status flush() override;
@@ -184,6 +186,8 @@ private:
         EventPtr core_op_activated_event, hailo_status &output_status);
 
     bool m_is_multi_planar;
+    // Size of the source images of an image pre-process, 0 if the vstream has none
+    size_t m_image_frame_size;
 };
 
 class OutputVStreamImpl : public OutputVStreamInternal
@@ -353,30 +357,49 @@ private:
     std::unique_ptr<InputTransformContext> m_transform_context;
 };
 
-class RemoveOverlappingBboxesElement : public FilterElement
+// Replaces PreInferElement on inputs with a host image pre-process (see ::hailo_image_preprocess_params_t)
+class ImagePreprocessElement : public FilterElement
 {
 public:
-    static Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> create(
-        const net_flow::NmsPostProcessConfig nms_config, const std::string &name,
-        hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
-        std::chrono::milliseconds timeout, hailo_vstream_stats_flags_t vstream_flags, EventPtr shutdown_event,
-        size_t buffer_pool_size, PipelineDirection pipeline_direction = PipelineDirection::PULL, bool is_last_copy_element = false);
-    static Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> create(const net_flow::NmsPostProcessConfig nms_config,
-        const std::string &name, const ElementBuildParams &build_params, PipelineDirection pipeline_direction = PipelineDirection::PULL, 
-        bool is_last_copy_element = false);
-    RemoveOverlappingBboxesElement(const net_flow::NmsPostProcessConfig &&nms_config, const std::string &name, DurationCollector &&duration_collector,
-        std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, BufferPoolPtr buffer_pool, std::chrono::milliseconds timeout,
-        PipelineDirection pipeline_direction);
-    virtual ~RemoveOverlappingBboxesElement() = default;
-    virtual hailo_status run_push(PipelineBuffer &&buffer, const PipelinePad &sink) override;
+    static Expected<std::shared_ptr<ImagePreprocessElement>> create(const hailo_image_preprocess_params_t &preprocess_params,
+        const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &dst_hw_shape, const hailo_format_t &dst_format,
+        const std::vector<hailo_quant_info_t> &dst_quant_infos, const std::string &name, std::chrono::milliseconds timeout,
+        size_t buffer_pool_size, hailo_pipeline_elem_stats_flags_t elem_flags, hailo_vstream_stats_flags_t vstream_flags,
+        EventPtr shutdown_event, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
+        PipelineDirection pipeline_direction = PipelineDirection::PUSH, bool is_dma_able = false);
+    static Expected<std::shared_ptr<ImagePreprocessElement>> create(const hailo_image_preprocess_params_t &preprocess_params,
+        const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &dst_hw_shape, const hailo_format_t &dst_format,
+        const std::vector<hailo_quant_info_t> &dst_quant_infos, const std::string &name, const hailo_vstream_params_t &vstream_params,
+        EventPtr shutdown_event, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
+        PipelineDirection pipeline_direction = PipelineDirection::PUSH, bool is_dma_able = false);
+    static Expected<std::shared_ptr<ImagePreprocessElement>> create(const hailo_image_preprocess_params_t &preprocess_params,
+        const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &dst_hw_shape, const hailo_format_t &dst_format,
+        const std::vector<hailo_quant_info_t> &dst_quant_infos, const std::string &name, const ElementBuildParams &build_params,
+        PipelineDirection pipeline_direction = PipelineDirection::PUSH, bool is_dma_able = false);
+    ImagePreprocessElement(std::unique_ptr<ImagePreprocessContext> &&preprocess_context,
+        std::unique_ptr<InputTransformContext> &&transform_context, Buffer &&rgb_frame, BufferPoolPtr buffer_pool,
+        const std::string &name, std::chrono::milliseconds timeout, DurationCollector &&duration_collector,
+        std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, PipelineDirection pipeline_direction);
+    virtual ~ImagePreprocessElement() = default;
+
+    virtual Expected<PipelineBuffer> run_pull(PipelineBuffer &&optional, const PipelinePad &source) override;
     virtual PipelinePad &next_pad() override;
     virtual std::string description() const override;
 
+    // Size of the source images pushed into the element
+    size_t get_src_frame_size() const;
+
 protected:
     virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
 
 private:
-    net_flow::NmsPostProcessConfig m_nms_config;
+    hailo_status preprocess(const MemoryView src, MemoryView dst);
+
+    std::unique_ptr<ImagePreprocessContext> m_preprocess_context;
+    // Used only when the pre-process can't write the device's input layout directly - the image is written to
+    // m_rgb_frame (NHWC), and transformed to the device's layout
+    std::unique_ptr<InputTransformContext> m_transform_context;
+    Buffer m_rgb_frame;
 };
 
 class PostInferElement : public FilterElement
@@ -412,46 +435,25 @@ private:
     std::unique_ptr<OutputTransformContext> m_transform_context;
 };
 
-class ConvertNmsToDetectionsElement : public FilterElement
+// Runs the host side of the NMS (IOU) on a frame in HAILO_NMS format: parses the detections, removes the
+// overlapping boxes and writes the result in the user's HAILO_NMS format.
+// The detections are parsed into storage owned by the element, so no allocation is done per frame.
+// Note: The element is not thread safe - frames are processed one at a time (by the thread pushing/pulling them).
+class HostNmsElement : public FilterElement
 {
 public:
-    static Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> create(const hailo_nms_info_t &nms_info, const std::string &name,
+    static Expected<std::shared_ptr<HostNmsElement>> create(const hailo_nms_info_t &nms_info,
+        const hailo_format_t &dst_format, const net_flow::NmsPostProcessConfig &nms_config, const std::string &name,
         hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
         std::chrono::milliseconds timeout, hailo_vstream_stats_flags_t vstream_flags, EventPtr shutdown_event,
         size_t buffer_pool_size, PipelineDirection pipeline_direction = PipelineDirection::PULL, bool is_last_copy_element = false);
-    static Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> create(
-        const hailo_nms_info_t &nms_info, const std::string &name, const ElementBuildParams &build_params,
-        PipelineDirection pipeline_direction = PipelineDirection::PULL, bool is_last_copy_element = false);
-    ConvertNmsToDetectionsElement(const hailo_nms_info_t &&nms_info, const std::string &name, DurationCollector &&duration_collector,
-        std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, BufferPoolPtr buffer_pool, std::chrono::milliseconds timeout,
-        PipelineDirection pipeline_direction);
-    virtual ~ConvertNmsToDetectionsElement() = default;
-    virtual hailo_status run_push(PipelineBuffer &&buffer, const PipelinePad &sink) override;
-    virtual PipelinePad &next_pad() override;
-    virtual std::string description() const override;
-
-protected:
-    virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
-
-private:
-    hailo_nms_info_t m_nms_info;
-};
-
-class FillNmsFormatElement : public FilterElement
-{
-public:
-    static Expected<std::shared_ptr<FillNmsFormatElement>> create(const hailo_nms_info_t nms_info,
-        const hailo_format_t &dst_format, const net_flow::NmsPostProcessConfig nms_config, const std::string &name,
-        hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
-        std::chrono::milliseconds timeout, hailo_vstream_stats_flags_t vstream_flags, EventPtr shutdown_event,
-        size_t buffer_pool_size, PipelineDirection pipeline_direction = PipelineDirection::PULL, bool is_last_copy_element = false);
-    static Expected<std::shared_ptr<FillNmsFormatElement>> create(const hailo_nms_info_t nms_info,
-        const hailo_format_t &dst_format, const net_flow::NmsPostProcessConfig nms_config, const std::string &name,
+    static Expected<std::shared_ptr<HostNmsElement>> create(const hailo_nms_info_t &nms_info,
+        const hailo_format_t &dst_format, const net_flow::NmsPostProcessConfig &nms_config, const std::string &name,
         const ElementBuildParams &build_params, PipelineDirection pipeline_direction = PipelineDirection::PULL, bool is_last_copy_element = false);
-    FillNmsFormatElement(const net_flow::NmsPostProcessConfig &&nms_config, const std::string &name, DurationCollector &&duration_collector,
-        std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, BufferPoolPtr buffer_pool, std::chrono::milliseconds timeout,
-        PipelineDirection pipeline_direction);
-    virtual ~FillNmsFormatElement() = default;
+    HostNmsElement(const hailo_nms_info_t &nms_info, const hailo_format_t &dst_format, const net_flow::NmsPostProcessConfig &nms_config,
+        const std::string &name, DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, BufferPoolPtr buffer_pool,
+        std::chrono::milliseconds timeout, PipelineDirection pipeline_direction);
+    virtual ~HostNmsElement() = default;
     virtual hailo_status run_push(PipelineBuffer &&buffer, const PipelinePad &sink) override;
     virtual PipelinePad &next_pad() override;
     virtual std::string description() const override;
@@ -460,7 +462,14 @@ protected:
     virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
 
 private:
-    net_flow::NmsPostProcessConfig m_nms_config;
+    const hailo_nms_info_t m_nms_info;
+    const hailo_format_t m_dst_format;
+    const net_flow::NmsPostProcessConfig m_nms_config;
+
+    // Per frame storage, reused between frames
+    std::vector<net_flow::DetectionBbox> m_detections;
+    std::vector<uint32_t> m_classes_detections_count;
+    std::vector<uint32_t> m_num_of_detections_before;
 };
 
 class ArgmaxPostProcessElement : public FilterElement
@@ -765,7 +774,7 @@ class VStreamsBuilderUtils
 {
 public:
     static Expected<std::vector<InputVStream>> create_inputs(std::vector<std::shared_ptr<InputStream>> input_streams, const hailo_vstream_info_t &input_vstream_infos,
-        const hailo_vstream_params_t &vstreams_params);
+        const hailo_vstream_params_t &vstreams_params, const hailo_image_preprocess_params_t &preprocess_params);
     static Expected<std::vector<OutputVStream>> create_outputs(std::shared_ptr<OutputStream> output_stream,
         NameToVStreamParamsMap &vstreams_params_map, const std::map<std::string, hailo_vstream_info_t> &output_vstream_infos);
     static InputVStream create_input(std::shared_ptr<InputVStreamInternal> input_vstream);
@@ -803,17 +812,7 @@ public:
         size_t buffer_pool_size, std::chrono::milliseconds timeout, const hailo_vstream_stats_flags_t &vstream_flags,
         EventPtr &shutdown_event);
 
-    static Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> add_nms_to_detections_convert_element(std::shared_ptr<OutputStream> &output_stream,
-        std::shared_ptr<std::atomic<hailo_status>> &pipeline_status, std::vector<std::shared_ptr<PipelineElement>> &elements, const std::string &element_name,
-        hailo_vstream_params_t &vstream_params, const net_flow::PostProcessOpMetadataPtr &iou_op_metadata, size_t buffer_pool_size, std::chrono::milliseconds timeout,
-        const hailo_vstream_stats_flags_t &vstream_flags, EventPtr &shutdown_event);
-
-    static Expected<std::shared_ptr<RemoveOverlappingBboxesElement>> add_remove_overlapping_bboxes_element(std::shared_ptr<OutputStream> &output_stream,
-        std::shared_ptr<std::atomic<hailo_status>> &pipeline_status, std::vector<std::shared_ptr<PipelineElement>> &elements,
-        const std::string &element_name, hailo_vstream_params_t &vstream_params, const net_flow::PostProcessOpMetadataPtr &iou_op_metadata,
-        size_t buffer_pool_size, std::chrono::milliseconds timeout, const hailo_vstream_stats_flags_t &vstream_flags, EventPtr &shutdown_event);
-
-    static Expected<std::shared_ptr<FillNmsFormatElement>> add_fill_nms_format_element(std::shared_ptr<OutputStream> &output_stream,
+    static Expected<std::shared_ptr<HostNmsElement>> add_host_nms_element(std::shared_ptr<OutputStream> &output_stream,
         std::shared_ptr<std::atomic<hailo_status>> &pipeline_status, std::vector<std::shared_ptr<PipelineElement>> &elements,
         const std::string &element_name, hailo_vstream_params_t &vstream_params, const net_flow::PostProcessOpMetadataPtr &iou_op_metadata,
         size_t buffer_pool_size, std::chrono::milliseconds timeout, const hailo_vstream_stats_flags_t &vstream_flags, EventPtr &shutdown_event);
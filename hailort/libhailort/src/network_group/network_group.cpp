@@ -561,6 +561,17 @@ static std::map<std::string, hailo_vstream_info_t> vstream_infos_vector_to_map(s
 
 Expected<std::vector<InputVStream>> ConfiguredNetworkGroupBase::create_input_vstreams(const std::map<std::string, hailo_vstream_params_t> &inputs_params)
 {
+    return create_input_vstreams(inputs_params, {});
+}
+
+Expected<std::vector<InputVStream>> ConfiguredNetworkGroupBase::create_input_vstreams(const std::map<std::string, hailo_vstream_params_t> &inputs_params,
+    const std::map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params)
+{
+    for (const auto &name_preprocess_pair : inputs_preprocess_params) {
+        CHECK_AS_EXPECTED(contains(inputs_params, name_preprocess_pair.first), HAILO_NOT_FOUND,
+            "Image pre-process is set to {}, which isn't in the created input vstreams", name_preprocess_pair.first);
+    }
+
     auto input_vstream_infos = get_input_vstream_infos();
     CHECK_EXPECTED(input_vstream_infos);
     auto input_vstream_infos_map = vstream_infos_vector_to_map(input_vstream_infos.release());
@@ -590,7 +601,12 @@ Expected<std::vector<InputVStream>> ConfiguredNetworkGroupBase::create_input_vst
 
         auto expanded_vstream_params = (streams.size() > 1) ? expand_vstream_params_autos_multi_planar(vstream_info->second, vstream_params) :
             expand_vstream_params_autos(streams.back()->get_info(), vstream_params);
-        auto inputs = VStreamsBuilderUtils::create_inputs(streams, vstream_info->second, expanded_vstream_params);
+        hailo_image_preprocess_params_t preprocess_params{};
+        if (contains(inputs_preprocess_params, vstream_name)) {
+            preprocess_params = inputs_preprocess_params.at(vstream_name);
+        }
+        auto inputs = VStreamsBuilderUtils::create_inputs(streams, vstream_info->second, expanded_vstream_params,
+            preprocess_params);
         CHECK_EXPECTED(inputs);
 
         vstreams.insert(vstreams.end(), std::make_move_iterator(inputs->begin()), std::make_move_iterator(inputs->end()));
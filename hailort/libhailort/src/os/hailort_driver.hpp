@@ -4,9 +4,11 @@
  **/
 /**
  * @file hailort_driver.hpp
- * @brief Low level interface to PCI driver
+ * @brief Low level interface to the hailo driver.
  *
- * 
+ * HailoRTDriver is an abstract interface - the default implementation (HailoRTKernelDriver, created by
+ * HailoRTDriver::create) sends the requests to the kernel driver. Other implementations (e.g. SoftwareDriver) can be
+ * used to run the vdma flows without a device.
  **/
 #ifndef _HAILORT_DRIVER_HPP_
 #define _HAILORT_DRIVER_HPP_
@@ -102,7 +104,7 @@ struct DescriptorsListInfo {
     void *user_address;
 };
 
-class HailoRTDriver final
+class HailoRTDriver
 {
 public:
 
@@ -148,36 +150,36 @@ public:
 
     using VdmaBufferHandle = size_t;
 
+    // Opens the kernel driver of the given device
     static Expected<std::unique_ptr<HailoRTDriver>> create(const DeviceInfo &device_info);
 
-// TODO: HRT-7309 add implementation for Windows
-#if defined(__linux__) || defined(__QNX__)
-    hailo_status hailo_ioctl(int fd, unsigned long request, void* request_struct, int &error_status);
-#endif // defined(__linux__) || defined(__QNX__)
-
     static Expected<std::vector<DeviceInfo>> scan_devices();
 
-    hailo_status read_memory(MemoryType memory_type, uint64_t address, void *buf, size_t size);
-    hailo_status write_memory(MemoryType memory_type, uint64_t address, const void *buf, size_t size);
+    virtual ~HailoRTDriver() = default;
+
+    virtual hailo_status read_memory(MemoryType memory_type, uint64_t address, void *buf, size_t size) = 0;
+    virtual hailo_status write_memory(MemoryType memory_type, uint64_t address, const void *buf, size_t size) = 0;
 
-    Expected<uint32_t> read_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction, size_t offset,
-        size_t reg_size);
-    hailo_status write_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction, size_t offset,
-        size_t reg_size, uint32_t data);
+    virtual Expected<uint32_t> read_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+        size_t offset, size_t reg_size) = 0;
+    virtual hailo_status write_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+        size_t offset, size_t reg_size, uint32_t data) = 0;
 
-    hailo_status vdma_buffer_sync(VdmaBufferHandle buffer, DmaSyncDirection sync_direction, size_t offset, size_t count);
+    virtual hailo_status vdma_buffer_sync(VdmaBufferHandle buffer, DmaSyncDirection sync_direction, size_t offset,
+        size_t count) = 0;
 
-    hailo_status vdma_interrupts_enable(const ChannelsBitmap &channels_bitmap, bool enable_timestamps_measure);
-    hailo_status vdma_interrupts_disable(const ChannelsBitmap &channel_id);
-    Expected<IrqData> vdma_interrupts_wait(const ChannelsBitmap &channels_bitmap);
-    Expected<ChannelInterruptTimestampList> vdma_interrupts_read_timestamps(vdma::ChannelId channel_id);
+    virtual hailo_status vdma_interrupts_enable(const ChannelsBitmap &channels_bitmap,
+        bool enable_timestamps_measure) = 0;
+    virtual hailo_status vdma_interrupts_disable(const ChannelsBitmap &channel_id) = 0;
+    virtual Expected<IrqData> vdma_interrupts_wait(const ChannelsBitmap &channels_bitmap) = 0;
+    virtual Expected<ChannelInterruptTimestampList> vdma_interrupts_read_timestamps(vdma::ChannelId channel_id) = 0;
 
-    Expected<std::vector<uint8_t>> read_notification();
-    hailo_status disable_notifications();
+    virtual Expected<std::vector<uint8_t>> read_notification() = 0;
+    virtual hailo_status disable_notifications() = 0;
 
-    hailo_status fw_control(const void *request, size_t request_len, const uint8_t request_md5[PCIE_EXPECTED_MD5_LENGTH],
-        void *response, size_t *response_len, uint8_t response_md5[PCIE_EXPECTED_MD5_LENGTH],
-        std::chrono::milliseconds timeout, hailo_cpu_id_t cpu_id);
+    virtual hailo_status fw_control(const void *request, size_t request_len,
+        const uint8_t request_md5[PCIE_EXPECTED_MD5_LENGTH], void *response, size_t *response_len,
+        uint8_t response_md5[PCIE_EXPECTED_MD5_LENGTH], std::chrono::milliseconds timeout, hailo_cpu_id_t cpu_id) = 0;
 
     /**
      * Read data from the debug log buffer.
@@ -188,9 +190,10 @@ public:
      * @param[in]     cpu_id            - The cpu source of the debug log.
      * @return hailo_status
      */
-    hailo_status read_log(uint8_t *buffer, size_t buffer_size, size_t *read_bytes, hailo_cpu_id_t cpu_id);
+    virtual hailo_status read_log(uint8_t *buffer, size_t buffer_size, size_t *read_bytes,
+        hailo_cpu_id_t cpu_id) = 0;
 
-    hailo_status reset_nn_core();
+    virtual hailo_status reset_nn_core() = 0;
 
     /**
      * Pins a page aligned user buffer to physical memory, creates an IOMMU mapping (pci_mag_sg).
@@ -200,13 +203,13 @@ public:
      * @param[in] driver_buff_handle - handle to driver allocated buffer - INVALID_DRIVER_BUFFER_HANDLE_VALUE in case
      *  of user allocated buffer
      */ 
-    Expected<VdmaBufferHandle> vdma_buffer_map(void *user_address, size_t required_size, DmaDirection data_direction,
-        const vdma_mapped_buffer_driver_identifier &driver_buff_handle);
+    virtual Expected<VdmaBufferHandle> vdma_buffer_map(void *user_address, size_t required_size,
+        DmaDirection data_direction, const vdma_mapped_buffer_driver_identifier &driver_buff_handle) = 0;
 
     /**
     * Unmaps user buffer mapped using HailoRTDriver::map_buffer.
     */
-    hailo_status vdma_buffer_unmap(VdmaBufferHandle handle);
+    virtual hailo_status vdma_buffer_unmap(VdmaBufferHandle handle) = 0;
 
     /**
      * Allocate vdma descriptors list object that can bind to some buffer. Used for scatter gather vdma.
@@ -215,21 +218,21 @@ public:
      * @param[in] is_circular - if true, the descriptors list can be used in a circular (and desc_count must be power
      *                          of 2)
      */
-    Expected<DescriptorsListInfo> descriptors_list_create(size_t desc_count, bool is_circular);
+    virtual Expected<DescriptorsListInfo> descriptors_list_create(size_t desc_count, bool is_circular) = 0;
 
     /**
      * Frees a vdma descriptors buffer allocated by 'descriptors_list_create'.
      */
-    hailo_status descriptors_list_release(const DescriptorsListInfo &descriptors_list_info);
+    virtual hailo_status descriptors_list_release(const DescriptorsListInfo &descriptors_list_info) = 0;
 
     /**
      * Configure vdma channel descriptors to point to the given user address.
      */
-    hailo_status descriptors_list_bind_vdma_buffer(uintptr_t desc_handle, VdmaBufferHandle buffer_handle,
-        uint16_t desc_page_size, uint8_t channel_index, uint32_t starting_desc);
+    virtual hailo_status descriptors_list_bind_vdma_buffer(uintptr_t desc_handle, VdmaBufferHandle buffer_handle,
+        uint16_t desc_page_size, uint8_t channel_index, uint32_t starting_desc) = 0;
 
-    Expected<uintptr_t> vdma_low_memory_buffer_alloc(size_t size);
-    hailo_status vdma_low_memory_buffer_free(uintptr_t buffer_handle);
+    virtual Expected<uintptr_t> vdma_low_memory_buffer_alloc(size_t size) = 0;
+    virtual hailo_status vdma_low_memory_buffer_free(uintptr_t buffer_handle) = 0;
 
     /**
      * Allocate continuous vdma buffer.
@@ -237,18 +240,18 @@ public:
      * @param[in] size - Buffer size
      * @return pair <buffer_handle, dma_address>.
      */
-    Expected<std::pair<uintptr_t, uint64_t>> vdma_continuous_buffer_alloc(size_t size);
+    virtual Expected<std::pair<uintptr_t, uint64_t>> vdma_continuous_buffer_alloc(size_t size) = 0;
 
     /**
      * Frees a vdma continuous buffer allocated by 'vdma_continuous_buffer_alloc'.
      */
-    hailo_status vdma_continuous_buffer_free(uintptr_t buffer_handle);
+    virtual hailo_status vdma_continuous_buffer_free(uintptr_t buffer_handle) = 0;
 
     /**
      * Marks the device as used for vDMA operations. Only one open FD can be marked at once.
      * The device is "unmarked" only on FD close.
      */
-    hailo_status mark_as_used();
+    virtual hailo_status mark_as_used() = 0;
 
     const std::string &device_id() const
     {
@@ -260,7 +263,8 @@ public:
         return m_dma_type;
     }
 
-    FileDescriptor& fd() {return m_fd;}
+    // The driver file, used to mmap driver allocated buffers
+    virtual FileDescriptor& fd() = 0;
 
     inline bool allocate_driver_buffer() const
     {
@@ -291,19 +295,15 @@ public:
     static const size_t INVALID_DRIVER_VDMA_MAPPING_HANDLE_VALUE;
     static const uint8_t INVALID_VDMA_CHANNEL_INDEX;
 
-private:
-    hailo_status read_memory_ioctl(MemoryType memory_type, uint64_t address, void *buf, size_t size);
-    hailo_status write_memory_ioctl(MemoryType memory_type, uint64_t address, const void *buf, size_t size);
-
-    Expected<std::pair<uintptr_t, uint64_t>> descriptors_list_create_ioctl(size_t desc_count, bool is_circular);
-    hailo_status descriptors_list_release_ioctl(uintptr_t desc_handle);
-    Expected<void *> descriptors_list_create_mmap(uintptr_t desc_handle, size_t desc_count);
-    hailo_status descriptors_list_create_munmap(void *address, size_t desc_count);
+protected:
+    HailoRTDriver(const DeviceInfo &device_info);
 
-    HailoRTDriver(const DeviceInfo &device_info, FileDescriptor &&fd, hailo_status &status);
+    bool is_valid_channel_id(const vdma::ChannelId &channel_id) const
+    {
+        return (channel_id.engine_index < m_dma_engines_count) && (channel_id.channel_index < VDMA_CHANNELS_PER_ENGINE);
+    }
 
-    bool is_valid_channel_id(const vdma::ChannelId &channel_id);
-    bool is_valid_channels_bitmap(const ChannelsBitmap &bitmap)
+    bool is_valid_channels_bitmap(const ChannelsBitmap &bitmap) const
     {
         for (size_t engine_index = m_dma_engines_count; engine_index < MAX_VDMA_ENGINES_COUNT; engine_index++) {
             if (bitmap[engine_index]) {
@@ -315,27 +315,23 @@ private:
         return true;
     }
 
-    FileDescriptor m_fd;
     DeviceInfo m_device_info;
     uint16_t m_desc_max_page_size;
     DmaType m_dma_type;
     bool m_allocate_driver_buffer;
     size_t m_dma_engines_count;
     bool m_is_fw_loaded;
-#ifdef __QNX__
-    pid_t m_resource_manager_pid;
-#endif // __QNX__
-
-#ifdef __linux__
-    // TODO: HRT-11595 fix linux driver deadlock and remove the mutex.
-    // Currently, on the linux, the mmap syscall is called under current->mm lock held. Inside, we lock the board
-    // mutex. On other ioctls, we first lock the board mutex, and then lock current->mm mutex (For example - before
-    // pinning user address to memory and on copy_to_user/copy_from_user calls).
-    // Need to refactor the driver lock mechanism and then remove the mutex from here.
-    std::mutex m_driver_lock;
-#endif
 };
 
+inline HailoRTDriver::HailoRTDriver(const DeviceInfo &device_info) :
+    m_device_info(device_info),
+    m_desc_max_page_size(0),
+    m_dma_type(DmaType::PCIE),
+    m_allocate_driver_buffer(false),
+    m_dma_engines_count(0),
+    m_is_fw_loaded(false)
+{}
+
 inline hailo_dma_buffer_direction_t to_hailo_dma_direction(HailoRTDriver::DmaDirection dma_direction)
 {
     return (dma_direction == HailoRTDriver::DmaDirection::H2D)  ? HAILO_DMA_BUFFER_DIRECTION_H2D :
@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2020-2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file hailort_kernel_driver.hpp
+ * @brief HailoRTDriver implementation that sends the requests to the hailo kernel driver (PCIe/integrated).
+ *        The implementation is platform specific (os/<platform>/hailort_driver.cpp).
+ **/
+
+#ifndef _HAILORT_KERNEL_DRIVER_HPP_
+#define _HAILORT_KERNEL_DRIVER_HPP_
+
+#include "os/hailort_driver.hpp"
+
+
+namespace hailort
+{
+
+class HailoRTKernelDriver final : public HailoRTDriver
+{
+public:
+    HailoRTKernelDriver(const DeviceInfo &device_info, FileDescriptor &&fd, hailo_status &status);
+    virtual ~HailoRTKernelDriver() = default;
+
+    HailoRTKernelDriver(const HailoRTKernelDriver &other) = delete;
+    HailoRTKernelDriver &operator=(const HailoRTKernelDriver &other) = delete;
+    HailoRTKernelDriver(HailoRTKernelDriver &&other) noexcept = delete;
+    HailoRTKernelDriver &operator=(HailoRTKernelDriver &&other) = delete;
+
+// TODO: HRT-7309 add implementation for Windows
+#if defined(__linux__) || defined(__QNX__)
+    hailo_status hailo_ioctl(int fd, unsigned long request, void* request_struct, int &error_status);
+#endif // defined(__linux__) || defined(__QNX__)
+
+    virtual hailo_status read_memory(MemoryType memory_type, uint64_t address, void *buf, size_t size) override;
+    virtual hailo_status write_memory(MemoryType memory_type, uint64_t address, const void *buf,
+        size_t size) override;
+
+    virtual Expected<uint32_t> read_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+        size_t offset, size_t reg_size) override;
+    virtual hailo_status write_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+        size_t offset, size_t reg_size, uint32_t data) override;
+
+    virtual hailo_status vdma_buffer_sync(VdmaBufferHandle buffer, DmaSyncDirection sync_direction, size_t offset,
+        size_t count) override;
+
+    virtual hailo_status vdma_interrupts_enable(const ChannelsBitmap &channels_bitmap,
+        bool enable_timestamps_measure) override;
+    virtual hailo_status vdma_interrupts_disable(const ChannelsBitmap &channel_id) override;
+    virtual Expected<IrqData> vdma_interrupts_wait(const ChannelsBitmap &channels_bitmap) override;
+    virtual Expected<ChannelInterruptTimestampList> vdma_interrupts_read_timestamps(
+        vdma::ChannelId channel_id) override;
+
+    virtual Expected<std::vector<uint8_t>> read_notification() override;
+    virtual hailo_status disable_notifications() override;
+
+    virtual hailo_status fw_control(const void *request, size_t request_len,
+        const uint8_t request_md5[PCIE_EXPECTED_MD5_LENGTH], void *response, size_t *response_len,
+        uint8_t response_md5[PCIE_EXPECTED_MD5_LENGTH], std::chrono::milliseconds timeout,
+        hailo_cpu_id_t cpu_id) override;
+
+    virtual hailo_status read_log(uint8_t *buffer, size_t buffer_size, size_t *read_bytes,
+        hailo_cpu_id_t cpu_id) override;
+
+    virtual hailo_status reset_nn_core() override;
+
+    virtual Expected<VdmaBufferHandle> vdma_buffer_map(void *user_address, size_t required_size,
+        DmaDirection data_direction, const vdma_mapped_buffer_driver_identifier &driver_buff_handle) override;
+    virtual hailo_status vdma_buffer_unmap(VdmaBufferHandle handle) override;
+
+    virtual Expected<DescriptorsListInfo> descriptors_list_create(size_t desc_count, bool is_circular) override;
+    virtual hailo_status descriptors_list_release(const DescriptorsListInfo &descriptors_list_info) override;
+    virtual hailo_status descriptors_list_bind_vdma_buffer(uintptr_t desc_handle, VdmaBufferHandle buffer_handle,
+        uint16_t desc_page_size, uint8_t channel_index, uint32_t starting_desc) override;
+
+    virtual Expected<uintptr_t> vdma_low_memory_buffer_alloc(size_t size) override;
+    virtual hailo_status vdma_low_memory_buffer_free(uintptr_t buffer_handle) override;
+
+    virtual Expected<std::pair<uintptr_t, uint64_t>> vdma_continuous_buffer_alloc(size_t size) override;
+    virtual hailo_status vdma_continuous_buffer_free(uintptr_t buffer_handle) override;
+
+    virtual hailo_status mark_as_used() override;
+
+    virtual FileDescriptor& fd() override {return m_fd;}
+
+private:
+    hailo_status read_memory_ioctl(MemoryType memory_type, uint64_t address, void *buf, size_t size);
+    hailo_status write_memory_ioctl(MemoryType memory_type, uint64_t address, const void *buf, size_t size);
+
+    Expected<std::pair<uintptr_t, uint64_t>> descriptors_list_create_ioctl(size_t desc_count, bool is_circular);
+    hailo_status descriptors_list_release_ioctl(uintptr_t desc_handle);
+    Expected<void *> descriptors_list_create_mmap(uintptr_t desc_handle, size_t desc_count);
+    hailo_status descriptors_list_create_munmap(void *address, size_t desc_count);
+
+    FileDescriptor m_fd;
+#ifdef __QNX__
+    pid_t m_resource_manager_pid;
+#endif // __QNX__
+
+#ifdef __linux__
+    // TODO: HRT-11595 fix linux driver deadlock and remove the mutex.
+    // Currently, on the linux, the mmap syscall is called under current->mm lock held. Inside, we lock the board
+    // mutex. On other ioctls, we first lock the board mutex, and then lock current->mm mutex (For example - before
+    // pinning user address to memory and on copy_to_user/copy_from_user calls).
+    // Need to refactor the driver lock mechanism and then remove the mutex from here.
+    std::mutex m_driver_lock;
+#endif
+};
+
+} /* namespace hailort */
+
+#endif  /* _HAILORT_KERNEL_DRIVER_HPP_ */
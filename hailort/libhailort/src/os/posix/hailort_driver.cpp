@@ -1,4 +1,4 @@
-#include "os/hailort_driver.hpp"
+#include "os/hailort_kernel_driver.hpp"
 #include "os/driver_scan.hpp"
 #include "hailo_ioctl_common.h"
 #include "common/logger_macros.hpp"
@@ -114,7 +114,8 @@ Expected<std::unique_ptr<HailoRTDriver>> HailoRTDriver::create(const DeviceInfo
         "Failed to open device file {} with error {}", device_info.dev_path, errno);
 
     hailo_status status = HAILO_UNINITIALIZED;
-    std::unique_ptr<HailoRTDriver> driver(new (std::nothrow) HailoRTDriver(device_info, std::move(fd), status));
+    std::unique_ptr<HailoRTDriver> driver(new (std::nothrow) HailoRTKernelDriver(device_info, std::move(fd),
+        status));
     CHECK_NOT_NULL_AS_EXPECTED(driver, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
@@ -134,7 +135,7 @@ static bool is_blocking_ioctl(unsigned long request)
     }
 }
 
-hailo_status HailoRTDriver::hailo_ioctl(int fd, unsigned long request, void* request_struct, int &error_status)
+hailo_status HailoRTKernelDriver::hailo_ioctl(int fd, unsigned long request, void* request_struct, int &error_status)
 {
     // We lock m_driver lock on all request but the blocking onces. Read m_driver_lock doc in the header
     std::unique_lock<std::mutex> lock;
@@ -147,7 +148,7 @@ hailo_status HailoRTDriver::hailo_ioctl(int fd, unsigned long request, void* req
     return (res >= 0) ? HAILO_SUCCESS : HAILO_DRIVER_FAIL;
 }
 #elif defined(__QNX__)
-hailo_status HailoRTDriver::hailo_ioctl(int fd, unsigned long request, void* request_struct, int &error_status)
+hailo_status HailoRTKernelDriver::hailo_ioctl(int fd, unsigned long request, void* request_struct, int &error_status)
 {
     int res = ioctl(fd, static_cast<int>(request), request_struct);
     if (0 > res) {
@@ -174,10 +175,9 @@ static hailo_status validate_driver_version(const hailo_driver_info &driver_info
     return HAILO_SUCCESS;
 }
 
-HailoRTDriver::HailoRTDriver(const DeviceInfo &device_info, FileDescriptor &&fd, hailo_status &status) :
-    m_fd(std::move(fd)),
-    m_device_info(device_info),
-    m_allocate_driver_buffer(false)
+HailoRTKernelDriver::HailoRTKernelDriver(const DeviceInfo &device_info, FileDescriptor &&fd, hailo_status &status) :
+    HailoRTDriver(device_info),
+    m_fd(std::move(fd))
 {
     hailo_driver_info driver_info = {};
     int err = 0;
@@ -226,7 +226,7 @@ HailoRTDriver::HailoRTDriver(const DeviceInfo &device_info, FileDescriptor &&fd,
     status = HAILO_SUCCESS;
 }
 
-Expected<std::vector<uint8_t>> HailoRTDriver::read_notification()
+Expected<std::vector<uint8_t>> HailoRTKernelDriver::read_notification()
 {
     hailo_d2h_notification notification_buffer = {};
 
@@ -241,7 +241,7 @@ Expected<std::vector<uint8_t>> HailoRTDriver::read_notification()
     return notification;
 }
 
-hailo_status HailoRTDriver::disable_notifications()
+hailo_status HailoRTKernelDriver::disable_notifications()
 {
     int err = 0;
     auto status = hailo_ioctl(this->m_fd, HAILO_DISABLE_NOTIFICATION, 0, err);
@@ -288,7 +288,7 @@ Expected<std::vector<HailoRTDriver::DeviceInfo>> HailoRTDriver::scan_devices()
 static_assert(true, "Error, Unsupported Platform");
 #endif //defined (__linux__)
 
-Expected<uint32_t> HailoRTDriver::read_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+Expected<uint32_t> HailoRTKernelDriver::read_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
     size_t offset, size_t  reg_size)
 {
     CHECK_AS_EXPECTED(is_valid_channel_id(channel_id), HAILO_INVALID_ARGUMENT, "Invalid channel id {} given", channel_id);
@@ -312,7 +312,7 @@ Expected<uint32_t> HailoRTDriver::read_vdma_channel_register(vdma::ChannelId cha
     return std::move(params.data);
 }
 
-hailo_status HailoRTDriver::write_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+hailo_status HailoRTKernelDriver::write_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
     size_t offset, size_t reg_size, uint32_t data)
 {
     CHECK(is_valid_channel_id(channel_id), HAILO_INVALID_ARGUMENT, "Invalid channel id {} given", channel_id);
@@ -336,7 +336,7 @@ hailo_status HailoRTDriver::write_vdma_channel_register(vdma::ChannelId channel_
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::read_memory(MemoryType memory_type, uint64_t address, void *buf, size_t size)
+hailo_status HailoRTKernelDriver::read_memory(MemoryType memory_type, uint64_t address, void *buf, size_t size)
 {
     if (size == 0) {
         LOGGER__ERROR("Invalid size to read");
@@ -361,7 +361,7 @@ hailo_status HailoRTDriver::read_memory(MemoryType memory_type, uint64_t address
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::write_memory(MemoryType memory_type, uint64_t address, const void *buf, size_t size)
+hailo_status HailoRTKernelDriver::write_memory(MemoryType memory_type, uint64_t address, const void *buf, size_t size)
 {
     if (size == 0) {
         LOGGER__ERROR("Invalid size to read");
@@ -386,7 +386,7 @@ hailo_status HailoRTDriver::write_memory(MemoryType memory_type, uint64_t addres
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::read_memory_ioctl(MemoryType memory_type, uint64_t address, void *buf, size_t size)
+hailo_status HailoRTKernelDriver::read_memory_ioctl(MemoryType memory_type, uint64_t address, void *buf, size_t size)
 {
     hailo_memory_transfer_params transfer = {
         .transfer_direction = TRANSFER_READ,
@@ -417,7 +417,7 @@ hailo_status HailoRTDriver::read_memory_ioctl(MemoryType memory_type, uint64_t a
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::write_memory_ioctl(MemoryType memory_type, uint64_t address, const void *buf, size_t size)
+hailo_status HailoRTKernelDriver::write_memory_ioctl(MemoryType memory_type, uint64_t address, const void *buf, size_t size)
 {
     hailo_memory_transfer_params transfer = {
         .transfer_direction = TRANSFER_WRITE,
@@ -448,7 +448,7 @@ hailo_status HailoRTDriver::write_memory_ioctl(MemoryType memory_type, uint64_t
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::vdma_buffer_sync(VdmaBufferHandle handle, DmaSyncDirection sync_direction,
+hailo_status HailoRTKernelDriver::vdma_buffer_sync(VdmaBufferHandle handle, DmaSyncDirection sync_direction,
     size_t offset, size_t count)
 {
 #if defined(__linux__)
@@ -477,7 +477,7 @@ hailo_status HailoRTDriver::vdma_buffer_sync(VdmaBufferHandle handle, DmaSyncDir
 #endif // __linux__
 }
 
-hailo_status HailoRTDriver::vdma_interrupts_enable(const ChannelsBitmap &channels_bitmap, bool enable_timestamps_measure)
+hailo_status HailoRTKernelDriver::vdma_interrupts_enable(const ChannelsBitmap &channels_bitmap, bool enable_timestamps_measure)
 {
     CHECK(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT, "Invalid channel bitmap given");
     hailo_vdma_interrupts_enable_params params{};
@@ -491,7 +491,7 @@ hailo_status HailoRTDriver::vdma_interrupts_enable(const ChannelsBitmap &channel
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::vdma_interrupts_disable(const ChannelsBitmap &channels_bitmap)
+hailo_status HailoRTKernelDriver::vdma_interrupts_disable(const ChannelsBitmap &channels_bitmap)
 {
     CHECK(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT, "Invalid channel bitmap given");
     hailo_vdma_interrupts_disable_params params{};
@@ -534,7 +534,7 @@ static Expected<IrqData> to_irq_data(const hailo_vdma_interrupts_wait_params& pa
     return irq;
 }
 
-Expected<IrqData> HailoRTDriver::vdma_interrupts_wait(const ChannelsBitmap &channels_bitmap)
+Expected<IrqData> HailoRTKernelDriver::vdma_interrupts_wait(const ChannelsBitmap &channels_bitmap)
 {
     CHECK_AS_EXPECTED(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT, "Invalid channel bitmap given");
     hailo_vdma_interrupts_wait_params params{};
@@ -550,7 +550,7 @@ Expected<IrqData> HailoRTDriver::vdma_interrupts_wait(const ChannelsBitmap &chan
     return to_irq_data(params, static_cast<uint8_t>(m_dma_engines_count));
 }
 
-Expected<ChannelInterruptTimestampList> HailoRTDriver::vdma_interrupts_read_timestamps(vdma::ChannelId channel_id)
+Expected<ChannelInterruptTimestampList> HailoRTKernelDriver::vdma_interrupts_read_timestamps(vdma::ChannelId channel_id)
 {
     hailo_vdma_interrupts_read_timestamp_params data{};
     data.engine_index = channel_id.engine_index;
@@ -563,7 +563,7 @@ Expected<ChannelInterruptTimestampList> HailoRTDriver::vdma_interrupts_read_time
     return create_interrupt_timestamp_list(data);
 }
 
-hailo_status HailoRTDriver::fw_control(const void *request, size_t request_len, const uint8_t request_md5[PCIE_EXPECTED_MD5_LENGTH],
+hailo_status HailoRTKernelDriver::fw_control(const void *request, size_t request_len, const uint8_t request_md5[PCIE_EXPECTED_MD5_LENGTH],
     void *response, size_t *response_len, uint8_t response_md5[PCIE_EXPECTED_MD5_LENGTH],
     std::chrono::milliseconds timeout, hailo_cpu_id_t cpu_id)
 {
@@ -600,7 +600,7 @@ hailo_status HailoRTDriver::fw_control(const void *request, size_t request_len,
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::read_log(uint8_t *buffer, size_t buffer_size, size_t *read_bytes, hailo_cpu_id_t cpu_id)
+hailo_status HailoRTKernelDriver::read_log(uint8_t *buffer, size_t buffer_size, size_t *read_bytes, hailo_cpu_id_t cpu_id)
 {
     CHECK_ARG_NOT_NULL(buffer);
     CHECK_ARG_NOT_NULL(read_bytes);
@@ -631,7 +631,7 @@ hailo_status HailoRTDriver::read_log(uint8_t *buffer, size_t buffer_size, size_t
     return HAILO_SUCCESS;
 }
  
-hailo_status HailoRTDriver::reset_nn_core()
+hailo_status HailoRTKernelDriver::reset_nn_core()
 {
     int err = 0;
     auto status = hailo_ioctl(this->m_fd, HAILO_RESET_NN_CORE, nullptr, err);
@@ -644,7 +644,7 @@ hailo_status HailoRTDriver::reset_nn_core()
 }
 
 #if defined(__linux__)
-Expected<HailoRTDriver::VdmaBufferHandle> HailoRTDriver::vdma_buffer_map(void *user_address, size_t required_size,
+Expected<HailoRTDriver::VdmaBufferHandle> HailoRTKernelDriver::vdma_buffer_map(void *user_address, size_t required_size,
     DmaDirection data_direction, const vdma_mapped_buffer_driver_identifier &driver_buff_handle)
 {
     hailo_vdma_buffer_map_params map_user_buffer_info {
@@ -665,7 +665,7 @@ Expected<HailoRTDriver::VdmaBufferHandle> HailoRTDriver::vdma_buffer_map(void *u
     return VdmaBufferHandle(map_user_buffer_info.mapped_handle);
 }
 #elif defined( __QNX__)
-Expected<HailoRTDriver::VdmaBufferHandle> HailoRTDriver::vdma_buffer_map(void *user_address, size_t required_size,
+Expected<HailoRTDriver::VdmaBufferHandle> HailoRTKernelDriver::vdma_buffer_map(void *user_address, size_t required_size,
     DmaDirection data_direction, const vdma_mapped_buffer_driver_identifier &driver_buff_handle)
 {
     // Mapping is done by the driver_buff_handle (shm file descriptor), and not by address.
@@ -704,7 +704,7 @@ Expected<HailoRTDriver::VdmaBufferHandle> HailoRTDriver::vdma_buffer_map(void *u
 #error "unsupported platform!"
 #endif // __linux__
 
-hailo_status HailoRTDriver::vdma_buffer_unmap(VdmaBufferHandle handle)
+hailo_status HailoRTKernelDriver::vdma_buffer_unmap(VdmaBufferHandle handle)
 {
     hailo_vdma_buffer_unmap_params unmap_user_buffer_info {
         .mapped_handle = handle
@@ -720,7 +720,7 @@ hailo_status HailoRTDriver::vdma_buffer_unmap(VdmaBufferHandle handle)
     return HAILO_SUCCESS;
 }
 
-Expected<DescriptorsListInfo> HailoRTDriver::descriptors_list_create(size_t desc_count, bool is_circular)
+Expected<DescriptorsListInfo> HailoRTKernelDriver::descriptors_list_create(size_t desc_count, bool is_circular)
 {
     auto handle_to_dma_address_pair = descriptors_list_create_ioctl(desc_count, is_circular);
     CHECK_EXPECTED(handle_to_dma_address_pair);
@@ -741,7 +741,7 @@ Expected<DescriptorsListInfo> HailoRTDriver::descriptors_list_create(size_t desc
     return DescriptorsListInfo{desc_handle, dma_address, desc_count, user_address.release()};
 }
 
-hailo_status HailoRTDriver::descriptors_list_release(const DescriptorsListInfo &descriptors_list_info)
+hailo_status HailoRTKernelDriver::descriptors_list_release(const DescriptorsListInfo &descriptors_list_info)
 {
     hailo_status status = HAILO_SUCCESS;
 
@@ -762,7 +762,7 @@ hailo_status HailoRTDriver::descriptors_list_release(const DescriptorsListInfo &
     return status;
 }
 
-Expected<std::pair<uintptr_t, uint64_t>> HailoRTDriver::descriptors_list_create_ioctl(size_t desc_count, bool is_circular)
+Expected<std::pair<uintptr_t, uint64_t>> HailoRTKernelDriver::descriptors_list_create_ioctl(size_t desc_count, bool is_circular)
 {
     hailo_desc_list_create_params create_desc_info{};
     create_desc_info.desc_count = desc_count;
@@ -778,7 +778,7 @@ Expected<std::pair<uintptr_t, uint64_t>> HailoRTDriver::descriptors_list_create_
     return std::make_pair(create_desc_info.desc_handle, create_desc_info.dma_address);
 }
 
-hailo_status HailoRTDriver::descriptors_list_release_ioctl(uintptr_t desc_handle)
+hailo_status HailoRTKernelDriver::descriptors_list_release_ioctl(uintptr_t desc_handle)
 {
     int err = 0;
     auto status = hailo_ioctl(this->m_fd, HAILO_DESC_LIST_RELEASE, &desc_handle, err);
@@ -791,7 +791,7 @@ hailo_status HailoRTDriver::descriptors_list_release_ioctl(uintptr_t desc_handle
 }
 
 #if defined(__linux__)
-Expected<void *> HailoRTDriver::descriptors_list_create_mmap(uintptr_t desc_handle, size_t desc_count)
+Expected<void *> HailoRTKernelDriver::descriptors_list_create_mmap(uintptr_t desc_handle, size_t desc_count)
 {
     // We lock m_driver_lock before calling mmap. Read m_driver_lock doc in the header
     std::unique_lock<std::mutex> lock(m_driver_lock);
@@ -805,7 +805,7 @@ Expected<void *> HailoRTDriver::descriptors_list_create_mmap(uintptr_t desc_hand
     return address;
 }
 
-hailo_status HailoRTDriver::descriptors_list_create_munmap(void *address, size_t desc_count)
+hailo_status HailoRTKernelDriver::descriptors_list_create_munmap(void *address, size_t desc_count)
 {
     const size_t buffer_size = desc_count * SIZE_OF_SINGLE_DESCRIPTOR;
     if (0 != munmap(address, buffer_size)) {
@@ -817,7 +817,7 @@ hailo_status HailoRTDriver::descriptors_list_create_munmap(void *address, size_t
 
 #elif defined(__QNX__)
 
-Expected<void *> HailoRTDriver::descriptors_list_create_mmap(uintptr_t desc_handle, size_t desc_count)
+Expected<void *> HailoRTKernelDriver::descriptors_list_create_mmap(uintptr_t desc_handle, size_t desc_count)
 {
     const size_t buffer_size = desc_count * SIZE_OF_SINGLE_DESCRIPTOR;
     struct hailo_non_linux_desc_list_mmap_params map_vdma_list_params {
@@ -827,7 +827,7 @@ Expected<void *> HailoRTDriver::descriptors_list_create_mmap(uintptr_t desc_hand
     };
 
     int err = 0;
-    auto status = HailoRTDriver::hailo_ioctl(m_fd, HAILO_NON_LINUX_DESC_LIST_MMAP, &map_vdma_list_params, err);
+    auto status = HailoRTKernelDriver::hailo_ioctl(m_fd, HAILO_NON_LINUX_DESC_LIST_MMAP, &map_vdma_list_params, err);
     if (HAILO_SUCCESS != status) {
         LOGGER__ERROR("Mmap descriptors list ioctl failed with errno:{}", err);
         return make_unexpected(HAILO_DRIVER_FAIL);
@@ -840,7 +840,7 @@ Expected<void *> HailoRTDriver::descriptors_list_create_mmap(uintptr_t desc_hand
     return address;
 }
 
-hailo_status HailoRTDriver::descriptors_list_create_munmap(void *address, size_t desc_count)
+hailo_status HailoRTKernelDriver::descriptors_list_create_munmap(void *address, size_t desc_count)
 {
     const size_t buffer_size = desc_count * SIZE_OF_SINGLE_DESCRIPTOR;
     if (0 != munmap(address, buffer_size)) {
@@ -854,7 +854,7 @@ hailo_status HailoRTDriver::descriptors_list_create_munmap(void *address, size_t
 #error "unsupported platform!"
 #endif
 
-hailo_status HailoRTDriver::descriptors_list_bind_vdma_buffer(uintptr_t desc_handle, VdmaBufferHandle buffer_handle,
+hailo_status HailoRTKernelDriver::descriptors_list_bind_vdma_buffer(uintptr_t desc_handle, VdmaBufferHandle buffer_handle,
     uint16_t desc_page_size, uint8_t channel_index, uint32_t starting_desc)
 {
     hailo_desc_list_bind_vdma_buffer_params config_info;
@@ -874,7 +874,7 @@ hailo_status HailoRTDriver::descriptors_list_bind_vdma_buffer(uintptr_t desc_han
     return HAILO_SUCCESS; 
 }
 
-Expected<uintptr_t> HailoRTDriver::vdma_low_memory_buffer_alloc(size_t size)
+Expected<uintptr_t> HailoRTKernelDriver::vdma_low_memory_buffer_alloc(size_t size)
 {
     CHECK_AS_EXPECTED(m_allocate_driver_buffer, HAILO_INVALID_OPERATION,
         "Tried to allocate buffer from driver even though operation is not supported");
@@ -894,7 +894,7 @@ Expected<uintptr_t> HailoRTDriver::vdma_low_memory_buffer_alloc(size_t size)
     return std::move(allocate_params.buffer_handle);
 }
 
-hailo_status HailoRTDriver::vdma_low_memory_buffer_free(uintptr_t buffer_handle)
+hailo_status HailoRTKernelDriver::vdma_low_memory_buffer_free(uintptr_t buffer_handle)
 {
     CHECK(m_allocate_driver_buffer, HAILO_INVALID_OPERATION,
         "Tried to free allocated buffer from driver even though operation is not supported");
@@ -909,7 +909,7 @@ hailo_status HailoRTDriver::vdma_low_memory_buffer_free(uintptr_t buffer_handle)
     return HAILO_SUCCESS; 
 }
 
-Expected<std::pair<uintptr_t, uint64_t>> HailoRTDriver::vdma_continuous_buffer_alloc(size_t size)
+Expected<std::pair<uintptr_t, uint64_t>> HailoRTKernelDriver::vdma_continuous_buffer_alloc(size_t size)
 {
     hailo_allocate_continuous_buffer_params params { .buffer_size = size, .buffer_handle = 0, .dma_address = 0 };
 
@@ -928,7 +928,7 @@ Expected<std::pair<uintptr_t, uint64_t>> HailoRTDriver::vdma_continuous_buffer_a
     return std::make_pair(params.buffer_handle, params.dma_address);
 }
 
-hailo_status HailoRTDriver::vdma_continuous_buffer_free(uintptr_t buffer_handle)
+hailo_status HailoRTKernelDriver::vdma_continuous_buffer_free(uintptr_t buffer_handle)
 {
     int err = 0;
     auto status = hailo_ioctl(this->m_fd, HAILO_VDMA_CONTINUOUS_BUFFER_FREE, (void*)buffer_handle, err);
@@ -940,7 +940,7 @@ hailo_status HailoRTDriver::vdma_continuous_buffer_free(uintptr_t buffer_handle)
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::mark_as_used()
+hailo_status HailoRTKernelDriver::mark_as_used()
 {
     hailo_mark_as_in_use_params params = {
         .in_use = false
@@ -957,9 +957,4 @@ hailo_status HailoRTDriver::mark_as_used()
     return HAILO_SUCCESS;
 }
 
-bool HailoRTDriver::is_valid_channel_id(const vdma::ChannelId &channel_id)
-{
-    return (channel_id.engine_index < m_dma_engines_count) && (channel_id.channel_index < MAX_VDMA_CHANNELS_PER_ENGINE);
-}
-
 } /* namespace hailort */
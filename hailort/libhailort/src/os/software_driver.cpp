@@ -0,0 +1,591 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file software_driver.cpp
+ * @brief In-process emulation of a device vdma engine
+ **/
+
+#include "os/software_driver.hpp"
+#include "vdma/memory/descriptor_list.hpp"
+#include "vdma/channel/vdma_channel_regs.hpp"
+
+#include "common/logger_macros.hpp"
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include "os/windows/osdep.hpp"
+#endif
+
+
+namespace hailort
+{
+
+// Descriptor layout - the same as the layout programmed by vdma::DescriptorList
+#define DESC_STATUS_REQ                       (1 << 0)
+#define DESC_PAGE_SIZE_SHIFT                  (8)
+#define DESC_PAGE_SIZE_MASK                   (0xFFFFFF00)
+#define DESC_IRQ_MASK                         (0x0000003C)
+#define DESC_LIST_ALIGNMENT                   (64)
+
+#define SOFTWARE_DEVICE_ID                    ("software")
+#define SOFTWARE_DMA_ENGINES_COUNT            (1)
+
+#if defined(_MSC_VER)
+#define INVALID_DRIVER_FILE (INVALID_HANDLE_VALUE)
+#else
+#define INVALID_DRIVER_FILE (-1)
+#endif
+
+static constexpr std::chrono::microseconds DEFAULT_FRAME_LATENCY(100);
+
+SoftwareDriver::Params SoftwareDriver::default_params()
+{
+    Params params{};
+    params.frame_latency = DEFAULT_FRAME_LATENCY;
+    params.desc_max_page_size = vdma::MAX_DESC_PAGE_SIZE;
+    return params;
+}
+
+Expected<std::unique_ptr<SoftwareDriver>> SoftwareDriver::create(const Params &params)
+{
+    CHECK_AS_EXPECTED(is_powerof2(params.desc_max_page_size) &&
+        (params.desc_max_page_size >= vdma::MIN_DESC_PAGE_SIZE) &&
+        (params.desc_max_page_size <= vdma::MAX_DESC_PAGE_SIZE), HAILO_INVALID_ARGUMENT,
+        "Invalid desc max page size {}", params.desc_max_page_size);
+
+    auto driver = make_unique_nothrow<SoftwareDriver>(params);
+    CHECK_NOT_NULL_AS_EXPECTED(driver, HAILO_OUT_OF_HOST_MEMORY);
+    return driver;
+}
+
+SoftwareDriver::SoftwareDriver(const Params &params) :
+    HailoRTDriver(DeviceInfo{"", SOFTWARE_DEVICE_ID}),
+    m_params(params),
+    m_fd(INVALID_DRIVER_FILE),
+    m_next_buffer_handle(0),
+    m_next_desc_list_handle(1),
+    m_channels(),
+    m_irq_enabled_bitmap(0),
+    m_is_running(true),
+    m_is_notifications_enabled(true),
+    m_operations_counters()
+{
+    m_desc_max_page_size = params.desc_max_page_size;
+    m_dma_type = DmaType::PCIE;
+    m_allocate_driver_buffer = false;
+    m_dma_engines_count = SOFTWARE_DMA_ENGINES_COUNT;
+    m_is_fw_loaded = true;
+
+    m_engine_thread = std::thread([this]() { engine_thread_main(); });
+}
+
+SoftwareDriver::~SoftwareDriver()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_is_running = false;
+        m_irq_enabled_bitmap = 0;
+        m_is_notifications_enabled = false;
+    }
+    m_engine_cv.notify_all();
+    m_irq_cv.notify_all();
+    m_notifications_cv.notify_all();
+    m_engine_thread.join();
+}
+
+hailo_status SoftwareDriver::read_memory(MemoryType /*memory_type*/, uint64_t /*address*/, void * /*buf*/,
+    size_t /*size*/)
+{
+    LOGGER__ERROR("Memory access is not supported on software device");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status SoftwareDriver::write_memory(MemoryType /*memory_type*/, uint64_t /*address*/, const void * /*buf*/,
+    size_t /*size*/)
+{
+    LOGGER__ERROR("Memory access is not supported on software device");
+    return HAILO_NOT_SUPPORTED;
+}
+
+Expected<uint32_t> SoftwareDriver::read_vdma_channel_register(vdma::ChannelId channel_id,
+    DmaDirection data_direction, size_t offset, size_t /*reg_size*/)
+{
+    CHECK_AS_EXPECTED(is_valid_channel_id(channel_id), HAILO_INVALID_ARGUMENT, "Invalid channel id {} given",
+        channel_id);
+    CHECK_AS_EXPECTED(data_direction != DmaDirection::BOTH, HAILO_INVALID_ARGUMENT, "Invalid direction given");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    switch (offset) {
+    case VDMA_CHANNEL_NUM_AVAIL_OFFSET:
+        return static_cast<uint32_t>(m_channels[channel_id.channel_index].num_available);
+    case VDMA_CHANNEL_NUM_PROC_OFFSET:
+        return static_cast<uint32_t>(m_channels[channel_id.channel_index].num_processed);
+    case VDMA_CHANNEL_CONTROL_OFFSET:
+        // The emulated channels are never aborted
+        return static_cast<uint32_t>(1);
+    default:
+        LOGGER__ERROR("Register offset {} is not supported on software device", offset);
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+    }
+}
+
+hailo_status SoftwareDriver::write_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+    size_t offset, size_t /*reg_size*/, uint32_t data)
+{
+    CHECK(is_valid_channel_id(channel_id), HAILO_INVALID_ARGUMENT, "Invalid channel id {} given", channel_id);
+    CHECK(data_direction != DmaDirection::BOTH, HAILO_INVALID_ARGUMENT, "Invalid direction given");
+    CHECK(VDMA_CHANNEL_NUM_AVAIL_OFFSET == offset, HAILO_NOT_SUPPORTED,
+        "Register offset {} is not supported on software device", offset);
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_channels[channel_id.channel_index].num_available = static_cast<uint16_t>(data);
+        m_operations_counters.channel_register_writes++;
+    }
+    m_engine_cv.notify_one();
+    return HAILO_SUCCESS;
+}
+
+hailo_status SoftwareDriver::vdma_buffer_sync(VdmaBufferHandle /*buffer*/, DmaSyncDirection /*sync_direction*/,
+    size_t /*offset*/, size_t /*count*/)
+{
+    // The emulated engine accesses the buffers from the host cpu, no need to sync.
+    return HAILO_SUCCESS;
+}
+
+hailo_status SoftwareDriver::vdma_interrupts_enable(const ChannelsBitmap &channels_bitmap,
+    bool enable_timestamps_measure)
+{
+    CHECK(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT, "Invalid channel bitmap given");
+    CHECK(!enable_timestamps_measure, HAILO_NOT_SUPPORTED, "Timestamps measure is not supported on software device");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_irq_enabled_bitmap |= channels_bitmap[0];
+    return HAILO_SUCCESS;
+}
+
+hailo_status SoftwareDriver::vdma_interrupts_disable(const ChannelsBitmap &channels_bitmap)
+{
+    CHECK(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT, "Invalid channel bitmap given");
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_irq_enabled_bitmap &= ~channels_bitmap[0];
+    }
+    // Wakes vdma_interrupts_wait
+    m_irq_cv.notify_all();
+    return HAILO_SUCCESS;
+}
+
+Expected<IrqData> SoftwareDriver::vdma_interrupts_wait(const ChannelsBitmap &channels_bitmap)
+{
+    CHECK_AS_EXPECTED(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT,
+        "Invalid channel bitmap given");
+
+    IrqData irq_data{};
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_irq_cv.wait(lock, [this, &channels_bitmap]() {
+        for (uint8_t channel_index = 0; channel_index < VDMA_CHANNELS_PER_ENGINE; channel_index++) {
+            if (0 == (channels_bitmap[0] & (1u << channel_index))) {
+                continue;
+            }
+            if (!is_irq_enabled(channel_index) || m_channels[channel_index].is_irq_pending) {
+                return true;
+            }
+        }
+        return false;
+    });
+
+    for (uint8_t channel_index = 0; channel_index < VDMA_CHANNELS_PER_ENGINE; channel_index++) {
+        auto &channel = m_channels[channel_index];
+        if ((0 == (channels_bitmap[0] & (1u << channel_index))) || !is_irq_enabled(channel_index)) {
+            // On disable, returns with an empty list
+            continue;
+        }
+        if (!channel.is_irq_pending) {
+            continue;
+        }
+
+        auto &channel_irq_data = irq_data.channels_irq_data[irq_data.channels_count++];
+        channel_irq_data.channel_id = vdma::ChannelId{0, channel_index};
+        channel_irq_data.is_active = true;
+        channel_irq_data.desc_num_processed = channel.irq_desc_num_processed;
+        channel_irq_data.host_error = 0;
+        channel_irq_data.device_error = 0;
+        channel.is_irq_pending = false;
+    }
+
+    return irq_data;
+}
+
+Expected<ChannelInterruptTimestampList> SoftwareDriver::vdma_interrupts_read_timestamps(
+    vdma::ChannelId /*channel_id*/)
+{
+    LOGGER__ERROR("Interrupts timestamps are not supported on software device");
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+Expected<std::vector<uint8_t>> SoftwareDriver::read_notification()
+{
+    // Like the notifications ioctl, blocks until there is a notification (never) or notifications are disabled.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_notifications_cv.wait(lock, [this]() { return !m_is_notifications_enabled; });
+    return make_unexpected(HAILO_SHUTDOWN_EVENT_SIGNALED);
+}
+
+hailo_status SoftwareDriver::disable_notifications()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_is_notifications_enabled = false;
+    }
+    m_notifications_cv.notify_all();
+    return HAILO_SUCCESS;
+}
+
+hailo_status SoftwareDriver::fw_control(const void * /*request*/, size_t /*request_len*/,
+    const uint8_t /*request_md5*/[PCIE_EXPECTED_MD5_LENGTH], void * /*response*/, size_t * /*response_len*/,
+    uint8_t /*response_md5*/[PCIE_EXPECTED_MD5_LENGTH], std::chrono::milliseconds /*timeout*/,
+    hailo_cpu_id_t /*cpu_id*/)
+{
+    LOGGER__ERROR("Firmware controls are not supported on software device");
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status SoftwareDriver::read_log(uint8_t * /*buffer*/, size_t /*buffer_size*/, size_t * /*read_bytes*/,
+    hailo_cpu_id_t /*cpu_id*/)
+{
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status SoftwareDriver::reset_nn_core()
+{
+    return HAILO_NOT_SUPPORTED;
+}
+
+Expected<HailoRTDriver::VdmaBufferHandle> SoftwareDriver::vdma_buffer_map(void *user_address, size_t required_size,
+    DmaDirection /*data_direction*/, const vdma_mapped_buffer_driver_identifier &driver_buff_handle)
+{
+    CHECK_AS_EXPECTED(INVALID_DRIVER_BUFFER_HANDLE_VALUE == driver_buff_handle, HAILO_NOT_SUPPORTED,
+        "Driver allocated buffers are not supported on software device");
+    CHECK_ARG_NOT_NULL_AS_EXPECTED(user_address);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    VdmaBufferHandle handle = m_next_buffer_handle++;
+    m_mapped_buffers.emplace(handle, MappedUserBuffer{static_cast<uint8_t*>(user_address), required_size});
+    m_operations_counters.buffer_maps++;
+    return handle;
+}
+
+hailo_status SoftwareDriver::vdma_buffer_unmap(VdmaBufferHandle handle)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    CHECK(1 == m_mapped_buffers.erase(handle), HAILO_INVALID_ARGUMENT, "Buffer handle {} is not mapped", handle);
+    m_operations_counters.buffer_unmaps++;
+    return HAILO_SUCCESS;
+}
+
+Expected<DescriptorsListInfo> SoftwareDriver::descriptors_list_create(size_t desc_count, bool is_circular)
+{
+    // The emulated engine wraps around the descriptors list like the circular lists of the boundary channels.
+    CHECK_AS_EXPECTED(is_circular && is_powerof2(desc_count), HAILO_NOT_SUPPORTED,
+        "Only circular descriptors lists are supported on software device");
+
+    SoftwareDescriptorsList desc_list{};
+    desc_list.memory.reset(new (std::nothrow) uint8_t[(desc_count * SIZE_OF_SINGLE_DESCRIPTOR) + DESC_LIST_ALIGNMENT]);
+    CHECK_NOT_NULL_AS_EXPECTED(desc_list.memory, HAILO_OUT_OF_HOST_MEMORY);
+    const auto memory_address = reinterpret_cast<uintptr_t>(desc_list.memory.get());
+    desc_list.descriptors = reinterpret_cast<void*>(
+        (memory_address + DESC_LIST_ALIGNMENT - 1) & ~static_cast<uintptr_t>(DESC_LIST_ALIGNMENT - 1));
+    memset(desc_list.descriptors, 0, desc_count * SIZE_OF_SINGLE_DESCRIPTOR);
+    desc_list.desc_count = desc_count;
+    desc_list.desc_addresses.resize(desc_count, nullptr);
+
+    DescriptorsListInfo info{};
+    info.desc_count = desc_count;
+    info.user_address = desc_list.descriptors;
+    // The emulated engine uses host addresses
+    info.dma_address = reinterpret_cast<uint64_t>(desc_list.descriptors);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    info.handle = m_next_desc_list_handle++;
+    m_desc_lists.emplace(info.handle, std::move(desc_list));
+    return info;
+}
+
+hailo_status SoftwareDriver::descriptors_list_release(const DescriptorsListInfo &descriptors_list_info)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (auto &channel : m_channels) {
+        if (channel.desc_list_handle == descriptors_list_info.handle) {
+            channel.desc_list_handle = 0;
+        }
+    }
+    CHECK(1 == m_desc_lists.erase(descriptors_list_info.handle), HAILO_INVALID_ARGUMENT,
+        "Descriptors list {} was not created", descriptors_list_info.handle);
+    return HAILO_SUCCESS;
+}
+
+hailo_status SoftwareDriver::descriptors_list_bind_vdma_buffer(uintptr_t desc_handle, VdmaBufferHandle buffer_handle,
+    uint16_t desc_page_size, uint8_t channel_index, uint32_t starting_desc)
+{
+    CHECK(channel_index < VDMA_CHANNELS_PER_ENGINE, HAILO_INVALID_ARGUMENT, "Invalid channel index {}",
+        channel_index);
+    CHECK((desc_page_size > 0) && (desc_page_size <= m_desc_max_page_size), HAILO_INVALID_ARGUMENT,
+        "Invalid desc page size {}", desc_page_size);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto desc_list = m_desc_lists.find(desc_handle);
+    CHECK(m_desc_lists.end() != desc_list, HAILO_INVALID_ARGUMENT, "Descriptors list {} was not created",
+        desc_handle);
+    auto buffer = m_mapped_buffers.find(buffer_handle);
+    CHECK(m_mapped_buffers.end() != buffer, HAILO_INVALID_ARGUMENT, "Buffer handle {} is not mapped", buffer_handle);
+
+    const auto desc_count = desc_list->second.desc_count;
+    const auto descs_in_buffer = vdma::DescriptorList::descriptors_in_buffer(buffer->second.size, desc_page_size);
+    CHECK(descs_in_buffer <= desc_count, HAILO_INSUFFICIENT_BUFFER,
+        "Buffer of size {} doesn't fit in descriptors list", buffer->second.size);
+
+    auto descriptors = static_cast<vdma::VdmaDescriptor*>(desc_list->second.descriptors);
+    for (size_t i = 0; i < descs_in_buffer; i++) {
+        const auto desc_index = (starting_desc + i) % desc_count;
+        desc_list->second.desc_addresses[desc_index] = buffer->second.address + (i * desc_page_size);
+        descriptors[desc_index].PageSize_DescControl =
+            static_cast<uint32_t>(desc_page_size << DESC_PAGE_SIZE_SHIFT) & DESC_PAGE_SIZE_MASK;
+        descriptors[desc_index].RemainingPageSize_Status = 0;
+    }
+
+    m_channels[channel_index].desc_list_handle = desc_handle;
+    m_operations_counters.descs_binds++;
+    return HAILO_SUCCESS;
+}
+
+Expected<uintptr_t> SoftwareDriver::vdma_low_memory_buffer_alloc(size_t /*size*/)
+{
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+hailo_status SoftwareDriver::vdma_low_memory_buffer_free(uintptr_t /*buffer_handle*/)
+{
+    return HAILO_NOT_SUPPORTED;
+}
+
+Expected<std::pair<uintptr_t, uint64_t>> SoftwareDriver::vdma_continuous_buffer_alloc(size_t /*size*/)
+{
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
+hailo_status SoftwareDriver::vdma_continuous_buffer_free(uintptr_t /*buffer_handle*/)
+{
+    return HAILO_NOT_SUPPORTED;
+}
+
+hailo_status SoftwareDriver::reset_channels(const ChannelsBitmap &channels_bitmap)
+{
+    CHECK(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT, "Invalid channel bitmap given");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (uint8_t channel_index = 0; channel_index < VDMA_CHANNELS_PER_ENGINE; channel_index++) {
+        if (channels_bitmap[0] & (1u << channel_index)) {
+            reset_channel(channel_index);
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+SoftwareDriver::OperationsCounters SoftwareDriver::get_operations_counters()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_operations_counters;
+}
+
+hailo_status SoftwareDriver::mark_as_used()
+{
+    return HAILO_SUCCESS;
+}
+
+void SoftwareDriver::engine_thread_main()
+{
+    OsUtils::set_current_thread_name("SW_VDMA_ENGINE");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_is_running) {
+        auto next_wakeup = Clock::time_point::max();
+        if (process_channels(next_wakeup)) {
+            m_irq_cv.notify_all();
+            continue;
+        }
+
+        if (Clock::time_point::max() == next_wakeup) {
+            m_engine_cv.wait(lock);
+        } else {
+            m_engine_cv.wait_until(lock, next_wakeup);
+        }
+    }
+}
+
+bool SoftwareDriver::process_channels(Clock::time_point &next_wakeup)
+{
+    bool processed = false;
+    for (uint8_t channel_index = MIN_H2D_CHANNEL_INDEX; channel_index <= MAX_H2D_CHANNEL_INDEX; channel_index++) {
+        processed |= process_h2d_channel(channel_index);
+    }
+    for (uint8_t channel_index = MIN_D2H_CHANNEL_INDEX; channel_index <= MAX_D2H_CHANNEL_INDEX; channel_index++) {
+        processed |= process_d2h_channel(channel_index, next_wakeup);
+    }
+    return processed;
+}
+
+bool SoftwareDriver::process_h2d_channel(uint8_t channel_index)
+{
+    auto &channel = m_channels[channel_index];
+    auto desc_list = bound_desc_list(channel_index);
+    if ((nullptr == desc_list) || !is_irq_enabled(channel_index)) {
+        return false;
+    }
+
+    auto &frames = m_loopback_frames[channel_index];
+    auto descriptors = static_cast<vdma::VdmaDescriptor*>(desc_list->descriptors);
+    const auto desc_count_mask = desc_list->desc_count - 1;
+    bool processed = false;
+    while (channel.num_processed != channel.num_available) {
+        const auto desc_index = channel.num_processed & desc_count_mask;
+        const auto control = descriptors[desc_index].PageSize_DescControl;
+        const auto size = (control & DESC_PAGE_SIZE_MASK) >> DESC_PAGE_SIZE_SHIFT;
+
+        if (frames.empty() || (Clock::time_point::max() != frames.back().ready_time)) {
+            // Open a new frame
+            std::vector<uint8_t> data;
+            if (!m_free_frame_buffers.empty()) {
+                data = std::move(m_free_frame_buffers.back());
+                m_free_frame_buffers.pop_back();
+                data.clear();
+            }
+            frames.emplace_back(LoopbackFrame{std::move(data), 0, Clock::time_point::max()});
+        }
+        auto &frame = frames.back();
+        const auto src = desc_list->desc_addresses[desc_index];
+        frame.data.insert(frame.data.end(), src, src + size);
+
+        complete_descriptor(descriptors[desc_index]);
+        channel.num_processed = static_cast<uint16_t>((channel.num_processed + 1) & desc_count_mask);
+        if (control & DESC_IRQ_MASK) {
+            frame.ready_time = Clock::now() + m_params.frame_latency;
+            channel.is_irq_pending = true;
+            channel.irq_desc_num_processed = channel.num_processed;
+        }
+        processed = true;
+    }
+    return processed;
+}
+
+bool SoftwareDriver::process_d2h_channel(uint8_t channel_index, Clock::time_point &next_wakeup)
+{
+    auto &channel = m_channels[channel_index];
+    auto desc_list = bound_desc_list(channel_index);
+    if ((nullptr == desc_list) || !is_irq_enabled(channel_index)) {
+        return false;
+    }
+
+    const uint8_t h2d_channel_index = static_cast<uint8_t>(channel_index - MIN_D2H_CHANNEL_INDEX);
+    auto descriptors = static_cast<vdma::VdmaDescriptor*>(desc_list->descriptors);
+    const auto desc_count_mask = desc_list->desc_count - 1;
+    const auto now = Clock::now();
+    auto ready_bytes = ready_loopback_bytes(h2d_channel_index, now, next_wakeup);
+    bool processed = false;
+    while (channel.num_processed != channel.num_available) {
+        const auto desc_index = channel.num_processed & desc_count_mask;
+        const auto control = descriptors[desc_index].PageSize_DescControl;
+        const size_t size = (control & DESC_PAGE_SIZE_MASK) >> DESC_PAGE_SIZE_SHIFT;
+        if (ready_bytes < size) {
+            // Waiting for the next loopback frame
+            break;
+        }
+
+        read_loopback_bytes(h2d_channel_index, desc_list->desc_addresses[desc_index], size);
+        ready_bytes -= size;
+
+        complete_descriptor(descriptors[desc_index]);
+        channel.num_processed = static_cast<uint16_t>((channel.num_processed + 1) & desc_count_mask);
+        if (control & DESC_IRQ_MASK) {
+            channel.is_irq_pending = true;
+            channel.irq_desc_num_processed = channel.num_processed;
+        }
+        processed = true;
+    }
+    return processed;
+}
+
+size_t SoftwareDriver::ready_loopback_bytes(uint8_t h2d_channel_index, Clock::time_point now,
+    Clock::time_point &next_wakeup)
+{
+    size_t ready_bytes = 0;
+    for (const auto &frame : m_loopback_frames[h2d_channel_index]) {
+        if (frame.ready_time > now) {
+            if (Clock::time_point::max() != frame.ready_time) {
+                next_wakeup = std::min(next_wakeup, frame.ready_time);
+            }
+            break;
+        }
+        ready_bytes += frame.data.size() - frame.read_offset;
+    }
+    return ready_bytes;
+}
+
+void SoftwareDriver::read_loopback_bytes(uint8_t h2d_channel_index, uint8_t *dst, size_t size)
+{
+    auto &frames = m_loopback_frames[h2d_channel_index];
+    while (size > 0) {
+        assert(!frames.empty());
+        auto &frame = frames.front();
+        const auto copy_size = std::min(size, frame.data.size() - frame.read_offset);
+        memcpy(dst, frame.data.data() + frame.read_offset, copy_size);
+        frame.read_offset += copy_size;
+        dst += copy_size;
+        size -= copy_size;
+
+        if (frame.read_offset == frame.data.size()) {
+            m_free_frame_buffers.emplace_back(std::move(frame.data));
+            frames.pop_front();
+        }
+    }
+}
+
+void SoftwareDriver::complete_descriptor(vdma::VdmaDescriptor &descriptor)
+{
+    if (descriptor.PageSize_DescControl & DESC_STATUS_REQ) {
+        descriptor.RemainingPageSize_Status = (1 << vdma::DESCRIPTOR_STATUS_DONE_BIT);
+    }
+}
+
+void SoftwareDriver::reset_channel(uint8_t channel_index)
+{
+    auto &channel = m_channels[channel_index];
+    channel.num_available = 0;
+    channel.num_processed = 0;
+    channel.is_irq_pending = false;
+    channel.irq_desc_num_processed = 0;
+
+    if (channel_index < MIN_D2H_CHANNEL_INDEX) {
+        m_loopback_frames[channel_index].clear();
+    }
+}
+
+SoftwareDriver::SoftwareDescriptorsList *SoftwareDriver::bound_desc_list(uint8_t channel_index)
+{
+    auto desc_list = m_desc_lists.find(m_channels[channel_index].desc_list_handle);
+    return (m_desc_lists.end() == desc_list) ? nullptr : &desc_list->second;
+}
+
+bool SoftwareDriver::is_irq_enabled(uint8_t channel_index) const
+{
+    return 0 != (m_irq_enabled_bitmap & (1u << channel_index));
+}
+
+} /* namespace hailort */
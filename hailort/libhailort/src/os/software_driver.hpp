@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file software_driver.hpp
+ * @brief In-process HailoRTDriver implementation that emulates the vdma engine of a device, so the host side of the
+ *        vdma flows (descriptor lists, buffer mapping, channel registers and interrupts) can run and be measured
+ *        without a device.
+ *
+ * The emulated device has a single vdma engine, and loops back the data of each H2D channel to the D2H channel
+ * with the same index + MIN_D2H_CHANNEL_INDEX:
+ *  - An H2D descriptor is processed once it becomes available (num_available register) - its data is appended to
+ *    the current loopback frame. A descriptor that requests an interrupt ends the frame, which becomes available to
+ *    the D2H channel after Params::frame_latency.
+ *  - A D2H descriptor is processed once enough loopback data is available, and is filled with the data.
+ *  - A processed descriptor that requests an interrupt raises an interrupt on its channel (returned from
+ *    vdma_interrupts_wait).
+ *
+ * Firmware controls, device memory access, driver allocated buffers and irq timestamps are not supported. The device
+ * sends no notifications - reading a notification blocks until notifications are disabled.
+ **/
+
+#ifndef _HAILO_SOFTWARE_DRIVER_HPP_
+#define _HAILO_SOFTWARE_DRIVER_HPP_
+
+#include "os/hailort_driver.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+
+
+namespace hailort
+{
+
+namespace vdma {
+struct VdmaDescriptor;
+} /* namespace vdma */
+
+class SoftwareDriver final : public HailoRTDriver
+{
+public:
+    struct Params {
+        // Time from the end of an input frame until its data can be read from the paired output channel.
+        std::chrono::microseconds frame_latency;
+        uint16_t desc_max_page_size;
+    };
+
+    // Number of calls of the driver operations that are ioctls (or register writes) on a device
+    struct OperationsCounters {
+        size_t buffer_maps;
+        size_t buffer_unmaps;
+        size_t descs_binds;
+        size_t channel_register_writes;
+    };
+
+    static Params default_params();
+    static Expected<std::unique_ptr<SoftwareDriver>> create(const Params &params = default_params());
+
+    SoftwareDriver(const Params &params);
+    virtual ~SoftwareDriver();
+
+    SoftwareDriver(const SoftwareDriver &other) = delete;
+    SoftwareDriver &operator=(const SoftwareDriver &other) = delete;
+    SoftwareDriver(SoftwareDriver &&other) noexcept = delete;
+    SoftwareDriver &operator=(SoftwareDriver &&other) = delete;
+
+    virtual hailo_status read_memory(MemoryType memory_type, uint64_t address, void *buf, size_t size) override;
+    virtual hailo_status write_memory(MemoryType memory_type, uint64_t address, const void *buf,
+        size_t size) override;
+
+    virtual Expected<uint32_t> read_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+        size_t offset, size_t reg_size) override;
+    virtual hailo_status write_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+        size_t offset, size_t reg_size, uint32_t data) override;
+
+    virtual hailo_status vdma_buffer_sync(VdmaBufferHandle buffer, DmaSyncDirection sync_direction, size_t offset,
+        size_t count) override;
+
+    virtual hailo_status vdma_interrupts_enable(const ChannelsBitmap &channels_bitmap,
+        bool enable_timestamps_measure) override;
+    virtual hailo_status vdma_interrupts_disable(const ChannelsBitmap &channel_id) override;
+    virtual Expected<IrqData> vdma_interrupts_wait(const ChannelsBitmap &channels_bitmap) override;
+    virtual Expected<ChannelInterruptTimestampList> vdma_interrupts_read_timestamps(
+        vdma::ChannelId channel_id) override;
+
+    virtual Expected<std::vector<uint8_t>> read_notification() override;
+    virtual hailo_status disable_notifications() override;
+
+    virtual hailo_status fw_control(const void *request, size_t request_len,
+        const uint8_t request_md5[PCIE_EXPECTED_MD5_LENGTH], void *response, size_t *response_len,
+        uint8_t response_md5[PCIE_EXPECTED_MD5_LENGTH], std::chrono::milliseconds timeout,
+        hailo_cpu_id_t cpu_id) override;
+
+    virtual hailo_status read_log(uint8_t *buffer, size_t buffer_size, size_t *read_bytes,
+        hailo_cpu_id_t cpu_id) override;
+
+    virtual hailo_status reset_nn_core() override;
+
+    virtual Expected<VdmaBufferHandle> vdma_buffer_map(void *user_address, size_t required_size,
+        DmaDirection data_direction, const vdma_mapped_buffer_driver_identifier &driver_buff_handle) override;
+    virtual hailo_status vdma_buffer_unmap(VdmaBufferHandle handle) override;
+
+    virtual Expected<DescriptorsListInfo> descriptors_list_create(size_t desc_count, bool is_circular) override;
+    virtual hailo_status descriptors_list_release(const DescriptorsListInfo &descriptors_list_info) override;
+    virtual hailo_status descriptors_list_bind_vdma_buffer(uintptr_t desc_handle, VdmaBufferHandle buffer_handle,
+        uint16_t desc_page_size, uint8_t channel_index, uint32_t starting_desc) override;
+
+    virtual Expected<uintptr_t> vdma_low_memory_buffer_alloc(size_t size) override;
+    virtual hailo_status vdma_low_memory_buffer_free(uintptr_t buffer_handle) override;
+
+    virtual Expected<std::pair<uintptr_t, uint64_t>> vdma_continuous_buffer_alloc(size_t size) override;
+    virtual hailo_status vdma_continuous_buffer_free(uintptr_t buffer_handle) override;
+
+    virtual hailo_status mark_as_used() override;
+
+    virtual FileDescriptor& fd() override {return m_fd;}
+
+    // Resets the channels, like the firmware does when a core-op is activated (the interrupts of the channels may be
+    // kept enabled across core-op switches, see InterruptsDispatcher::switch_context).
+    hailo_status reset_channels(const ChannelsBitmap &channels_bitmap);
+    OperationsCounters get_operations_counters();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct MappedUserBuffer {
+        uint8_t *address;
+        size_t size;
+    };
+
+    struct SoftwareDescriptorsList {
+        // Must be 64 bytes aligned, like the descriptors lists allocated by the kernel driver.
+        std::unique_ptr<uint8_t[]> memory;
+        void *descriptors;
+        size_t desc_count;
+        // The host address each descriptor points to (set on bind)
+        std::vector<uint8_t*> desc_addresses;
+    };
+
+    struct LoopbackFrame {
+        std::vector<uint8_t> data;
+        size_t read_offset;
+        Clock::time_point ready_time;
+    };
+
+    struct SoftwareChannel {
+        uintptr_t desc_list_handle;
+        uint16_t num_available;
+        uint16_t num_processed;
+        bool is_irq_pending;
+        uint16_t irq_desc_num_processed;
+    };
+
+    // Emulates the vdma engine - processes the available descriptors of all channels.
+    void engine_thread_main();
+
+    // Processes the available descriptors of all channels, returns true if any descriptor was processed.
+    // next_wakeup is updated to the time the next loopback frame becomes available.
+    // Must be called with m_mutex locked.
+    bool process_channels(Clock::time_point &next_wakeup);
+    bool process_h2d_channel(uint8_t channel_index);
+    bool process_d2h_channel(uint8_t channel_index, Clock::time_point &next_wakeup);
+    size_t ready_loopback_bytes(uint8_t h2d_channel_index, Clock::time_point now, Clock::time_point &next_wakeup);
+    void read_loopback_bytes(uint8_t h2d_channel_index, uint8_t *dst, size_t size);
+    // Writes the descriptor status (if requested by the descriptor).
+    static void complete_descriptor(vdma::VdmaDescriptor &descriptor);
+    void reset_channel(uint8_t channel_index);
+
+    // Returns nullptr if no descriptors list is bound to the channel.
+    SoftwareDescriptorsList *bound_desc_list(uint8_t channel_index);
+    bool is_irq_enabled(uint8_t channel_index) const;
+
+    const Params m_params;
+    FileDescriptor m_fd;
+
+    std::mutex m_mutex;
+    // Signaled when a channel register is written (or on shutdown)
+    std::condition_variable m_engine_cv;
+    // Signaled when an interrupt is raised or interrupts are disabled
+    std::condition_variable m_irq_cv;
+    // Signaled when notifications are disabled
+    std::condition_variable m_notifications_cv;
+
+    std::map<VdmaBufferHandle, MappedUserBuffer> m_mapped_buffers;
+    VdmaBufferHandle m_next_buffer_handle;
+    std::map<uintptr_t, SoftwareDescriptorsList> m_desc_lists;
+    uintptr_t m_next_desc_list_handle;
+
+    std::array<SoftwareChannel, VDMA_CHANNELS_PER_ENGINE> m_channels;
+    // Loopback frames of each H2D channel, ordered by ready time.
+    std::array<std::deque<LoopbackFrame>, MIN_D2H_CHANNEL_INDEX> m_loopback_frames;
+    // Frame buffers are recycled, to avoid allocating on each frame.
+    std::vector<std::vector<uint8_t>> m_free_frame_buffers;
+    uint32_t m_irq_enabled_bitmap;
+    bool m_is_running;
+    bool m_is_notifications_enabled;
+    OperationsCounters m_operations_counters;
+
+    std::thread m_engine_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SOFTWARE_DRIVER_HPP_ */
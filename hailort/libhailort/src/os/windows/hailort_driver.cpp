@@ -8,7 +8,7 @@
  **/
 
 #include "os/windows/osdep.hpp"
-#include "os/hailort_driver.hpp"
+#include "os/hailort_kernel_driver.hpp"
 #include "os/driver_scan.hpp"
 #include "common/logger_macros.hpp"
 #include "common/utils.hpp"
@@ -294,10 +294,9 @@ static hailo_status validate_driver_version(const hailo_driver_info &driver_info
     return HAILO_SUCCESS;
 }
 
-HailoRTDriver::HailoRTDriver(const DeviceInfo &device_info, FileDescriptor &&fd, hailo_status &status) :
-    m_fd(std::move(fd)),
-    m_device_info(device_info),
-    m_allocate_driver_buffer(false)
+HailoRTKernelDriver::HailoRTKernelDriver(const DeviceInfo &device_info, FileDescriptor &&fd, hailo_status &status) :
+    HailoRTDriver(device_info),
+    m_fd(std::move(fd))
 {
     tCompatibleHailoIoctlData data = {};
     hailo_driver_info& driver_info = data.Buffer.DriverInfo;
@@ -363,14 +362,15 @@ Expected<std::unique_ptr<HailoRTDriver>> HailoRTDriver::create(const DeviceInfo
     FileDescriptor fd(f.Detach());
 
     hailo_status status = HAILO_UNINITIALIZED;
-    std::unique_ptr<HailoRTDriver> driver(new (std::nothrow) HailoRTDriver(device_info, std::move(fd), status));
+    std::unique_ptr<HailoRTDriver> driver(new (std::nothrow) HailoRTKernelDriver(device_info, std::move(fd),
+        status));
     CHECK_NOT_NULL_AS_EXPECTED(driver, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     return driver;
 }
 
-Expected<std::vector<uint8_t>> HailoRTDriver::read_notification()
+Expected<std::vector<uint8_t>> HailoRTKernelDriver::read_notification()
 {
     tCompatibleHailoIoctlData data;
     hailo_d2h_notification& notification_buffer = data.Buffer.D2HNotification;
@@ -385,7 +385,7 @@ Expected<std::vector<uint8_t>> HailoRTDriver::read_notification()
     return notification;
 }
 
-hailo_status HailoRTDriver::disable_notifications()
+hailo_status HailoRTKernelDriver::disable_notifications()
 {
     tCompatibleHailoIoctlData data = {};
 
@@ -394,7 +394,7 @@ hailo_status HailoRTDriver::disable_notifications()
 
     return HAILO_SUCCESS;
 }
-hailo_status HailoRTDriver::read_memory(MemoryType memory_type, uint64_t address, void *buf, size_t size)
+hailo_status HailoRTKernelDriver::read_memory(MemoryType memory_type, uint64_t address, void *buf, size_t size)
 {
     if (size == 0) {
         LOGGER__ERROR("Invalid size to read");
@@ -419,7 +419,7 @@ hailo_status HailoRTDriver::read_memory(MemoryType memory_type, uint64_t address
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::write_memory(MemoryType memory_type, uint64_t address, const void *buf, size_t size)
+hailo_status HailoRTKernelDriver::write_memory(MemoryType memory_type, uint64_t address, const void *buf, size_t size)
 {
     if (size == 0) {
         LOGGER__ERROR("Invalid size to read");
@@ -444,7 +444,7 @@ hailo_status HailoRTDriver::write_memory(MemoryType memory_type, uint64_t addres
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::read_memory_ioctl(MemoryType memory_type, uint64_t address, void *buf, size_t size)
+hailo_status HailoRTKernelDriver::read_memory_ioctl(MemoryType memory_type, uint64_t address, void *buf, size_t size)
 {
     if (size == 0) {
         LOGGER__ERROR("Invalid size to read");
@@ -481,7 +481,7 @@ hailo_status HailoRTDriver::read_memory_ioctl(MemoryType memory_type, uint64_t a
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::write_memory_ioctl(MemoryType memory_type, uint64_t address, const void *buf, size_t size)
+hailo_status HailoRTKernelDriver::write_memory_ioctl(MemoryType memory_type, uint64_t address, const void *buf, size_t size)
 {
     if (size == 0) {
         LOGGER__ERROR("Invalid size to write");
@@ -518,7 +518,7 @@ hailo_status HailoRTDriver::write_memory_ioctl(MemoryType memory_type, uint64_t
     return HAILO_SUCCESS;
 }
 
-Expected<uint32_t> HailoRTDriver::read_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+Expected<uint32_t> HailoRTKernelDriver::read_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
     size_t offset, size_t reg_size)
 {
     CHECK_AS_EXPECTED(is_valid_channel_id(channel_id), HAILO_INVALID_ARGUMENT, "Invalid channel id {} given", channel_id);
@@ -541,7 +541,7 @@ Expected<uint32_t> HailoRTDriver::read_vdma_channel_register(vdma::ChannelId cha
     return std::move(params.data);
 }
 
-hailo_status HailoRTDriver::write_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
+hailo_status HailoRTKernelDriver::write_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
     size_t offset, size_t reg_size, uint32_t value)
 {
     CHECK(is_valid_channel_id(channel_id), HAILO_INVALID_ARGUMENT, "Invalid channel id {} given", channel_id);
@@ -564,7 +564,7 @@ hailo_status HailoRTDriver::write_vdma_channel_register(vdma::ChannelId channel_
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::vdma_buffer_sync(VdmaBufferHandle handle, DmaSyncDirection sync_direction,
+hailo_status HailoRTKernelDriver::vdma_buffer_sync(VdmaBufferHandle handle, DmaSyncDirection sync_direction,
     size_t offset, size_t count)
 {
     tCompatibleHailoIoctlData data = {};
@@ -581,7 +581,7 @@ hailo_status HailoRTDriver::vdma_buffer_sync(VdmaBufferHandle handle, DmaSyncDir
 }
 
 
-hailo_status HailoRTDriver::vdma_interrupts_enable(const ChannelsBitmap &channels_bitmap, bool enable_timestamps_measure)
+hailo_status HailoRTKernelDriver::vdma_interrupts_enable(const ChannelsBitmap &channels_bitmap, bool enable_timestamps_measure)
 {
     CHECK(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT, "Invalid channel bitmap given");
     tCompatibleHailoIoctlData data = {};
@@ -595,7 +595,7 @@ hailo_status HailoRTDriver::vdma_interrupts_enable(const ChannelsBitmap &channel
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::vdma_interrupts_disable(const ChannelsBitmap &channels_bitmap)
+hailo_status HailoRTKernelDriver::vdma_interrupts_disable(const ChannelsBitmap &channels_bitmap)
 {
     CHECK(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT, "Invalid channel bitmap given");
     tCompatibleHailoIoctlData data = {};
@@ -654,7 +654,7 @@ static Expected<IrqData> to_irq_data(const hailo_vdma_interrupts_wait_params& pa
     return irq;
 }
 
-Expected<IrqData> HailoRTDriver::vdma_interrupts_wait(const ChannelsBitmap &channels_bitmap)
+Expected<IrqData> HailoRTKernelDriver::vdma_interrupts_wait(const ChannelsBitmap &channels_bitmap)
 {
     CHECK_AS_EXPECTED(is_valid_channels_bitmap(channels_bitmap), HAILO_INVALID_ARGUMENT, "Invalid channel bitmap given");
     tCompatibleHailoIoctlData data = {};
@@ -669,7 +669,7 @@ Expected<IrqData> HailoRTDriver::vdma_interrupts_wait(const ChannelsBitmap &chan
     return to_irq_data(params, static_cast<uint8_t>(m_dma_engines_count));
 }
 
-Expected<ChannelInterruptTimestampList> HailoRTDriver::vdma_interrupts_read_timestamps(vdma::ChannelId channel_id)
+Expected<ChannelInterruptTimestampList> HailoRTKernelDriver::vdma_interrupts_read_timestamps(vdma::ChannelId channel_id)
 {
     tCompatibleHailoIoctlData data = {};
     hailo_vdma_interrupts_read_timestamp_params &params = data.Buffer.VdmaInterruptsReadTimestamps;
@@ -684,7 +684,7 @@ Expected<ChannelInterruptTimestampList> HailoRTDriver::vdma_interrupts_read_time
     return create_interrupt_timestamp_list(params);
 }
 
-hailo_status HailoRTDriver::fw_control(const void *request, size_t request_len, const uint8_t request_md5[PCIE_EXPECTED_MD5_LENGTH],
+hailo_status HailoRTKernelDriver::fw_control(const void *request, size_t request_len, const uint8_t request_md5[PCIE_EXPECTED_MD5_LENGTH],
     void *response, size_t *response_len, uint8_t response_md5[PCIE_EXPECTED_MD5_LENGTH],
     std::chrono::milliseconds timeout, hailo_cpu_id_t cpu_id)
 {
@@ -730,7 +730,7 @@ hailo_status read_log(uint8_t *buffer, size_t buffer_size, size_t *read_bytes, h
     return HAILO_PCIE_NOT_SUPPORTED_ON_PLATFORM;
 }
 
-Expected<size_t> HailoRTDriver::vdma_buffer_map(void *user_address, size_t required_size, DmaDirection data_direction,
+Expected<size_t> HailoRTKernelDriver::vdma_buffer_map(void *user_address, size_t required_size, DmaDirection data_direction,
     const vdma_mapped_buffer_driver_identifier &driver_buff_handle)
 {
     tCompatibleHailoIoctlData data = {};
@@ -749,7 +749,7 @@ Expected<size_t> HailoRTDriver::vdma_buffer_map(void *user_address, size_t requi
     return std::move(map_user_buffer_info.mapped_handle);
 }
 
-hailo_status HailoRTDriver::vdma_buffer_unmap(VdmaBufferHandle handle)
+hailo_status HailoRTKernelDriver::vdma_buffer_unmap(VdmaBufferHandle handle)
 {
     tCompatibleHailoIoctlData data = {};
     hailo_vdma_buffer_unmap_params& unmap_user_buffer_info = data.Buffer.VdmaBufferUnmap;
@@ -762,7 +762,7 @@ hailo_status HailoRTDriver::vdma_buffer_unmap(VdmaBufferHandle handle)
     return HAILO_SUCCESS;
 }
 
-Expected<DescriptorsListInfo> HailoRTDriver::descriptors_list_create(size_t desc_count, bool is_circular)
+Expected<DescriptorsListInfo> HailoRTKernelDriver::descriptors_list_create(size_t desc_count, bool is_circular)
 {
     auto handle_to_dma_address_pair = descriptors_list_create_ioctl(desc_count, is_circular);
     CHECK_EXPECTED(handle_to_dma_address_pair);
@@ -783,7 +783,7 @@ Expected<DescriptorsListInfo> HailoRTDriver::descriptors_list_create(size_t desc
     return DescriptorsListInfo{desc_handle, dma_address, desc_count, user_address.release()};
 }
 
-hailo_status HailoRTDriver::descriptors_list_release(const DescriptorsListInfo &descriptors_list_info)
+hailo_status HailoRTKernelDriver::descriptors_list_release(const DescriptorsListInfo &descriptors_list_info)
 {
     hailo_status status = HAILO_SUCCESS;
 
@@ -804,7 +804,7 @@ hailo_status HailoRTDriver::descriptors_list_release(const DescriptorsListInfo &
     return status;
 }
 
-Expected<std::pair<uintptr_t, uint64_t>> HailoRTDriver::descriptors_list_create_ioctl(size_t desc_count, bool is_circular)
+Expected<std::pair<uintptr_t, uint64_t>> HailoRTKernelDriver::descriptors_list_create_ioctl(size_t desc_count, bool is_circular)
 {
     tCompatibleHailoIoctlData data = {};
     hailo_desc_list_create_params& create_desc_info = data.Buffer.DescListCreate;
@@ -819,7 +819,7 @@ Expected<std::pair<uintptr_t, uint64_t>> HailoRTDriver::descriptors_list_create_
     return std::move(std::make_pair(create_desc_info.desc_handle, create_desc_info.dma_address));
 }
 
-hailo_status HailoRTDriver::descriptors_list_release_ioctl(uintptr_t desc_handle)
+hailo_status HailoRTKernelDriver::descriptors_list_release_ioctl(uintptr_t desc_handle)
 {
     tCompatibleHailoIoctlData data = {};
     uintptr_t& release_desc_info = data.Buffer.DescListReleaseParam;
@@ -832,7 +832,7 @@ hailo_status HailoRTDriver::descriptors_list_release_ioctl(uintptr_t desc_handle
     return HAILO_SUCCESS;
 }
 
-Expected<void *> HailoRTDriver::descriptors_list_create_mmap(uintptr_t desc_handle, size_t desc_count)
+Expected<void *> HailoRTKernelDriver::descriptors_list_create_mmap(uintptr_t desc_handle, size_t desc_count)
 {
     tCompatibleHailoIoctlData data = {};
     data.Buffer.DescListMmap.desc_handle = desc_handle;
@@ -846,13 +846,13 @@ Expected<void *> HailoRTDriver::descriptors_list_create_mmap(uintptr_t desc_hand
     return user_address;
 }
 
-hailo_status HailoRTDriver::descriptors_list_create_munmap(void *, size_t )
+hailo_status HailoRTKernelDriver::descriptors_list_create_munmap(void *, size_t )
 {
     // On windows, the unmap is done on the release ioctl
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::descriptors_list_bind_vdma_buffer(uintptr_t desc_handle, VdmaBufferHandle buffer_handle,
+hailo_status HailoRTKernelDriver::descriptors_list_bind_vdma_buffer(uintptr_t desc_handle, VdmaBufferHandle buffer_handle,
     uint16_t desc_page_size,  uint8_t channel_index, uint32_t starting_desc)
 {
     tCompatibleHailoIoctlData data = {};
@@ -871,7 +871,7 @@ hailo_status HailoRTDriver::descriptors_list_bind_vdma_buffer(uintptr_t desc_han
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::read_log(uint8_t *buffer, size_t buffer_size, size_t *read_bytes, hailo_cpu_id_t cpu_id)
+hailo_status HailoRTKernelDriver::read_log(uint8_t *buffer, size_t buffer_size, size_t *read_bytes, hailo_cpu_id_t cpu_id)
 {
     tCompatibleHailoIoctlData data = {};
     hailo_read_log_params& params = data.Buffer.ReadLog;
@@ -896,36 +896,36 @@ hailo_status HailoRTDriver::read_log(uint8_t *buffer, size_t buffer_size, size_t
     return HAILO_SUCCESS;
 }
 
-hailo_status HailoRTDriver::reset_nn_core()
+hailo_status HailoRTKernelDriver::reset_nn_core()
 {
     LOGGER__ERROR("Reset nn core is not supported over the windows driver");
     return HAILO_NOT_IMPLEMENTED;
 }
 
-Expected<uintptr_t> HailoRTDriver::vdma_low_memory_buffer_alloc(size_t size) {
+Expected<uintptr_t> HailoRTKernelDriver::vdma_low_memory_buffer_alloc(size_t size) {
     (void) size;
     return make_unexpected(HAILO_INVALID_OPERATION);
 }
 
 
-hailo_status HailoRTDriver::vdma_low_memory_buffer_free(uintptr_t buffer_handle) {
+hailo_status HailoRTKernelDriver::vdma_low_memory_buffer_free(uintptr_t buffer_handle) {
     (void) buffer_handle;
     return HAILO_INVALID_OPERATION;
 }
 
-Expected<std::pair<uintptr_t, uint64_t>> HailoRTDriver::vdma_continuous_buffer_alloc(size_t size)
+Expected<std::pair<uintptr_t, uint64_t>> HailoRTKernelDriver::vdma_continuous_buffer_alloc(size_t size)
 {
     (void) size;
     return make_unexpected(HAILO_INVALID_OPERATION);
 }
 
-hailo_status HailoRTDriver::vdma_continuous_buffer_free(uintptr_t buffer_handle)
+hailo_status HailoRTKernelDriver::vdma_continuous_buffer_free(uintptr_t buffer_handle)
 {
     (void) buffer_handle;
     return HAILO_INVALID_OPERATION;
 }
 
-hailo_status HailoRTDriver::mark_as_used()
+hailo_status HailoRTKernelDriver::mark_as_used()
 {
     tCompatibleHailoIoctlData data = {};
     if (0 > ioctl(this->m_fd, HAILO_MARK_AS_IN_USE, &data)) {
@@ -938,10 +938,4 @@ hailo_status HailoRTDriver::mark_as_used()
     return HAILO_SUCCESS;
 }
 
-// TODO: HRT-7309 merge with posix
-bool HailoRTDriver::is_valid_channel_id(const vdma::ChannelId &channel_id)
-{
-    return (channel_id.engine_index < m_dma_engines_count) && (channel_id.channel_index < MAX_VDMA_CHANNELS_PER_ENGINE);
-}
-
 } /* namespace hailort */
@@ -622,7 +622,7 @@ hailo_vstream_info_t deserialize_vstream_info(const ProtoVStreamInfo &info_proto
         static_cast<hailo_format_flags_t>(info_proto.format().flags())
     };
     info.format = format;
-    if (format.order == HAILO_FORMAT_ORDER_HAILO_NMS) {
+    if (HailoRTCommon::is_nms(format.order)) {
         hailo_nms_shape_t nms_shape = {
             info_proto.nms_shape().number_of_classes(),
             info_proto.nms_shape().max_bbox_per_class(),
@@ -982,7 +982,10 @@ hailo_status HailoRtRpcClient::OutputVStream_read(const VStreamIdentifier &ident
         return static_cast<hailo_status>(reply.status());
     }
     CHECK_SUCCESS(static_cast<hailo_status>(reply.status()));
-    memcpy(buffer.data(), reply.data().data(), buffer.size());
+    // Variable-length formats (e.g. HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS) are sent without the unused part of the frame
+    CHECK(reply.data().size() <= buffer.size(), HAILO_INTERNAL_FAILURE, "VStream read returned {} bytes, buffer size is {}",
+        reply.data().size(), buffer.size());
+    memcpy(buffer.data(), reply.data().data(), reply.data().size());
     return HAILO_SUCCESS;
 }
 
@@ -326,6 +326,14 @@ Expected<std::vector<std::string>> ConfiguredNetworkGroupClient::get_vstream_nam
     return m_client->ConfiguredNetworkGroup_get_vstream_names_from_stream_name(m_identifier, stream_name);
 }
 
+Expected<std::vector<InputVStream>> ConfiguredNetworkGroupClient::create_input_vstreams(const std::map<std::string, hailo_vstream_params_t> &inputs_params,
+    const std::map<std::string, hailo_image_preprocess_params_t> &inputs_preprocess_params)
+{
+    CHECK_AS_EXPECTED(inputs_preprocess_params.empty(), HAILO_NOT_SUPPORTED,
+        "Image pre-process is not supported when using the HailoRT service");
+    return create_input_vstreams(inputs_params);
+}
+
 Expected<std::vector<InputVStream>> ConfiguredNetworkGroupClient::create_input_vstreams(const std::map<std::string, hailo_vstream_params_t> &inputs_params)
 {
     auto reply = m_client->InputVStreams_create(m_identifier, inputs_params, OsUtils::get_curr_pid());
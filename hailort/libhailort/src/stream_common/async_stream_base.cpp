@@ -195,6 +195,29 @@ hailo_status AsyncInputStreamBase::write_async(TransferRequest &&transfer_reques
     return call_write_async_impl(std::move(transfer_request));
 }
 
+hailo_status AsyncInputStreamBase::write_async_batch(std::vector<TransferRequest> &transfer_requests)
+{
+    auto status = set_buffer_mode(StreamBufferMode::NOT_OWNING);
+    CHECK_SUCCESS(status);
+
+    std::unique_lock<std::mutex> lock(m_stream_mutex);
+    return call_write_async_batch_impl(transfer_requests);
+}
+
+hailo_status AsyncInputStreamBase::write_async_batch_impl(std::vector<TransferRequest> &transfer_requests)
+{
+    size_t launched_count = 0;
+    auto status = HAILO_SUCCESS;
+    for (; launched_count < transfer_requests.size(); launched_count++) {
+        status = write_async_impl(std::move(transfer_requests[launched_count]));
+        if (HAILO_SUCCESS != status) {
+            break;
+        }
+    }
+    transfer_requests.erase(transfer_requests.begin(), transfer_requests.begin() + launched_count);
+    return status;
+}
+
 hailo_status AsyncInputStreamBase::activate_stream()
 {
     std::unique_lock<std::mutex> lock(m_stream_mutex);
@@ -231,9 +254,10 @@ hailo_status AsyncInputStreamBase::deactivate_stream()
     return status;
 }
 
-hailo_status AsyncInputStreamBase::call_write_async_impl(TransferRequest &&transfer_request)
+InternalTransferDoneCallback AsyncInputStreamBase::wrap_transfer_done_callback(
+    const InternalTransferDoneCallback &callback)
 {
-    transfer_request.callback = [this, callback=transfer_request.callback](hailo_status callback_status) {
+    return [this, callback](hailo_status callback_status) {
         if (HAILO_SUCCESS == callback_status) {
             // Calling interrupt callback first (only if successful), since callback() may update the state (and we call
             // interrupt_callback before the state is activated).
@@ -249,7 +273,11 @@ hailo_status AsyncInputStreamBase::call_write_async_impl(TransferRequest &&trans
 
         m_has_ready_buffer.notify_all();
     };
+}
 
+hailo_status AsyncInputStreamBase::call_write_async_impl(TransferRequest &&transfer_request)
+{
+    transfer_request.callback = wrap_transfer_done_callback(transfer_request.callback);
 
     auto status = write_async_impl(std::move(transfer_request));
     if ((HAILO_STREAM_NOT_ACTIVATED == status) || (HAILO_STREAM_ABORTED_BY_USER == status)) {
@@ -262,6 +290,25 @@ hailo_status AsyncInputStreamBase::call_write_async_impl(TransferRequest &&trans
     return HAILO_SUCCESS;
 }
 
+hailo_status AsyncInputStreamBase::call_write_async_batch_impl(std::vector<TransferRequest> &transfer_requests)
+{
+    for (auto &transfer_request : transfer_requests) {
+        transfer_request.callback = wrap_transfer_done_callback(transfer_request.callback);
+    }
+
+    const auto requests_count = transfer_requests.size();
+    auto status = write_async_batch_impl(transfer_requests);
+    // Requests left in transfer_requests weren't launched
+    m_ongoing_transfers += (requests_count - transfer_requests.size());
+
+    if ((HAILO_STREAM_NOT_ACTIVATED == status) || (HAILO_STREAM_ABORTED_BY_USER == status)) {
+        return status;
+    }
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
 bool AsyncInputStreamBase::is_ready_for_transfer() const
 {
     return m_ongoing_transfers < get_max_ongoing_transfers();
@@ -330,9 +377,33 @@ hailo_status AsyncOutputStreamBase::read_async(TransferRequest &&transfer_reques
     return call_read_async_impl(std::move(transfer_request));
 }
 
-hailo_status AsyncOutputStreamBase::call_read_async_impl(TransferRequest &&transfer_request)
+hailo_status AsyncOutputStreamBase::read_async_batch(std::vector<TransferRequest> &transfer_requests)
+{
+    auto status = set_buffer_mode(StreamBufferMode::NOT_OWNING);
+    CHECK_SUCCESS(status);
+
+    std::unique_lock<std::mutex> lock(m_stream_mutex);
+    return call_read_async_batch_impl(transfer_requests);
+}
+
+hailo_status AsyncOutputStreamBase::read_async_batch_impl(std::vector<TransferRequest> &transfer_requests)
+{
+    size_t launched_count = 0;
+    auto status = HAILO_SUCCESS;
+    for (; launched_count < transfer_requests.size(); launched_count++) {
+        status = read_async_impl(std::move(transfer_requests[launched_count]));
+        if (HAILO_SUCCESS != status) {
+            break;
+        }
+    }
+    transfer_requests.erase(transfer_requests.begin(), transfer_requests.begin() + launched_count);
+    return status;
+}
+
+InternalTransferDoneCallback AsyncOutputStreamBase::wrap_transfer_done_callback(
+    const InternalTransferDoneCallback &callback)
 {
-    transfer_request.callback = [this, callback=transfer_request.callback](hailo_status callback_status) {
+    return [this, callback](hailo_status callback_status) {
         if (HAILO_SUCCESS == callback_status) {
             // Calling interrupt callback first (only if successful), since callback() may update the state (and we call
             // interrupt_callback before the state is activated).
@@ -348,7 +419,11 @@ hailo_status AsyncOutputStreamBase::call_read_async_impl(TransferRequest &&trans
 
         m_has_ready_buffer.notify_all();
     };
+}
 
+hailo_status AsyncOutputStreamBase::call_read_async_impl(TransferRequest &&transfer_request)
+{
+    transfer_request.callback = wrap_transfer_done_callback(transfer_request.callback);
 
     auto status = read_async_impl(std::move(transfer_request));
     if (HAILO_STREAM_ABORTED_BY_USER == status) {
@@ -361,6 +436,25 @@ hailo_status AsyncOutputStreamBase::call_read_async_impl(TransferRequest &&trans
     return HAILO_SUCCESS;
 }
 
+hailo_status AsyncOutputStreamBase::call_read_async_batch_impl(std::vector<TransferRequest> &transfer_requests)
+{
+    for (auto &transfer_request : transfer_requests) {
+        transfer_request.callback = wrap_transfer_done_callback(transfer_request.callback);
+    }
+
+    const auto requests_count = transfer_requests.size();
+    auto status = read_async_batch_impl(transfer_requests);
+    // Requests left in transfer_requests weren't launched
+    m_ongoing_transfers += (requests_count - transfer_requests.size());
+
+    if (HAILO_STREAM_ABORTED_BY_USER == status) {
+        return status;
+    }
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status AsyncOutputStreamBase::register_interrupt_callback(const ProcessingCompleteCallback &callback)
 {
     std::unique_lock<std::mutex> lock(m_stream_mutex);
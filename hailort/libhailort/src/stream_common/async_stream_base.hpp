@@ -40,6 +40,7 @@ public:
     virtual Expected<size_t> get_async_max_queue_size() const override;
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout) override;
     virtual hailo_status write_async(TransferRequest &&transfer_request) override;
+    virtual hailo_status write_async_batch(std::vector<TransferRequest> &transfer_requests) override;
 
     virtual hailo_status write_impl(const MemoryView &buffer, std::function<bool()> should_cancel);
     virtual hailo_status write_impl(const MemoryView &buffer) override;
@@ -51,6 +52,9 @@ public:
     virtual Expected<std::unique_ptr<StreamBufferPool>> allocate_buffer_pool() = 0;
     virtual size_t get_max_ongoing_transfers() const = 0;
     virtual hailo_status write_async_impl(TransferRequest &&transfer_request) = 0;
+    // By default, the requests are launched one by one. On return, transfer_requests contains the requests that
+    // weren't launched.
+    virtual hailo_status write_async_batch_impl(std::vector<TransferRequest> &transfer_requests);
     virtual hailo_status activate_stream_impl() { return HAILO_SUCCESS; }
     virtual hailo_status deactivate_stream_impl() { return HAILO_SUCCESS; }
 
@@ -59,6 +63,8 @@ protected:
 
 private:
     hailo_status call_write_async_impl(TransferRequest &&transfer_request);
+    hailo_status call_write_async_batch_impl(std::vector<TransferRequest> &transfer_requests);
+    InternalTransferDoneCallback wrap_transfer_done_callback(const InternalTransferDoneCallback &callback);
 
     bool is_ready_for_transfer() const;
     bool is_ready_for_dequeue() const;
@@ -126,6 +132,7 @@ public:
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout) override;
     virtual Expected<size_t> get_async_max_queue_size() const override;
     virtual hailo_status read_async(TransferRequest &&transfer_request) override;
+    virtual hailo_status read_async_batch(std::vector<TransferRequest> &transfer_requests) override;
 
     virtual hailo_status read_impl(MemoryView buffer) override;
 
@@ -141,6 +148,9 @@ public:
     virtual Expected<std::unique_ptr<StreamBufferPool>> allocate_buffer_pool() = 0;
     virtual size_t get_max_ongoing_transfers() const = 0;
     virtual hailo_status read_async_impl(TransferRequest &&transfer_request) = 0;
+    // By default, the requests are launched one by one. On return, transfer_requests contains the requests that
+    // weren't launched.
+    virtual hailo_status read_async_batch_impl(std::vector<TransferRequest> &transfer_requests);
     virtual hailo_status activate_stream_impl() { return HAILO_SUCCESS; }
     virtual hailo_status deactivate_stream_impl() { return HAILO_SUCCESS; }
 
@@ -149,6 +159,8 @@ protected:
 
 private:
     hailo_status call_read_async_impl(TransferRequest &&transfer_request);
+    hailo_status call_read_async_batch_impl(std::vector<TransferRequest> &transfer_requests);
+    InternalTransferDoneCallback wrap_transfer_done_callback(const InternalTransferDoneCallback &callback);
 
     bool is_ready_for_transfer() const;
 
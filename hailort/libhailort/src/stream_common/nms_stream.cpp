@@ -44,6 +44,12 @@
  *    can be in the following burst) and then assume the rest of the burst is padding (and in debug we verify that). NOTE: currently this mode is not
  *    supported in the sdk.
  *
+ * Bulk mode: in modes 3)-4) with interrupt per frame, every class is a single burst (burst size is larger than max bboxes
+ * and the delimeters), and the whole frame is read in a single transfer. Instead of running the state machine over each
+ * bbox, the frame is parsed from memory - each burst is scanned for its first delimeter, and its bboxes are moved (in place)
+ * to their place in the nms frame. On vdma streams these transfers are launched directly on the base stream, so the nms
+ * frames are not serialized on the reader thread.
+ *
  **/
 
 #include "nms_stream.hpp"
@@ -55,6 +61,31 @@
 namespace hailort
 {
 
+// Returns the index of the first nms delimeter/image delimeter/padding in entries, or count if there is none.
+// All of these special values are >= NMS_H15_PADDING, so blocks of entries are tested with a single comparison each
+// (vectorized by the compiler), and only the block containing the special value is scanned entry by entry.
+static size_t find_first_special_entry(const uint64_t *entries, size_t count)
+{
+    static const size_t BLOCK_SIZE = 8;
+    size_t index = 0;
+    for (; (index + BLOCK_SIZE) <= count; index += BLOCK_SIZE) {
+        uint64_t has_special_entry = 0;
+        for (size_t i = 0; i < BLOCK_SIZE; i++) {
+            has_special_entry |= static_cast<uint64_t>(entries[index + i] >= NMS_H15_PADDING);
+        }
+        if (0 != has_special_entry) {
+            break;
+        }
+    }
+
+    for (; index < count; index++) {
+        if (entries[index] >= NMS_H15_PADDING) {
+            return index;
+        }
+    }
+    return count;
+}
+
 static void finish_reading_burst_update_state(NMSBurstState *burst_state, bool *can_stop_reading_burst, size_t *burst_index)
 {
     *burst_state = NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER;
@@ -231,6 +262,17 @@ hailo_status NMSStreamReader::read_nms_burst_mode(OutputStreamBase &stream, void
     CHECK(transfer_size <= buffer_size, HAILO_INTERNAL_FAILURE, "Invalid transfer size {}, Cannot be larger than buffer {}",
         transfer_size, buffer_size);
 
+    if (is_interrupt_per_frame && is_bulk_read_supported(stream.get_layer_info())) {
+        MemoryView frame(static_cast<uint8_t*>(buffer) + offset, transfer_size);
+        auto status = stream.read_impl(frame);
+        if ((HAILO_STREAM_ABORTED_BY_USER == status) || ((HAILO_STREAM_NOT_ACTIVATED == status))) {
+            return status;
+        }
+        CHECK_SUCCESS(status, "Failed reading nms frame");
+
+        return parse_nms_bulk(stream.get_layer_info(), static_cast<uint8_t*>(buffer) + offset, buffer_size - offset);
+    }
+
     // Start writing bboxes at offset sizeof(nms_bbox_counter_t) - because the first sizeof(nms_bbox_counter_t) will be
     // used to write amount of bboxes found for class 0 etc...
     nms_bbox_counter_t class_bboxes_count = 0;
@@ -302,6 +344,72 @@ hailo_status NMSStreamReader::read_nms_burst_mode(OutputStreamBase &stream, void
     return HAILO_SUCCESS;
 }
 
+bool NMSStreamReader::is_bulk_read_supported(const LayerInfo &layer_info)
+{
+    const auto burst_type = layer_info.nms_info.burst_type;
+    if ((HAILO_BURST_TYPE_H8_PER_CLASS != burst_type) && (HAILO_BURST_TYPE_H15_PER_CLASS != burst_type)) {
+        return false;
+    }
+
+    if (sizeof(uint64_t) != layer_info.nms_info.bbox_size) {
+        return false;
+    }
+
+    // Interrupt per frame
+    const size_t burst_size = layer_info.nms_info.burst_size * layer_info.nms_info.bbox_size;
+    return LayerInfoUtils::get_nms_layer_transfer_size(layer_info) > burst_size;
+}
+
+hailo_status NMSStreamReader::parse_nms_bulk(const LayerInfo &layer_info, uint8_t *buffer, size_t buffer_size)
+{
+    assert(is_bulk_read_supported(layer_info));
+    const auto &nms_info = layer_info.nms_info;
+    const size_t burst_entries = nms_info.burst_size;
+    const size_t bursts_count = nms_info.number_of_classes * nms_info.chunks_per_frame;
+    const bool has_image_delimeter = (HAILO_BURST_TYPE_H15_PER_CLASS == nms_info.burst_type);
+    CHECK(bursts_count * burst_entries * sizeof(uint64_t) <= buffer_size, HAILO_INTERNAL_FAILURE,
+        "Invalid nms frame size {}, buffer size is {}", bursts_count * burst_entries * sizeof(uint64_t), buffer_size);
+
+    // Each class is a single burst (interrupt per frame). The class bboxes are always moved backwards (the counter is
+    // smaller than the delimeter which ends the burst), so the frame can be parsed in place.
+    uint8_t *dst = buffer;
+    for (size_t burst_index = 0; burst_index < bursts_count; burst_index++) {
+        const auto burst = reinterpret_cast<const uint64_t*>(buffer + (burst_index * burst_entries * sizeof(uint64_t)));
+        const size_t bboxes_count = find_first_special_entry(burst, burst_entries);
+        CHECK((bboxes_count < burst_entries) && (NMS_DELIMITER == burst[bboxes_count]), HAILO_NMS_BURST_INVALID_DATA,
+            "Expected delimeter at the end of class {} burst", burst_index);
+        CHECK_IN_DEBUG(bboxes_count <= nms_info.max_bboxes_per_class, HAILO_INTERNAL_FAILURE,
+            "Data read from the device for the current class was size {}, max size is {}", bboxes_count,
+            nms_info.max_bboxes_per_class);
+
+        // The rest of the burst is image delimeter (Hailo-15) and padding. Only its edges are always checked, which
+        // catches bursts that are shifted or cut - the whole padding is checked on debug builds.
+        size_t padding_index = bboxes_count + 1;
+        if (has_image_delimeter) {
+            CHECK((padding_index < burst_entries) && (NMS_IMAGE_DELIMITER == burst[padding_index]), HAILO_NMS_BURST_INVALID_DATA,
+                "Expected image delimeter after class {} delimeter", burst_index);
+            padding_index++;
+        }
+        const uint64_t padding = has_image_delimeter ? NMS_H15_PADDING : NMS_DELIMITER;
+        CHECK((padding_index == burst_entries) || (padding == burst[burst_entries - 1]), HAILO_NMS_BURST_INVALID_DATA,
+            "Expected padding at the end of class {} burst", burst_index);
+#ifndef NDEBUG
+        for (; padding_index < burst_entries; padding_index++) {
+            CHECK(padding == burst[padding_index], HAILO_NMS_BURST_INVALID_DATA,
+                "Expected padding at the end of class {} burst", burst_index);
+        }
+#endif // NDEBUG
+
+        const size_t bboxes_size = bboxes_count * sizeof(uint64_t);
+        memmove(dst + sizeof(nms_bbox_counter_t), burst, bboxes_size);
+        const auto class_bboxes_count = static_cast<nms_bbox_counter_t>(bboxes_count);
+        memcpy(dst, &class_bboxes_count, sizeof(class_bboxes_count));
+        dst += sizeof(nms_bbox_counter_t) + bboxes_size;
+    }
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status NMSStreamReader::read_nms(OutputStreamBase &stream, void *buffer, size_t offset, size_t size)
 {
     hailo_status status = HAILO_UNINITIALIZED;
@@ -323,19 +431,58 @@ hailo_status NMSStreamReader::read_nms(OutputStreamBase &stream, void *buffer, s
 Expected<std::shared_ptr<NmsOutputStream>> NmsOutputStream::create(std::shared_ptr<OutputStreamBase> base_stream,
     const LayerInfo &edge_layer, size_t max_queue_size, EventPtr core_op_activated_event)
 {
+    // Bulk reads are launched as async reads on the base stream, into the nms frame buffers.
+    const auto interface = base_stream->get_interface();
+    const bool is_bulk_read = NMSStreamReader::is_bulk_read_supported(edge_layer) &&
+        ((HAILO_STREAM_INTERFACE_PCIE == interface) || (HAILO_STREAM_INTERFACE_INTEGRATED == interface));
+
     auto status = HAILO_UNINITIALIZED;
-    auto nms_stream = make_shared_nothrow<NmsOutputStream>(base_stream, edge_layer, max_queue_size,
+    auto nms_stream = make_shared_nothrow<NmsOutputStream>(base_stream, edge_layer, max_queue_size, is_bulk_read,
         std::move(core_op_activated_event), status);
     CHECK_NOT_NULL_AS_EXPECTED(nms_stream, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
-    // On nms stream, we always want that the underline stream will own the buffers the read operations.
-    status = base_stream->set_buffer_mode(StreamBufferMode::OWNING);
+    // Without bulk reads, we always want that the underline stream will own the buffers the read operations.
+    status = base_stream->set_buffer_mode(is_bulk_read ? StreamBufferMode::NOT_OWNING : StreamBufferMode::OWNING);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     return nms_stream;
 }
 
+NmsOutputStream::NmsOutputStream(std::shared_ptr<OutputStreamBase> base_stream, const LayerInfo &edge_layer,
+    size_t max_queue_size, bool is_bulk_read, EventPtr core_op_activated_event, hailo_status &status) :
+        AsyncOutputStreamBase(edge_layer, base_stream->get_interface(), std::move(core_op_activated_event), status),
+        m_base_stream(base_stream),
+        m_max_queue_size(max_queue_size),
+        m_is_bulk_read(is_bulk_read)
+{
+    // Check status for base class c'tor
+    if (HAILO_SUCCESS != status) {
+        return;
+    }
+
+    if (!m_is_bulk_read) {
+        m_reader_thread = make_unique_nothrow<NmsReaderThread>(base_stream, max_queue_size);
+        if (nullptr == m_reader_thread) {
+            status = HAILO_OUT_OF_HOST_MEMORY;
+            return;
+        }
+    }
+
+    status = HAILO_SUCCESS;
+}
+
+NmsOutputStream::~NmsOutputStream()
+{
+    if (m_is_bulk_read) {
+        // The base stream transfers hold callbacks to this stream.
+        auto status = m_base_stream->deactivate_stream();
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR("Failed deactivate base stream, status {}", status);
+        }
+    }
+}
+
 hailo_stream_interface_t NmsOutputStream::get_interface() const
 {
     return m_base_stream->get_interface();
@@ -343,9 +490,10 @@ hailo_stream_interface_t NmsOutputStream::get_interface() const
 
 Expected<std::unique_ptr<StreamBufferPool>> NmsOutputStream::allocate_buffer_pool()
 {
-    const size_t queue_size = m_reader_thread.get_max_ongoing_transfers();
-    const BufferStorageParams heap_params{};
-    auto queued_pool = QueuedStreamBufferPool::create(queue_size, get_frame_size(), heap_params);
+    const size_t queue_size = get_max_ongoing_transfers();
+    // Bulk reads are transferred by the device directly into the pool buffers
+    const auto buffer_params = m_is_bulk_read ? BufferStorageParams::create_dma() : BufferStorageParams{};
+    auto queued_pool = QueuedStreamBufferPool::create(queue_size, get_frame_size(), buffer_params);
     CHECK_EXPECTED(queued_pool);
 
     return std::unique_ptr<StreamBufferPool>(queued_pool.release());
@@ -353,12 +501,41 @@ Expected<std::unique_ptr<StreamBufferPool>> NmsOutputStream::allocate_buffer_poo
 
 size_t NmsOutputStream::get_max_ongoing_transfers() const
 {
-    return m_reader_thread.get_max_ongoing_transfers();
+    if (m_is_bulk_read) {
+        auto base_queue_size = m_base_stream->get_async_max_queue_size();
+        return base_queue_size ? std::min(m_max_queue_size, base_queue_size.value()) : m_max_queue_size;
+    }
+    return m_reader_thread->get_max_ongoing_transfers();
 }
 
 hailo_status NmsOutputStream::read_async_impl(TransferRequest &&transfer_request)
 {
-    return m_reader_thread.launch_transfer(std::move(transfer_request));
+    if (m_is_bulk_read) {
+        return read_bulk_async(std::move(transfer_request));
+    }
+    return m_reader_thread->launch_transfer(std::move(transfer_request));
+}
+
+hailo_status NmsOutputStream::read_bulk_async(TransferRequest &&transfer_request)
+{
+    CHECK(0 == transfer_request.buffer.offset(), HAILO_INVALID_OPERATION,
+        "NMS stream doesn't support buffer with offset");
+
+    auto buffer = transfer_request.buffer.base_buffer();
+    const size_t transfer_size = LayerInfoUtils::get_nms_layer_transfer_size(get_layer_info());
+    CHECK(transfer_size <= buffer->size(), HAILO_INTERNAL_FAILURE, "Invalid transfer size {}, Cannot be larger than buffer {}",
+        transfer_size, buffer->size());
+
+    auto callback = transfer_request.callback;
+    TransferRequest bulk_request{TransferBuffer(buffer, transfer_size, 0),
+        [this, buffer, callback](hailo_status status) {
+            if (HAILO_SUCCESS == status) {
+                status = NMSStreamReader::parse_nms_bulk(get_layer_info(), buffer->data(), buffer->size());
+            }
+            callback(status);
+        }
+    };
+    return m_base_stream->read_async(std::move(bulk_request));
 }
 
 hailo_status NmsOutputStream::activate_stream_impl()
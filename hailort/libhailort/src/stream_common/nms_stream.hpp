@@ -35,6 +35,11 @@ enum class NMSBurstState {
 class NMSStreamReader {
 public:
     static hailo_status read_nms(OutputStreamBase &stream, void *buffer, size_t offset, size_t size);
+
+    // Bulk mode - on burst per class modes with interrupt per frame, a whole nms frame is received in a single
+    // transfer, so it can be read directly into the frame buffer and parsed from memory (in place) once it is done.
+    static bool is_bulk_read_supported(const LayerInfo &layer_info);
+    static hailo_status parse_nms_bulk(const LayerInfo &layer_info, uint8_t *buffer, size_t buffer_size);
 private:
     static hailo_status read_nms_bbox_mode(OutputStreamBase &stream, void *buffer, size_t offset);
     static hailo_status read_nms_burst_mode(OutputStreamBase &stream, void *buffer, size_t offset, size_t buffer_size);
@@ -74,7 +79,9 @@ private:
 
 // NMS requires multiple reads from the device + parsing the output. Hence, a background thread is needed.
 // This class opens a worker thread that processes nms transfers, signalling the user's callback upon completion.
-// read_async adds transfer requests to a producer-consumer queue
+// read_async adds transfer requests to a producer-consumer queue.
+// In bulk mode (see NMSStreamReader::is_bulk_read_supported) no thread is used - each transfer is launched directly
+// on the base stream, and the frame is parsed on its completion callback.
 class NmsOutputStream : public AsyncOutputStreamBase {
 public:
     static Expected<std::shared_ptr<NmsOutputStream>> create(std::shared_ptr<OutputStreamBase> base_stream,
@@ -83,11 +90,8 @@ public:
     virtual hailo_stream_interface_t get_interface() const override;
 
     NmsOutputStream(std::shared_ptr<OutputStreamBase> base_stream, const LayerInfo &edge_layer, size_t max_queue_size,
-        EventPtr core_op_activated_event, hailo_status &status) :
-            AsyncOutputStreamBase(edge_layer, base_stream->get_interface(), std::move(core_op_activated_event), status),
-            m_base_stream(base_stream),
-            m_reader_thread(base_stream, max_queue_size)
-    {}
+        bool is_bulk_read, EventPtr core_op_activated_event, hailo_status &status);
+    virtual ~NmsOutputStream();
 
 protected:
     virtual Expected<std::unique_ptr<StreamBufferPool>> allocate_buffer_pool() override;
@@ -96,9 +100,14 @@ protected:
     virtual hailo_status activate_stream_impl() override;
     virtual hailo_status deactivate_stream_impl() override;
 
+    hailo_status read_bulk_async(TransferRequest &&transfer_request);
+
     std::shared_ptr<OutputStreamBase> m_base_stream;
+    const size_t m_max_queue_size;
+    const bool m_is_bulk_read;
 
-    NmsReaderThread m_reader_thread;
+    // Not used in bulk mode
+    std::unique_ptr<NmsReaderThread> m_reader_thread;
 };
 
 } /* namespace hailort */
@@ -61,6 +61,18 @@ Expected<size_t> OutputStream::get_async_max_queue_size() const
     return make_unexpected(HAILO_NOT_IMPLEMENTED);
 }
 
+hailo_status OutputStream::register_buffers_ring(const std::vector<MemoryView> &/* buffers */)
+{
+    LOGGER__ERROR("register_buffers_ring not implemented for stream {}", name());
+    return HAILO_NOT_IMPLEMENTED;
+}
+
+hailo_status OutputStream::unregister_buffers_ring()
+{
+    LOGGER__ERROR("unregister_buffers_ring not implemented for stream {}", name());
+    return HAILO_NOT_IMPLEMENTED;
+}
+
 std::string OutputStream::to_string() const
 {
     std::stringstream string_stream;
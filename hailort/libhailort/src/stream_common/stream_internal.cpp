@@ -80,6 +80,20 @@ hailo_status InputStreamBase::write_async(TransferRequest &&)
     return HAILO_NOT_IMPLEMENTED;
 }
 
+hailo_status InputStreamBase::write_async_batch(std::vector<TransferRequest> &transfer_requests)
+{
+    size_t launched_count = 0;
+    auto status = HAILO_SUCCESS;
+    for (; launched_count < transfer_requests.size(); launched_count++) {
+        status = write_async(std::move(transfer_requests[launched_count]));
+        if (HAILO_SUCCESS != status) {
+            break;
+        }
+    }
+    transfer_requests.erase(transfer_requests.begin(), transfer_requests.begin() + launched_count);
+    return status;
+}
+
 EventPtr &InputStreamBase::get_core_op_activated_event()
 {
     return m_core_op_activated_event;
@@ -108,6 +122,7 @@ OutputStreamBase::OutputStreamBase(const LayerInfo &layer_info, const hailo_stre
 {
     m_stream_info = stream_info;
     m_quant_infos = m_layer_info.quant_infos;
+    m_trace_name = TraceStrings::get_id(m_stream_info.name);
 }
 
 hailo_status OutputStreamBase::read(MemoryView buffer)
@@ -163,6 +178,20 @@ hailo_status OutputStreamBase::read_async(TransferRequest &&)
     return HAILO_NOT_IMPLEMENTED;
 }
 
+hailo_status OutputStreamBase::read_async_batch(std::vector<TransferRequest> &transfer_requests)
+{
+    size_t launched_count = 0;
+    auto status = HAILO_SUCCESS;
+    for (; launched_count < transfer_requests.size(); launched_count++) {
+        status = read_async(std::move(transfer_requests[launched_count]));
+        if (HAILO_SUCCESS != status) {
+            break;
+        }
+    }
+    transfer_requests.erase(transfer_requests.begin(), transfer_requests.begin() + launched_count);
+    return status;
+}
+
 EventPtr &OutputStreamBase::get_core_op_activated_event()
 {
     return m_core_op_activated_event;
@@ -43,6 +43,7 @@
 #include "hef/hef_internal.hpp"
 #include "device_common/control_protocol.hpp"
 #include "hef/layer_info.hpp"
+#include "utils/profiler/trace_strings.hpp"
 
 
 namespace hailort
@@ -101,6 +102,35 @@ public:
         return HAILO_INVALID_OPERATION;
     }
 
+    // Use by the scheduler to launch a burst of transfers_count transfers on the given activated device.
+    virtual hailo_status launch_transfers(const device_id_t &device_id, size_t transfers_count)
+    {
+        for (size_t i = 0; i < transfers_count; i++) {
+            auto status = launch_transfer(device_id);
+            if (HAILO_SUCCESS != status) {
+                return status;
+            }
+        }
+        return HAILO_SUCCESS;
+    }
+
+    // Use by the scheduler to prepare the next transfers_count transfers on the given device, before the core-op is
+    // activated on it (while another core-op is running). Only host side work is done (e.g. mapping the buffers).
+    virtual hailo_status prepare_transfers(const device_id_t &device_id, size_t transfers_count)
+    {
+        (void)device_id;
+        (void)transfers_count;
+        return HAILO_SUCCESS;
+    }
+
+    // Prepares a transfer that will be launched after the stream is activated (see prepare_transfers).
+    virtual hailo_status prepare_async_transfer(TransferRequest &transfer_request, bool is_first_transfer)
+    {
+        (void)transfer_request;
+        (void)is_first_transfer;
+        return HAILO_SUCCESS;
+    }
+
     virtual Expected<size_t> get_buffer_frames_size() const
     {
         return make_unexpected(HAILO_INVALID_OPERATION);
@@ -122,6 +152,10 @@ public:
 
     virtual hailo_status write_async(TransferRequest &&transfer_request);
 
+    // Launches all transfer requests as a single burst (if supported by the stream). On return, transfer_requests
+    // contains the requests that weren't launched (empty on success).
+    virtual hailo_status write_async_batch(std::vector<TransferRequest> &transfer_requests);
+
     virtual EventPtr &get_core_op_activated_event() override;
     virtual bool is_scheduled() override;
 
@@ -155,6 +189,7 @@ protected:
         assert(1 == stream_infos.size());
         m_stream_info = stream_infos[0];
         m_quant_infos = layer_info.quant_infos;
+        m_trace_name = TraceStrings::get_id(m_stream_info.name);
 
         auto max_periph_bytes_from_hef = HefConfigurator::max_periph_bytes_value(stream_interface);
         if (HAILO_SUCCESS != max_periph_bytes_from_hef.status()) {
@@ -177,6 +212,9 @@ protected:
 
     LayerInfo m_layer_info;
 
+    // The stream name as passed to the per-frame traces (interned once, so tracing a frame doesn't build a string).
+    trace_string_id_t m_trace_name;
+
 private:
 
     EventPtr m_core_op_activated_event;
@@ -218,6 +256,35 @@ public:
         return HAILO_INVALID_OPERATION;
     }
 
+    // Use by the scheduler to launch a burst of transfers_count transfers on the given activated device.
+    virtual hailo_status launch_transfers(const device_id_t &device_id, size_t transfers_count)
+    {
+        for (size_t i = 0; i < transfers_count; i++) {
+            auto status = launch_transfer(device_id);
+            if (HAILO_SUCCESS != status) {
+                return status;
+            }
+        }
+        return HAILO_SUCCESS;
+    }
+
+    // Use by the scheduler to prepare the next transfers_count transfers on the given device, before the core-op is
+    // activated on it (while another core-op is running). Only host side work is done (e.g. mapping the buffers).
+    virtual hailo_status prepare_transfers(const device_id_t &device_id, size_t transfers_count)
+    {
+        (void)device_id;
+        (void)transfers_count;
+        return HAILO_SUCCESS;
+    }
+
+    // Prepares a transfer that will be launched after the stream is activated (see prepare_transfers).
+    virtual hailo_status prepare_async_transfer(TransferRequest &transfer_request, bool is_first_transfer)
+    {
+        (void)transfer_request;
+        (void)is_first_transfer;
+        return HAILO_SUCCESS;
+    }
+
     virtual hailo_status read(MemoryView buffer) override;
     virtual hailo_status read(void *buffer, size_t size) override;
 
@@ -229,6 +296,10 @@ public:
 
     virtual hailo_status read_async(TransferRequest &&transfer_request);
 
+    // Launches all transfer requests as a single burst (if supported by the stream). On return, transfer_requests
+    // contains the requests that weren't launched (empty on success).
+    virtual hailo_status read_async_batch(std::vector<TransferRequest> &transfer_requests);
+
     virtual EventPtr &get_core_op_activated_event() override;
     virtual bool is_scheduled() override;
 
@@ -252,6 +323,7 @@ protected:
         assert(1 == stream_infos.size());
         m_stream_info = stream_infos[0];
         m_quant_infos = m_layer_info.quant_infos;
+        m_trace_name = TraceStrings::get_id(m_stream_info.name);
 
         auto max_periph_bytes_from_hef = HefConfigurator::max_periph_bytes_value(stream_interface);
         if (HAILO_SUCCESS != max_periph_bytes_from_hef.status()) {
@@ -276,6 +348,9 @@ protected:
 
     LayerInfo m_layer_info;
 
+    // The stream name as passed to the per-frame traces (interned once, so tracing a frame doesn't build a string).
+    trace_string_id_t m_trace_name;
+
 private:
     EventPtr m_core_op_activated_event;
 };
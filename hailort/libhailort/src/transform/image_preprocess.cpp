@@ -0,0 +1,434 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file image_preprocess.cpp
+ * @brief Host image pre-process
+ *
+ * The row kernels are written so the compiler vectorizes them (no data dependent branches, fixed point arithmetic over
+ * contiguous planar rows), like the post-process kernels in net_flow/ops/vectorized_kernels.hpp.
+ **/
+
+#include "transform/image_preprocess.hpp"
+
+#include "hailo/hailort_common.hpp"
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+
+namespace hailort
+{
+
+// Bilinear weights are fixed point with INTERPOLATION_BITS fraction bits. A horizontally interpolated sample takes
+// 8 + INTERPOLATION_BITS bits, and a vertically interpolated one 8 + (2 * INTERPOLATION_BITS) bits, so uint32_t holds both.
+static const uint32_t INTERPOLATION_BITS = 11;
+static const uint32_t INTERPOLATION_ONE = 1 << INTERPOLATION_BITS;
+
+static inline uint8_t clamp_to_uint8(int32_t value)
+{
+    return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+// BT.601 limited range YUV to RGB, on planar rows
+static void yuv_to_rgb(const uint8_t *__restrict y_row, const uint8_t *__restrict u_row,
+    const uint8_t *__restrict v_row, uint8_t *__restrict r_row, uint8_t *__restrict g_row,
+    uint8_t *__restrict b_row, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        const int32_t c = 298 * (static_cast<int32_t>(y_row[i]) - 16);
+        const int32_t d = static_cast<int32_t>(u_row[i]) - 128;
+        const int32_t e = static_cast<int32_t>(v_row[i]) - 128;
+        r_row[i] = clamp_to_uint8((c + (409 * e) + 128) >> 8);
+        g_row[i] = clamp_to_uint8((c - (100 * d) - (208 * e) + 128) >> 8);
+        b_row[i] = clamp_to_uint8((c + (516 * d) + 128) >> 8);
+    }
+}
+
+static void horizontal_interpolation(const uint8_t *__restrict src_row, const uint32_t *__restrict offsets0,
+    const uint32_t *__restrict offsets1, const uint32_t *__restrict right_weights, uint32_t *__restrict dst,
+    uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        dst[i] = (src_row[offsets0[i]] * (INTERPOLATION_ONE - right_weights[i])) + (src_row[offsets1[i]] * right_weights[i]);
+    }
+}
+
+static void vertical_interpolation(const uint32_t *__restrict top_row, const uint32_t *__restrict bottom_row,
+    uint32_t bottom_weight, uint8_t *__restrict dst, uint32_t count)
+{
+    const uint32_t top_weight = INTERPOLATION_ONE - bottom_weight;
+    const uint32_t rounding = 1u << ((2 * INTERPOLATION_BITS) - 1);
+    for (uint32_t i = 0; i < count; i++) {
+        dst[i] = static_cast<uint8_t>(((top_row[i] * top_weight) + (bottom_row[i] * bottom_weight) + rounding) >>
+            (2 * INTERPOLATION_BITS));
+    }
+}
+
+static void interleave(const uint8_t *__restrict channel_row, uint8_t *__restrict dst, uint32_t dst_stride,
+    uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        dst[i * dst_stride] = channel_row[i];
+    }
+}
+
+/**
+ * Maps the dst_size destination positions onto the samples of a channel, which has a sample every @a subsampling
+ * pixels. Pixel centers are aligned (like OpenCV's resize), and chroma samples are centered between the pixels they
+ * cover. Samples outside of the crop aren't used.
+ */
+static ImagePreprocessContext::AxisMap create_axis_map(uint32_t crop_offset, uint32_t crop_size, uint32_t dst_size,
+    uint32_t subsampling, uint32_t sample_stride, bool is_bilinear)
+{
+    ImagePreprocessContext::AxisMap map;
+    map.offset0.resize(dst_size);
+    map.offset1.resize(dst_size);
+    map.weight.resize(dst_size);
+
+    const uint32_t first_sample = crop_offset / subsampling;
+    const uint32_t last_sample = (crop_offset + crop_size - 1) / subsampling;
+    for (uint32_t i = 0; i < dst_size; i++) {
+        // The center of i in source pixels, in fixed point: crop_offset + ((i + 0.5) * crop_size / dst_size)
+        const int64_t center = (static_cast<int64_t>(crop_offset) * INTERPOLATION_ONE) +
+            (((2 * static_cast<int64_t>(i)) + 1) * crop_size * INTERPOLATION_ONE) / (2 * static_cast<int64_t>(dst_size));
+        uint32_t sample0 = 0;
+        uint32_t sample1 = 0;
+        uint32_t weight = 0;
+        if (is_bilinear) {
+            const int64_t position = std::max<int64_t>((center / subsampling) - (INTERPOLATION_ONE / 2),
+                static_cast<int64_t>(first_sample) * INTERPOLATION_ONE);
+            sample0 = std::min(static_cast<uint32_t>(position >> INTERPOLATION_BITS), last_sample);
+            sample1 = std::min(sample0 + 1, last_sample);
+            weight = (sample0 < last_sample) ? static_cast<uint32_t>(position & (INTERPOLATION_ONE - 1)) : 0;
+        } else {
+            sample0 = std::max(std::min(static_cast<uint32_t>((center / subsampling) >> INTERPOLATION_BITS), last_sample),
+                first_sample);
+            sample1 = sample0;
+        }
+        map.offset0[i] = sample0 * sample_stride;
+        map.offset1[i] = sample1 * sample_stride;
+        map.weight[i] = weight;
+    }
+    return map;
+}
+
+static const char *color_format_str(hailo_image_color_format_t color_format)
+{
+    switch (color_format) {
+    case HAILO_IMAGE_COLOR_FORMAT_RGB:
+        return "RGB";
+    case HAILO_IMAGE_COLOR_FORMAT_BGR:
+        return "BGR";
+    case HAILO_IMAGE_COLOR_FORMAT_NV12:
+        return "NV12";
+    case HAILO_IMAGE_COLOR_FORMAT_I420:
+        return "I420";
+    case HAILO_IMAGE_COLOR_FORMAT_YUY2:
+        return "YUY2";
+    default:
+        return "Nan";
+    }
+}
+
+static std::array<ImagePreprocessContext::SrcChannel, ImagePreprocessContext::CHANNELS_COUNT> get_src_channels(
+    const hailo_image_preprocess_params_t &params)
+{
+    const uint32_t row_stride = HailoRTCommon::get_image_row_stride(params);
+    const size_t luma_plane_size = static_cast<size_t>(row_stride) * params.height;
+    switch (params.color_format) {
+    case HAILO_IMAGE_COLOR_FORMAT_RGB:
+        return {{{0, 3, row_stride, 1, 1}, {1, 3, row_stride, 1, 1}, {2, 3, row_stride, 1, 1}}};
+    case HAILO_IMAGE_COLOR_FORMAT_BGR:
+        return {{{2, 3, row_stride, 1, 1}, {1, 3, row_stride, 1, 1}, {0, 3, row_stride, 1, 1}}};
+    case HAILO_IMAGE_COLOR_FORMAT_NV12:
+        return {{{0, 1, row_stride, 1, 1}, {luma_plane_size, 2, row_stride, 2, 2},
+            {luma_plane_size + 1, 2, row_stride, 2, 2}}};
+    case HAILO_IMAGE_COLOR_FORMAT_I420:
+    {
+        const uint32_t chroma_row_stride = (row_stride + 1) / 2;
+        const size_t chroma_plane_size = static_cast<size_t>(chroma_row_stride) * ((params.height + 1) / 2);
+        return {{{0, 1, row_stride, 1, 1}, {luma_plane_size, 1, chroma_row_stride, 2, 2},
+            {luma_plane_size + chroma_plane_size, 1, chroma_row_stride, 2, 2}}};
+    }
+    case HAILO_IMAGE_COLOR_FORMAT_YUY2:
+        return {{{0, 2, row_stride, 1, 1}, {1, 4, row_stride, 2, 1}, {3, 4, row_stride, 2, 1}}};
+    default:
+        assert(false);
+        return {};
+    }
+}
+
+bool ImagePreprocessContext::is_dst_layout_supported(const hailo_3d_image_shape_t &dst_image_shape,
+    const hailo_3d_image_shape_t &dst_padded_shape, const hailo_format_t &dst_format)
+{
+    const bool is_supported_order = (HAILO_FORMAT_ORDER_NHWC == dst_format.order) ||
+        (HAILO_FORMAT_ORDER_FCR == dst_format.order) || (HAILO_FORMAT_ORDER_NHCW == dst_format.order);
+    return is_supported_order && (HAILO_FORMAT_TYPE_UINT8 == dst_format.type) &&
+        (0 == (dst_format.flags & HAILO_FORMAT_FLAGS_TRANSPOSED)) && (CHANNELS_COUNT == dst_image_shape.features) &&
+        (dst_padded_shape.height == dst_image_shape.height) && (dst_padded_shape.width >= dst_image_shape.width) &&
+        (dst_padded_shape.features >= dst_image_shape.features);
+}
+
+Expected<std::unique_ptr<ImagePreprocessContext>> ImagePreprocessContext::create(const hailo_image_preprocess_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &dst_padded_shape,
+    const hailo_format_t &dst_format)
+{
+    CHECK_AS_EXPECTED((HAILO_IMAGE_COLOR_FORMAT_NONE < params.color_format) &&
+        (params.color_format <= HAILO_IMAGE_COLOR_FORMAT_YUY2), HAILO_INVALID_ARGUMENT,
+        "Invalid image pre-process color format {}", static_cast<int>(params.color_format));
+    CHECK_AS_EXPECTED((0 < params.width) && (0 < params.height), HAILO_INVALID_ARGUMENT,
+        "Image pre-process source size must not be empty ({}x{})", params.width, params.height);
+    CHECK_AS_EXPECTED(is_dst_layout_supported(dst_image_shape, dst_padded_shape, dst_format), HAILO_INVALID_ARGUMENT,
+        "Image pre-process requires an 8 bit RGB input with NHWC, FCR or NHCW layout");
+
+    hailo_image_preprocess_params_t packed_params = params;
+    packed_params.row_stride = 0;
+    CHECK_AS_EXPECTED(HailoRTCommon::get_image_row_stride(params) >= HailoRTCommon::get_image_row_stride(packed_params),
+        HAILO_INVALID_ARGUMENT, "Image pre-process row stride {} is smaller than a row", params.row_stride);
+
+    hailo_image_rectangle_t crop = params.crop;
+    if ((0 == crop.width) || (0 == crop.height)) {
+        crop = {0, 0, params.width, params.height};
+    }
+    CHECK_AS_EXPECTED((crop.x < params.width) && (crop.width <= (params.width - crop.x)) &&
+        (crop.y < params.height) && (crop.height <= (params.height - crop.y)), HAILO_INVALID_ARGUMENT,
+        "Image pre-process crop ({},{} {}x{}) exceeds the image ({}x{})", crop.x, crop.y, crop.width, crop.height,
+        params.width, params.height);
+
+    hailo_image_rectangle_t content = {0, 0, dst_image_shape.width, dst_image_shape.height};
+    if (HAILO_IMAGE_RESIZE_MODE_LETTERBOX == params.resize_mode) {
+        const uint64_t width_by_height = static_cast<uint64_t>(crop.width) * dst_image_shape.height;
+        const uint64_t height_by_width = static_cast<uint64_t>(crop.height) * dst_image_shape.width;
+        if (width_by_height <= height_by_width) {
+            // The scale is bounded by the height
+            content.width = static_cast<uint32_t>((width_by_height + (crop.height / 2)) / crop.height);
+        } else {
+            content.height = static_cast<uint32_t>((height_by_width + (crop.width / 2)) / crop.width);
+        }
+        content.width = std::max(std::min(content.width, dst_image_shape.width), 1u);
+        content.height = std::max(std::min(content.height, dst_image_shape.height), 1u);
+        content.x = (dst_image_shape.width - content.width) / 2;
+        content.y = (dst_image_shape.height - content.height) / 2;
+    } else {
+        CHECK_AS_EXPECTED(HAILO_IMAGE_RESIZE_MODE_STRETCH == params.resize_mode, HAILO_INVALID_ARGUMENT,
+            "Invalid image pre-process resize mode {}", static_cast<int>(params.resize_mode));
+    }
+    CHECK_AS_EXPECTED((HAILO_IMAGE_INTERPOLATION_BILINEAR == params.interpolation) ||
+        (HAILO_IMAGE_INTERPOLATION_NEAREST == params.interpolation), HAILO_INVALID_ARGUMENT,
+        "Invalid image pre-process interpolation {}", static_cast<int>(params.interpolation));
+
+    DstLayout dst_layout = {};
+    dst_layout.row_stride = dst_padded_shape.width * dst_padded_shape.features;
+    dst_layout.frame_size = static_cast<size_t>(dst_layout.row_stride) * dst_padded_shape.height;
+    dst_layout.has_padding = (dst_padded_shape.width != dst_image_shape.width) ||
+        (dst_padded_shape.features != dst_image_shape.features);
+    if (HAILO_FORMAT_ORDER_NHCW == dst_format.order) {
+        dst_layout.pixel_stride = 1;
+        dst_layout.channel_stride = dst_padded_shape.width;
+    } else {
+        dst_layout.pixel_stride = dst_padded_shape.features;
+        dst_layout.channel_stride = 1;
+    }
+
+    // Without scaling (and chroma subsampling), bilinear interpolation samples exactly the source pixels
+    const auto src_channels = get_src_channels(params);
+    const bool is_subsampled = (1 != src_channels[1].subsampling_x) || (1 != src_channels[1].subsampling_y);
+    const bool is_bilinear = (HAILO_IMAGE_INTERPOLATION_BILINEAR == params.interpolation) &&
+        (is_subsampled || (crop.width != content.width) || (crop.height != content.height));
+
+    std::array<AxisMap, CHANNELS_COUNT> x_maps;
+    std::array<AxisMap, CHANNELS_COUNT> y_maps;
+    for (uint32_t channel = 0; channel < CHANNELS_COUNT; channel++) {
+        const auto &src_channel = src_channels[channel];
+        x_maps[channel] = create_axis_map(crop.x, crop.width, content.width, src_channel.subsampling_x,
+            src_channel.sample_stride, is_bilinear);
+        y_maps[channel] = create_axis_map(crop.y, crop.height, content.height, src_channel.subsampling_y, 1,
+            is_bilinear);
+    }
+
+    auto context = make_unique_nothrow<ImagePreprocessContext>(params, crop, dst_image_shape, content, dst_layout,
+        src_channels, std::move(x_maps), std::move(y_maps), is_bilinear);
+    CHECK_NOT_NULL_AS_EXPECTED(context, HAILO_OUT_OF_HOST_MEMORY);
+
+    return context;
+}
+
+ImagePreprocessContext::ImagePreprocessContext(const hailo_image_preprocess_params_t &params,
+    const hailo_image_rectangle_t &crop, const hailo_3d_image_shape_t &dst_image_shape,
+    const hailo_image_rectangle_t &content, const DstLayout &dst_layout,
+    const std::array<SrcChannel, CHANNELS_COUNT> &src_channels, std::array<AxisMap, CHANNELS_COUNT> &&x_maps,
+    std::array<AxisMap, CHANNELS_COUNT> &&y_maps, bool is_bilinear) :
+        m_params(params),
+        m_crop(crop),
+        m_dst_image_shape(dst_image_shape),
+        m_content(content),
+        m_dst_layout(dst_layout),
+        m_src_channels(src_channels),
+        m_x_maps(std::move(x_maps)),
+        m_y_maps(std::move(y_maps)),
+        m_is_bilinear(is_bilinear),
+        m_is_yuv((HAILO_IMAGE_COLOR_FORMAT_RGB != params.color_format) && (HAILO_IMAGE_COLOR_FORMAT_BGR != params.color_format)),
+        m_src_frame_size(HailoRTCommon::get_image_frame_size(params))
+{
+    for (uint32_t channel = 0; channel < CHANNELS_COUNT; channel++) {
+        if (m_is_bilinear) {
+            m_horizontal_rows[channel][0].resize(content.width);
+            m_horizontal_rows[channel][1].resize(content.width);
+        }
+        m_horizontal_rows_indices[channel] = {INVALID_ROW, INVALID_ROW};
+        m_channel_rows[channel].resize(content.width);
+        m_rgb_rows[channel].resize(content.width);
+    }
+}
+
+const uint32_t *ImagePreprocessContext::get_horizontal_row(const uint8_t *src, uint32_t channel, uint32_t row,
+    uint32_t row_to_keep)
+{
+    auto &indices = m_horizontal_rows_indices[channel];
+    for (uint32_t slot = 0; slot < 2; slot++) {
+        if (row == indices[slot]) {
+            return m_horizontal_rows[channel][slot].data();
+        }
+    }
+
+    const uint32_t slot = (row_to_keep == indices[0]) ? 1 : 0;
+    indices[slot] = row;
+    uint32_t *dst = m_horizontal_rows[channel][slot].data();
+
+    const auto &src_channel = m_src_channels[channel];
+    const auto &x_map = m_x_maps[channel];
+    horizontal_interpolation(src + src_channel.offset + (static_cast<size_t>(row) * src_channel.row_stride),
+        x_map.offset0.data(), x_map.offset1.data(), x_map.weight.data(), dst, m_content.width);
+    return dst;
+}
+
+void ImagePreprocessContext::resize_channel_row(const uint8_t *src, uint32_t channel, uint32_t content_row, uint8_t *dst)
+{
+    const auto &y_map = m_y_maps[channel];
+    if (m_is_bilinear) {
+        const uint32_t top = y_map.offset0[content_row];
+        const uint32_t bottom = y_map.offset1[content_row];
+        const uint32_t *top_row = get_horizontal_row(src, channel, top, bottom);
+        const uint32_t *bottom_row = get_horizontal_row(src, channel, bottom, top);
+        vertical_interpolation(top_row, bottom_row, y_map.weight[content_row], dst, m_content.width);
+        return;
+    }
+
+    const auto &src_channel = m_src_channels[channel];
+    const auto &x_map = m_x_maps[channel];
+    const uint8_t *src_row = src + src_channel.offset +
+        (static_cast<size_t>(y_map.offset0[content_row]) * src_channel.row_stride);
+    for (uint32_t x = 0; x < m_content.width; x++) {
+        dst[x] = src_row[x_map.offset0[x]];
+    }
+}
+
+void ImagePreprocessContext::write_content_row(uint8_t *dst_row, uint32_t content_row, const uint8_t *src)
+{
+    // Planar destinations (NHCW) are written directly, other layouts are interleaved from m_rgb_rows
+    const bool is_planar_dst = (1 == m_dst_layout.pixel_stride);
+    std::array<uint8_t*, CHANNELS_COUNT> rgb_rows;
+    for (uint32_t channel = 0; channel < CHANNELS_COUNT; channel++) {
+        rgb_rows[channel] = is_planar_dst ?
+            (dst_row + (channel * m_dst_layout.channel_stride) + m_content.x) : m_rgb_rows[channel].data();
+    }
+
+    if (m_is_yuv) {
+        for (uint32_t channel = 0; channel < CHANNELS_COUNT; channel++) {
+            resize_channel_row(src, channel, content_row, m_channel_rows[channel].data());
+        }
+        yuv_to_rgb(m_channel_rows[0].data(), m_channel_rows[1].data(), m_channel_rows[2].data(),
+            rgb_rows[0], rgb_rows[1], rgb_rows[2], m_content.width);
+    } else {
+        for (uint32_t channel = 0; channel < CHANNELS_COUNT; channel++) {
+            resize_channel_row(src, channel, content_row, rgb_rows[channel]);
+        }
+    }
+
+    if (!is_planar_dst) {
+        uint8_t *content_start = dst_row + (m_content.x * m_dst_layout.pixel_stride);
+        for (uint32_t channel = 0; channel < CHANNELS_COUNT; channel++) {
+            interleave(rgb_rows[channel], content_start + (channel * m_dst_layout.channel_stride),
+                m_dst_layout.pixel_stride, m_content.width);
+        }
+    }
+}
+
+void ImagePreprocessContext::fill_pixels(uint8_t *dst_row, uint32_t first_pixel, uint32_t pixels_count) const
+{
+    if ((CHANNELS_COUNT == m_dst_layout.pixel_stride) && (1 == m_dst_layout.channel_stride)) {
+        memset(dst_row + (first_pixel * CHANNELS_COUNT), m_params.pad_value, pixels_count * CHANNELS_COUNT);
+        return;
+    }
+    for (uint32_t channel = 0; channel < CHANNELS_COUNT; channel++) {
+        uint8_t *dst = dst_row + (channel * m_dst_layout.channel_stride) + (first_pixel * m_dst_layout.pixel_stride);
+        for (uint32_t x = 0; x < pixels_count; x++) {
+            dst[x * m_dst_layout.pixel_stride] = m_params.pad_value;
+        }
+    }
+}
+
+hailo_status ImagePreprocessContext::process(const MemoryView src, MemoryView dst)
+{
+    CHECK(src.size() == m_src_frame_size, HAILO_INVALID_ARGUMENT,
+        "src size must be {}. passed size - {}", m_src_frame_size, src.size());
+    CHECK(dst.size() == m_dst_layout.frame_size, HAILO_INVALID_ARGUMENT,
+        "dst_size must be {}. passed size - {}", m_dst_layout.frame_size, dst.size());
+
+    // The cached rows belong to the previous image
+    for (auto &indices : m_horizontal_rows_indices) {
+        indices = {INVALID_ROW, INVALID_ROW};
+    }
+
+    const uint32_t content_right = m_content.x + m_content.width;
+    const uint32_t content_bottom = m_content.y + m_content.height;
+    for (uint32_t y = 0; y < m_dst_image_shape.height; y++) {
+        uint8_t *dst_row = dst.data() + (static_cast<size_t>(y) * m_dst_layout.row_stride);
+        if (m_dst_layout.has_padding) {
+            memset(dst_row, 0, m_dst_layout.row_stride);
+        }
+
+        if ((y < m_content.y) || (y >= content_bottom)) {
+            fill_pixels(dst_row, 0, m_dst_image_shape.width);
+            continue;
+        }
+        fill_pixels(dst_row, 0, m_content.x);
+        write_content_row(dst_row, y - m_content.y, src.data());
+        fill_pixels(dst_row, content_right, m_dst_image_shape.width - content_right);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+size_t ImagePreprocessContext::get_src_frame_size() const
+{
+    return m_src_frame_size;
+}
+
+size_t ImagePreprocessContext::get_dst_frame_size() const
+{
+    return m_dst_layout.frame_size;
+}
+
+std::string ImagePreprocessContext::description() const
+{
+    std::stringstream description;
+    description << "ImagePreprocess - " << color_format_str(m_params.color_format) << " " << m_params.width << "x" <<
+        m_params.height;
+    if ((m_crop.width != m_params.width) || (m_crop.height != m_params.height)) {
+        description << " crop(" << m_crop.x << "," << m_crop.y << " " << m_crop.width << "x" << m_crop.height << ")";
+    }
+    description << " -> RGB " << m_dst_image_shape.width << "x" << m_dst_image_shape.height;
+    if ((m_content.width != m_dst_image_shape.width) || (m_content.height != m_dst_image_shape.height)) {
+        description << " letterbox(" << m_content.width << "x" << m_content.height << ")";
+    }
+    description << (m_is_bilinear ? " bilinear" : " nearest");
+    return description.str();
+}
+
+} /* namespace hailort */
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file image_preprocess.hpp
+ * @brief Host image pre-process - crop, resize, letterbox and color conversion of source images into an input frame
+ **/
+
+#ifndef _HAILO_IMAGE_PREPROCESS_HPP_
+#define _HAILO_IMAGE_PREPROCESS_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace hailort
+{
+
+/**
+ * Converts source images (see ::hailo_image_preprocess_params_t) into 8 bit RGB frames of the network's input shape.
+ * The frame is written directly in the destination layout - NHWC (also with padded features, e.g. FCR) or NHCW, with
+ * padded width - so for the common device input layouts no other transformation is needed.
+ *
+ * The image is handled as 3 channels (R, G, B or Y, U, V), each with its own sampling of the source buffer, so all the
+ * color formats share the same kernels. Every destination row is produced in one pass:
+ *  - The source rows it depends on are interpolated horizontally, per channel. Consecutive destination rows share
+ *    source rows, so the last 2 rows of each channel are cached.
+ *  - The vertical interpolation produces planar channel rows of the resized width.
+ *  - YUV channels are converted to RGB (after resizing, so only the destination pixels are converted).
+ *  - The planar rows are written to the destination layout.
+ */
+class ImagePreprocessContext final
+{
+public:
+    /**
+     * @param[in] params              The source images parameters.
+     * @param[in] dst_image_shape     The network's input shape - the RGB image that is written (features must be 3).
+     * @param[in] dst_padded_shape    The shape of the destination buffer, including the padding of the image shape.
+     * @param[in] dst_format          The format of the destination buffer (see is_dst_layout_supported()).
+     */
+    static Expected<std::unique_ptr<ImagePreprocessContext>> create(const hailo_image_preprocess_params_t &params,
+        const hailo_3d_image_shape_t &dst_image_shape, const hailo_3d_image_shape_t &dst_padded_shape,
+        const hailo_format_t &dst_format);
+
+    static bool is_dst_layout_supported(const hailo_3d_image_shape_t &dst_image_shape,
+        const hailo_3d_image_shape_t &dst_padded_shape, const hailo_format_t &dst_format);
+
+    hailo_status process(const MemoryView src, MemoryView dst);
+
+    size_t get_src_frame_size() const;
+    size_t get_dst_frame_size() const;
+    std::string description() const;
+
+    static const uint32_t CHANNELS_COUNT = 3;
+
+    // Offsets (in bytes) between the elements of the destination buffer
+    struct DstLayout {
+        uint32_t pixel_stride;
+        uint32_t channel_stride;
+        uint32_t row_stride;
+        size_t frame_size;
+        bool has_padding;
+    };
+
+    // Where the samples of a channel are in the source buffer
+    struct SrcChannel {
+        size_t offset;
+        uint32_t sample_stride;
+        uint32_t row_stride;
+        uint32_t subsampling_x;
+        uint32_t subsampling_y;
+    };
+
+    // Source positions of a resized axis of a channel - offset0/offset1 are the neighbouring source samples (in bytes
+    // for the x axis, in rows for the y axis), and weight is the (fixed point) weight of offset1
+    struct AxisMap {
+        std::vector<uint32_t> offset0;
+        std::vector<uint32_t> offset1;
+        std::vector<uint32_t> weight;
+    };
+
+    ImagePreprocessContext(const hailo_image_preprocess_params_t &params, const hailo_image_rectangle_t &crop,
+        const hailo_3d_image_shape_t &dst_image_shape, const hailo_image_rectangle_t &content, const DstLayout &dst_layout,
+        const std::array<SrcChannel, CHANNELS_COUNT> &src_channels, std::array<AxisMap, CHANNELS_COUNT> &&x_maps,
+        std::array<AxisMap, CHANNELS_COUNT> &&y_maps, bool is_bilinear);
+
+private:
+    const uint32_t *get_horizontal_row(const uint8_t *src, uint32_t channel, uint32_t row, uint32_t row_to_keep);
+    void resize_channel_row(const uint8_t *src, uint32_t channel, uint32_t content_row, uint8_t *dst);
+    void write_content_row(uint8_t *dst_row, uint32_t content_row, const uint8_t *src);
+    void fill_pixels(uint8_t *dst_row, uint32_t first_pixel, uint32_t pixels_count) const;
+
+    static const uint32_t INVALID_ROW = UINT32_MAX;
+
+    const hailo_image_preprocess_params_t m_params;
+    const hailo_image_rectangle_t m_crop;
+    const hailo_3d_image_shape_t m_dst_image_shape;
+    // The resized image inside the destination frame (differs from the frame when letterboxing)
+    const hailo_image_rectangle_t m_content;
+    const DstLayout m_dst_layout;
+    const std::array<SrcChannel, CHANNELS_COUNT> m_src_channels;
+    const std::array<AxisMap, CHANNELS_COUNT> m_x_maps;
+    const std::array<AxisMap, CHANNELS_COUNT> m_y_maps;
+    const bool m_is_bilinear;
+    const bool m_is_yuv;
+    const size_t m_src_frame_size;
+
+    // 2 cached horizontally interpolated rows per channel
+    std::array<std::array<std::vector<uint32_t>, 2>, CHANNELS_COUNT> m_horizontal_rows;
+    std::array<std::array<uint32_t, 2>, CHANNELS_COUNT> m_horizontal_rows_indices;
+    std::array<std::vector<uint8_t>, CHANNELS_COUNT> m_channel_rows;
+    std::array<std::vector<uint8_t>, CHANNELS_COUNT> m_rgb_rows;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_IMAGE_PREPROCESS_HPP_ */
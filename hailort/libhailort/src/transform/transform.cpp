@@ -12,8 +12,10 @@
 #include "hailo/expected.hpp"
 #include "hailo/hailort_common.hpp"
 #include "hailo/quantization.hpp"
+#include "hailo/float16.hpp"
 #include "hailo/hailort_defaults.hpp"
 #include "net_flow/ops/nms_post_process.hpp"
+#include "net_flow/ops/vectorized_kernels.hpp"
 
 #include "common/compiler_extensions_compat.hpp"
 #include "common/logger_macros.hpp"
@@ -43,8 +45,8 @@ Expected<bool> TransformContextUtils::should_quantize_by_type(const hailo_stream
     const hailo_format_type_t &src_format_type, const hailo_format_type_t &dst_format_type)
 {
     if (HAILO_H2D_STREAM == stream_direction) {
-        CHECK_AS_EXPECTED(HAILO_FORMAT_TYPE_FLOAT32 != dst_format_type, HAILO_INVALID_ARGUMENT,
-            "dst type cant be {} on input quantization", HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
+        CHECK_AS_EXPECTED(!HailoRTCommon::is_float_type(dst_format_type), HAILO_INVALID_ARGUMENT,
+            "dst type cant be {} on input quantization", HailoRTCommon::get_format_type_str(dst_format_type));
         CHECK_AS_EXPECTED(!((HAILO_FORMAT_TYPE_UINT8 == dst_format_type) && (HAILO_FORMAT_TYPE_UINT16 == src_format_type)),
             HAILO_INVALID_ARGUMENT, "src type is {}, while the model compiled for type {}. Input quantization is impossible with this src type.",
             HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8));
@@ -55,8 +57,8 @@ Expected<bool> TransformContextUtils::should_quantize_by_type(const hailo_stream
         }
         return ((src_format_type != HAILO_FORMAT_TYPE_AUTO) && (dst_format_type != src_format_type));
     } else {
-        CHECK_AS_EXPECTED(HAILO_FORMAT_TYPE_FLOAT32 != src_format_type, HAILO_INVALID_ARGUMENT,
-            "src type cant be {} on output de-quantization", HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
+        CHECK_AS_EXPECTED(!HailoRTCommon::is_float_type(src_format_type), HAILO_INVALID_ARGUMENT,
+            "src type cant be {} on output de-quantization", HailoRTCommon::get_format_type_str(src_format_type));
         CHECK_AS_EXPECTED(!((HAILO_FORMAT_TYPE_UINT8 == dst_format_type) && (HAILO_FORMAT_TYPE_UINT16 == src_format_type)),
             HAILO_INVALID_ARGUMENT, "The model compiled for type {}, while the dst type is {}. Output de-quantization is impossible to this dst type",
             HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8));
@@ -789,26 +791,8 @@ hailo_status transform__d2h_argmax_NHCW_to_NHW(const T *src_ptr, const hailo_3d_
     const auto src_row_size = src_image_shape.width * src_image_shape.features;
     const auto dst_row_size = dst_image_shape.width;
     for (uint32_t r = 0; r < src_image_shape.height; r++) {
-        // For each row, we iterate on all columns, and find the max feature. It can be implemented better by iteratre
-        // over all features, and on each iteration save the max value for each column.
-        const T *src_row = src_ptr + (r * src_row_size);
-        T *dst_row = dst_ptr + (r * dst_row_size);
-        for (uint32_t w = 0; w < dst_image_shape.width; w++) {
-            const T *offset_in_row = src_row + w;
-            T max_index = 0;
-            T max_value = *offset_in_row;
-
-            for (uint32_t c = 1; c < src_image_shape.features; c++) {
-                offset_in_row += src_image_shape.width;
-                const auto &current_value = *offset_in_row;
-                if (current_value > max_value) {
-                    max_index = static_cast<T>(c);
-                    max_value = current_value;
-                }
-            }
-
-            dst_row[w] = max_index;
-        }
+        net_flow::VectorizedKernels::planar_argmax(src_ptr + (r * src_row_size), src_image_shape.width,
+            src_image_shape.features, dst_image_shape.width, dst_ptr + (r * dst_row_size));
     }
 
     return HAILO_SUCCESS;
@@ -897,6 +881,55 @@ hailo_status transform__h2d_RGB4_to_NHCW(const T *src_ptr, const hailo_3d_image_
     return HAILO_SUCCESS;
 }
 
+// Float16 buffers are converted in float32 chunks, so the bulk conversions (using the hardware instructions when
+// available) are used instead of converting the values one by one.
+static constexpr uint32_t FLOAT16_CONVERSION_CHUNK_SIZE = 256;
+
+template <typename Q>
+static void quantize_float16_buffer(const Float16 *src_ptr, Q *dst_ptr, uint32_t elements_count,
+    const hailo_quant_info_t &quant_info)
+{
+    std::array<float32_t, FLOAT16_CONVERSION_CHUNK_SIZE> values;
+    for (uint32_t start = 0; start < elements_count; start += FLOAT16_CONVERSION_CHUNK_SIZE) {
+        const uint32_t chunk_size = std::min(FLOAT16_CONVERSION_CHUNK_SIZE, elements_count - start);
+        Float16::convert(src_ptr + start, values.data(), chunk_size);
+        Quantization::quantize_input_buffer<float32_t, Q>(values.data(), dst_ptr + start, chunk_size, quant_info);
+    }
+}
+
+template <typename Q>
+static void dequantize_float16_buffer_in_place(Float16 *dst_ptr, uint32_t elements_count,
+    const hailo_quant_info_t &quant_info)
+{
+    static_assert(sizeof(Q) <= sizeof(Float16), "The quantized values must not be larger than the float16 values");
+    std::array<float32_t, FLOAT16_CONVERSION_CHUNK_SIZE> values;
+    // The chunks are converted from the end of the buffer, so the quantized values of the preceding chunks aren't
+    // overwritten before they are read.
+    uint32_t end = elements_count;
+    while (end > 0) {
+        const uint32_t start = (end > FLOAT16_CONVERSION_CHUNK_SIZE) ? (end - FLOAT16_CONVERSION_CHUNK_SIZE) : 0;
+        Quantization::dequantize_output_buffer<float32_t, Q>(reinterpret_cast<Q*>(dst_ptr) + start, values.data(),
+            end - start, quant_info);
+        Float16::convert(values.data(), dst_ptr + start, end - start);
+        end = start;
+    }
+}
+
+template <typename T>
+hailo_status InputTransformContext::quantize_float_stream(T *src_ptr, void *quant_buffer, uint32_t shape_size)
+{
+    if (HAILO_FORMAT_TYPE_UINT8 == m_dst_format.type) {
+        Quantization::quantize_input_buffer<T, uint8_t>(src_ptr, (uint8_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
+    }
+    else if (HAILO_FORMAT_TYPE_UINT16 == m_dst_format.type) {
+        Quantization::quantize_input_buffer<T, uint16_t>(src_ptr, (uint16_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
+    }
+    else {
+        return HAILO_INVALID_OPERATION;
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status InputTransformContext::quantize_stream(const void *src_ptr, void *quant_buffer)
 {
     auto shape_size = HailoRTCommon::get_shape_size(m_src_image_shape);
@@ -911,16 +944,20 @@ hailo_status InputTransformContext::quantize_stream(const void *src_ptr, void *q
             }
             break;
         case HAILO_FORMAT_TYPE_FLOAT32:
+            return quantize_float_stream<float32_t>((float32_t*)src_ptr, quant_buffer, shape_size);
+        case HAILO_FORMAT_TYPE_FLOAT16:
             if (HAILO_FORMAT_TYPE_UINT8 == m_dst_format.type) {
-                Quantization::quantize_input_buffer<float32_t, uint8_t>((float32_t*)src_ptr, (uint8_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
-            }
-            else if (HAILO_FORMAT_TYPE_UINT16 == m_dst_format.type) {
-                Quantization::quantize_input_buffer<float32_t, uint16_t>((float32_t*)src_ptr, (uint16_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
-            }
-            else {
+                quantize_float16_buffer<uint8_t>(static_cast<const Float16*>(src_ptr),
+                    static_cast<uint8_t*>(quant_buffer), shape_size, m_dst_quant_infos[0]);
+            } else if (HAILO_FORMAT_TYPE_UINT16 == m_dst_format.type) {
+                quantize_float16_buffer<uint16_t>(static_cast<const Float16*>(src_ptr),
+                    static_cast<uint16_t*>(quant_buffer), shape_size, m_dst_quant_infos[0]);
+            } else {
                 return HAILO_INVALID_OPERATION;
             }
             break;
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            return quantize_float_stream<BFloat16>((BFloat16*)src_ptr, quant_buffer, shape_size);
         default:
             LOGGER__ERROR("Invalid src-buffer's type format");
             return HAILO_INVALID_ARGUMENT;
@@ -928,6 +965,42 @@ hailo_status InputTransformContext::quantize_stream(const void *src_ptr, void *q
     return HAILO_SUCCESS;
 }
 
+template <typename T>
+hailo_status FrameOutputTransformContext::dequantize_float_stream(T *dst_ptr, uint32_t shape_size)
+{
+    /* if output layer is argmax - do not rescale */
+    if (HAILO_FORMAT_ORDER_NHW != m_dst_format.order) {
+        if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+            if (m_are_all_qps_the_same) {
+                Quantization::dequantize_output_buffer_in_place<T, uint8_t>(dst_ptr, shape_size, m_dst_quant_infos[0]);
+            } else {
+                dequantize_output_by_feature<T, uint8_t>(dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
+            }
+        }
+        else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+            if (m_are_all_qps_the_same) {
+                Quantization::dequantize_output_buffer_in_place<T, uint16_t>(dst_ptr, shape_size, m_dst_quant_infos[0]);
+            } else {
+                dequantize_output_by_feature<T, uint16_t>(dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
+            }
+        }
+        else {
+            return HAILO_INVALID_OPERATION;
+        }
+    } else {
+        if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+            cast_elements_inplace<T, uint8_t>(dst_ptr, shape_size);
+        }
+        else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+            cast_elements_inplace<T, uint16_t>(dst_ptr, shape_size);
+        }
+        else {
+            return HAILO_INVALID_OPERATION;
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
 {
     auto shape_size = HailoRTCommon::get_shape_size(m_dst_image_shape);
@@ -941,37 +1014,20 @@ hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
             }
             break;
         case HAILO_FORMAT_TYPE_FLOAT32:
-            /* if output layer is argmax - do not rescale */
-            if (HAILO_FORMAT_ORDER_NHW != m_dst_format.order) {
-                if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
-                    if (m_are_all_qps_the_same) {
-                        Quantization::dequantize_output_buffer_in_place<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size, m_dst_quant_infos[0]);
-                    } else {
-                        dequantize_output_by_feature<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
-                    }
-                }
-                else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
-                    if (m_are_all_qps_the_same) {
-                        Quantization::dequantize_output_buffer_in_place<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size, m_dst_quant_infos[0]);
-                    } else {
-                        dequantize_output_by_feature<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
-                    }
-                }
-                else {
-                    return HAILO_INVALID_OPERATION;
-                }
-            } else {
+            return dequantize_float_stream<float32_t>((float32_t*)dst_ptr, shape_size);
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            if ((HAILO_FORMAT_ORDER_NHW != m_dst_format.order) && m_are_all_qps_the_same) {
                 if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
-                    cast_elements_inplace<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size);
-                }
-                else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
-                    cast_elements_inplace<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size);
-                }
-                else {
-                    return HAILO_INVALID_OPERATION;
+                    dequantize_float16_buffer_in_place<uint8_t>((Float16*)dst_ptr, shape_size, m_dst_quant_infos[0]);
+                    return HAILO_SUCCESS;
+                } else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+                    dequantize_float16_buffer_in_place<uint16_t>((Float16*)dst_ptr, shape_size, m_dst_quant_infos[0]);
+                    return HAILO_SUCCESS;
                 }
             }
-            break;
+            return dequantize_float_stream<Float16>((Float16*)dst_ptr, shape_size);
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            return dequantize_float_stream<BFloat16>((BFloat16*)dst_ptr, shape_size);
         default:
             LOGGER__ERROR("Invalid dst-buffer's type format");
             return HAILO_INVALID_ARGUMENT;
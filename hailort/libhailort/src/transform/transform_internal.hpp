@@ -141,6 +141,8 @@ public:
     hailo_status transform_inner(const void *src_ptr, void *dst_ptr, MemoryView transpose_buffer);
 
     hailo_status quantize_stream(const void *dst_ptr);
+    template <typename T>
+    hailo_status dequantize_float_stream(T *dst_ptr, uint32_t shape_size);
 
 
     virtual hailo_status transform(const MemoryView src, MemoryView dst) override;
@@ -342,4 +342,27 @@ Expected<vdma::MappedBufferPtr> DmaStorage::get_dma_mapped_buffer(const std::str
     return Expected<vdma::MappedBufferPtr>(mapped_buffer->second);
 }
 
+bool DmaStorage::is_user_allocated() const
+{
+    return m_dma_able_buffer->is_user_allocated();
+}
+
+bool DmaStorage::is_dma_mapped(const std::string &device_id) const
+{
+    return m_mappings.end() != m_mappings.find(device_id);
+}
+
+hailo_status DmaStorage::set_dma_mapped_buffer(const std::string &device_id, vdma::MappedBufferPtr mapped_buffer)
+{
+    CHECK_ARG_NOT_NULL(mapped_buffer);
+    CHECK(mapped_buffer->user_address() == m_dma_able_buffer->user_address(), HAILO_INVALID_ARGUMENT,
+        "Mapped buffer doesn't match the storage buffer");
+    CHECK(mapped_buffer->size() == m_dma_able_buffer->size(), HAILO_INVALID_ARGUMENT,
+        "Mapped buffer size {} doesn't match the storage size {}", mapped_buffer->size(), m_dma_able_buffer->size());
+
+    const auto emplace_result = m_mappings.emplace(device_id, mapped_buffer);
+    CHECK(emplace_result.second, HAILO_INVALID_OPERATION, "Buffer is already mapped to {}", device_id);
+    return HAILO_SUCCESS;
+}
+
 } /* namespace hailort */
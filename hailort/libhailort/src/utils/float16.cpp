@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file float16.cpp
+ * @brief Bulk conversions of Float16, using the hardware conversion instructions when available
+ **/
+
+#include "hailo/float16.hpp"
+
+#if defined(__F16C__) && defined(__AVX__)
+#define F16C_CONVERSIONS
+#include <immintrin.h>
+#elif defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+// Without -mf16c, the F16C instructions are used if the cpu supports them (checked at runtime)
+#define F16C_CONVERSIONS
+#define F16C_RUNTIME_DISPATCH
+#include <immintrin.h>
+#include <cpuid.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#if defined(F16C_RUNTIME_DISPATCH)
+#define F16C_TARGET __attribute__((target("avx,f16c")))
+#else
+#define F16C_TARGET
+#endif
+
+
+namespace hailort
+{
+
+#if defined(F16C_CONVERSIONS)
+static bool is_f16c_supported()
+{
+#if defined(F16C_RUNTIME_DISPATCH)
+    // __builtin_cpu_supports("avx") also checks that the OS saves the AVX registers
+    static const bool is_supported = []() {
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        return (0 != __get_cpuid(1, &eax, &ebx, &ecx, &edx)) && (0 != (ecx & bit_F16C)) &&
+            (0 != __builtin_cpu_supports("avx"));
+    }();
+    return is_supported;
+#else
+    return true;
+#endif
+}
+
+F16C_TARGET
+static void convert_f16c(const float32_t *src, Float16 *dst, size_t count)
+{
+    size_t i = 0;
+    for (; (i + 8) <= count; i += 8) {
+        const __m128i half_values = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), half_values);
+    }
+    for (; i < count; i++) {
+        dst[i] = Float16::from_bits(static_cast<uint16_t>(_cvtss_sh(src[i], _MM_FROUND_TO_NEAREST_INT)));
+    }
+}
+
+F16C_TARGET
+static void convert_f16c(const Float16 *src, float32_t *dst, size_t count)
+{
+    size_t i = 0;
+    for (; (i + 8) <= count; i += 8) {
+        const __m128i half_values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half_values));
+    }
+    for (; i < count; i++) {
+        dst[i] = _cvtsh_ss(src[i].bits());
+    }
+}
+#endif
+
+void Float16::convert(const float32_t *src, Float16 *dst, size_t count)
+{
+    size_t i = 0;
+#if defined(F16C_CONVERSIONS)
+    if (is_f16c_supported()) {
+        convert_f16c(src, dst, count);
+        return;
+    }
+#elif defined(__aarch64__)
+    for (; (i + 4) <= count; i += 4) {
+        vst1_u16(reinterpret_cast<uint16_t*>(dst + i), vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = Float16(src[i]);
+    }
+}
+
+void Float16::convert(const Float16 *src, float32_t *dst, size_t count)
+{
+    size_t i = 0;
+#if defined(F16C_CONVERSIONS)
+    if (is_f16c_supported()) {
+        convert_f16c(src, dst, count);
+        return;
+    }
+#elif defined(__aarch64__)
+    for (; (i + 4) <= count; i += 4) {
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(reinterpret_cast<const uint16_t*>(src + i)))));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = static_cast<float32_t>(src[i]);
+    }
+}
+
+} /* namespace hailort */
@@ -16,6 +16,8 @@ namespace hailort
 // Needed for the linker
 const uint32_t HailoRTCommon::BBOX_PARAMS;
 const uint32_t HailoRTCommon::MASK_PARAMS;
+const uint32_t HailoRTCommon::DETECTION_PARAMS;
+const uint32_t HailoRTCommon::DETECTIONS_MASK_ALIGNMENT;
 const uint32_t HailoRTCommon::MAX_DEFUSED_LAYER_COUNT;
 const size_t HailoRTCommon::HW_DATA_ALIGNMENT;
 const uint32_t HailoRTCommon::MAX_NMS_BURST_SIZE;
@@ -50,6 +52,10 @@ uint32_t HailoRTCommon::get_nms_host_frame_size(const hailo_nms_shape_t &nms_sha
     auto shape_size = 0;
     if (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == format.order) {
         shape_size = get_nms_with_byte_mask_host_shape_size(nms_shape, format);
+    } else if (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS == format.order) {
+        shape_size = get_nms_detections_host_shape_size(nms_shape, format);
+    } else if (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS_WITH_BYTE_MASK == format.order) {
+        shape_size = get_nms_detections_with_byte_mask_host_shape_size(nms_shape, format);
     } else {
         shape_size = get_nms_host_shape_size(nms_shape);
     }
@@ -62,4 +68,31 @@ uint32_t HailoRTCommon::get_nms_host_frame_size(const hailo_nms_shape_t &nms_sha
     }
 }
 
+size_t HailoRTCommon::get_nms_detections_used_size(const uint8_t *buffer, size_t buffer_size, hailo_format_order_t order)
+{
+    if (!is_nms_detections(order) || (buffer_size < sizeof(uint32_t))) {
+        return buffer_size;
+    }
+
+    uint32_t detections_count = 0;
+    memcpy(&detections_count, buffer, sizeof(detections_count));
+    size_t used_size = sizeof(detections_count);
+    if (HAILO_FORMAT_ORDER_HAILO_NMS_DETECTIONS == order) {
+        used_size += static_cast<size_t>(detections_count) * sizeof(hailo_detection_t);
+        return std::min(used_size, buffer_size);
+    }
+
+    // Each detection is followed by its mask, so the detections are traversed to find the end of the last one.
+    for (uint32_t i = 0; i < detections_count; i++) {
+        used_size += sizeof(hailo_detection_t);
+        if ((used_size + sizeof(uint32_t)) > buffer_size) {
+            return buffer_size;
+        }
+        uint32_t mask_size = 0;
+        memcpy(&mask_size, buffer + used_size, sizeof(mask_size));
+        used_size += sizeof(mask_size) + mask_size;
+    }
+    return std::min(used_size, buffer_size);
+}
+
 } /* namespace hailort */
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file binary_trace_format.hpp
+ * @brief File format written by the BinaryTraceHandler (HAILO_TRACE=binary), and read by "hailortcli convert-trace".
+ *
+ * The file is built from:
+ *  1. BinaryTraceFileHeader.
+ *  2. BinaryTraceEvent records, grouped by the recording thread (so they are not sorted by timestamp).
+ *  3. A BinaryTraceEvent of type END, whose value is the amount of events dropped because a ring was full.
+ *  4. The strings table - for each interned string: uint32_t id, uint32_t length and the string bytes (without '\0').
+ *     Device ids, stream names and core-op names in the events are ids in this table.
+ * If the process didn't exit cleanly, the file may end after (2).
+ **/
+
+#ifndef _HAILO_BINARY_TRACE_FORMAT_HPP_
+#define _HAILO_BINARY_TRACE_FORMAT_HPP_
+
+#include <cstdint>
+
+namespace hailort
+{
+
+#define BINARY_TRACE_MAGIC ("HAILOTRC")
+#define BINARY_TRACE_MAGIC_SIZE (8)
+#define BINARY_TRACE_VERSION (1)
+#define BINARY_TRACE_INVALID_ID (UINT32_MAX)
+
+enum class BinaryTraceEventType : uint16_t {
+    END = 0,
+    ADD_DEVICE,
+    ADD_CORE_OP,
+    CREATE_INPUT_STREAM,
+    CREATE_OUTPUT_STREAM,
+    WRITE_FRAME,
+    INPUT_VDMA_DEQUEUE,
+    OUTPUT_VDMA_ENQUEUE,
+    READ_FRAME,
+    SWITCH_CORE_OP,
+    ORACLE_DECISION,
+    SET_CORE_OP_TIMEOUT,
+    SET_CORE_OP_THRESHOLD,
+    SET_CORE_OP_PRIORITY,
+};
+
+// Bits of the value field of an ORACLE_DECISION event
+#define BINARY_TRACE_DECISION_REASON_IDLE (1 << 0)
+#define BINARY_TRACE_DECISION_OVER_THRESHOLD (1 << 1)
+#define BINARY_TRACE_DECISION_OVER_TIMEOUT (1 << 2)
+
+#pragma pack(push, 1)
+struct BinaryTraceFileHeader {
+    char magic[BINARY_TRACE_MAGIC_SIZE];
+    uint32_t version;
+    uint32_t event_size;
+    // The events timestamps are relative to this time.
+    int64_t start_time_ns_since_epoch;
+};
+
+struct BinaryTraceEvent {
+    uint64_t timestamp_ns;
+    // Sequential id of the recording thread (given on its first event). Once a thread exits, its id (and ring) is
+    // reused by the next new thread.
+    uint32_t thread_id;
+    BinaryTraceEventType type;
+    uint16_t reserved;
+    uint32_t core_op_handle;
+    // Interned string ids (or BINARY_TRACE_INVALID_ID if not relevant to the event type).
+    uint32_t device_id;
+    // The stream name (for stream events), the core-op name (ADD_CORE_OP) or the device arch (ADD_DEVICE).
+    uint32_t name;
+    // Event specific - queue size, batch size, timeout in ms, threshold, priority or decision bits.
+    uint32_t value;
+};
+#pragma pack(pop)
+
+static_assert(32 == sizeof(BinaryTraceEvent), "BinaryTraceEvent size is part of the file format");
+
+} /* namespace hailort */
+
+#endif /* _HAILO_BINARY_TRACE_FORMAT_HPP_ */
@@ -0,0 +1,330 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file binary_trace_handler.cpp
+ * @brief Implementation of the binary trace handler
+ **/
+
+#include "binary_trace_handler.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <cstring>
+
+#define BINARY_TRACE_FILE_ENV_VAR ("HAILO_TRACE_FILE")
+#define BINARY_TRACE_DEFAULT_FILE_NAME ("hailort_trace.bin")
+// Amount of events in each thread's ring (must be a power of 2). At 32 bytes per event, each ring takes 512KB.
+#define BINARY_TRACE_RING_SIZE (16 * 1024)
+#define BINARY_TRACE_DRAIN_INTERVAL (std::chrono::milliseconds(100))
+
+namespace hailort
+{
+
+BinaryTraceEventsRing::BinaryTraceEventsRing(uint32_t thread_id, size_t size) :
+    m_thread_id(thread_id),
+    m_events(size),
+    m_events_mask(size - 1),
+    m_head(0),
+    m_tail(0),
+    m_dropped_events_count(0)
+{
+    assert(is_powerof2(size));
+}
+
+bool BinaryTraceEventsRing::push(BinaryTraceEvent &event)
+{
+    const auto head = m_head.load(std::memory_order_relaxed);
+    if ((head - m_tail.load(std::memory_order_acquire)) >= m_events.size()) {
+        // We prefer losing events over blocking the traced thread.
+        m_dropped_events_count.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    event.thread_id = m_thread_id;
+    m_events[head & m_events_mask] = event;
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+hailo_status BinaryTraceEventsRing::drain(std::ofstream &output)
+{
+    const auto head = m_head.load(std::memory_order_acquire);
+    auto tail = m_tail.load(std::memory_order_relaxed);
+    while (tail != head) {
+        // Write until the end of the ring (the rest is written on the next iteration).
+        const auto index = static_cast<size_t>(tail & m_events_mask);
+        const auto count = std::min(static_cast<size_t>(head - tail), m_events.size() - index);
+        output.write(reinterpret_cast<const char*>(&m_events[index]),
+            static_cast<std::streamsize>(count * sizeof(BinaryTraceEvent)));
+        CHECK(output.good(), HAILO_FILE_OPERATION_FAILURE, "Failed writing binary trace events");
+        tail += count;
+    }
+
+    m_tail.store(tail, std::memory_order_release);
+    return HAILO_SUCCESS;
+}
+
+Expected<std::unique_ptr<BinaryTraceHandler>> BinaryTraceHandler::create(int64_t start_time_ns_since_epoch)
+{
+    auto file_env_var = std::getenv(BINARY_TRACE_FILE_ENV_VAR);
+    std::string file_name = BINARY_TRACE_DEFAULT_FILE_NAME;
+    if (nullptr != file_env_var) {
+        file_name = std::string(file_env_var);
+    }
+
+    std::ofstream output(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+    CHECK_AS_EXPECTED(output.good(), HAILO_OPEN_FILE_FAILURE, "Failed opening binary trace file {}", file_name);
+
+    BinaryTraceFileHeader header{};
+    std::memcpy(header.magic, BINARY_TRACE_MAGIC, BINARY_TRACE_MAGIC_SIZE);
+    header.version = BINARY_TRACE_VERSION;
+    header.event_size = static_cast<uint32_t>(sizeof(BinaryTraceEvent));
+    header.start_time_ns_since_epoch = start_time_ns_since_epoch;
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    CHECK_AS_EXPECTED(output.good(), HAILO_FILE_OPERATION_FAILURE, "Failed writing binary trace file {}", file_name);
+
+    auto status = HAILO_UNINITIALIZED;
+    auto handler = make_unique_nothrow<BinaryTraceHandler>(std::move(output), status);
+    CHECK_NOT_NULL_AS_EXPECTED(handler, HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    LOGGER__INFO("Writing binary trace to {}", file_name);
+    return handler;
+}
+
+BinaryTraceHandler::BinaryTraceHandler(std::ofstream &&output, hailo_status &status) :
+    m_output(std::move(output))
+{
+    // The strings table is written when the handler is destructed, so we make sure TraceStrings is constructed (and
+    // hence destructed) before us.
+    (void)TraceStrings::get_strings();
+
+    m_rings_pool = make_shared_nothrow<BinaryTraceRingsPool>();
+    if (nullptr == m_rings_pool) {
+        status = HAILO_OUT_OF_HOST_MEMORY;
+        return;
+    }
+
+    auto shutdown_event = Event::create_shared(Event::State::not_signalled);
+    if (!shutdown_event) {
+        status = shutdown_event.status();
+        return;
+    }
+    m_shutdown_event = shutdown_event.release();
+
+    m_drain_thread = std::thread([this]() { drain_thread_main(); });
+    status = HAILO_SUCCESS;
+}
+
+BinaryTraceHandler::~BinaryTraceHandler()
+{
+    if (m_drain_thread.joinable()) {
+        m_shutdown_event->signal();
+        m_drain_thread.join();
+    }
+
+    // The traced threads may still record events, but they won't be drained anymore.
+    drain_rings();
+    write_footer();
+}
+
+void BinaryTraceHandler::drain_thread_main()
+{
+    while (true) {
+        auto status = m_shutdown_event->wait(BINARY_TRACE_DRAIN_INTERVAL);
+        if (HAILO_TIMEOUT == status) {
+            drain_rings();
+        } else if (HAILO_SUCCESS == status) {
+            break; // shutdown_event was signaled
+        } else {
+            LOGGER__ERROR("Binary trace drain thread failed with status {}", status);
+            return;
+        }
+    }
+}
+
+void BinaryTraceHandler::drain_rings()
+{
+    std::lock_guard<std::mutex> lock(m_rings_pool->mutex);
+    for (auto &ring : m_rings_pool->rings) {
+        auto status = ring->drain(m_output);
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR("Failed draining binary trace events, status {}", status);
+            return;
+        }
+    }
+}
+
+void BinaryTraceHandler::write_footer()
+{
+    uint64_t dropped_events_count = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_rings_pool->mutex);
+        for (auto &ring : m_rings_pool->rings) {
+            dropped_events_count += ring->dropped_events_count();
+        }
+    }
+    if (0 != dropped_events_count) {
+        LOGGER__WARNING("Binary trace dropped {} events (rings were full)", dropped_events_count);
+    }
+
+    BinaryTraceEvent end_event{};
+    end_event.type = BinaryTraceEventType::END;
+    end_event.value = static_cast<uint32_t>(std::min(dropped_events_count, static_cast<uint64_t>(UINT32_MAX)));
+    m_output.write(reinterpret_cast<const char*>(&end_event), sizeof(end_event));
+
+    const auto strings = TraceStrings::get_strings();
+    for (size_t id = 0; id < strings.size(); id++) {
+        const uint32_t string_header[] = {static_cast<uint32_t>(id), static_cast<uint32_t>(strings[id].size())};
+        m_output.write(reinterpret_cast<const char*>(string_header), sizeof(string_header));
+        m_output.write(strings[id].data(), static_cast<std::streamsize>(strings[id].size()));
+    }
+
+    m_output.flush();
+    if (!m_output.good()) {
+        LOGGER__ERROR("Failed writing binary trace file footer");
+    }
+}
+
+BinaryTraceEventsRing &BinaryTraceHandler::get_thread_ring()
+{
+    // Releases the ring of the thread back to its pool when the thread exits.
+    class ThreadRing final {
+    public:
+        ~ThreadRing()
+        {
+            release();
+        }
+
+        void release()
+        {
+            if (nullptr != pool) {
+                std::lock_guard<std::mutex> lock(pool->mutex);
+                pool->free_rings.push_back(ring);
+            }
+            pool = nullptr;
+            ring = nullptr;
+        }
+
+        std::shared_ptr<BinaryTraceRingsPool> pool;
+        BinaryTraceEventsRing *ring = nullptr;
+    };
+    thread_local ThreadRing thread_ring;
+
+    if (m_rings_pool != thread_ring.pool) {
+        // First event of this thread - the only time the traced thread takes a lock (other than on its exit).
+        thread_ring.release();
+
+        std::lock_guard<std::mutex> lock(m_rings_pool->mutex);
+        if (!m_rings_pool->free_rings.empty()) {
+            thread_ring.ring = m_rings_pool->free_rings.back();
+            m_rings_pool->free_rings.pop_back();
+        } else {
+            m_rings_pool->rings.emplace_back(std::make_unique<BinaryTraceEventsRing>(
+                static_cast<uint32_t>(m_rings_pool->rings.size()), BINARY_TRACE_RING_SIZE));
+            thread_ring.ring = m_rings_pool->rings.back().get();
+        }
+        thread_ring.pool = m_rings_pool;
+    }
+
+    return *thread_ring.ring;
+}
+
+void BinaryTraceHandler::record(const Trace &trace, BinaryTraceEventType type, uint32_t core_op_handle,
+    uint32_t device_id, uint32_t name, uint32_t value)
+{
+    BinaryTraceEvent event{};
+    event.timestamp_ns = trace.timestamp;
+    event.type = type;
+    event.core_op_handle = core_op_handle;
+    event.device_id = device_id;
+    event.name = name;
+    event.value = value;
+    get_thread_ring().push(event);
+}
+
+void BinaryTraceHandler::handle_trace(const AddDeviceTrace &trace)
+{
+    record(trace, BinaryTraceEventType::ADD_DEVICE, INVALID_CORE_OP_HANDLE, TraceStrings::get_id(trace.device_id),
+        TraceStrings::get_id(trace.device_arch), 0);
+}
+
+void BinaryTraceHandler::handle_trace(const AddCoreOpTrace &trace)
+{
+    record(trace, BinaryTraceEventType::ADD_CORE_OP, trace.core_op_handle, BINARY_TRACE_INVALID_ID,
+        TraceStrings::get_id(trace.core_op_name), static_cast<uint32_t>(trace.batch_size));
+}
+
+void BinaryTraceHandler::handle_trace(const CreateCoreOpInputStreamsTrace &trace)
+{
+    record(trace, BinaryTraceEventType::CREATE_INPUT_STREAM, trace.core_op_handle,
+        TraceStrings::get_id(trace.device_id), TraceStrings::get_id(trace.stream_name), trace.queue_size);
+}
+
+void BinaryTraceHandler::handle_trace(const CreateCoreOpOutputStreamsTrace &trace)
+{
+    record(trace, BinaryTraceEventType::CREATE_OUTPUT_STREAM, trace.core_op_handle,
+        TraceStrings::get_id(trace.device_id), TraceStrings::get_id(trace.stream_name), trace.queue_size);
+}
+
+void BinaryTraceHandler::handle_trace(const WriteFrameTrace &trace)
+{
+    record(trace, BinaryTraceEventType::WRITE_FRAME, trace.core_op_handle, BINARY_TRACE_INVALID_ID,
+        trace.queue_name, 0);
+}
+
+void BinaryTraceHandler::handle_trace(const InputVdmaDequeueTrace &trace)
+{
+    record(trace, BinaryTraceEventType::INPUT_VDMA_DEQUEUE, trace.core_op_handle, trace.device_id,
+        trace.queue_name, 0);
+}
+
+void BinaryTraceHandler::handle_trace(const OutputVdmaEnqueueTrace &trace)
+{
+    record(trace, BinaryTraceEventType::OUTPUT_VDMA_ENQUEUE, trace.core_op_handle, trace.device_id,
+        trace.queue_name, 0);
+}
+
+void BinaryTraceHandler::handle_trace(const ReadFrameTrace &trace)
+{
+    record(trace, BinaryTraceEventType::READ_FRAME, trace.core_op_handle, BINARY_TRACE_INVALID_ID,
+        trace.queue_name, 0);
+}
+
+void BinaryTraceHandler::handle_trace(const SwitchCoreOpTrace &trace)
+{
+    record(trace, BinaryTraceEventType::SWITCH_CORE_OP, trace.core_op_handle, trace.device_id,
+        BINARY_TRACE_INVALID_ID, 0);
+}
+
+void BinaryTraceHandler::handle_trace(const OracleDecisionTrace &trace)
+{
+    const uint32_t decision = (trace.reason_idle ? BINARY_TRACE_DECISION_REASON_IDLE : 0) |
+        (trace.over_threshold ? BINARY_TRACE_DECISION_OVER_THRESHOLD : 0) |
+        (trace.over_timeout ? BINARY_TRACE_DECISION_OVER_TIMEOUT : 0);
+    record(trace, BinaryTraceEventType::ORACLE_DECISION, trace.core_op_handle, trace.device_id,
+        BINARY_TRACE_INVALID_ID, decision);
+}
+
+void BinaryTraceHandler::handle_trace(const SetCoreOpTimeoutTrace &trace)
+{
+    record(trace, BinaryTraceEventType::SET_CORE_OP_TIMEOUT, trace.core_op_handle, BINARY_TRACE_INVALID_ID,
+        BINARY_TRACE_INVALID_ID, static_cast<uint32_t>(trace.timeout.count()));
+}
+
+void BinaryTraceHandler::handle_trace(const SetCoreOpThresholdTrace &trace)
+{
+    record(trace, BinaryTraceEventType::SET_CORE_OP_THRESHOLD, trace.core_op_handle, BINARY_TRACE_INVALID_ID,
+        BINARY_TRACE_INVALID_ID, trace.threshold);
+}
+
+void BinaryTraceHandler::handle_trace(const SetCoreOpPriorityTrace &trace)
+{
+    record(trace, BinaryTraceEventType::SET_CORE_OP_PRIORITY, trace.core_op_handle, BINARY_TRACE_INVALID_ID,
+        BINARY_TRACE_INVALID_ID, trace.priority);
+}
+
+} /* namespace hailort */
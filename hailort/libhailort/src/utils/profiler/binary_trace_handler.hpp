@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file binary_trace_handler.hpp
+ * @brief Low overhead trace handler - each thread writes fixed size binary events into its own lock-free ring, and
+ *        a background thread drains the rings into a file (see binary_trace_format.hpp).
+ *        The file can be converted to the Chrome/Perfetto trace-event format using "hailortcli convert-trace".
+ **/
+
+#ifndef _HAILO_BINARY_TRACE_HANDLER_HPP_
+#define _HAILO_BINARY_TRACE_HANDLER_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/event.hpp"
+
+#include "handler.hpp"
+#include "binary_trace_format.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hailort
+{
+
+#define BINARY_TRACE_ENV_VAR_VALUE ("binary")
+
+// Single producer (the thread owning the ring), single consumer (the drain thread) ring of events.
+class BinaryTraceEventsRing final
+{
+public:
+    BinaryTraceEventsRing(uint32_t thread_id, size_t size);
+
+    // Called by the owning thread. Returns false (and counts the event as dropped) if the ring is full.
+    bool push(BinaryTraceEvent &event);
+
+    // Called by the drain thread. Writes all the events in the ring to the given stream.
+    hailo_status drain(std::ofstream &output);
+
+    uint64_t dropped_events_count() const
+    {
+        return m_dropped_events_count.load();
+    }
+
+private:
+    const uint32_t m_thread_id;
+    std::vector<BinaryTraceEvent> m_events;
+    const size_t m_events_mask;
+
+    // Increasing counters (the index in m_events is the counter masked by m_events_mask).
+    std::atomic<uint64_t> m_head;
+    std::atomic<uint64_t> m_tail;
+    std::atomic<uint64_t> m_dropped_events_count;
+};
+
+// The rings of the traced threads. The ring of a thread is released to free_rings when the thread exits, and reused by
+// the next new thread (keeping its thread id), so the memory doesn't grow with the amount of threads created over
+// time. Shared with the traced threads, as they may exit after the handler is destructed.
+struct BinaryTraceRingsPool {
+    std::mutex mutex;
+    // Rings are only added, and are drained by the handler also while they are free.
+    std::vector<std::unique_ptr<BinaryTraceEventsRing>> rings;
+    std::vector<BinaryTraceEventsRing*> free_rings;
+};
+
+class BinaryTraceHandler : public Handler
+{
+public:
+    static Expected<std::unique_ptr<BinaryTraceHandler>> create(int64_t start_time_ns_since_epoch);
+
+    BinaryTraceHandler(std::ofstream &&output, hailo_status &status);
+    BinaryTraceHandler(BinaryTraceHandler const&) = delete;
+    void operator=(BinaryTraceHandler const&) = delete;
+    virtual ~BinaryTraceHandler();
+
+    virtual void handle_trace(const AddDeviceTrace&) override;
+    virtual void handle_trace(const AddCoreOpTrace&) override;
+    virtual void handle_trace(const CreateCoreOpInputStreamsTrace&) override;
+    virtual void handle_trace(const CreateCoreOpOutputStreamsTrace&) override;
+    virtual void handle_trace(const WriteFrameTrace&) override;
+    virtual void handle_trace(const InputVdmaDequeueTrace&) override;
+    virtual void handle_trace(const OutputVdmaEnqueueTrace&) override;
+    virtual void handle_trace(const ReadFrameTrace&) override;
+    virtual void handle_trace(const SwitchCoreOpTrace&) override;
+    virtual void handle_trace(const OracleDecisionTrace&) override;
+    virtual void handle_trace(const SetCoreOpTimeoutTrace&) override;
+    virtual void handle_trace(const SetCoreOpThresholdTrace&) override;
+    virtual void handle_trace(const SetCoreOpPriorityTrace&) override;
+
+private:
+    void record(const Trace &trace, BinaryTraceEventType type, uint32_t core_op_handle, uint32_t device_id,
+        uint32_t name, uint32_t value);
+    BinaryTraceEventsRing &get_thread_ring();
+
+    void drain_thread_main();
+    void drain_rings();
+    void write_footer();
+
+    std::ofstream m_output;
+
+    std::shared_ptr<BinaryTraceRingsPool> m_rings_pool;
+
+    EventPtr m_shutdown_event;
+    std::thread m_drain_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_BINARY_TRACE_HANDLER_HPP_ */
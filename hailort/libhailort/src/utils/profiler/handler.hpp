@@ -14,20 +14,21 @@
 #include "hailo/stream.hpp"
 
 #include "vdevice/scheduler/scheduler_base.hpp"
+#include "utils/profiler/trace_strings.hpp"
 
 namespace hailort
 {
 
 struct Trace
 {
-    Trace(const std::string &name)
+    Trace(const char *name)
         : name(name)
     {}
 
     virtual ~Trace() = default;
 
     uint64_t timestamp = 0;
-    std::string name;
+    const char *name;
 };
 
 struct InitTrace : Trace
@@ -116,55 +117,57 @@ struct CreateCoreOpOutputStreamsTrace : Trace
     scheduler_core_op_handle_t core_op_handle;
 };
 
+// The per-frame traces (and the ones used on each core-op switch) carry the device id and the stream name as ids
+// interned by TraceStrings (see TraceStrings::get_string), so constructing them doesn't allocate.
 struct WriteFrameTrace : Trace
 {
-    WriteFrameTrace(scheduler_core_op_handle_t core_op_handle, const std::string &queue_name)
+    WriteFrameTrace(scheduler_core_op_handle_t core_op_handle, trace_string_id_t queue_name)
         : Trace("write_frame"), core_op_handle(core_op_handle), queue_name(queue_name)
     {}
 
     scheduler_core_op_handle_t core_op_handle;
-    std::string queue_name;
+    trace_string_id_t queue_name;
 };
 
 struct InputVdmaDequeueTrace : Trace
 {
-    InputVdmaDequeueTrace(const device_id_t &device_id, scheduler_core_op_handle_t core_op_handle, const std::string &queue_name)
+    InputVdmaDequeueTrace(trace_string_id_t device_id, scheduler_core_op_handle_t core_op_handle, trace_string_id_t queue_name)
         : Trace("input_vdma_dequeue"), device_id(device_id), core_op_handle(core_op_handle), queue_name(queue_name)
     {}
 
-    device_id_t device_id;
+    trace_string_id_t device_id;
     scheduler_core_op_handle_t core_op_handle;
-    std::string queue_name;
+    trace_string_id_t queue_name;
 };
 
 struct ReadFrameTrace : Trace
 {
-    ReadFrameTrace(scheduler_core_op_handle_t core_op_handle, const std::string &queue_name)
+    ReadFrameTrace(scheduler_core_op_handle_t core_op_handle, trace_string_id_t queue_name)
         : Trace("read_frame"), core_op_handle(core_op_handle), queue_name(queue_name)
     {}
 
     scheduler_core_op_handle_t core_op_handle;
-    std::string queue_name;
+    trace_string_id_t queue_name;
 };
 
 struct OutputVdmaEnqueueTrace : Trace
 {
-    OutputVdmaEnqueueTrace(const device_id_t &device_id, scheduler_core_op_handle_t core_op_handle, const std::string &queue_name)
+    OutputVdmaEnqueueTrace(trace_string_id_t device_id, scheduler_core_op_handle_t core_op_handle, trace_string_id_t queue_name)
         : Trace("output_vdma_enqueue"), device_id(device_id), core_op_handle(core_op_handle), queue_name(queue_name)
     {}
 
-    device_id_t device_id;
+    trace_string_id_t device_id;
     scheduler_core_op_handle_t core_op_handle;
-    std::string queue_name;
+    trace_string_id_t queue_name;
 };
 
 struct SwitchCoreOpTrace : Trace
 {
-    SwitchCoreOpTrace(const device_id_t &device_id, scheduler_core_op_handle_t handle)
+    SwitchCoreOpTrace(trace_string_id_t device_id, scheduler_core_op_handle_t handle)
         : Trace("switch_core_op"), device_id(device_id), core_op_handle(handle)
     {}
 
-    device_id_t device_id;
+    trace_string_id_t device_id;
     scheduler_core_op_handle_t core_op_handle;
 };
 
@@ -200,14 +203,14 @@ struct SetCoreOpPriorityTrace : Trace
 
 struct OracleDecisionTrace : Trace
 {
-    OracleDecisionTrace(bool reason_idle, device_id_t device_id, vdevice_core_op_handle_t handle, bool over_threshold,
+    OracleDecisionTrace(bool reason_idle, trace_string_id_t device_id, vdevice_core_op_handle_t handle, bool over_threshold,
         bool over_timeout)
         : Trace("switch_core_op_decision"), reason_idle(reason_idle), device_id(device_id), core_op_handle(handle),
         over_threshold(over_threshold), over_timeout(over_timeout)
     {}
 
     bool reason_idle;
-    device_id_t device_id;
+    trace_string_id_t device_id;
     vdevice_core_op_handle_t core_op_handle;
     bool over_threshold;
     bool over_timeout;
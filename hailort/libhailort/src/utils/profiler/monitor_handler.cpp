@@ -56,8 +56,10 @@ void MonitorHandler::handle_trace(const AddDeviceTrace &trace)
 
 void MonitorHandler::handle_trace(const SwitchCoreOpTrace &trace)
 {
-    assert(contains(m_devices_info, trace.device_id));
-    m_devices_info.at(trace.device_id).current_core_op_handle = trace.core_op_handle;
+    const auto &device_id = TraceStrings::get_string(trace.device_id);
+
+    assert(contains(m_devices_info, device_id));
+    m_devices_info.at(device_id).current_core_op_handle = trace.core_op_handle;
 }
 
 void MonitorHandler::handle_trace(const CreateCoreOpInputStreamsTrace &trace)
@@ -90,18 +92,22 @@ void MonitorHandler::handle_trace(const CreateCoreOpOutputStreamsTrace &trace)
 
 void MonitorHandler::handle_trace(const WriteFrameTrace &trace)
 {
+    const auto &queue_name = TraceStrings::get_string(trace.queue_name);
+
     assert(contains(m_core_ops_info, trace.core_op_handle));
-    assert(contains(m_core_ops_info[trace.core_op_handle].input_streams_info, trace.queue_name));
-    auto &queue = m_core_ops_info[trace.core_op_handle].input_streams_info[trace.queue_name];
+    assert(contains(m_core_ops_info[trace.core_op_handle].input_streams_info, queue_name));
+    auto &queue = m_core_ops_info[trace.core_op_handle].input_streams_info[queue_name];
     queue.pending_frames_count->fetch_add(1);
     queue.pending_frames_count_acc->add_data_point(queue.pending_frames_count->load());
 }
 
 void MonitorHandler::handle_trace(const ReadFrameTrace &trace)
 {
+    const auto &queue_name = TraceStrings::get_string(trace.queue_name);
+
     assert(contains(m_core_ops_info, trace.core_op_handle));
-    assert(contains(m_core_ops_info[trace.core_op_handle].output_streams_info, trace.queue_name));
-    auto &queue = m_core_ops_info[trace.core_op_handle].output_streams_info[trace.queue_name];
+    assert(contains(m_core_ops_info[trace.core_op_handle].output_streams_info, queue_name));
+    auto &queue = m_core_ops_info[trace.core_op_handle].output_streams_info[queue_name];
     queue.pending_frames_count->fetch_sub(1);
     queue.pending_frames_count_acc->add_data_point(queue.pending_frames_count->load());
     queue.total_frames_count->fetch_add(1);
@@ -109,39 +115,45 @@ void MonitorHandler::handle_trace(const ReadFrameTrace &trace)
 
 void MonitorHandler::handle_trace(const OutputVdmaEnqueueTrace &trace)
 {
+    const auto &device_id = TraceStrings::get_string(trace.device_id);
+    const auto &queue_name = TraceStrings::get_string(trace.queue_name);
+
     assert(contains(m_core_ops_info, trace.core_op_handle));
-    assert(contains(m_core_ops_info[trace.core_op_handle].output_streams_info, trace.queue_name));
+    assert(contains(m_core_ops_info[trace.core_op_handle].output_streams_info, queue_name));
 
-    assert(contains(m_devices_info, trace.device_id));
-    assert(contains(m_devices_info.at(trace.device_id).requested_transferred_frames_h2d, trace.core_op_handle));
+    assert(contains(m_devices_info, device_id));
+    assert(contains(m_devices_info.at(device_id).requested_transferred_frames_h2d, trace.core_op_handle));
 
-    auto &queue = m_core_ops_info[trace.core_op_handle].output_streams_info[trace.queue_name];
+    auto &queue = m_core_ops_info[trace.core_op_handle].output_streams_info[queue_name];
     queue.pending_frames_count->fetch_add(1);
     queue.pending_frames_count_acc->add_data_point(queue.pending_frames_count->load());
 
-    m_devices_info.at(trace.device_id).finished_transferred_frames_d2h[trace.core_op_handle]->increase(trace.queue_name);
+    m_devices_info.at(device_id).finished_transferred_frames_d2h[trace.core_op_handle]->increase(queue_name);
 
-    const auto max_transferred_h2d = m_devices_info.at(trace.device_id).requested_transferred_frames_h2d[trace.core_op_handle]->get_max_value();
-    const auto min_transferred_d2h = m_devices_info.at(trace.device_id).finished_transferred_frames_d2h[trace.core_op_handle]->get_min_value();
+    const auto max_transferred_h2d = m_devices_info.at(device_id).requested_transferred_frames_h2d[trace.core_op_handle]->get_max_value();
+    const auto min_transferred_d2h = m_devices_info.at(device_id).finished_transferred_frames_d2h[trace.core_op_handle]->get_min_value();
     if(max_transferred_h2d == min_transferred_d2h) {
-            update_utilization_read_buffers_finished(trace.device_id, trace.core_op_handle, true);
+            update_utilization_read_buffers_finished(device_id, trace.core_op_handle, true);
     }
 }
 
 void MonitorHandler::handle_trace(const InputVdmaDequeueTrace &trace)
 {
+    const auto &device_id = TraceStrings::get_string(trace.device_id);
+    const auto &queue_name = TraceStrings::get_string(trace.queue_name);
+
     assert(contains(m_core_ops_info, trace.core_op_handle));
-    assert(contains(m_core_ops_info[trace.core_op_handle].input_streams_info, trace.queue_name));
-    assert(contains(m_devices_info, trace.device_id));
-    assert(contains(m_devices_info.at(trace.device_id).requested_transferred_frames_h2d, trace.core_op_handle));
+    assert(contains(m_core_ops_info[trace.core_op_handle].input_streams_info, queue_name));
+    assert(contains(m_devices_info, device_id));
+    assert(contains(m_devices_info.at(device_id).requested_transferred_frames_h2d, trace.core_op_handle));
 
-    auto &queue = m_core_ops_info[trace.core_op_handle].input_streams_info[trace.queue_name];
+    auto &queue = m_core_ops_info[trace.core_op_handle].input_streams_info[queue_name];
     queue.pending_frames_count->fetch_sub(1);
     queue.pending_frames_count_acc->add_data_point(queue.pending_frames_count->load());
 
-    m_devices_info.at(trace.device_id).requested_transferred_frames_h2d[trace.core_op_handle]->increase(trace.queue_name);
+    m_devices_info.at(device_id).requested_transferred_frames_h2d[trace.core_op_handle]->increase(queue_name);
 
-    update_utilization_send_started(trace.device_id);
+    update_utilization_send_started(device_id);
 }
 
 scheduler_core_op_handle_t MonitorHandler::get_core_op_handle_by_name(const std::string &name)
@@ -99,6 +99,13 @@ std::string json_to_string(const std::string &val) {
     return os.str();
 }
 
+template<>
+std::string json_to_string(const char *const &val) {
+    std::ostringstream os;
+    os << std::quoted(val);
+    return os.str();
+}
+
 template<>
 std::string json_to_string(const bool &bool_val) {
     return bool_val ? "true" : "false";
@@ -226,88 +233,100 @@ void SchedulerProfilerHandler::handle_trace(const CreateCoreOpOutputStreamsTrace
 
 void SchedulerProfilerHandler::handle_trace(const WriteFrameTrace &trace)
 {
+    const auto &queue_name = TraceStrings::get_string(trace.queue_name);
+
     log(JSON({
         {"action", json_to_string(trace.name)},
         {"timestamp", json_to_string(trace.timestamp)},
         {"core_op_handle", json_to_string(trace.core_op_handle)},
-        {"queue_name", json_to_string(trace.queue_name)}
+        {"queue_name", json_to_string(queue_name)}
     }));
 
     std::lock_guard<std::mutex> lock(m_proto_lock);
     auto added_trace = m_profiler_trace_proto.add_added_trace();
     added_trace->mutable_frame_enqueue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__H2D);
-    added_trace->mutable_frame_enqueue()->set_stream_name(trace.queue_name);
+    added_trace->mutable_frame_enqueue()->set_stream_name(queue_name);
     added_trace->mutable_frame_enqueue()->set_core_op_handle(trace.core_op_handle);
     added_trace->mutable_frame_enqueue()->set_time_stamp(trace.timestamp);
 }
 
 void SchedulerProfilerHandler::handle_trace(const InputVdmaDequeueTrace &trace)
 {
+    const auto &device_id = TraceStrings::get_string(trace.device_id);
+    const auto &queue_name = TraceStrings::get_string(trace.queue_name);
+
     log(JSON({
         {"action", json_to_string(trace.name)},
         {"timestamp", json_to_string(trace.timestamp)},
-        {"device_id", json_to_string(trace.device_id)},
+        {"device_id", json_to_string(device_id)},
         {"core_op_handle", json_to_string(trace.core_op_handle)},
-        {"queue_name", json_to_string(trace.queue_name)}
+        {"queue_name", json_to_string(queue_name)}
     }));
 
     std::lock_guard<std::mutex> lock(m_proto_lock);
     auto added_trace = m_profiler_trace_proto.add_added_trace();
     added_trace->mutable_frame_dequeue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__H2D);
-    added_trace->mutable_frame_dequeue()->set_device_id(trace.device_id);
-    added_trace->mutable_frame_dequeue()->set_stream_name(trace.queue_name);
+    added_trace->mutable_frame_dequeue()->set_device_id(device_id);
+    added_trace->mutable_frame_dequeue()->set_stream_name(queue_name);
     added_trace->mutable_frame_dequeue()->set_core_op_handle(trace.core_op_handle);
     added_trace->mutable_frame_dequeue()->set_time_stamp(trace.timestamp);
 }
 
 void SchedulerProfilerHandler::handle_trace(const ReadFrameTrace &trace)
 {
+    const auto &queue_name = TraceStrings::get_string(trace.queue_name);
+
     log(JSON({
         {"action", json_to_string(trace.name)},
         {"timestamp", json_to_string(trace.timestamp)},
         {"core_op_handle", json_to_string(trace.core_op_handle)},
-        {"queue_name", json_to_string(trace.queue_name)}
+        {"queue_name", json_to_string(queue_name)}
     }));
 
     std::lock_guard<std::mutex> lock(m_proto_lock);
     auto added_trace = m_profiler_trace_proto.add_added_trace();
     added_trace->mutable_frame_dequeue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__D2H);
-    added_trace->mutable_frame_dequeue()->set_stream_name(trace.queue_name);
+    added_trace->mutable_frame_dequeue()->set_stream_name(queue_name);
     added_trace->mutable_frame_dequeue()->set_core_op_handle(trace.core_op_handle);
     added_trace->mutable_frame_dequeue()->set_time_stamp(trace.timestamp);
 }
 
 void SchedulerProfilerHandler::handle_trace(const OutputVdmaEnqueueTrace &trace)
 {
+    const auto &device_id = TraceStrings::get_string(trace.device_id);
+    const auto &queue_name = TraceStrings::get_string(trace.queue_name);
+
     log(JSON({
         {"action", json_to_string(trace.name)},
         {"timestamp", json_to_string(trace.timestamp)},
-        {"device_id", json_to_string(trace.device_id)},
+        {"device_id", json_to_string(device_id)},
         {"core_op_handle", json_to_string(trace.core_op_handle)},
-        {"queue_name", json_to_string(trace.queue_name)}
+        {"queue_name", json_to_string(queue_name)}
     }));
 
     std::lock_guard<std::mutex> lock(m_proto_lock);
     auto added_trace = m_profiler_trace_proto.add_added_trace();
     added_trace->mutable_frame_enqueue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__D2H);
-    added_trace->mutable_frame_enqueue()->set_device_id(trace.device_id);
-    added_trace->mutable_frame_enqueue()->set_stream_name(trace.queue_name);
+    added_trace->mutable_frame_enqueue()->set_device_id(device_id);
+    added_trace->mutable_frame_enqueue()->set_stream_name(queue_name);
     added_trace->mutable_frame_enqueue()->set_core_op_handle(trace.core_op_handle);
     added_trace->mutable_frame_enqueue()->set_time_stamp(trace.timestamp);
 }
 
 void SchedulerProfilerHandler::handle_trace(const SwitchCoreOpTrace &trace)
 {
+    const auto &device_id = TraceStrings::get_string(trace.device_id);
+
     log(JSON({
         {"action", json_to_string(trace.name)},
         {"timestamp", json_to_string(trace.timestamp)},
-        {"device_id", json_to_string(trace.device_id)},
+        {"device_id", json_to_string(device_id)},
         {"core_op_handle", json_to_string(trace.core_op_handle)}
     }));
 
     std::lock_guard<std::mutex> lock(m_proto_lock);
     auto added_trace = m_profiler_trace_proto.add_added_trace();
-    added_trace->mutable_switched_core_op()->set_device_id(trace.device_id);
+    added_trace->mutable_switched_core_op()->set_device_id(device_id);
     added_trace->mutable_switched_core_op()->set_new_core_op_handle(trace.core_op_handle);
     added_trace->mutable_switched_core_op()->set_time_stamp(trace.timestamp);
 }
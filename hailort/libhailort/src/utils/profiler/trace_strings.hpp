@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file trace_strings.hpp
+ * @brief Interning of the strings used by the traces (device ids, stream names), so the per-frame traces carry
+ *        integer ids instead of building strings.
+ **/
+
+#ifndef _HAILO_TRACE_STRINGS_HPP_
+#define _HAILO_TRACE_STRINGS_HPP_
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hailort
+{
+
+using trace_string_id_t = uint32_t;
+
+class TraceStrings final
+{
+public:
+    // Returns the id of the given string, registering it on the first call. Meant to be called once per object
+    // (when it is created), and the id should be stored for the hot-path traces.
+    static trace_string_id_t get_id(const std::string &str)
+    {
+        auto &instance = get_instance();
+        std::lock_guard<std::mutex> lock(instance.m_mutex);
+        auto id_iter = instance.m_ids.find(str);
+        if (instance.m_ids.end() != id_iter) {
+            return id_iter->second;
+        }
+
+        const auto index = instance.m_ids.size();
+        if (index >= MAX_STRINGS_COUNT) {
+            // Not expected, as the strings are registered once per object - the traces will show the last string.
+            assert(false);
+            return static_cast<trace_string_id_t>(MAX_STRINGS_COUNT - 1);
+        }
+
+        auto &chunk = instance.m_chunks[index / STRINGS_PER_CHUNK];
+        if (nullptr == chunk.load(std::memory_order_relaxed)) {
+            // Allocated once per STRINGS_PER_CHUNK strings, and freed only when the process exits (see get_string).
+            chunk.store(new std::string[STRINGS_PER_CHUNK], std::memory_order_release);
+        }
+        chunk.load(std::memory_order_relaxed)[index % STRINGS_PER_CHUNK] = str;
+
+        const auto id = static_cast<trace_string_id_t>(index);
+        instance.m_ids.emplace(str, id);
+        return id;
+    }
+
+    // Doesn't lock - the strings are never moved or removed, and the string of an id is set before the id is returned
+    // by get_id. The returned reference stays valid for the lifetime of the process.
+    static const std::string &get_string(trace_string_id_t id)
+    {
+        assert(id < MAX_STRINGS_COUNT);
+        const auto chunk = get_instance().m_chunks[id / STRINGS_PER_CHUNK].load(std::memory_order_acquire);
+        assert(nullptr != chunk);
+        return chunk[id % STRINGS_PER_CHUNK];
+    }
+
+    // Returns all the interned strings, where the id of each string is its index.
+    static std::vector<std::string> get_strings()
+    {
+        auto &instance = get_instance();
+        std::lock_guard<std::mutex> lock(instance.m_mutex);
+        std::vector<std::string> strings;
+        strings.reserve(instance.m_ids.size());
+        for (size_t index = 0; index < instance.m_ids.size(); index++) {
+            strings.emplace_back(instance.m_chunks[index / STRINGS_PER_CHUNK].load()[index % STRINGS_PER_CHUNK]);
+        }
+        return strings;
+    }
+
+private:
+    static constexpr size_t STRINGS_PER_CHUNK = 256;
+    static constexpr size_t MAX_CHUNKS_COUNT = 1024;
+    static constexpr size_t MAX_STRINGS_COUNT = STRINGS_PER_CHUNK * MAX_CHUNKS_COUNT;
+
+    TraceStrings() = default;
+
+    ~TraceStrings()
+    {
+        for (auto &chunk : m_chunks) {
+            delete[] chunk.load();
+        }
+    }
+
+    static TraceStrings &get_instance()
+    {
+        static TraceStrings trace_strings;
+        return trace_strings;
+    }
+
+    std::mutex m_mutex;
+    // The strings are stored in fixed chunks, so the readers (get_string) can access them without locking.
+    std::array<std::atomic<std::string*>, MAX_CHUNKS_COUNT> m_chunks{};
+    std::unordered_map<std::string, trace_string_id_t> m_ids;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_TRACE_STRINGS_HPP_ */
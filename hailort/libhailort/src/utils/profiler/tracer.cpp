@@ -20,7 +20,9 @@ namespace hailort
 Tracer::Tracer()
 {
     init_scheduler_profiler_handler();
+    init_binary_trace_handler();
     init_monitor_handler();
+    m_is_enabled = m_should_trace || m_should_monitor;
 }
 
 void Tracer::init_scheduler_profiler_handler()
@@ -34,6 +36,24 @@ void Tracer::init_scheduler_profiler_handler()
     }
 }
 
+void Tracer::init_binary_trace_handler()
+{
+    const char* env_var_name = PROFILER_ENV_VAR;
+    if (!is_env_variable_on(env_var_name, BINARY_TRACE_ENV_VAR_VALUE, sizeof(BINARY_TRACE_ENV_VAR_VALUE))) {
+        return;
+    }
+
+    m_start_time = std::chrono::high_resolution_clock::now();
+    int64_t time_since_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(m_start_time.time_since_epoch()).count();
+    auto handler = BinaryTraceHandler::create(time_since_epoch);
+    if (!handler) {
+        LOGGER__ERROR("Failed creating binary trace handler, status {}", handler.status());
+        return;
+    }
+    m_handlers.push_back(handler.release());
+    m_should_trace = true;
+}
+
 void Tracer::init_monitor_handler()
 {
     const char* env_var_name = SCHEDULER_MON_ENV_VAR;
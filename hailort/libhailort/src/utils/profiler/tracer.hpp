@@ -14,6 +14,7 @@
 
 #include "scheduler_profiler_handler.hpp"
 #include "monitor_handler.hpp"
+#include "binary_trace_handler.hpp"
 namespace hailort
 {
 class Tracer
@@ -26,10 +27,17 @@ public:
         tracer.execute_trace<TraceType>(trace_args...);
     }
 
+    // Checked by the TRACE macro before the trace arguments are evaluated.
+    static bool is_enabled()
+    {
+        return get_instance().m_is_enabled;
+    }
+
 private:
     Tracer();
     void init_monitor_handler();
     void init_scheduler_profiler_handler();
+    void init_binary_trace_handler();
 
     static Tracer& get_instance()
     {
@@ -40,7 +48,7 @@ private:
     template<class TraceType, typename... Args>
     void execute_trace(Args... trace_args)
     {
-        if ((!m_should_trace) && (!m_should_monitor)) {
+        if (!m_is_enabled) {
             return;
         }
 
@@ -54,6 +62,7 @@ private:
 
     bool m_should_trace = false;
     bool m_should_monitor = false;
+    bool m_is_enabled = false;
     std::chrono::high_resolution_clock::time_point m_start_time;
     std::vector<std::unique_ptr<Handler>> m_handlers;
 };
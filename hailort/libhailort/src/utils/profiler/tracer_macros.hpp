@@ -10,6 +10,8 @@
 #ifndef _HAILO_TRACER_MACROS_HPP_
 #define _HAILO_TRACER_MACROS_HPP_
 
+#include "utils/profiler/trace_strings.hpp"
+
 #if defined HAILO_ENABLE_PROFILER_BUILD
 #include "tracer.hpp"
 #endif
@@ -22,11 +24,23 @@ struct VoidAll {
 };
 
 #if defined HAILO_ENABLE_PROFILER_BUILD
-#define TRACE(type, ...) (Tracer::trace<type>(__VA_ARGS__))
+// The trace arguments are evaluated (and the trace is constructed) only if some trace handler is enabled.
+#define TRACE(type, ...)                            \
+    do {                                            \
+        if (Tracer::is_enabled()) {                 \
+            Tracer::trace<type>(__VA_ARGS__);       \
+        }                                           \
+    } while (0)
 #else
-#define TRACE(type, ...) {VoidAll temporary_name{__VA_ARGS__};}
+// The arguments are still compiled (so the build doesn't break only when the profiler is on), but never evaluated.
+#define TRACE(type, ...)                            \
+    do {                                            \
+        if (false) {                                \
+            VoidAll temporary_name{__VA_ARGS__};    \
+        }                                           \
+    } while (0)
 #endif
 
 }
 
-#endif // _HAILO_TRACER_MACROS_HPP_
\ No newline at end of file
+#endif // _HAILO_TRACER_MACROS_HPP_
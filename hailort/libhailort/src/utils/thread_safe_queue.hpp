@@ -33,6 +33,9 @@
 #endif
 
 #include <queue>
+#include <deque>
+#include <vector>
+#include <algorithm>
 #include <mutex>
 #include <memory>
 #include <condition_variable>
@@ -66,7 +69,7 @@ public:
         if ((m_max_size != UNLIMITED_QUEUE_SIZE) && (m_queue.size() >= m_max_size)) {
             return HAILO_QUEUE_IS_FULL;
         }
-        m_queue.push(std::move(t));
+        m_queue.push_back(std::move(t));
         return HAILO_SUCCESS;
     }
 
@@ -75,16 +78,22 @@ public:
         std::lock_guard<std::mutex> lock(m_mutex);
         CHECK_AS_EXPECTED(!m_queue.empty(), HAILO_INTERNAL_FAILURE, "Can't dequeue if queue is empty");
         T val = m_queue.front();
-        m_queue.pop();
+        m_queue.pop_front();
         return val;
     }
 
+    // Returns a copy of the next (up to) max_count items to be dequeued, without dequeuing them.
+    std::vector<T> peek(size_t max_count) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto count = std::min(max_count, m_queue.size());
+        return std::vector<T>(m_queue.begin(), m_queue.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+
     void clear()
     {
         std::lock_guard<std::mutex> lock(m_mutex);
-        while (!m_queue.empty()) {
-            m_queue.pop();
-        }
+        m_queue.clear();
     }
 
     bool empty() const { return m_queue.empty(); }
@@ -93,7 +102,7 @@ public:
 
 protected:
     const size_t m_max_size;
-    std::queue<T> m_queue;
+    std::deque<T> m_queue;
     mutable std::mutex m_mutex;
 };
 
@@ -11,64 +11,98 @@
 namespace hailort
 {
 
-InternalTransferDoneCallback CallbackReorderQueue::wrap_callback(const InternalTransferDoneCallback &original)
+Expected<CallbackReorderQueue::WrappedCallback> CallbackReorderQueue::wrap_callback(
+    InternalTransferDoneCallback &&original)
 {
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
-    const uint64_t current_callback_index = m_registered_callbacks++;
+    auto current_callback_index = claim_callback_index();
+    if (!current_callback_index) {
+        return make_unexpected(current_callback_index.status());
+    }
 
-    return [this, original, current_callback_index](hailo_status status) {
-        // Push callback without calling it yet.
-        push_callback(std::make_pair(current_callback_index, [original, status]() {
-            return original(status);
-        }));
+    // The slot is owned by this thread until the wrapped callback is called (or canceled).
+    auto &slot = m_slots[*current_callback_index & m_slots_mask];
+    assert(!slot.is_done);
+    slot.callback = std::move(original);
 
-        // Then, call the queued callbacks in order (if there is ready callback).
-        call_queued_callbacks_in_order();
+    // The wrapped callback is small enough to be stored inside the std::function (without allocation).
+    const uint64_t callback_index = *current_callback_index;
+    return WrappedCallback{
+        InternalTransferDoneCallback([this, callback_index](hailo_status status) {
+            on_callback_done(callback_index, status);
+        }),
+        callback_index
     };
 }
 
-void CallbackReorderQueue::cancel_last_callback()
+void CallbackReorderQueue::cancel_callback(uint64_t callback_index)
 {
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
-    assert(m_called_callbacks < m_registered_callbacks);
-    m_registered_callbacks--;
+    assert(m_called_callbacks <= callback_index);
+    assert(callback_index < m_registered_callbacks);
+
+    // The canceled callback is skipped when its turn comes, so the callbacks after it are not blocked.
+    auto &slot = m_slots[callback_index & m_slots_mask];
+    slot.callback = nullptr;
+    slot.is_done = true;
+
+    call_queued_callbacks_in_order();
 }
 
-void CallbackReorderQueue::push_callback(const Callback &callback)
+Expected<uint64_t> CallbackReorderQueue::claim_callback_index()
 {
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
-    assert(m_callbacks_queue.size() < m_max_size);
-    m_callbacks_queue.push(callback);
+    uint64_t current_callback_index = m_registered_callbacks.load();
+    do {
+        if ((current_callback_index - m_called_callbacks.load()) >= m_slots.size()) {
+            // The slot of this callback is still used by a callback that wasn't called yet.
+            return make_unexpected(HAILO_QUEUE_IS_FULL);
+        }
+    } while (!m_registered_callbacks.compare_exchange_weak(current_callback_index, current_callback_index + 1));
+
+    return current_callback_index;
 }
 
-void CallbackReorderQueue::call_queued_callbacks_in_order()
+void CallbackReorderQueue::on_callback_done(uint64_t callback_index, hailo_status status)
 {
-    // Allow only one thread to execute the callbacks.
-    std::lock_guard<std::mutex> callbacks_lock(m_callbacks_mutex);
+    // Mark the callback as done without calling it yet.
+    auto &slot = m_slots[callback_index & m_slots_mask];
+    slot.status = status;
+    slot.is_done = true;
 
-    while (auto callback = pop_ready_callback()) {
-        callback->second();
-    }
+    // Then, call the queued callbacks in order (if there is ready callback).
+    call_queued_callbacks_in_order();
 }
 
-Expected<CallbackReorderQueue::Callback> CallbackReorderQueue::pop_ready_callback()
+void CallbackReorderQueue::call_queued_callbacks_in_order()
 {
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
+    do {
+        if (m_is_calling_callbacks.exchange(true)) {
+            // Another thread is calling the callbacks - it will call ours as well (see the loop condition).
+            return;
+        }
 
-    if (m_callbacks_queue.empty()) {
-        return make_unexpected(HAILO_NOT_AVAILABLE);
-    }
+        while (true) {
+            auto &slot = m_slots[m_called_callbacks & m_slots_mask];
+            if (!slot.is_done) {
+                // We need to wait until the callback with index m_called_callbacks is done.
+                break;
+            }
 
-    if (m_callbacks_queue.top().first != m_called_callbacks) {
-        // We need to wait until top() contains callback with index - m_called_callbacks.
-        return make_unexpected(HAILO_NOT_AVAILABLE);
-    }
+            // Free the slot before calling the callback, so the callback can wrap a new callback.
+            auto callback = std::move(slot.callback);
+            const auto status = slot.status;
+            slot.callback = nullptr;
+            slot.is_done = false;
+            m_called_callbacks++;
+
+            if (callback) {
+                callback(status);
+            }
+        }
 
-    auto next_callback = m_callbacks_queue.top();
-    m_callbacks_queue.pop();
+        m_is_calling_callbacks = false;
 
-    m_called_callbacks++;
-    return next_callback;
+        // A callback may have been marked as done after we checked it, while its thread saw we are still calling the
+        // callbacks, so we check again after we stopped.
+    } while (m_slots[m_called_callbacks & m_slots_mask].is_done);
 }
 
 } /* namespace hailort */
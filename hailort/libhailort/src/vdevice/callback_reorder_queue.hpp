@@ -12,78 +12,79 @@
 #ifndef _HAILO_CALLBACK_REORDER_QUEUE_HPP_
 #define _HAILO_CALLBACK_REORDER_QUEUE_HPP_
 
+#include "common/utils.hpp"
+
 #include "stream_common/transfer_common.hpp"
 
-#include <mutex>
-#include <queue>
+#include <atomic>
+#include <vector>
 
 namespace hailort
 {
 
+// The callbacks are stored in a ring indexed by their sequence number. A completed callback marks its slot as done,
+// and the thread that completes the next expected callback calls all the done callbacks in order. No locks are used,
+// and no memory is allocated per callback.
+// Callbacks may be wrapped (and canceled) by several threads concurrently - each one claims its own sequence number.
 class CallbackReorderQueue final {
 public:
     CallbackReorderQueue(size_t max_size) :
-        m_max_size(max_size),
-        m_callbacks_queue(compare_callbacks{}, make_queue_storage(m_max_size))
+        m_slots(get_ring_size(max_size)),
+        m_slots_mask(m_slots.size() - 1)
     {}
 
+    struct WrappedCallback {
+        InternalTransferDoneCallback callback;
+        // Sequence number of the callback, used to cancel it (see cancel_callback).
+        uint64_t index;
+    };
+
     // Wraps the given original callback so it will be called in the same wrap_callback order.
-    InternalTransferDoneCallback wrap_callback(const InternalTransferDoneCallback &original);
+    // original is moved into the queue only on success.
+    // Returns HAILO_QUEUE_IS_FULL if too many callbacks are waiting to be called.
+    Expected<WrappedCallback> wrap_callback(InternalTransferDoneCallback &&original);
 
     // If some wrapped callback wasn't registered to some async API (for example because the queue is full), we need to
-    // remove the counters we added in `wrap_callback` (otherwise, next callback will wait forever).
+    // skip its place in the order (otherwise, next callback will wait forever). The original callback isn't called.
     // Note!
-    //   * Call this function only after a `wrap_callback` was called.
     //   * Make sure the wrapped callback will never be called! (Otherwise counters will loss syncronization).
-    void cancel_last_callback();
+    //   * Callbacks wrapped before the canceled one may be called by this function (if they were already done).
+    void cancel_callback(uint64_t callback_index);
 
 private:
-    // must be called with m_lock held
-    void call_queued_callbacks_in_order();
-
-    // Each callback has a function pointer and its index
-    using Callback = std::pair<uint64_t, std::function<void()>>;
-
-    void push_callback(const Callback &callback);
-
-    // Pop next callback ready to be called. Can return HAILO_NOT_AVAILABLE if there is no callback ready.
-    Expected<Callback> pop_ready_callback();
+    struct Slot {
+        InternalTransferDoneCallback callback;
+        hailo_status status = HAILO_UNINITIALIZED;
+        // Set when the wrapped callback was called (or canceled), cleared once the original callback is taken from the
+        // slot. An empty callback is a canceled one.
+        std::atomic_bool is_done{false};
+    };
 
-    // We don't want to have any memory allocations in runtime, so we init the priority queue with a reserved vector.
-    static std::vector<Callback> make_queue_storage(size_t max_size)
+    // Up to max_size callbacks may be ongoing, and (as they may complete before the first one) up to max_size
+    // callbacks may wait for the first one.
+    static size_t get_ring_size(size_t max_size)
     {
-        std::vector<Callback> storage;
-        storage.reserve(max_size);
-        return storage;
+        return get_nearest_powerof_2(static_cast<uint32_t>(std::max(max_size, size_t(1)) * 2), 1);
     }
 
-    const size_t m_max_size;
+    Expected<uint64_t> claim_callback_index();
+    void on_callback_done(uint64_t callback_index, hailo_status status);
+
+    void call_queued_callbacks_in_order();
 
-    // Guards access to m_callbacks_queue and the counters.
-    std::mutex m_queue_mutex;
+    std::vector<Slot> m_slots;
+    const size_t m_slots_mask;
 
-    // Increasing counter for the index on next register callback. We don't worry about overflow (Even if we assume
-    // extreme value of 1,000,000 per second)
-    uint64_t m_registered_callbacks = 0;
+    // Increasing counter for the index on next register callback (claimed with compare exchange, so concurrent wraps
+    // get different indices). We don't worry about overflow (Even if we assume extreme value of 1,000,000 per second)
+    std::atomic<uint64_t> m_registered_callbacks{0};
 
     // Amount of callback that have called. Because the callbacks are called in order, this counter contains the index
-    // of the next callback expected to be executed.
-    uint64_t m_called_callbacks = 0;
-
-    struct compare_callbacks {
-        bool operator()(const Callback &a, const Callback &b)
-        {
-            // We want to pop the lower index first
-            return a.first > b.first;
-        }
-    };
-
-    // Callbacks are stored inside a priority_queue data-structure.
-    // The queue is sorted by the callbacks index (so we pop the callbacks with the smallest index first).
-    std::priority_queue<Callback, std::vector<Callback>, compare_callbacks> m_callbacks_queue;
+    // of the next callback expected to be executed. Only changed by the thread calling the callbacks.
+    std::atomic<uint64_t> m_called_callbacks{0};
 
-    // This lock guarantee that only one thread is executing the callbacks.
-    std::mutex m_callbacks_mutex;
+    // Guarantees that only one thread is executing the callbacks.
+    std::atomic_bool m_is_calling_callbacks{false};
 };
 
 } /* namespace hailort */
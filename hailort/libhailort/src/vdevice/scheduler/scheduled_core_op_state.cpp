@@ -21,17 +21,21 @@ ScheduledCoreOp::ScheduledCoreOp(std::shared_ptr<CoreOp> core_op, std::chrono::m
     m_core_op(core_op),
     m_last_run_time_stamp(std::chrono::steady_clock::now()),
     m_timeout(std::move(timeout)),
+    m_timeout_deadline(m_last_run_time_stamp + m_timeout),
     m_frame_was_sent(false),
     m_max_batch_size(max_batch_size),
     m_use_dynamic_batch_flow(use_dynamic_batch_flow),
+    m_threshold(DEFAULT_SCHEDULER_MIN_THRESHOLD),
+    m_inputs_over_threshold_count(0),
     m_priority(HAILO_SCHEDULER_PRIORITY_NORMAL),
     m_last_device_id(INVALID_DEVICE_ID),
     m_inputs_names(),
-    m_outputs_names()
+    m_outputs_names(),
+    m_min_input_buffers_count(calc_min_input_buffers_count()),
+    m_min_output_buffers_count(calc_min_output_buffers_count())
 {
     // Prepare empty counters for the added core-op
     for (const auto &stream_info : stream_infos) {
-        m_min_threshold_per_stream[stream_info.name] = DEFAULT_SCHEDULER_MIN_THRESHOLD;
         m_is_stream_enabled[stream_info.name] = true;
         m_pending_frames.insert(stream_info.name);
         if (HAILO_H2D_STREAM == stream_info.direction) {
@@ -65,6 +69,16 @@ uint32_t ScheduledCoreOp::get_max_ongoing_frames_per_device() const
 }
 
 uint16_t ScheduledCoreOp::get_min_input_buffers_count() const
+{
+    return m_min_input_buffers_count;
+}
+
+uint16_t ScheduledCoreOp::get_min_output_buffers_count() const
+{
+    return m_min_output_buffers_count;
+}
+
+uint16_t ScheduledCoreOp::calc_min_input_buffers_count() const
 {
     auto input_streams = m_core_op->get_input_streams();
     uint16_t buffers_count = UINT16_MAX;
@@ -77,7 +91,7 @@ uint16_t ScheduledCoreOp::get_min_input_buffers_count() const
     return buffers_count;
 }
 
-uint16_t ScheduledCoreOp::get_min_output_buffers_count() const
+uint16_t ScheduledCoreOp::calc_min_output_buffers_count() const
 {
     auto output_streams = m_core_op->get_output_streams();
     uint16_t buffers_count = UINT16_MAX;
@@ -100,6 +114,7 @@ hailo_status ScheduledCoreOp::set_timeout(const std::chrono::milliseconds &timeo
     CHECK(!m_frame_was_sent, HAILO_INVALID_OPERATION,
         "Setting scheduler timeout is allowed only before sending / receiving frames on the core-op.");
     m_timeout = timeout;
+    m_timeout_deadline = m_last_run_time_stamp + m_timeout;
 
     auto name = (stream_name.empty()) ? m_core_op->name() : stream_name;
     LOGGER__INFO("Setting scheduler timeout of {} to {}ms", name, timeout.count());
@@ -116,9 +131,8 @@ hailo_status ScheduledCoreOp::set_threshold(uint32_t threshold, const stream_nam
         "Setting scheduler threshold is allowed only before sending / receiving frames on the core-op.");
 
     // TODO: Support setting threshold per stream. currently stream_name is always empty and de-facto we set threshold for the whole NG
-    for (auto &threshold_per_stream_pair : m_min_threshold_per_stream) {
-        threshold_per_stream_pair.second = threshold;
-    }
+    // No input frames were sent yet, so no input is over the new threshold.
+    m_threshold = threshold;
 
     auto name = (stream_name.empty()) ? m_core_op->name() : stream_name;
     LOGGER__INFO("Setting scheduler threshold of {} to {} frames", name, threshold);
@@ -164,19 +178,29 @@ std::chrono::time_point<std::chrono::steady_clock> ScheduledCoreOp::get_last_run
 void ScheduledCoreOp::set_last_run_timestamp(const std::chrono::time_point<std::chrono::steady_clock> &timestamp)
 {
     m_last_run_time_stamp = timestamp;
+    m_timeout_deadline = m_last_run_time_stamp + m_timeout;
+}
+
+bool ScheduledCoreOp::is_over_timeout(const std::chrono::time_point<std::chrono::steady_clock> &now) const
+{
+    return now >= m_timeout_deadline;
+}
+
+std::chrono::milliseconds ScheduledCoreOp::get_timeout() const
+{
+    return m_timeout;
 }
 
-Expected<std::chrono::milliseconds> ScheduledCoreOp::get_timeout(const stream_name_t &stream_name)
+uint32_t ScheduledCoreOp::get_threshold() const
 {
-    CHECK_AS_EXPECTED(stream_name.empty(), HAILO_INVALID_OPERATION, "timeout per network is not supported");
-    auto timeout = m_timeout;
-    return timeout;
+    return m_threshold;
 }
 
-Expected<uint32_t> ScheduledCoreOp::get_threshold(const stream_name_t &stream_name)
+uint32_t ScheduledCoreOp::get_effective_threshold() const
 {
-    CHECK_AS_EXPECTED(contains(m_min_threshold_per_stream, stream_name), HAILO_NOT_FOUND);
-    return m_min_threshold_per_stream[stream_name].load();
+    // Without a threshold, the core-op is ready once there is a pending frame on each input
+    const uint32_t threshold = m_threshold;
+    return (DEFAULT_SCHEDULER_MIN_THRESHOLD == threshold) ? 1 : threshold;
 }
 
 uint16_t ScheduledCoreOp::get_max_batch_size() const
@@ -192,18 +216,34 @@ uint16_t ScheduledCoreOp::get_burst_size() const
     return m_core_op->is_default_batch_size() ? get_min_output_buffers_count() : get_max_batch_size();
 }
 
-SchedulerCounter &ScheduledCoreOp::pending_frames()
+const SchedulerCounter &ScheduledCoreOp::pending_frames() const
 {
     return m_pending_frames;
 }
 
-uint32_t ScheduledCoreOp::get_min_input_pending_frames() const
+void ScheduledCoreOp::increase_pending_frames(const stream_name_t &stream_name, hailo_stream_direction_t direction)
 {
-    uint32_t min_count = std::numeric_limits<uint32_t>::max();
-    for (const auto &input_name : m_inputs_names) {
-        min_count = std::min(min_count, m_pending_frames[input_name]);
+    const auto prev_count = m_pending_frames.increase(stream_name);
+    if ((HAILO_H2D_STREAM == direction) && ((prev_count + 1) == get_effective_threshold())) {
+        m_inputs_over_threshold_count++;
     }
-    return min_count;
+}
+
+void ScheduledCoreOp::decrease_pending_frames(const stream_name_t &stream_name, hailo_stream_direction_t direction,
+    uint32_t count)
+{
+    const auto prev_count = m_pending_frames.decrease(stream_name, count);
+    // The counter changes of each stream are atomic, so each crossing of the threshold is counted exactly once.
+    const auto threshold = get_effective_threshold();
+    if ((HAILO_H2D_STREAM == direction) && (prev_count >= threshold) && ((prev_count - count) < threshold)) {
+        assert(m_inputs_over_threshold_count > 0);
+        m_inputs_over_threshold_count--;
+    }
+}
+
+bool ScheduledCoreOp::are_all_inputs_over_threshold() const
+{
+    return m_inputs_over_threshold_count == m_inputs_names.size();
 }
 
 bool ScheduledCoreOp::is_stream_enabled(const stream_name_t &stream_name) const
@@ -64,20 +64,25 @@ public:
     device_id_t get_last_device();
     void set_last_device(const device_id_t &device_id);
 
-    Expected<std::chrono::milliseconds> get_timeout(const stream_name_t &stream_name = "");
+    std::chrono::milliseconds get_timeout() const;
     hailo_status set_timeout(const std::chrono::milliseconds &timeout, const stream_name_t &stream_name = "");
-    Expected<uint32_t> get_threshold(const stream_name_t &stream_name);
+    uint32_t get_threshold() const;
     hailo_status set_threshold(uint32_t threshold, const stream_name_t &stream_name = "");
     core_op_priority_t get_priority();
     void set_priority(core_op_priority_t priority);
 
     std::chrono::time_point<std::chrono::steady_clock> get_last_run_timestamp();
     void set_last_run_timestamp(const std::chrono::time_point<std::chrono::steady_clock> &timestamp);
+    // True if the timeout has passed since the last run of the core-op
+    bool is_over_timeout(const std::chrono::time_point<std::chrono::steady_clock> &now) const;
 
     void mark_frame_sent();
 
-    SchedulerCounter &pending_frames();
-    uint32_t get_min_input_pending_frames() const;
+    const SchedulerCounter &pending_frames() const;
+    void increase_pending_frames(const stream_name_t &stream_name, hailo_stream_direction_t direction);
+    void decrease_pending_frames(const stream_name_t &stream_name, hailo_stream_direction_t direction, uint32_t count);
+    // True if the pending frames of all inputs reached the threshold
+    bool are_all_inputs_over_threshold() const;
 
     bool is_stream_enabled(const stream_name_t &stream_name) const;
     void enable_stream(const stream_name_t &stream_name);
@@ -89,9 +94,15 @@ public:
         uint16_t max_batch_size, bool use_dynamic_batch_flow, StreamInfoVector &stream_infos);
 
 private:
+    uint16_t calc_min_input_buffers_count() const;
+    uint16_t calc_min_output_buffers_count() const;
+    uint32_t get_effective_threshold() const;
+
     std::shared_ptr<CoreOp> m_core_op;
     std::chrono::time_point<std::chrono::steady_clock> m_last_run_time_stamp;
     std::chrono::milliseconds m_timeout;
+    // m_last_run_time_stamp + m_timeout, so checking the timeout is a single comparison
+    std::chrono::time_point<std::chrono::steady_clock> m_timeout_deadline;
     std::atomic_bool m_frame_was_sent;
     uint16_t m_max_batch_size;
     bool m_use_dynamic_batch_flow;
@@ -99,7 +110,10 @@ private:
     // For each stream, amount of frames pending (for launch_transfer call)
     SchedulerCounter m_pending_frames;
 
-    std::unordered_map<stream_name_t, std::atomic_uint32_t> m_min_threshold_per_stream;
+    // The threshold is the same for all streams (setting it per stream isn't supported). Since it can't be changed
+    // after frames were sent, the number of inputs whose pending frames reached it is updated with the pending frames.
+    std::atomic_uint32_t m_threshold;
+    std::atomic_uint32_t m_inputs_over_threshold_count;
     std::unordered_map<stream_name_t, std::atomic_bool> m_is_stream_enabled;
 
     core_op_priority_t m_priority;
@@ -108,6 +122,10 @@ private:
 
     std::vector<stream_name_t> m_inputs_names;
     std::vector<stream_name_t> m_outputs_names;
+
+    // The buffers count of the streams don't change after the core-op is configured
+    uint16_t m_min_input_buffers_count;
+    uint16_t m_min_output_buffers_count;
 };
 
 
@@ -56,15 +56,21 @@ hailo_status ScheduledInputStream::launch_transfer(const device_id_t &device_id)
     auto pending_buffer = m_transfer_requests.dequeue();
     CHECK_EXPECTED_AS_STATUS(pending_buffer);
 
-    auto reorder_queue_callback = m_callback_reorder_queue.wrap_callback(pending_buffer->callback);
-    pending_buffer->callback = reorder_queue_callback;
+    // Wrap callback with reorder queue.
+    auto reorder_queue_callback_exp = m_callback_reorder_queue.wrap_callback(std::move(pending_buffer->callback));
+    if (!reorder_queue_callback_exp) {
+        // The callback must be called to give the error back to the user.
+        pending_buffer->callback(reorder_queue_callback_exp.status());
+        CHECK_EXPECTED_AS_STATUS(reorder_queue_callback_exp);
+    }
+    auto reorder_queue_callback = reorder_queue_callback_exp.release().callback;
 
     // Wrap callback with scheduler signal read finish.
     pending_buffer->callback = [this, device_id, callback=reorder_queue_callback](hailo_status status) {
         if (HAILO_SUCCESS == status) {
             auto scheduler = m_core_ops_scheduler.lock();
             assert(scheduler);
-            scheduler->signal_frame_transferred(m_core_op_handle, name(), device_id, HAILO_H2D_STREAM);
+            scheduler->signal_frame_transferred(m_core_op_handle, name(), m_trace_name, device_id, HAILO_H2D_STREAM);
         }
 
         callback(status);
@@ -80,6 +86,86 @@ hailo_status ScheduledInputStream::launch_transfer(const device_id_t &device_id)
     return status;
 }
 
+hailo_status ScheduledInputStream::launch_transfers(const device_id_t &device_id, size_t transfers_count)
+{
+    if (1 == transfers_count) {
+        // Avoids the batch allocations on the common single frame burst.
+        return launch_transfer(device_id);
+    }
+
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INTERNAL_FAILURE, "core_op_scheduler was destructed");
+
+    std::vector<TransferRequest> transfer_requests;
+    transfer_requests.reserve(transfers_count);
+    std::vector<InternalTransferDoneCallback> reorder_queue_callbacks;
+    reorder_queue_callbacks.reserve(transfers_count);
+    for (size_t i = 0; i < transfers_count; i++) {
+        auto pending_buffer = m_transfer_requests.dequeue();
+        if (!pending_buffer) {
+            // The buffers dequeued so far were already registered, so we must call their callbacks to give the error
+            // back to the user.
+            for (auto &reorder_queue_callback : reorder_queue_callbacks) {
+                reorder_queue_callback(pending_buffer.status());
+            }
+            CHECK_EXPECTED_AS_STATUS(pending_buffer);
+        }
+
+        // Wrap callback with reorder queue.
+        auto reorder_queue_callback_exp = m_callback_reorder_queue.wrap_callback(std::move(pending_buffer->callback));
+        if (!reorder_queue_callback_exp) {
+            // The callbacks must be called to give the error back to the user.
+            pending_buffer->callback(reorder_queue_callback_exp.status());
+            for (auto &reorder_queue_callback : reorder_queue_callbacks) {
+                reorder_queue_callback(reorder_queue_callback_exp.status());
+            }
+            CHECK_EXPECTED_AS_STATUS(reorder_queue_callback_exp);
+        }
+        auto reorder_queue_callback = reorder_queue_callback_exp.release().callback;
+
+        // Wrap callback with scheduler signal read finish.
+        pending_buffer->callback = [this, device_id, callback=reorder_queue_callback](hailo_status status) {
+            if (HAILO_SUCCESS == status) {
+                auto scheduler = m_core_ops_scheduler.lock();
+                assert(scheduler);
+                scheduler->signal_frame_transferred(m_core_op_handle, name(), m_trace_name, device_id, HAILO_H2D_STREAM);
+            }
+
+            callback(status);
+        };
+
+        reorder_queue_callbacks.emplace_back(reorder_queue_callback);
+        transfer_requests.emplace_back(pending_buffer.release());
+    }
+
+    assert(contains(m_streams, device_id));
+    auto status = m_streams.at(device_id).get().write_async_batch(transfer_requests);
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("write_async on device {} failed with {}", device_id, status);
+        // The pending buffers were already registered so we must call the callbacks of the buffers that weren't
+        // launched to give the error back to the user.
+        const auto launched_count = transfers_count - transfer_requests.size();
+        for (size_t i = launched_count; i < transfers_count; i++) {
+            reorder_queue_callbacks[i](status);
+        }
+    }
+    return status;
+}
+
+hailo_status ScheduledInputStream::prepare_transfers(const device_id_t &device_id, size_t transfers_count)
+{
+    assert(contains(m_streams, device_id));
+    auto &stream = m_streams.at(device_id).get();
+
+    // The requests are copied, the buffers (and their mappings) are shared with the queued requests.
+    auto pending_transfers = m_transfer_requests.peek(transfers_count);
+    for (size_t i = 0; i < pending_transfers.size(); i++) {
+        auto status = stream.prepare_async_transfer(pending_transfers[i], (0 == i));
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_stream_interface_t ScheduledInputStream::get_interface() const
 {
     // All interface values of m_streams should be the same
@@ -118,7 +204,7 @@ hailo_status ScheduledInputStream::write_async_impl(TransferRequest &&transfer_r
     }
     CHECK_SUCCESS(status);
 
-    status = core_ops_scheduler->signal_frame_pending(m_core_op_handle, name(), HAILO_H2D_STREAM);
+    status = core_ops_scheduler->signal_frame_pending(m_core_op_handle, name(), m_trace_name, HAILO_H2D_STREAM);
     if (HAILO_STREAM_ABORTED_BY_USER == status) {
         return status;
     }
@@ -185,18 +271,24 @@ hailo_status ScheduledOutputStream::launch_transfer(const device_id_t &device_id
     CHECK_EXPECTED_AS_STATUS(pending_buffer);
 
     // Wrap callback with reorder queue.
-    auto reorder_queue_callback = m_callback_reorder_queue.wrap_callback(pending_buffer->callback);
+    auto reorder_queue_callback_exp = m_callback_reorder_queue.wrap_callback(std::move(pending_buffer->callback));
+    if (!reorder_queue_callback_exp) {
+        // The callback must be called to give the error back to the user.
+        pending_buffer->callback(reorder_queue_callback_exp.status());
+        CHECK_EXPECTED_AS_STATUS(reorder_queue_callback_exp);
+    }
+    auto reorder_queue_callback = reorder_queue_callback_exp.release().callback;
 
     // Wrap callback with scheduler signal read finish.
     pending_buffer->callback = [this, device_id, callback=reorder_queue_callback](hailo_status status) {
         if (HAILO_SUCCESS == status) {
             auto scheduler = m_core_ops_scheduler.lock();
             assert(scheduler);
-            scheduler->signal_frame_transferred(m_core_op_handle, name(), device_id, HAILO_D2H_STREAM);
+            scheduler->signal_frame_transferred(m_core_op_handle, name(), m_trace_name, device_id, HAILO_D2H_STREAM);
 
             if (buffer_mode() == StreamBufferMode::NOT_OWNING) {
                 // On OWNING mode this trace is called after read_impl is called.
-                TRACE(ReadFrameTrace, m_core_op_handle, name());
+                TRACE(ReadFrameTrace, m_core_op_handle, m_trace_name);
             }
         }
 
@@ -213,6 +305,91 @@ hailo_status ScheduledOutputStream::launch_transfer(const device_id_t &device_id
     return status;
 }
 
+hailo_status ScheduledOutputStream::launch_transfers(const device_id_t &device_id, size_t transfers_count)
+{
+    if (1 == transfers_count) {
+        // Avoids the batch allocations on the common single frame burst.
+        return launch_transfer(device_id);
+    }
+
+    auto core_ops_scheduler = m_core_ops_scheduler.lock();
+    CHECK(core_ops_scheduler, HAILO_INTERNAL_FAILURE, "core_op_scheduler was destructed");
+
+    std::vector<TransferRequest> transfer_requests;
+    transfer_requests.reserve(transfers_count);
+    std::vector<InternalTransferDoneCallback> reorder_queue_callbacks;
+    reorder_queue_callbacks.reserve(transfers_count);
+    for (size_t i = 0; i < transfers_count; i++) {
+        auto pending_buffer = m_transfer_requests.dequeue();
+        if (!pending_buffer) {
+            // The buffers dequeued so far were already registered, so we must call their callbacks to give the error
+            // back to the user.
+            for (auto &reorder_queue_callback : reorder_queue_callbacks) {
+                reorder_queue_callback(pending_buffer.status());
+            }
+            CHECK_EXPECTED_AS_STATUS(pending_buffer);
+        }
+
+        // Wrap callback with reorder queue.
+        auto reorder_queue_callback_exp = m_callback_reorder_queue.wrap_callback(std::move(pending_buffer->callback));
+        if (!reorder_queue_callback_exp) {
+            // The callbacks must be called to give the error back to the user.
+            pending_buffer->callback(reorder_queue_callback_exp.status());
+            for (auto &reorder_queue_callback : reorder_queue_callbacks) {
+                reorder_queue_callback(reorder_queue_callback_exp.status());
+            }
+            CHECK_EXPECTED_AS_STATUS(reorder_queue_callback_exp);
+        }
+        auto reorder_queue_callback = reorder_queue_callback_exp.release().callback;
+
+        // Wrap callback with scheduler signal read finish.
+        pending_buffer->callback = [this, device_id, callback=reorder_queue_callback](hailo_status status) {
+            if (HAILO_SUCCESS == status) {
+                auto scheduler = m_core_ops_scheduler.lock();
+                assert(scheduler);
+                scheduler->signal_frame_transferred(m_core_op_handle, name(), m_trace_name, device_id, HAILO_D2H_STREAM);
+
+                if (buffer_mode() == StreamBufferMode::NOT_OWNING) {
+                    // On OWNING mode this trace is called after read_impl is called.
+                    TRACE(ReadFrameTrace, m_core_op_handle, m_trace_name);
+                }
+            }
+
+            callback(status);
+        };
+
+        reorder_queue_callbacks.emplace_back(reorder_queue_callback);
+        transfer_requests.emplace_back(pending_buffer.release());
+    }
+
+    assert(contains(m_streams, device_id));
+    auto status = m_streams.at(device_id).get().read_async_batch(transfer_requests);
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("read_async on device {} failed with {}", device_id, status);
+        // The pending buffers were already registered so we must call the callbacks of the buffers that weren't
+        // launched to give the error back to the user.
+        const auto launched_count = transfers_count - transfer_requests.size();
+        for (size_t i = launched_count; i < transfers_count; i++) {
+            reorder_queue_callbacks[i](status);
+        }
+    }
+    return status;
+}
+
+hailo_status ScheduledOutputStream::prepare_transfers(const device_id_t &device_id, size_t transfers_count)
+{
+    assert(contains(m_streams, device_id));
+    auto &stream = m_streams.at(device_id).get();
+
+    // The requests are copied, the buffers (and their mappings) are shared with the queued requests.
+    auto pending_transfers = m_transfer_requests.peek(transfers_count);
+    for (size_t i = 0; i < pending_transfers.size(); i++) {
+        auto status = stream.prepare_async_transfer(pending_transfers[i], (0 == i));
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_stream_interface_t ScheduledOutputStream::get_interface() const
 {
     // All interface values of m_streams should be the same
@@ -240,6 +417,25 @@ size_t ScheduledOutputStream::get_max_ongoing_transfers() const
     return m_transfer_requests.max_size();
 }
 
+hailo_status ScheduledOutputStream::register_buffers_ring(const std::vector<MemoryView> &buffers)
+{
+    // The scheduler may launch each frame on any device, so the ring is registered on the streams of all devices.
+    for (auto &pair : m_streams) {
+        auto status = pair.second.get().register_buffers_ring(buffers);
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status ScheduledOutputStream::unregister_buffers_ring()
+{
+    for (auto &pair : m_streams) {
+        auto status = pair.second.get().unregister_buffers_ring();
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
+}
+
 
 hailo_status ScheduledOutputStream::read_async_impl(TransferRequest &&transfer_request)
 {
@@ -252,7 +448,7 @@ hailo_status ScheduledOutputStream::read_async_impl(TransferRequest &&transfer_r
     }
     CHECK_SUCCESS(status);
 
-    status = core_ops_scheduler->signal_frame_pending(m_core_op_handle, name(), HAILO_D2H_STREAM);
+    status = core_ops_scheduler->signal_frame_pending(m_core_op_handle, name(), m_trace_name, HAILO_D2H_STREAM);
     if (HAILO_STREAM_ABORTED_BY_USER == status) {
         return status;
     }
@@ -61,6 +61,8 @@ public:
     virtual hailo_status write_async_impl(TransferRequest &&transfer_request) override;
 
     virtual hailo_status launch_transfer(const device_id_t &device_id) override;
+    virtual hailo_status launch_transfers(const device_id_t &device_id, size_t transfers_count) override;
+    virtual hailo_status prepare_transfers(const device_id_t &device_id, size_t transfers_count) override;
     virtual hailo_status abort() override;
     virtual hailo_status clear_abort() override;
 
@@ -112,6 +114,8 @@ public:
     {}
 
     virtual hailo_status launch_transfer(const device_id_t &device_id) override;
+    virtual hailo_status launch_transfers(const device_id_t &device_id, size_t transfers_count) override;
+    virtual hailo_status prepare_transfers(const device_id_t &device_id, size_t transfers_count) override;
 
     virtual hailo_status abort() override;
     virtual hailo_status clear_abort() override;
@@ -121,6 +125,8 @@ public:
     virtual Expected<std::unique_ptr<StreamBufferPool>> allocate_buffer_pool() override;
     virtual size_t get_max_ongoing_transfers() const override;
     virtual hailo_status read_async_impl(TransferRequest &&transfer_request) override;
+    virtual hailo_status register_buffers_ring(const std::vector<MemoryView> &buffers) override;
+    virtual hailo_status unregister_buffers_ring() override;
 
     virtual bool is_scheduled() override final { return true; };
 
@@ -134,7 +140,7 @@ public:
     {
         auto status = AsyncOutputStreamBase::read_impl(user_buffer);
         if (HAILO_SUCCESS == status) {
-            TRACE(ReadFrameTrace, m_core_op_handle, name());
+            TRACE(ReadFrameTrace, m_core_op_handle, m_trace_name);
         }
         return status;
     }
@@ -17,6 +17,7 @@
 #include "hef/hef_internal.hpp"
 
 #include <fstream>
+#include <algorithm>
 
 
 namespace hailort
@@ -54,10 +55,21 @@ hailo_status CoreOpsScheduler::add_core_op(scheduler_core_op_handle_t core_op_ha
     auto scheduled_core_op = ScheduledCoreOp::create(added_cng, stream_infos.value());
     CHECK_EXPECTED_AS_STATUS(scheduled_core_op);
 
+    // The core-op of each device is resolved once, so switching to the core-op doesn't need to look it up.
+    auto vdevice_core_op = std::dynamic_pointer_cast<VDeviceCoreOp>(added_cng);
+    CHECK(nullptr != vdevice_core_op, HAILO_INTERNAL_FAILURE);
+    std::map<device_id_t, std::shared_ptr<VdmaConfigCoreOp>> vdma_core_ops;
+    for (const auto &pair : m_devices) {
+        auto vdma_core_op = vdevice_core_op->get_core_op_by_device_id(pair.first);
+        CHECK_EXPECTED_AS_STATUS(vdma_core_op);
+        vdma_core_ops.emplace(pair.first, vdma_core_op.release());
+    }
+
     m_scheduled_core_ops.emplace(core_op_handle, scheduled_core_op.release());
 
     for (const auto &pair : m_devices) {
         auto &device_info = pair.second;
+        device_info->vdma_core_ops[core_op_handle] = vdma_core_ops.at(pair.first);
         for (const auto &stream_info : stream_infos.value()) {
             device_info->ongoing_frames[core_op_handle].insert(stream_info.name);
         }
@@ -82,18 +94,11 @@ void CoreOpsScheduler::shutdown()
     for (const auto &pair : m_devices) {
         auto &device_info = pair.second;
         if (INVALID_CORE_OP_HANDLE != device_info->current_core_op_handle) {
-            auto current_core_op = m_scheduled_core_ops.at(device_info->current_core_op_handle)->get_core_op();
-            auto current_core_op_bundle = std::dynamic_pointer_cast<VDeviceCoreOp>(current_core_op);
-            assert(nullptr != current_core_op_bundle);
-            auto vdma_core_op = current_core_op_bundle->get_core_op_by_device_id(device_info->device_id);
-            if (!vdma_core_op) {
-                LOGGER__ERROR("Error retrieving core-op in scheduler destructor");
-            } else {
-                if (HAILO_SUCCESS != VdmaConfigManager::deactivate_core_op(vdma_core_op.value())) {
-                    LOGGER__ERROR("Error deactivating core-op when destroying scheduler");
-                }
-                device_info->current_core_op_handle = INVALID_CORE_OP_HANDLE;
+            auto vdma_core_op = device_info->vdma_core_ops.at(device_info->current_core_op_handle);
+            if (HAILO_SUCCESS != VdmaConfigManager::deactivate_core_op(vdma_core_op)) {
+                LOGGER__ERROR("Error deactivating core-op when destroying scheduler");
             }
+            device_info->current_core_op_handle = INVALID_CORE_OP_HANDLE;
         }
     }
 }
@@ -105,6 +110,7 @@ hailo_status CoreOpsScheduler::switch_core_op(const scheduler_core_op_handle_t &
     assert(is_device_idle(device_id));
     auto curr_device_info = m_devices[device_id];
     curr_device_info->is_switching_core_op = false;
+    curr_device_info->prepared_core_op_handle = INVALID_CORE_OP_HANDLE;
 
     const auto burst_size = scheduled_core_op->get_burst_size();
 
@@ -122,24 +128,15 @@ hailo_status CoreOpsScheduler::switch_core_op(const scheduler_core_op_handle_t &
     curr_device_info->current_batch_size = hw_batch_size;
 
     if ((core_op_handle != curr_device_info->current_core_op_handle) || (!has_same_hw_batch_size_as_previous)) {
-        auto next_active_cng = scheduled_core_op->get_core_op();
-        auto next_active_cng_wrapper = std::dynamic_pointer_cast<VDeviceCoreOp>(next_active_cng);
-        assert(nullptr != next_active_cng_wrapper);
-        auto next_active_cng_expected = next_active_cng_wrapper->get_core_op_by_device_id(curr_device_info->device_id);
-        CHECK_EXPECTED_AS_STATUS(next_active_cng_expected);
+        auto next_active_vdma_cng = curr_device_info->vdma_core_ops.at(core_op_handle);
 
         std::shared_ptr<VdmaConfigCoreOp> current_active_vdma_cng = nullptr;
         if (curr_device_info->current_core_op_handle != INVALID_CORE_OP_HANDLE) {
-            auto current_active_cng = m_scheduled_core_ops.at(curr_device_info->current_core_op_handle)->get_core_op();
-            auto current_active_cng_bundle = std::dynamic_pointer_cast<VDeviceCoreOp>(current_active_cng);
-            assert(nullptr != current_active_cng_bundle);
-            auto current_active_cng_expected = current_active_cng_bundle->get_core_op_by_device_id(curr_device_info->device_id);
-            CHECK_EXPECTED_AS_STATUS(current_active_cng_expected);
-            current_active_vdma_cng = current_active_cng_expected.release();
+            current_active_vdma_cng = curr_device_info->vdma_core_ops.at(curr_device_info->current_core_op_handle);
         }
 
         const bool is_batch_switch = (core_op_handle == curr_device_info->current_core_op_handle);
-        auto status = VdmaConfigManager::switch_core_op(current_active_vdma_cng, next_active_cng_expected.value(), hw_batch_size,
+        auto status = VdmaConfigManager::switch_core_op(current_active_vdma_cng, next_active_vdma_cng, hw_batch_size,
             is_batch_switch);
         CHECK_SUCCESS(status, "Failed switching core-op");
     }
@@ -165,47 +162,49 @@ hailo_status CoreOpsScheduler::send_all_pending_buffers(const scheduler_core_op_
     }
 
     auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
+    if (0 == burst_size) {
+        return HAILO_SUCCESS;
+    }
 
-    for (size_t i = 0; i < burst_size; i++) {
-        if (current_device_info->frames_left_before_stop_streaming > 0) {
-            current_device_info->frames_left_before_stop_streaming--;
-        }
+    current_device_info->frames_left_before_stop_streaming -= std::min(
+        current_device_info->frames_left_before_stop_streaming, static_cast<size_t>(burst_size));
 
-        for (auto &input_stream : scheduled_core_op->get_core_op()->get_input_streams()) {
-            const auto &stream_name = input_stream.get().name();
-            scheduled_core_op->pending_frames().decrease(stream_name);
-            current_device_info->ongoing_frames[core_op_handle].increase(stream_name);
+    // The whole burst of each stream is launched at once, so the descriptors of all frames are programmed to the
+    // channel with a single doorbell.
+    for (auto &input_stream : scheduled_core_op->get_core_op()->get_input_streams()) {
+        const auto &stream_name = input_stream.get().name();
+        scheduled_core_op->decrease_pending_frames(stream_name, HAILO_H2D_STREAM, burst_size);
+        current_device_info->ongoing_frames[core_op_handle].increase(stream_name, burst_size);
 
-            // After launching the transfer, signal_frame_transferred may be called (and ongoing frames will be
-            // decreased).
-            auto &input_stream_base = static_cast<InputStreamBase&>(input_stream.get());
-            auto status = input_stream_base.launch_transfer(device_id);
-            if (HAILO_STREAM_ABORTED_BY_USER == status) {
-                LOGGER__INFO("launch_transfer has failed with status=HAILO_STREAM_ABORTED_BY_USER");
-                return status;
-            }
-            CHECK_SUCCESS(status);
+        // After launching the transfers, signal_frame_transferred may be called (and ongoing frames will be
+        // decreased).
+        auto &input_stream_base = static_cast<InputStreamBase&>(input_stream.get());
+        auto status = input_stream_base.launch_transfers(device_id, burst_size);
+        if (HAILO_STREAM_ABORTED_BY_USER == status) {
+            LOGGER__INFO("launch_transfers has failed with status=HAILO_STREAM_ABORTED_BY_USER");
+            return status;
         }
+        CHECK_SUCCESS(status);
+    }
 
-        for (auto &output_stream : scheduled_core_op->get_core_op()->get_output_streams()) {
-            const auto &stream_name = output_stream.get().name();
-            scheduled_core_op->pending_frames().decrease(stream_name);
-            current_device_info->ongoing_frames[core_op_handle].increase(stream_name);
+    for (auto &output_stream : scheduled_core_op->get_core_op()->get_output_streams()) {
+        const auto &stream_name = output_stream.get().name();
+        scheduled_core_op->decrease_pending_frames(stream_name, HAILO_D2H_STREAM, burst_size);
+        current_device_info->ongoing_frames[core_op_handle].increase(stream_name, burst_size);
 
-            // After launching the transfer, signal_frame_transferred may be called (and ongoing frames will be
-            // decreased).
-            auto &output_stream_base = static_cast<OutputStreamBase&>(output_stream.get());
-            auto status = output_stream_base.launch_transfer(device_id);
-            if (HAILO_STREAM_ABORTED_BY_USER == status) {
-                LOGGER__INFO("launch_transfer has failed with status=HAILO_STREAM_ABORTED_BY_USER");
-                return status;
-            }
-            CHECK_SUCCESS(status);
+        // After launching the transfers, signal_frame_transferred may be called (and ongoing frames will be
+        // decreased).
+        auto &output_stream_base = static_cast<OutputStreamBase&>(output_stream.get());
+        auto status = output_stream_base.launch_transfers(device_id, burst_size);
+        if (HAILO_STREAM_ABORTED_BY_USER == status) {
+            LOGGER__INFO("launch_transfers has failed with status=HAILO_STREAM_ABORTED_BY_USER");
+            return status;
         }
-
-        scheduled_core_op->set_last_device(device_id);
+        CHECK_SUCCESS(status);
     }
 
+    scheduled_core_op->set_last_device(device_id);
+
     return HAILO_SUCCESS;
 }
 
@@ -222,41 +221,15 @@ CoreOpsScheduler::ReadyInfo CoreOpsScheduler::is_core_op_ready(const scheduler_c
 
     auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
 
-    std::vector<bool> over_threshold;
-    over_threshold.reserve(scheduled_core_op->get_inputs_names().size());
-    std::vector<bool> over_timeout;
-    over_timeout.reserve(scheduled_core_op->get_inputs_names().size());
-
     if (check_threshold) {
-        for (const auto &name : scheduled_core_op->get_inputs_names()) {
-            auto threshold_exp = scheduled_core_op->get_threshold(name);
-            if (!threshold_exp) {
-                LOGGER__ERROR("Failed to get threshold for stream {}", name);
-                return result;
-            }
-            auto threshold = (DEFAULT_SCHEDULER_MIN_THRESHOLD == threshold_exp.value()) ? 1 : threshold_exp.value();
-            auto timeout_exp = scheduled_core_op->get_timeout();
-            if (!timeout_exp) {
-                LOGGER__ERROR("Failed to get timeout for stream {}", name);
-                return result;
-            }
-            auto timeout = timeout_exp.release();
-
-            // Check if there arent enough write requests to reach threshold and timeout didnt passed
-            const auto write_requests = scheduled_core_op->pending_frames()[name];
-            auto stream_over_threshold = write_requests >= threshold;
-            auto stream_over_timeout = timeout <= (std::chrono::steady_clock::now() - scheduled_core_op->get_last_run_timestamp());
-            over_threshold.push_back(stream_over_threshold);
-            over_timeout.push_back(stream_over_timeout);
-            if (stream_over_threshold || stream_over_timeout) {
-                continue;
-            } else {
-                result.is_ready = false;
-                return result;
-            }
+        // The inputs over threshold are counted when the pending frames change, and the timeout is the same for all
+        // inputs, so this check doesn't depend on the number of streams.
+        result.over_threshold = scheduled_core_op->are_all_inputs_over_threshold();
+        result.over_timeout = scheduled_core_op->is_over_timeout(std::chrono::steady_clock::now());
+        if (!result.over_threshold && !result.over_timeout) {
+            // Some input hasn't reached the threshold, and the timeout didn't pass
+            return result;
         }
-        result.over_threshold = std::all_of(over_threshold.begin(), over_threshold.end(), [](auto over) { return over; });
-        result.over_timeout = std::all_of(over_timeout.begin(), over_timeout.end(), [](auto over) { return over; });
     }
 
     result.is_ready = (get_frames_ready_to_transfer(core_op_handle, device_id) > 0);
@@ -265,7 +238,7 @@ CoreOpsScheduler::ReadyInfo CoreOpsScheduler::is_core_op_ready(const scheduler_c
 }
 
 hailo_status CoreOpsScheduler::signal_frame_pending(const scheduler_core_op_handle_t &core_op_handle,
-    const std::string &stream_name, hailo_stream_direction_t direction)
+    const std::string &stream_name, trace_string_id_t trace_name, hailo_stream_direction_t direction)
 {
     std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
     auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
@@ -275,26 +248,28 @@ hailo_status CoreOpsScheduler::signal_frame_pending(const scheduler_core_op_hand
     }
 
     if (HAILO_H2D_STREAM == direction) {
-        TRACE(WriteFrameTrace, core_op_handle, stream_name);
+        TRACE(WriteFrameTrace, core_op_handle, trace_name);
         scheduled_core_op->mark_frame_sent();
     }
 
-    scheduled_core_op->pending_frames().increase(stream_name);
+    scheduled_core_op->increase_pending_frames(stream_name, direction);
     m_scheduler_thread.signal();
 
     return HAILO_SUCCESS;
 }
 
 void CoreOpsScheduler::signal_frame_transferred(const scheduler_core_op_handle_t &core_op_handle,
-    const std::string &stream_name, const device_id_t &device_id, hailo_stream_direction_t stream_direction)
+    const std::string &stream_name, trace_string_id_t trace_name, const device_id_t &device_id,
+    hailo_stream_direction_t stream_direction)
 {
     std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
 
     auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
 
-    m_devices[device_id]->ongoing_frames[core_op_handle].decrease(stream_name);
+    auto &device_info = m_devices[device_id];
+    device_info->ongoing_frames[core_op_handle].decrease(stream_name);
     if (HAILO_D2H_STREAM == stream_direction) {
-        TRACE(OutputVdmaEnqueueTrace, device_id, core_op_handle, stream_name);
+        TRACE(OutputVdmaEnqueueTrace, device_info->trace_device_id, core_op_handle, trace_name);
     }
 
     m_scheduler_thread.signal();
@@ -406,7 +381,7 @@ uint16_t CoreOpsScheduler::get_frames_ready_to_transfer(scheduler_core_op_handle
     const device_id_t &device_id) const
 {
     auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
-    auto device_info = m_devices.at(device_id);
+    const auto &device_info = m_devices.at(device_id);
 
     const auto max_ongoing_frames = scheduled_core_op->get_max_ongoing_frames_per_device();
     const auto ongoing_frames = device_info->ongoing_frames[core_op_handle].get_max_value();
@@ -419,29 +394,102 @@ uint16_t CoreOpsScheduler::get_frames_ready_to_transfer(scheduler_core_op_handle
 
 void CoreOpsScheduler::schedule()
 {
-    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
-    m_scheduled_core_ops.for_each([this](const std::pair<vdevice_core_op_handle_t, ScheduledCoreOpPtr> &core_op_pair) {
-        auto status = optimize_streaming_if_enabled(core_op_pair.first);
-        if ((HAILO_SUCCESS != status) &&
-            (HAILO_STREAM_ABORTED_BY_USER != status)) {
-            LOGGER__ERROR("optimize_streaming_if_enabled thread failed with status={}", status);
+    std::vector<CoreOpPreparation> preparations;
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+        m_scheduled_core_ops.for_each([this](const std::pair<vdevice_core_op_handle_t, ScheduledCoreOpPtr> &core_op_pair) {
+            auto status = optimize_streaming_if_enabled(core_op_pair.first);
+            if ((HAILO_SUCCESS != status) &&
+                (HAILO_STREAM_ABORTED_BY_USER != status)) {
+                LOGGER__ERROR("optimize_streaming_if_enabled thread failed with status={}", status);
+            }
+
+        });
+
+        auto oracle_decisions = CoreOpsSchedulerOracle::get_oracle_decisions(*this);
+
+        for (const auto &run_params : oracle_decisions) {
+            auto status = switch_core_op(run_params.core_op_handle, run_params.device_id);
+            if (HAILO_STREAM_ABORTED_BY_USER == status) {
+                continue;
+            }
+
+            if (HAILO_SUCCESS != status) {
+                LOGGER__ERROR("Scheduler thread failed with status={}", status);
+                break;
+            }
         }
 
-    });
+        preparations = get_core_ops_to_prepare();
+    }
 
-    auto oracle_decisions = CoreOpsSchedulerOracle::get_oracle_decisions(*this);
+    // Mapping the buffers (dma_map ioctls) may take a while, so it is done after the scheduler mutex is released.
+    prepare_core_ops(preparations);
+}
 
-    for (const auto &run_params : oracle_decisions) {
-        auto status = switch_core_op(run_params.core_op_handle, run_params.device_id);
-        if (HAILO_STREAM_ABORTED_BY_USER == status) {
+std::vector<CoreOpsScheduler::CoreOpPreparation> CoreOpsScheduler::get_core_ops_to_prepare()
+{
+    std::vector<CoreOpPreparation> preparations;
+    for (const auto &pair : m_devices) {
+        auto &device_info = pair.second;
+        if (device_info->is_switching_core_op || is_device_idle(device_info->device_id)) {
+            // The next core-op is (or will be) switched to right away.
+            continue;
+        }
+
+        const auto core_op_handle = CoreOpsSchedulerOracle::get_core_op_to_prepare(*this, device_info->device_id);
+        if ((INVALID_CORE_OP_HANDLE == core_op_handle) || (core_op_handle == device_info->prepared_core_op_handle)) {
             continue;
         }
 
+        auto scheduled_core_op = m_scheduled_core_ops.at(core_op_handle);
+        const size_t frames_count = std::min(get_frames_ready_to_transfer(core_op_handle, device_info->device_id),
+            scheduled_core_op->get_burst_size());
+        preparations.emplace_back(CoreOpPreparation{core_op_handle, device_info->device_id, scheduled_core_op,
+            frames_count});
+    }
+    return preparations;
+}
+
+void CoreOpsScheduler::prepare_core_ops(const std::vector<CoreOpPreparation> &preparations)
+{
+    if (preparations.empty()) {
+        return;
+    }
+
+    std::vector<std::reference_wrapper<const CoreOpPreparation>> prepared;
+    for (const auto &preparation : preparations) {
+        auto status = prepare_core_op(preparation);
         if (HAILO_SUCCESS != status) {
-            LOGGER__ERROR("Scheduler thread failed with status={}", status);
-            break;
+            // Not critical, the transfers are prepared again when launched
+            LOGGER__WARNING("Failed preparing core-op {} on device {} with status={}", preparation.core_op_handle,
+                preparation.device_id, status);
+            continue;
         }
+        prepared.emplace_back(preparation);
     }
+
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    for (const auto &preparation : prepared) {
+        m_devices.at(preparation.get().device_id)->prepared_core_op_handle = preparation.get().core_op_handle;
+    }
+}
+
+hailo_status CoreOpsScheduler::prepare_core_op(const CoreOpPreparation &preparation)
+{
+    for (auto &input_stream : preparation.scheduled_core_op->get_core_op()->get_input_streams()) {
+        auto &input_stream_base = static_cast<InputStreamBase&>(input_stream.get());
+        auto status = input_stream_base.prepare_transfers(preparation.device_id, preparation.frames_count);
+        CHECK_SUCCESS(status);
+    }
+
+    for (auto &output_stream : preparation.scheduled_core_op->get_core_op()->get_output_streams()) {
+        auto &output_stream_base = static_cast<OutputStreamBase&>(output_stream.get());
+        auto status = output_stream_base.prepare_transfers(preparation.device_id, preparation.frames_count);
+        CHECK_SUCCESS(status);
+    }
+
+    return HAILO_SUCCESS;
 }
 
 CoreOpsScheduler::SchedulerThread::SchedulerThread(CoreOpsScheduler &scheduler) :
@@ -56,11 +56,13 @@ public:
     // is not recoverable.
     void shutdown();
 
+    // trace_name is the interned stream name (see TraceStrings), so the per-frame traces don't look it up.
     hailo_status signal_frame_pending(const scheduler_core_op_handle_t &core_op_handle, const std::string &stream_name,
-        hailo_stream_direction_t direction);
+        trace_string_id_t trace_name, hailo_stream_direction_t direction);
 
     void signal_frame_transferred(const scheduler_core_op_handle_t &core_op_handle,
-        const std::string &stream_name, const device_id_t &device_id, hailo_stream_direction_t direction);
+        const std::string &stream_name, trace_string_id_t trace_name, const device_id_t &device_id,
+        hailo_stream_direction_t direction);
 
     void enable_stream(const scheduler_core_op_handle_t &core_op_handle, const std::string &stream_name);
     void disable_stream(const scheduler_core_op_handle_t &core_op_handle, const std::string &stream_name);
@@ -78,6 +80,21 @@ private:
 
     hailo_status send_all_pending_buffers(const scheduler_core_op_handle_t &core_op_handle, const device_id_t &device_id, uint32_t burst_size);
 
+    // While a core-op is running on a device, the transfers of the core-op expected to run next on it are prepared
+    // (the host side work that doesn't depend on the device state), so the switch only activates the core-op and
+    // launches the transfers.
+    struct CoreOpPreparation {
+        scheduler_core_op_handle_t core_op_handle;
+        device_id_t device_id;
+        ScheduledCoreOpPtr scheduled_core_op;
+        size_t frames_count;
+    };
+    // Chooses the core-ops to prepare (called with m_scheduler_mutex locked)
+    std::vector<CoreOpPreparation> get_core_ops_to_prepare();
+    // Prepares the transfers (maps their buffers) without m_scheduler_mutex, and marks the core-ops as prepared under it
+    void prepare_core_ops(const std::vector<CoreOpPreparation> &preparations);
+    hailo_status prepare_core_op(const CoreOpPreparation &preparation);
+
     bool should_core_op_stop(const scheduler_core_op_handle_t &core_op_handle);
 
     hailo_status optimize_streaming_if_enabled(const scheduler_core_op_handle_t &core_op_handle);
@@ -18,6 +18,7 @@
 
 #include "stream_common/stream_internal.hpp"
 #include "vdevice/scheduler/scheduler_counter.hpp"
+#include "utils/profiler/trace_strings.hpp"
 
 #include <condition_variable>
 
@@ -34,12 +35,15 @@ using core_op_priority_t = uint8_t;
 
 using stream_name_t = std::string;
 
+class VdmaConfigCoreOp;
+
 struct ActiveDeviceInfo {
     ActiveDeviceInfo(const device_id_t &device_id, const std::string &device_arch) : 
         current_core_op_handle(INVALID_CORE_OP_HANDLE), next_core_op_handle(INVALID_CORE_OP_HANDLE), is_switching_core_op(false), 
+        prepared_core_op_handle(INVALID_CORE_OP_HANDLE),
         current_batch_size(0),
         frames_left_before_stop_streaming(0),
-        device_id(device_id), device_arch(device_arch)
+        device_id(device_id), device_arch(device_arch), trace_device_id(TraceStrings::get_id(device_id))
     {}
 
     uint32_t get_ongoing_frames() const
@@ -60,6 +64,8 @@ struct ActiveDeviceInfo {
     scheduler_core_op_handle_t current_core_op_handle;
     scheduler_core_op_handle_t next_core_op_handle;
     std::atomic_bool is_switching_core_op;
+    // The core-op whose next transfers were prepared on this device while the current core-op is running
+    scheduler_core_op_handle_t prepared_core_op_handle;
     std::atomic_uint32_t current_batch_size;
 
     // Until this counter is greater than zero, we won't stop streaming on current core op if we have ready frames
@@ -70,8 +76,13 @@ struct ActiveDeviceInfo {
     // launching transfer and decrease it when we get the transfer callback called.
     std::unordered_map<scheduler_core_op_handle_t, SchedulerCounter> ongoing_frames;
 
+    // The core-op of each scheduled core-op on this device (resolved once, when the core-op is added)
+    std::unordered_map<scheduler_core_op_handle_t, std::shared_ptr<VdmaConfigCoreOp>> vdma_core_ops;
+
     device_id_t device_id;
     std::string device_arch;
+    // The interned device id, for the traces (see TraceStrings)
+    trace_string_id_t trace_device_id;
 };
 
 
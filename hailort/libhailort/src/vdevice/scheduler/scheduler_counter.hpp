@@ -13,6 +13,8 @@
 #include "common/utils.hpp"
 
 #include <unordered_map>
+#include <deque>
+#include <algorithm>
 #include <cassert>
 #include <atomic>
 
@@ -21,51 +23,62 @@ namespace hailort
 
 using stream_name_t = std::string;
 
+// The counters are stored contiguously (the names only map to their index), so reading the min/max value doesn't
+// iterate a string keyed map.
 class SchedulerCounter
 {
 public:
-    SchedulerCounter() : m_map()
+    SchedulerCounter() : m_indices(), m_values()
     {}
 
     void insert(const stream_name_t &name)
     {
-        assert(!contains(m_map, name));
-        m_map[name] = 0;
+        assert(!contains(m_indices, name));
+        m_indices[name] = m_values.size();
+        m_values.emplace_back(0);
     }
 
     uint32_t operator[](const stream_name_t &name) const
     {
-        assert(contains(m_map, name));
-        return m_map.at(name);
+        return m_values[index_of(name)];
     }
 
-    void increase(const stream_name_t &name)
+    // Returns the counter value before the increase
+    uint32_t increase(const stream_name_t &name, uint32_t count = 1)
     {
-        assert(contains(m_map, name));
-        m_map[name]++;
+        return m_values[index_of(name)].fetch_add(count);
     }
 
-    void decrease(const stream_name_t &name)
+    // Returns the counter value before the decrease
+    uint32_t decrease(const stream_name_t &name, uint32_t count = 1)
     {
-        assert(contains(m_map, name));
-        assert(m_map[name] > 0);
-        m_map[name]--;
+        const auto prev_value = m_values[index_of(name)].fetch_sub(count);
+        assert(prev_value >= count);
+        return prev_value;
     }
 
     uint32_t get_min_value() const
     {
-        return get_min_value_of_unordered_map(m_map);
+        uint32_t min_value = UINT32_MAX;
+        for (const auto &value : m_values) {
+            min_value = std::min(min_value, value.load());
+        }
+        return min_value;
     }
 
     uint32_t get_max_value() const
     {
-        return get_max_value_of_unordered_map(m_map);
+        uint32_t max_value = 0;
+        for (const auto &value : m_values) {
+            max_value = std::max(max_value, value.load());
+        }
+        return max_value;
     }
 
     bool all_values_bigger_or_equal(uint32_t value) const
     {
-        for (const auto &pair : m_map) {
-            if (value > pair.second) {
+        for (const auto &counter : m_values) {
+            if (value > counter) {
                 return false;
             }
         }
@@ -74,8 +87,8 @@ public:
 
     bool empty() const
     {
-        for (const auto &pair : m_map) {
-            if (0 != pair.second) {
+        for (const auto &value : m_values) {
+            if (0 != value) {
                 return false;
             }
         }
@@ -84,13 +97,21 @@ public:
 
     void reset()
     {
-        for (auto &pair : m_map) {
-            pair.second = 0;
+        for (auto &value : m_values) {
+            value = 0;
         }
     }
 
 private:
-    std::unordered_map<stream_name_t, std::atomic_uint32_t> m_map;
+    size_t index_of(const stream_name_t &name) const
+    {
+        assert(contains(m_indices, name));
+        return m_indices.at(name);
+    }
+
+    std::unordered_map<stream_name_t, size_t> m_indices;
+    // std::deque doesn't move its elements on insertion (std::atomic isn't movable)
+    std::deque<std::atomic_uint32_t> m_values;
 };
 
 
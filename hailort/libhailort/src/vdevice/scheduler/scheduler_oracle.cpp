@@ -29,7 +29,7 @@ scheduler_core_op_handle_t CoreOpsSchedulerOracle::choose_next_model(SchedulerBa
             if (ready_info.is_ready) {
                 // In cases device is idle the check_threshold is not needed, therefore is false.
                 bool switch_because_idle = !(check_threshold);
-                TRACE(OracleDecisionTrace, switch_because_idle, device_id, core_op_handle, ready_info.over_threshold, ready_info.over_timeout);
+                TRACE(OracleDecisionTrace, switch_because_idle, device_info->trace_device_id, core_op_handle, ready_info.over_threshold, ready_info.over_timeout);
                 device_info->is_switching_core_op = true;
                 device_info->next_core_op_handle = core_op_handle;
                 // Set next to run as next in round-robin
@@ -69,6 +69,29 @@ bool CoreOpsSchedulerOracle::should_stop_streaming(SchedulerBase &scheduler, cor
     return false;
 }
 
+scheduler_core_op_handle_t CoreOpsSchedulerOracle::get_core_op_to_prepare(SchedulerBase &scheduler,
+    const device_id_t &device_id)
+{
+    // Same order as choose_next_model (with the threshold checked), skipping the running core-op.
+    const auto device_info = scheduler.get_device_info(device_id);
+    auto priority_map = scheduler.get_core_op_priority_map();
+    for (auto iter = priority_map.rbegin(); iter != priority_map.rend(); ++iter) {
+        auto priority_group_size = iter->second.size();
+
+        for (uint32_t i = 0; i < priority_group_size; i++) {
+            uint32_t index = scheduler.get_next_core_op(iter->first) + i;
+            index %= static_cast<uint32_t>(priority_group_size);
+            auto core_op_handle = iter->second[index];
+            if ((core_op_handle != device_info->current_core_op_handle) &&
+                scheduler.is_core_op_ready(core_op_handle, true, device_id).is_ready) {
+                return core_op_handle;
+            }
+        }
+    }
+
+    return INVALID_CORE_OP_HANDLE;
+}
+
 bool CoreOpsSchedulerOracle::is_core_op_active(SchedulerBase &scheduler, scheduler_core_op_handle_t core_op_handle)
 {
     auto &devices = scheduler.get_device_infos();
@@ -32,6 +32,9 @@ public:
     static scheduler_core_op_handle_t choose_next_model(SchedulerBase &scheduler, const device_id_t &device_id, bool check_threshold);
     static std::vector<RunParams> get_oracle_decisions(SchedulerBase &scheduler);
     static bool should_stop_streaming(SchedulerBase &scheduler, core_op_priority_t core_op_priority, const device_id_t &device_id);
+    // Returns the core-op that is expected to run next on the device (once the running core-op is done), without
+    // changing the scheduler state.
+    static scheduler_core_op_handle_t get_core_op_to_prepare(SchedulerBase &scheduler, const device_id_t &device_id);
 
 private:
     CoreOpsSchedulerOracle() {}
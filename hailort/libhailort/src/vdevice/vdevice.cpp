@@ -100,6 +100,18 @@ Expected<ConfigureNetworkParams> VDevice::create_configure_params(Hef &hef, cons
     return hef.create_configure_params(stream_interface.release(), network_group_name);
 }
 
+hailo_status VDevice::invalidate_dma_mapping_cache(void *address, size_t size)
+{
+    auto physical_devices = get_physical_devices();
+    CHECK_EXPECTED_AS_STATUS(physical_devices);
+
+    for (auto &device : physical_devices.value()) {
+        auto status = device.get().invalidate_dma_mapping_cache(address, size);
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status VDevice::before_fork()
 {
     return HAILO_SUCCESS;
@@ -332,6 +344,15 @@ Expected<InferModel> VDeviceClient::create_infer_model(const std::string &hef_pa
     return make_unexpected(HAILO_NOT_IMPLEMENTED);
 }
 
+hailo_status VDeviceClient::invalidate_dma_mapping_cache(void *address, size_t size)
+{
+    (void)address;
+    (void)size;
+    // User buffers are passed to the service by copy, so they are never mapped (nor cached) on the client side
+    LOGGER__ERROR("DMA mapping cache invalidation is not supported when working with the service");
+    return HAILO_NOT_SUPPORTED;
+}
+
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
 
@@ -127,6 +127,7 @@ public:
     Expected<std::vector<std::string>> get_physical_devices_ids() const override;
     Expected<hailo_stream_interface_t> get_default_streams_interface() const override;
     virtual Expected<InferModel> create_infer_model(const std::string &hef_path) override;
+    virtual hailo_status invalidate_dma_mapping_cache(void *address, size_t size) override;
 
     virtual hailo_status before_fork() override;
     virtual hailo_status after_fork_in_parent() override;
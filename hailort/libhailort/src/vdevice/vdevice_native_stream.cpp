@@ -137,7 +137,7 @@ hailo_status VDeviceNativeInputStream::flush()
 
 hailo_status VDeviceNativeInputStream::write_impl(const MemoryView &buffer)
 {
-    TRACE(WriteFrameTrace, m_core_op_handle, name());
+    TRACE(WriteFrameTrace, m_core_op_handle, m_trace_name);
 
     auto status = next_stream().write_impl(buffer);
     if ((HAILO_STREAM_ABORTED_BY_USER == status) || (HAILO_STREAM_NOT_ACTIVATED == status)){
@@ -180,13 +180,19 @@ hailo_status VDeviceNativeInputStream::write_async(TransferRequest &&transfer_re
 {
     // TODO HRT-10583 - allow option to remove reorder queue
     CHECK(m_callback_reorder_queue, HAILO_INVALID_OPERATION, "Stream does not support async api");
-    transfer_request.callback = m_callback_reorder_queue->wrap_callback(transfer_request.callback);
+    auto reorder_queue_callback = m_callback_reorder_queue->wrap_callback(std::move(transfer_request.callback));
+    if (HAILO_QUEUE_IS_FULL == reorder_queue_callback.status()) {
+        return HAILO_QUEUE_IS_FULL;
+    }
+    CHECK_EXPECTED_AS_STATUS(reorder_queue_callback);
+    const auto callback_index = reorder_queue_callback->index;
+    transfer_request.callback = std::move(reorder_queue_callback->callback);
 
-    TRACE(WriteFrameTrace, m_core_op_handle, name());
+    TRACE(WriteFrameTrace, m_core_op_handle, m_trace_name);
 
     auto status = next_stream().write_async(std::move(transfer_request));
     if (HAILO_SUCCESS != status) {
-        m_callback_reorder_queue->cancel_last_callback();
+        m_callback_reorder_queue->cancel_callback(callback_index);
         return status;
     }
 
@@ -328,7 +334,7 @@ hailo_status VDeviceNativeOutputStream::read_impl(MemoryView buffer)
     }
     CHECK_SUCCESS(status, "Failed read from stream (device: {})", m_next_transfer_stream);
 
-    TRACE(ReadFrameTrace, m_core_op_handle, name());
+    TRACE(ReadFrameTrace, m_core_op_handle, m_trace_name);
 
     advance_stream();
     return HAILO_SUCCESS;
@@ -360,17 +366,41 @@ Expected<size_t> VDeviceNativeOutputStream::get_async_max_queue_size() const
     return actual_queue_per_stream * m_streams.size();
 }
 
+hailo_status VDeviceNativeOutputStream::register_buffers_ring(const std::vector<MemoryView> &buffers)
+{
+    // The ring is registered on all devices. Since the frames are split between the devices, with more than one device
+    // the buffers don't return to the same descriptors, and only their mappings are reused.
+    for (auto &pair : m_streams) {
+        auto status = pair.second.get().register_buffers_ring(buffers);
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDeviceNativeOutputStream::unregister_buffers_ring()
+{
+    for (auto &pair : m_streams) {
+        auto status = pair.second.get().unregister_buffers_ring();
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status VDeviceNativeOutputStream::read_async(TransferRequest &&transfer_request)
 {
     // TODO HRT-10583 - allow option to remove reorder queue
     CHECK(m_callback_reorder_queue, HAILO_INVALID_OPERATION, "Stream does not support async api");
 
+    auto reorder_queue_callback = m_callback_reorder_queue->wrap_callback(std::move(transfer_request.callback));
+    if (HAILO_QUEUE_IS_FULL == reorder_queue_callback.status()) {
+        return HAILO_QUEUE_IS_FULL;
+    }
+    CHECK_EXPECTED_AS_STATUS(reorder_queue_callback);
+    const auto callback_index = reorder_queue_callback->index;
 
-    auto reorder_queue_callback = m_callback_reorder_queue->wrap_callback(transfer_request.callback);
-
-    transfer_request.callback = [this, callback=reorder_queue_callback](hailo_status status) {
+    transfer_request.callback = [this, callback=std::move(reorder_queue_callback->callback)](hailo_status status) {
         if (HAILO_SUCCESS == status) {
-            TRACE(ReadFrameTrace, m_core_op_handle, name());
+            TRACE(ReadFrameTrace, m_core_op_handle, m_trace_name);
         }
 
         callback(status);
@@ -378,7 +408,7 @@ hailo_status VDeviceNativeOutputStream::read_async(TransferRequest &&transfer_re
 
     auto status = next_stream().read_async(std::move(transfer_request));
     if (HAILO_SUCCESS != status) {
-        m_callback_reorder_queue->cancel_last_callback();
+        m_callback_reorder_queue->cancel_callback(callback_index);
         return status;
     }
 
@@ -110,7 +110,7 @@ public:
         for (auto &output_stream :  m_streams) {
             if (HAILO_STREAM_INTERFACE_ETH != output_stream.second.get().get_interface()) {
                 auto register_status = output_stream.second.get().register_interrupt_callback(
-                    [core_op_handle=m_core_op_handle, name=name(), device_id=output_stream.first]() {
+                    [core_op_handle=m_core_op_handle, name=m_trace_name, device_id=TraceStrings::get_id(output_stream.first)]() {
                         TRACE(OutputVdmaEnqueueTrace, device_id, core_op_handle, name);
                     }
                 );
@@ -137,6 +137,8 @@ public:
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout) override;
     virtual hailo_status read_async(TransferRequest &&transfer_request) override;
     virtual Expected<size_t> get_async_max_queue_size() const override;
+    virtual hailo_status register_buffers_ring(const std::vector<MemoryView> &buffers) override;
+    virtual hailo_status unregister_buffers_ring() override;
 
 private:
     OutputStreamBase &next_stream();
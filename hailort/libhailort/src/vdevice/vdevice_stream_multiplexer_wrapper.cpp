@@ -87,6 +87,16 @@ hailo_status VDeviceInputStreamMultiplexerWrapper::launch_transfer(const device_
     return m_base_stream->launch_transfer(device_id);
 }
 
+hailo_status VDeviceInputStreamMultiplexerWrapper::launch_transfers(const device_id_t &device_id, size_t transfers_count)
+{
+    return m_base_stream->launch_transfers(device_id, transfers_count);
+}
+
+hailo_status VDeviceInputStreamMultiplexerWrapper::prepare_transfers(const device_id_t &device_id, size_t transfers_count)
+{
+    return m_base_stream->prepare_transfers(device_id, transfers_count);
+}
+
 Expected<size_t> VDeviceInputStreamMultiplexerWrapper::get_buffer_frames_size() const
 {
     return m_base_stream->get_buffer_frames_size();
@@ -238,6 +248,16 @@ hailo_status VDeviceOutputStreamMultiplexerWrapper::launch_transfer(const device
     return m_base_stream->launch_transfer(device_id);
 }
 
+hailo_status VDeviceOutputStreamMultiplexerWrapper::launch_transfers(const device_id_t &device_id, size_t transfers_count)
+{
+    return m_base_stream->launch_transfers(device_id, transfers_count);
+}
+
+hailo_status VDeviceOutputStreamMultiplexerWrapper::prepare_transfers(const device_id_t &device_id, size_t transfers_count)
+{
+    return m_base_stream->prepare_transfers(device_id, transfers_count);
+}
+
 hailo_status VDeviceOutputStreamMultiplexerWrapper::abort()
 {
     if (*m_is_aborted) {
@@ -52,6 +52,8 @@ public:
     virtual bool is_scheduled() override;
 
     virtual hailo_status launch_transfer(const device_id_t &device_id) override;
+    virtual hailo_status launch_transfers(const device_id_t &device_id, size_t transfers_count) override;
+    virtual hailo_status prepare_transfers(const device_id_t &device_id, size_t transfers_count) override;
     virtual Expected<size_t> get_buffer_frames_size() const override;
 
 protected:
@@ -91,6 +93,8 @@ public:
     virtual hailo_stream_interface_t get_interface() const override;
     virtual std::chrono::milliseconds get_timeout() const override;
     virtual hailo_status launch_transfer(const device_id_t &device_id) override;
+    virtual hailo_status launch_transfers(const device_id_t &device_id, size_t transfers_count) override;
+    virtual hailo_status prepare_transfers(const device_id_t &device_id, size_t transfers_count) override;
     virtual hailo_status abort() override;
     virtual hailo_status clear_abort() override;
     virtual bool is_scheduled() override;
@@ -15,6 +15,7 @@
 #include "vdma/memory/vdma_buffer.hpp"
 
 #include <list>
+#include <algorithm>
 #include <chrono>
 #include <thread>
 #include <iostream>
@@ -23,6 +24,9 @@
 namespace hailort {
 namespace vdma {
 
+// Limits the bound buffers cache, so checking if a buffer is bound stays cheap (forgetting a binding only means the
+// buffer is bound again on its next transfer).
+static constexpr size_t MAX_BOUNDED_BUFFERS = 64;
 
 Expected<BoundaryChannelPtr> BoundaryChannel::create(vdma::ChannelId channel_id, Direction direction,
     HailoRTDriver &driver, uint32_t descs_count, uint16_t desc_page_size, const std::string &stream_name,
@@ -48,7 +52,7 @@ BoundaryChannel::BoundaryChannel(vdma::ChannelId channel_id, Direction direction
     m_latency_meter(latency_meter),
     m_is_channel_activated(false),
     m_ongoing_transfers((latency_meter != nullptr) ? ONGOING_TRANSFERS_SIZE/2 : ONGOING_TRANSFERS_SIZE),
-    m_last_bounded_buffer(BoundedBuffer{nullptr, 0, 0})
+    m_bounded_buffers()
 {
     if (Direction::BOTH == direction) {
         LOGGER__ERROR("Boundary channels must be unidirectional");
@@ -69,6 +73,7 @@ BoundaryChannel::BoundaryChannel(vdma::ChannelId channel_id, Direction direction
     }
 
     CB_INIT(m_descs, descs_count);
+    m_bounded_buffers.reserve(MAX_BOUNDED_BUFFERS);
 
     status = allocate_descriptor_list(descs_count, desc_page_size);
     if (HAILO_SUCCESS != status) {
@@ -95,6 +100,14 @@ hailo_status BoundaryChannel::trigger_channel_completion(uint16_t hw_num_process
     // value can be m_descs.size, in this case we change it to zero.
     hw_num_processed = static_cast<uint16_t>(hw_num_processed & m_descs.size_mask);
 
+    // The num processed of an irq may be older than the one already handled (when the interrupts dispatcher reads it
+    // from the channel after a core-op switch, a later irq may hold a value read before). Such values are outside
+    // [tail, head], and are ignored.
+    if (!is_desc_between(static_cast<uint16_t>(CB_TAIL(m_descs)), static_cast<uint16_t>(CB_HEAD(m_descs)),
+            hw_num_processed) && (hw_num_processed != CB_HEAD(m_descs))) {
+        return HAILO_SUCCESS;
+    }
+
     if (m_latency_meter != nullptr) {
         // The latency meter gets an updated hw_num_processed via a call to vdma_interrupts_read_timestamps
         // (the desc index of the last measured timestamp returned from that ioctl). Since update_latency_meter
@@ -184,34 +197,143 @@ hailo_status BoundaryChannel::launch_transfer(TransferRequest &&transfer_request
     CHECK_EXPECTED_AS_STATUS(mapped_buffer_exp);
     auto mapped_buffer = mapped_buffer_exp.release();
 
-    // Syncing the buffer to device change its ownership from host to the device.
-    // We sync on D2H as well if the user owns the buffer since the buffer might have been changed by
-    // the host between the time it was mapped and the current async transfer. If the buffer is not owned by the user,
-    // it won't be accessed for write.
-    if ((Direction::H2D == m_direction) || user_owns_buffer) {
+    if (should_sync_to_device(user_owns_buffer)) {
         auto status = transfer_request.buffer.synchronize(m_driver, HailoRTDriver::DmaSyncDirection::TO_DEVICE);
         CHECK_SUCCESS(status);
     }
 
-    const auto desired_desc_num = m_desc_list->descriptors_in_buffer(transfer_request.buffer.size());
-    CHECK(desired_desc_num <= MAX_DESCS_COUNT, HAILO_INTERNAL_FAILURE);
-    const uint16_t desc_num = static_cast<uint16_t>(desired_desc_num);
-
-    const auto num_available = get_num_available();
-    const auto last_desc_avail = static_cast<uint16_t>((num_available + desc_num - 1) & m_descs.size_mask);
+    auto desc_num = program_transfer(transfer_request, mapped_buffer, get_num_available());
+    CHECK_EXPECTED_AS_STATUS(desc_num);
 
-    auto status = prepare_descriptors(transfer_request.buffer.size(), num_available, mapped_buffer,
-        transfer_request.buffer.offset());
+    auto status = inc_num_available(desc_num.value());
     CHECK_SUCCESS(status);
 
-    add_ongoing_transfer(std::move(transfer_request), num_available, last_desc_avail);
+    return HAILO_SUCCESS;
+}
+
+hailo_status BoundaryChannel::launch_transfers(std::vector<TransferRequest> &transfer_requests, bool user_owns_buffer)
+{
+    std::unique_lock<std::mutex> lock(m_channel_mutex);
+    if (!m_is_channel_activated) {
+        return HAILO_STREAM_NOT_ACTIVATED;
+    }
+
+    // All transfers are validated before programming any of them, so a failure here leaves no transfer ongoing.
+    size_t total_desc_num = 0;
+    for (size_t i = 0; i < transfer_requests.size(); i++) {
+        if ((m_ongoing_transfers.size() + i) >= get_max_ongoing_transfers(transfer_requests[i].buffer.size())) {
+            return HAILO_QUEUE_IS_FULL;
+        }
+        total_desc_num += m_desc_list->descriptors_in_buffer(transfer_requests[i].buffer.size());
+    }
+    CHECK(total_desc_num < static_cast<size_t>(CB_SIZE(m_descs)), HAILO_INVALID_ARGUMENT,
+        "Transfers batch of channel {} needs {} descriptors, but the channel has only {}", m_channel_id,
+        total_desc_num, CB_SIZE(m_descs));
+
+    std::vector<MappedBufferPtr> mapped_buffers;
+    mapped_buffers.reserve(transfer_requests.size());
+    for (auto &transfer_request : transfer_requests) {
+        auto mapped_buffer = transfer_request.buffer.map_buffer(m_driver, m_direction);
+        CHECK_EXPECTED_AS_STATUS(mapped_buffer);
+        mapped_buffers.emplace_back(mapped_buffer.release());
+    }
+
+    if (should_sync_to_device(user_owns_buffer)) {
+        auto status = synchronize_to_device(transfer_requests);
+        CHECK_SUCCESS(status);
+    }
 
-    status = inc_num_available(desc_num);
+    // Program all transfers, and then launch all programmed transfers at once (even if some transfer has failed).
+    auto status = HAILO_SUCCESS;
+    auto starting_desc = get_num_available();
+    uint16_t programmed_desc_num = 0;
+    size_t programmed_count = 0;
+    for (; programmed_count < transfer_requests.size(); programmed_count++) {
+        auto desc_num = program_transfer(transfer_requests[programmed_count], mapped_buffers[programmed_count],
+            starting_desc);
+        if (!desc_num) {
+            status = desc_num.status();
+            break;
+        }
+        starting_desc = static_cast<uint16_t>((starting_desc + desc_num.value()) & m_descs.size_mask);
+        programmed_desc_num = static_cast<uint16_t>(programmed_desc_num + desc_num.value());
+    }
+    transfer_requests.erase(transfer_requests.begin(), transfer_requests.begin() + programmed_count);
+
+    if (0 < programmed_desc_num) {
+        auto inc_status = inc_num_available(programmed_desc_num);
+        CHECK_SUCCESS(inc_status);
+    }
     CHECK_SUCCESS(status);
 
     return HAILO_SUCCESS;
 }
 
+hailo_status BoundaryChannel::prepare_transfer(TransferRequest &transfer_request, bool is_first_transfer)
+{
+    std::unique_lock<std::mutex> lock(m_channel_mutex);
+
+    auto mapped_buffer = transfer_request.buffer.map_buffer(m_driver, m_direction);
+    CHECK_EXPECTED_AS_STATUS(mapped_buffer);
+
+    if (!is_first_transfer || m_is_channel_activated) {
+        // The descriptors of the following transfers depend on the transfers before them.
+        return HAILO_SUCCESS;
+    }
+
+    static const uint16_t FIRST_DESC = 0;
+    return configure_buffer(mapped_buffer.release(), transfer_request.buffer.offset(), FIRST_DESC);
+}
+
+hailo_status BoundaryChannel::bind_buffers_ring(const std::vector<MappedBufferPtr> &buffers)
+{
+    std::unique_lock<std::mutex> lock(m_channel_mutex);
+
+    CHECK(!buffers.empty(), HAILO_INVALID_ARGUMENT, "Buffers ring of channel {} is empty", m_channel_id);
+    CHECK(m_ongoing_transfers.empty(), HAILO_INVALID_OPERATION,
+        "Can't bind buffers ring to channel {} while transfers are ongoing", m_channel_id);
+
+    const auto buffer_size = buffers[0]->size();
+    for (const auto &buffer : buffers) {
+        CHECK_ARG_NOT_NULL(buffer);
+        CHECK(buffer->size() == buffer_size, HAILO_INVALID_ARGUMENT,
+            "All buffers in the ring must have the same size (got {} and {})", buffer->size(), buffer_size);
+    }
+
+    // The transfers of the ring are launched one after the other, so buffer i is transferred starting from
+    // desc (i * descs_in_transfer) after the first descriptor, and returns to the same descriptors only if the ring
+    // divides the descriptors list.
+    const auto descs_count = static_cast<size_t>(CB_SIZE(m_descs));
+    const size_t descs_in_transfer = m_desc_list->descriptors_in_buffer(buffer_size);
+    CHECK(((descs_count % descs_in_transfer) == 0) && (((descs_count / descs_in_transfer) % buffers.size()) == 0),
+        HAILO_INVALID_ARGUMENT,
+        "Buffers ring size ({} buffers of {} descriptors) must divide the {} descriptors of channel {}",
+        buffers.size(), descs_in_transfer, descs_count, m_channel_id);
+
+    // When the channel isn't activated, the next transfer starts from the first descriptor (where activate() resets
+    // the channel to).
+    const uint16_t first_desc = m_is_channel_activated ? get_num_available() : 0;
+    static const size_t BUFFER_OFFSET = 0;
+    for (size_t desc = 0; desc < descs_count; desc += descs_in_transfer) {
+        const auto &buffer = buffers[(desc / descs_in_transfer) % buffers.size()];
+        const auto starting_desc = static_cast<uint16_t>((first_desc + desc) & static_cast<size_t>(m_descs.size_mask));
+        auto status = configure_buffer(buffer, BUFFER_OFFSET, starting_desc);
+        CHECK_SUCCESS(status);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status BoundaryChannel::unbind_buffers()
+{
+    std::unique_lock<std::mutex> lock(m_channel_mutex);
+
+    CHECK(m_ongoing_transfers.empty(), HAILO_INVALID_OPERATION,
+        "Can't unbind the buffers of channel {} while transfers are ongoing", m_channel_id);
+    m_bounded_buffers.clear();
+    return HAILO_SUCCESS;
+}
+
 void BoundaryChannel::cancel_pending_transfers()
 {
     std::unique_lock<std::mutex> lock(m_channel_mutex);
@@ -318,28 +440,8 @@ hailo_status BoundaryChannel::prepare_descriptors(size_t transfer_size, uint16_t
     MappedBufferPtr mapped_buffer, size_t buffer_offset)
 {
     if (mapped_buffer != nullptr) {
-        CHECK((buffer_offset % m_desc_list->desc_page_size()) == 0, HAILO_INTERNAL_FAILURE,
-            "Buffer offset {} must be desc page size aligned {}", buffer_offset, m_desc_list->desc_page_size());
-        const size_t buffer_offset_in_descs = buffer_offset / m_desc_list->desc_page_size();
-        if (!is_buffer_already_configured(mapped_buffer, buffer_offset_in_descs, starting_desc)) {
-            // We need to configure the buffer now.
-
-            // First, store information on the buffer.
-            m_last_bounded_buffer.buffer = mapped_buffer;
-            m_last_bounded_buffer.starting_desc = starting_desc;
-            m_last_bounded_buffer.buffer_offset_in_descs = static_cast<uint16_t>(buffer_offset_in_descs);
-
-            // Now we want that m_desc_list[starting_desc] will be mapped into mapped_buffer[buffer_offset].
-            // The descriptors list configure always starts from buffer_offset=0, so in order to achieve our
-            // configuration, we configure the buffer starting from desc=(starting_desc - buffer_offset_in_desc).
-            // Then, after configuring buffer_offset bytes from the buffer, the desc_index will be starting desc.
-            const int desc_diff = static_cast<int>(starting_desc) - static_cast<int>(buffer_offset_in_descs);
-            const auto configure_starting_desc = static_cast<uint16_t>(m_descs.size + desc_diff) % m_descs.size;
-
-            // Finally do the actual configuration.
-            auto status = m_desc_list->configure_to_use_buffer(*mapped_buffer, m_channel_id, configure_starting_desc);
-            CHECK_SUCCESS(status);
-        }
+        auto status = configure_buffer(mapped_buffer, buffer_offset, starting_desc);
+        CHECK_SUCCESS(status);
     }
 
     if ((nullptr != m_latency_meter) && (m_direction == Direction::H2D)) {
@@ -356,21 +458,132 @@ hailo_status BoundaryChannel::prepare_descriptors(size_t transfer_size, uint16_t
     return HAILO_SUCCESS;
 }
 
+hailo_status BoundaryChannel::configure_buffer(MappedBufferPtr mapped_buffer, size_t buffer_offset,
+    uint16_t starting_desc)
+{
+    CHECK((buffer_offset % m_desc_list->desc_page_size()) == 0, HAILO_INTERNAL_FAILURE,
+        "Buffer offset {} must be desc page size aligned {}", buffer_offset, m_desc_list->desc_page_size());
+    const size_t buffer_offset_in_descs = buffer_offset / m_desc_list->desc_page_size();
+    if (is_buffer_already_configured(mapped_buffer, buffer_offset_in_descs, starting_desc)) {
+        return HAILO_SUCCESS;
+    }
+
+    // We need to configure the buffer now.
+
+    // We want that m_desc_list[starting_desc] will be mapped into mapped_buffer[buffer_offset].
+    // The descriptors list configure always starts from buffer_offset=0, so in order to achieve our
+    // configuration, we configure the buffer starting from desc=(starting_desc - buffer_offset_in_desc).
+    // Then, after configuring buffer_offset bytes from the buffer, the desc_index will be starting desc.
+    const int desc_diff = static_cast<int>(starting_desc) - static_cast<int>(buffer_offset_in_descs);
+    const auto configure_starting_desc = static_cast<uint16_t>(m_descs.size + desc_diff) % m_descs.size;
+
+    // Do the actual configuration.
+    auto status = m_desc_list->configure_to_use_buffer(*mapped_buffer, m_channel_id, configure_starting_desc);
+    CHECK_SUCCESS(status);
+
+    // Finally, store information on the buffer.
+    add_bounded_buffer(mapped_buffer, static_cast<uint16_t>(configure_starting_desc));
+    return HAILO_SUCCESS;
+}
+
+bool BoundaryChannel::should_sync_to_device(bool user_owns_buffer) const
+{
+    // Syncing the buffer to device change its ownership from host to the device.
+    // We sync on D2H as well if the user owns the buffer since the buffer might have been changed by
+    // the host between the time it was mapped and the current async transfer. If the buffer is not owned by the user,
+    // it won't be accessed for write.
+    return (Direction::H2D == m_direction) || user_owns_buffer;
+}
+
+hailo_status BoundaryChannel::synchronize_to_device(std::vector<TransferRequest> &transfer_requests)
+{
+    if (transfer_requests.empty()) {
+        return HAILO_SUCCESS;
+    }
+
+    // Consecutive parts of the same buffer (for example, frames of a circular buffer) are synced as a single range.
+    auto range = transfer_requests[0].buffer;
+    for (size_t i = 1; i < transfer_requests.size(); i++) {
+        auto &next = transfer_requests[i].buffer;
+        auto base_buffer = range.base_buffer();
+        const bool is_consecutive = (next.base_buffer() == base_buffer) &&
+            (next.offset() == ((range.offset() + range.size()) % base_buffer->size())) &&
+            ((range.size() + next.size()) <= base_buffer->size());
+        if (is_consecutive) {
+            range = TransferBuffer(base_buffer, range.size() + next.size(), range.offset());
+            continue;
+        }
+
+        auto status = range.synchronize(m_driver, HailoRTDriver::DmaSyncDirection::TO_DEVICE);
+        CHECK_SUCCESS(status);
+        range = next;
+    }
+
+    return range.synchronize(m_driver, HailoRTDriver::DmaSyncDirection::TO_DEVICE);
+}
+
+Expected<uint16_t> BoundaryChannel::program_transfer(TransferRequest &transfer_request, MappedBufferPtr mapped_buffer,
+    uint16_t starting_desc)
+{
+    const auto desired_desc_num = m_desc_list->descriptors_in_buffer(transfer_request.buffer.size());
+    CHECK_AS_EXPECTED(desired_desc_num <= MAX_DESCS_COUNT, HAILO_INTERNAL_FAILURE);
+    const uint16_t desc_num = static_cast<uint16_t>(desired_desc_num);
+
+    const auto last_desc = static_cast<uint16_t>((starting_desc + desc_num - 1) & m_descs.size_mask);
+
+    auto status = prepare_descriptors(transfer_request.buffer.size(), starting_desc, mapped_buffer,
+        transfer_request.buffer.offset());
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    add_ongoing_transfer(std::move(transfer_request), starting_desc, last_desc);
+
+    return Expected<uint16_t>(desc_num);
+}
+
 bool BoundaryChannel::is_buffer_already_configured(MappedBufferPtr buffer, size_t buffer_offset_in_descs,
     size_t starting_desc) const
 {
-    if (m_last_bounded_buffer.buffer != buffer) {
-        // Last buffer is nullptr or not the same as the given.
-        return false;
+    // The buffer is already configured if it is bound such that buffer_offset_in_descs is at starting_desc.
+    // Note that we don't afraid of overflow since buffer_offset_in_descs * desc_page_size() must fit inside the buffer.
+    for (const auto &bounded_buffer : m_bounded_buffers) {
+        if ((bounded_buffer.buffer == buffer) &&
+            (((bounded_buffer.first_desc + buffer_offset_in_descs) & static_cast<size_t>(m_descs.size_mask)) == starting_desc)) {
+            return true;
+        }
     }
+    return false;
+}
 
-    // If the diff between starting_desc and m_last_bounded_buffer.starting_desc and the diff between
-    // buffer_offset_in_descs - m_last_bounded_buffer.buffer_offset_in_descs are equal, it means that the buffer is
-    // already configured.
-    // Note that we don't afraid of overflow since buffer_offset_in_descs * desc_page_size() must fit inside the buffer.
-    const auto starting_desc_diff = (starting_desc - m_last_bounded_buffer.starting_desc) % m_descs.size;
-    const auto buffer_offset_diff_in_descs = (buffer_offset_in_descs - m_last_bounded_buffer.buffer_offset_in_descs) % m_descs.size;
-    return starting_desc_diff == buffer_offset_diff_in_descs;
+void BoundaryChannel::add_bounded_buffer(MappedBufferPtr buffer, uint16_t first_desc)
+{
+    const size_t descs_count = std::min(static_cast<size_t>(m_descs.size),
+        static_cast<size_t>(m_desc_list->descriptors_in_buffer(buffer->size())));
+
+    // The descriptors of the new buffer are no longer bound to the buffers they overlap.
+    m_bounded_buffers.erase(std::remove_if(m_bounded_buffers.begin(), m_bounded_buffers.end(),
+        [&](const BoundedBuffer &bounded_buffer) {
+            return are_descs_overlapping(first_desc, descs_count, bounded_buffer.first_desc, bounded_buffer.descs_count);
+        }), m_bounded_buffers.end());
+
+    if (m_bounded_buffers.size() == MAX_BOUNDED_BUFFERS) {
+        m_bounded_buffers.erase(m_bounded_buffers.begin());
+    }
+    m_bounded_buffers.emplace_back(BoundedBuffer{buffer, first_desc, descs_count});
+}
+
+bool BoundaryChannel::are_descs_overlapping(uint16_t first_desc_a, size_t descs_count_a, uint16_t first_desc_b,
+    size_t descs_count_b) const
+{
+    const auto descs_size = static_cast<size_t>(m_descs.size);
+    const auto descs_size_mask = static_cast<size_t>(m_descs.size_mask);
+    if ((descs_count_a >= descs_size) || (descs_count_b >= descs_size)) {
+        return true;
+    }
+
+    // Distance (in the circular descriptors list) from the start of each range to the start of the other one.
+    const auto a_to_b = (descs_size + first_desc_b - first_desc_a) & descs_size_mask;
+    const auto b_to_a = (descs_size + first_desc_a - first_desc_b) & descs_size_mask;
+    return (a_to_b < descs_count_a) || (b_to_a < descs_count_b);
 }
 
 void BoundaryChannel::add_ongoing_transfer(TransferRequest &&transfer_request, uint16_t first_desc, uint16_t last_desc)
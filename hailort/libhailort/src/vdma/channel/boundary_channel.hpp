@@ -20,6 +20,7 @@
 #include "context_switch_defs.h"
 
 #include <memory>
+#include <vector>
 
 
 namespace hailort {
@@ -67,6 +68,28 @@ public:
     // user_owns_buffer is set when the buffer is owned by the user (otherwise we may have some assumtions).
     hailo_status launch_transfer(TransferRequest &&transfer_request, bool user_owns_buffer);
 
+    // Launches a burst of transfers - the descriptors of all transfers are programmed, and then the channel
+    // num_available is updated once. Consecutive buffers are synced to the device in a single call.
+    // If the channel can't hold all transfers, none of them is launched (HAILO_QUEUE_IS_FULL is returned).
+    // On return, transfer_requests contains the requests that weren't launched (empty on success).
+    hailo_status launch_transfers(std::vector<TransferRequest> &transfer_requests, bool user_owns_buffer);
+
+    // Prepares a transfer that will be launched after the channel is activated (used by the scheduler while another
+    // core-op is running, so it doesn't touch the channel registers). The buffer is mapped, and if it is the first
+    // transfer, it is bound to the descriptors list starting from the first descriptor (where activate() resets the
+    // channel to), so launching it only programs its last descriptor.
+    hailo_status prepare_transfer(TransferRequest &transfer_request, bool is_first_transfer);
+
+    // Binds a ring of buffers (used in order, one buffer per transfer) to the descriptors list ahead of time, so
+    // launching a transfer into one of the buffers only programs its last descriptor. Each buffer is bound to every
+    // descriptors region it will be transferred with, so the ring size must divide the number of transfers that fill
+    // the descriptors list. Must be called when there are no ongoing transfers.
+    hailo_status bind_buffers_ring(const std::vector<MappedBufferPtr> &buffers);
+
+    // Forgets the buffers bound to the descriptors list (releasing their mappings), so the next transfers bind their
+    // buffers again. Must be called when there are no ongoing transfers.
+    hailo_status unbind_buffers();
+
     size_t get_max_ongoing_transfers(size_t transfer_size) const;
 
     CONTROL_PROTOCOL__host_buffer_info_t get_boundary_buffer_info(uint32_t transfer_size) const;
@@ -98,8 +121,21 @@ private:
         hailo_status complete_status);
     hailo_status prepare_descriptors(size_t transfer_size, uint16_t starting_desc,
         MappedBufferPtr mapped_buffer, size_t buffer_offset);
+    // Binds the descriptors list to the buffer, so m_desc_list[starting_desc] points to mapped_buffer[buffer_offset]
+    hailo_status configure_buffer(MappedBufferPtr mapped_buffer, size_t buffer_offset, uint16_t starting_desc);
+
+    bool should_sync_to_device(bool user_owns_buffer) const;
+    hailo_status synchronize_to_device(std::vector<TransferRequest> &transfer_requests);
+
+    // Programs the descriptors of the transfer (starting from starting_desc) and adds it to the ongoing transfers.
+    // The transfer is launched only after num_available is increased by the returned descriptors count.
+    Expected<uint16_t> program_transfer(TransferRequest &transfer_request, MappedBufferPtr mapped_buffer,
+        uint16_t starting_desc);
 
     bool is_buffer_already_configured(MappedBufferPtr buffer, size_t buffer_offset_in_descs, size_t starting_desc) const;
+    void add_bounded_buffer(MappedBufferPtr buffer, uint16_t first_desc);
+    bool are_descs_overlapping(uint16_t first_desc_a, size_t descs_count_a, uint16_t first_desc_b,
+        size_t descs_count_b) const;
     void add_ongoing_transfer(TransferRequest &&transfer_request, uint16_t first_desc, uint16_t last_desc);
 
     static bool is_desc_between(uint16_t begin, uint16_t end, uint16_t desc);
@@ -125,23 +161,22 @@ private:
     struct BoundedBuffer {
         MappedBufferPtr buffer;
 
-        // The buffer is bounded starting from this descriptor.
-        uint16_t starting_desc;
+        // desc_list[first_desc] points to the start of the buffer.
+        uint16_t first_desc;
 
-        // Offset inside the buffer (in desc_page_size granularity) of the "actual start" of the buffer.
-        // It implies that:
-        //      desc_list[starting_desc] will point to buffer[buffers_desc_offset * desc_page_size].
-        uint16_t buffer_offset_in_descs;
+        // Amount of descriptors bound to the buffer (at most the whole descriptors list).
+        size_t descs_count;
     };
 
-    // We store the last bounded buffer as cache in order to avoid unnecessary descriptors list reprogramming.
-    // It is good enough to store only the last bounded buffer because we have two modes of execution:
-    //      1. User allocated buffers - On each transfer we bind new buffer. Even if the user always uses the same
-    //         buffers, due to the circular nature of descriptor list, reprogramming will almost always be needed (So
-    //         cacheing won't help).
+    // We store the buffers currently bound to the descriptors list as cache in order to avoid unnecessary descriptors
+    // list reprogramming. The bound regions don't overlap (binding a buffer removes the buffers it overrides).
+    // There are two modes of execution:
+    //      1. User allocated buffers - On each transfer we bind the buffer. If the user cycles through a ring of
+    //         buffers that fills the descriptors list (see bind_buffers_ring), each buffer is always transferred with
+    //         the same descriptors, so after the first round no reprogramming is needed.
     //      2. Single circular buffer (internally) - In this case we don't need to bind each time (maybe after the
-    //         channel is re-activated). Caching the last bounded buffer is enough.
-    BoundedBuffer m_last_bounded_buffer;
+    //         channel is re-activated).
+    std::vector<BoundedBuffer> m_bounded_buffers;
 };
 
 } /* namespace vdma */
@@ -4,27 +4,85 @@
 **/
 /**
  * @file interrupts_dispatcher.cpp
- * @brief Manages a thread that is waiting for channel interrupts.
+ * @brief Manages the threads that are waiting for channel interrupts, and the threads processing them.
  **/
 
 #include "interrupts_dispatcher.hpp"
+#include "vdma/channel/vdma_channel_regs.hpp"
 #include "hailo/hailort_common.hpp"
 #include "common/os_utils.hpp"
 
+#include <algorithm>
+
 namespace hailort {
 namespace vdma {
 
-Expected<std::unique_ptr<InterruptsDispatcher>> InterruptsDispatcher::create(std::reference_wrapper<HailoRTDriver> driver)
+// Number of threads waiting for the channels interrupts.
+static constexpr const char *INTERRUPTS_THREADS_ENV_VAR = "HAILO_VDMA_INTERRUPTS_THREADS";
+static constexpr size_t DEFAULT_INTERRUPTS_THREADS = 1;
+// Number of threads processing the interrupts (and calling the transfers callbacks), 0 to process them on the
+// interrupts threads.
+static constexpr const char *COMPLETION_THREADS_ENV_VAR = "HAILO_VDMA_COMPLETION_THREADS";
+static constexpr size_t DEFAULT_COMPLETION_THREADS = 0;
+
+static size_t get_threads_count_from_env(const char *env_var_name, size_t default_count)
 {
-    auto thread = make_unique_nothrow<InterruptsDispatcher>(driver);
+    auto count_env = std::getenv(env_var_name);
+    if (nullptr == count_env) {
+        return default_count;
+    }
+    // No more than a thread per channel
+    return std::min(static_cast<size_t>(std::strtoull(count_env, nullptr, 10)), MAX_VDMA_CHANNELS_COUNT);
+}
+
+InterruptsDispatcher::Params InterruptsDispatcher::get_default_params()
+{
+    Params params{};
+    params.wait_threads_count = std::max(get_threads_count_from_env(INTERRUPTS_THREADS_ENV_VAR, DEFAULT_INTERRUPTS_THREADS),
+        size_t(1));
+    params.completion_threads_count = get_threads_count_from_env(COMPLETION_THREADS_ENV_VAR, DEFAULT_COMPLETION_THREADS);
+    return params;
+}
+
+Expected<std::unique_ptr<InterruptsDispatcher>> InterruptsDispatcher::create(std::reference_wrapper<HailoRTDriver> driver,
+    const Params &params)
+{
+    CHECK_AS_EXPECTED(params.wait_threads_count > 0, HAILO_INVALID_ARGUMENT, "At least one interrupts thread is needed");
+
+    auto status = HAILO_UNINITIALIZED;
+    auto thread = make_unique_nothrow<InterruptsDispatcher>(driver, params, status);
     CHECK_NOT_NULL_AS_EXPECTED(thread, HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_SUCCESS_AS_EXPECTED(status);
     return thread;
 }
 
-InterruptsDispatcher::InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver) :
+InterruptsDispatcher::InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver, const Params &params,
+    hailo_status &status) :
     m_driver(driver),
-    m_interrupts_thread([this] { wait_interrupts(); })
-{}
+    m_params(params),
+    m_threads_states(params.wait_threads_count, ThreadState::not_active),
+    m_dispatched_contexts(params.wait_threads_count, nullptr)
+{
+    m_completion_threads.reserve(m_params.completion_threads_count);
+    for (size_t i = 0; i < m_params.completion_threads_count; i++) {
+        auto completion_thread = make_unique_nothrow<CompletionThread>();
+        if (nullptr == completion_thread) {
+            LOGGER__ERROR("Failed to allocate completion thread");
+            status = HAILO_OUT_OF_HOST_MEMORY;
+            return;
+        }
+        auto &completion_thread_ref = *completion_thread;
+        completion_thread->thread = std::thread([this, &completion_thread_ref] { process_completions(completion_thread_ref); });
+        m_completion_threads.emplace_back(std::move(completion_thread));
+    }
+
+    m_interrupts_threads.reserve(m_params.wait_threads_count);
+    for (size_t i = 0; i < m_params.wait_threads_count; i++) {
+        m_interrupts_threads.emplace_back([this, i] { wait_interrupts(i); });
+    }
+
+    status = HAILO_SUCCESS;
+}
 
 InterruptsDispatcher::~InterruptsDispatcher()
 {
@@ -35,86 +93,304 @@ InterruptsDispatcher::~InterruptsDispatcher()
         }
     }
 
-    if (m_interrupts_thread.joinable()) {
-        signal_thread_quit();
-        m_interrupts_thread.join();
+    signal_thread_quit();
+    for (auto &interrupts_thread : m_interrupts_threads) {
+        if (interrupts_thread.joinable()) {
+            interrupts_thread.join();
+        }
+    }
+
+    for (auto &completion_thread : m_completion_threads) {
+        {
+            std::unique_lock<std::mutex> lock(completion_thread->mutex);
+            completion_thread->should_quit = true;
+        }
+        completion_thread->cond.notify_one();
+        if (completion_thread->thread.joinable()) {
+            completion_thread->thread.join();
+        }
     }
 }
 
 hailo_status InterruptsDispatcher::start(const ChannelsBitmap &channels_bitmap, bool enable_timestamp_measure,
     const ProcessIrqCallback &process_irq)
+{
+    return start_impl(channels_bitmap, channels_bitmap, enable_timestamp_measure, process_irq);
+}
+
+hailo_status InterruptsDispatcher::start_impl(const ChannelsBitmap &channels_bitmap,
+    const ChannelsBitmap &process_bitmap, bool enable_timestamp_measure, const ProcessIrqCallback &process_irq)
 {
     {
         std::unique_lock<std::mutex> lock(m_mutex);
         CHECK(m_wait_context == nullptr, HAILO_INVALID_OPERATION, "Interrupt thread already running");
 
-        auto wait_context = make_unique_nothrow<WaitContext>(WaitContext{channels_bitmap, process_irq});
+        auto wait_context = make_shared_nothrow<WaitContext>();
         CHECK_NOT_NULL(wait_context, HAILO_OUT_OF_HOST_MEMORY);
+        wait_context->bitmap = channels_bitmap;
+        wait_context->process_bitmap = process_bitmap;
+        wait_context->enable_timestamp_measure = enable_timestamp_measure;
+        wait_context->process_irq = process_irq;
+        for (auto &engine_refresh_bitmap : wait_context->refresh_bitmap) {
+            engine_refresh_bitmap = 0;
+        }
+
+        // Split the channels between the interrupts threads
+        wait_context->threads_bitmaps.resize(m_params.wait_threads_count, ChannelsBitmap{});
+        size_t channels_count = 0;
+        for (size_t engine_index = 0; engine_index < channels_bitmap.size(); engine_index++) {
+            for (size_t channel_index = 0; channel_index < VDMA_CHANNELS_PER_ENGINE; channel_index++) {
+                const uint32_t channel_bit = (1u << channel_index);
+                if (0 != (channels_bitmap[engine_index] & channel_bit)) {
+                    wait_context->threads_bitmaps[channels_count % m_params.wait_threads_count][engine_index] |= channel_bit;
+                    channels_count++;
+                }
+            }
+        }
+
         m_wait_context = std::move(wait_context);
 
         auto status = m_driver.get().vdma_interrupts_enable(m_wait_context->bitmap, enable_timestamp_measure);
         CHECK_SUCCESS(status, "Failed to enable vdma interrupts");
     }
-    m_cond.notify_one();
+    m_cond.notify_all();
 
     return HAILO_SUCCESS;
 }
 
 hailo_status InterruptsDispatcher::stop()
 {
-    std::unique_lock<std::mutex> lock(m_mutex);
-    CHECK(m_wait_context != nullptr, HAILO_INVALID_OPERATION, "Interrupt thread not running");
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        CHECK(m_wait_context != nullptr, HAILO_INVALID_OPERATION, "Interrupt thread not running");
 
-    // Nullify wait context so the thread will pause
-    const auto bitmap = m_wait_context->bitmap;
-    m_wait_context = nullptr;
+        // Nullify wait context so the threads will pause
+        const auto bitmap = m_wait_context->bitmap;
+        m_wait_context = nullptr;
 
-    // Calling disable interrupts will cause the vdma_interrupts_wait to return.
-    auto status = m_driver.get().vdma_interrupts_disable(bitmap);
-    CHECK_SUCCESS(status, "Failed to disable vdma interrupts");
+        // Calling disable interrupts will cause the vdma_interrupts_wait to return.
+        auto status = m_driver.get().vdma_interrupts_disable(bitmap);
+        CHECK_SUCCESS(status, "Failed to disable vdma interrupts");
 
-    // Needs to make sure that the interrupts thread is disabled.
-    // The wait is needed because otherwise, on a fast stop() and start(), the next start() may accept
-    // interrupts from previous run.
-    m_cond.wait(lock, [&]{ return m_thread_state == ThreadState::not_active; });
+        // Needs to make sure that the interrupts threads are disabled.
+        // The wait is needed because otherwise, on a fast stop() and start(), the next start() may accept
+        // interrupts from previous run.
+        m_cond.wait(lock, [&]{ return are_all_threads_not_active(); });
+    }
+
+    // The interrupts received before stop are still processed (same as when processing them on the interrupts
+    // threads), so the process_irq callback isn't used once stop() returns.
+    wait_for_completions();
 
     return HAILO_SUCCESS;
 }
 
-void InterruptsDispatcher::wait_interrupts()
+bool InterruptsDispatcher::is_running()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return (m_wait_context != nullptr);
+}
+
+hailo_status InterruptsDispatcher::switch_context(const ChannelsBitmap &channels_bitmap, bool enable_timestamp_measure,
+    const ProcessIrqCallback &process_irq)
+{
+    ChannelsBitmap waited_bitmap = channels_bitmap;
+    bool is_running = false;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        is_running = (m_wait_context != nullptr);
+        if (is_running) {
+            bool are_channels_waited = true;
+            for (size_t engine_index = 0; engine_index < channels_bitmap.size(); engine_index++) {
+                waited_bitmap[engine_index] |= m_wait_context->bitmap[engine_index];
+                are_channels_waited &= (waited_bitmap[engine_index] == m_wait_context->bitmap[engine_index]);
+            }
+
+            if (are_channels_waited && (enable_timestamp_measure == m_wait_context->enable_timestamp_measure)) {
+                auto wait_context = make_shared_nothrow<WaitContext>();
+                CHECK_NOT_NULL(wait_context, HAILO_OUT_OF_HOST_MEMORY);
+                wait_context->bitmap = m_wait_context->bitmap;
+                wait_context->threads_bitmaps = m_wait_context->threads_bitmaps;
+                wait_context->process_bitmap = channels_bitmap;
+                wait_context->enable_timestamp_measure = enable_timestamp_measure;
+                wait_context->process_irq = process_irq;
+                for (size_t engine_index = 0; engine_index < channels_bitmap.size(); engine_index++) {
+                    wait_context->refresh_bitmap[engine_index] = channels_bitmap[engine_index];
+                }
+
+                // From now on, the wait threads process the irqs they read with the new context (even if they started
+                // waiting before the switch). We only wait for the irqs that are already processed with the previous one.
+                m_wait_context = std::move(wait_context);
+                m_cond.wait(lock, [&]{ return !is_dispatching_other_context(m_wait_context.get()); });
+
+                lock.unlock();
+                wait_for_completions();
+                return HAILO_SUCCESS;
+            }
+        }
+    }
+
+    // New channels are waited (or the timestamps measure changes), so the wait threads are restarted.
+    if (is_running) {
+        auto status = stop();
+        CHECK_SUCCESS(status);
+    }
+    return start_impl(waited_bitmap, channels_bitmap, enable_timestamp_measure, process_irq);
+}
+
+void InterruptsDispatcher::wait_interrupts(size_t thread_index)
 {
     OsUtils::set_current_thread_name("CHANNEL_INTR");
 
     std::unique_lock<std::mutex> lock(m_mutex);
     while (true) {
 
-        m_thread_state = ThreadState::not_active;
-        m_cond.notify_one(); // Wake up stop()
+        m_threads_states[thread_index] = ThreadState::not_active;
+        m_cond.notify_all(); // Wake up stop() and switch_context()
 
-        m_cond.wait(lock, [&]{ return m_should_quit || (m_wait_context != nullptr); });
+        // Threads without channels (more threads than channels) stay not active
+        m_cond.wait(lock, [&]{
+            return m_should_quit ||
+                ((m_wait_context != nullptr) && (ChannelsBitmap{} != m_wait_context->threads_bitmaps[thread_index]));
+        });
         if (m_should_quit) {
             break;
         }
 
-        m_thread_state = ThreadState::active;
-        auto wait_context = *m_wait_context;
+        m_threads_states[thread_index] = ThreadState::active;
+        auto wait_context = m_wait_context;
+        // The channels of each thread are kept on switch_context, so the thread keeps waiting on them after a switch.
+        const auto thread_bitmap = wait_context->threads_bitmaps[thread_index];
 
         // vdma_interrupts_wait is a blocking function that returns in this scenarios:
         //   1. We got a new interrupts, irq_data will be passed to the process_irq callback
         //   2. vdma_interrupts_disable will be called, vdma_interrupts_wait will return with an empty list.
         //   3. Other error returns - shouldn't really happen, we exit the interrupt thread.
+        // stop() waits until the thread is not active again.
         lock.unlock();
-        auto irq_data = m_driver.get().vdma_interrupts_wait(wait_context.bitmap);
+        auto irq_data = m_driver.get().vdma_interrupts_wait(thread_bitmap);
         lock.lock();
 
         if (!irq_data.has_value()) {
             LOGGER__ERROR("Interrupt thread exit with {}", irq_data.status());
+            m_threads_states[thread_index] = ThreadState::not_active;
+            m_cond.notify_all();
             break;
         }
 
         if (irq_data->channels_count > 0) {
-            wait_context.process_irq(irq_data.release());
+            // If switch_context was called while waiting, the irq is processed with the new context. After stop(), the
+            // irqs received before it are still processed with the context they were waited with.
+            if (m_wait_context != nullptr) {
+                wait_context = m_wait_context;
+            }
+
+            // The irq is processed (or dispatched) without the lock, so the interrupts threads don't block each other.
+            m_dispatched_contexts[thread_index] = wait_context.get();
+            lock.unlock();
+            dispatch_irq(wait_context, irq_data.release());
+            lock.lock();
+            m_dispatched_contexts[thread_index] = nullptr;
+        }
+    }
+}
+
+void InterruptsDispatcher::dispatch_irq(const std::shared_ptr<WaitContext> &wait_context, IrqData &&irq_data)
+{
+    update_irq_data(*wait_context, irq_data);
+    if (0 == irq_data.channels_count) {
+        return;
+    }
+
+    if (m_completion_threads.empty()) {
+        wait_context->process_irq(std::move(irq_data));
+        return;
+    }
+
+    // Pass the channels irq data to the completion threads they belong to (in the same order)
+    std::vector<CompletionRequest> requests(m_completion_threads.size(), CompletionRequest{wait_context, IrqData{}});
+    for (uint8_t i = 0; i < irq_data.channels_count; i++) {
+        const auto &channel_irq_data = irq_data.channels_irq_data[i];
+        auto &request_irq_data = requests[get_completion_thread_index(channel_irq_data.channel_id)].irq_data;
+        request_irq_data.channels_irq_data[request_irq_data.channels_count++] = channel_irq_data;
+    }
+
+    for (size_t i = 0; i < requests.size(); i++) {
+        if (0 == requests[i].irq_data.channels_count) {
+            continue;
+        }
+
+        auto &completion_thread = *m_completion_threads[i];
+        {
+            std::unique_lock<std::mutex> lock(completion_thread.mutex);
+            completion_thread.requests.emplace(std::move(requests[i]));
+        }
+        completion_thread.cond.notify_all();
+    }
+}
+
+void InterruptsDispatcher::update_irq_data(WaitContext &wait_context, IrqData &irq_data)
+{
+    uint8_t channels_count = 0;
+    for (uint8_t i = 0; i < irq_data.channels_count; i++) {
+        auto channel_irq_data = irq_data.channels_irq_data[i];
+        const auto channel_id = channel_irq_data.channel_id;
+        const uint32_t channel_bit = (1u << channel_id.channel_index);
+
+        if (0 == (wait_context.process_bitmap[channel_id.engine_index] & channel_bit)) {
+            // The channel is waited since a previous context, the irq belongs to it.
+            continue;
+        }
+
+        if (0 != (wait_context.refresh_bitmap[channel_id.engine_index].fetch_and(~channel_bit) & channel_bit)) {
+            // First irq of the channel since switch_context - it may have been read before the switch (so it belongs
+            // to the previous context), hence the num processed is read from the channel itself.
+            const auto direction = (channel_id.channel_index < MIN_D2H_CHANNEL_INDEX) ?
+                HailoRTDriver::DmaDirection::H2D : HailoRTDriver::DmaDirection::D2H;
+            auto num_processed = VdmaChannelRegs(m_driver.get(), channel_id, direction).get_num_processed();
+            if (!num_processed) {
+                LOGGER__ERROR("Failed reading num processed of channel {} with {}", channel_id, num_processed.status());
+                continue;
+            }
+            channel_irq_data.desc_num_processed = num_processed.release();
+        }
+
+        irq_data.channels_irq_data[channels_count++] = channel_irq_data;
+    }
+    irq_data.channels_count = channels_count;
+}
+
+void InterruptsDispatcher::process_completions(CompletionThread &completion_thread)
+{
+    OsUtils::set_current_thread_name("CHANNEL_CMPL");
+
+    std::unique_lock<std::mutex> lock(completion_thread.mutex);
+    while (true) {
+        completion_thread.is_busy = false;
+        completion_thread.cond.notify_all(); // Wake up wait_for_completions()
+
+        completion_thread.cond.wait(lock, [&]{ return completion_thread.should_quit || !completion_thread.requests.empty(); });
+        if (completion_thread.should_quit) {
+            break;
         }
+
+        auto request = std::move(completion_thread.requests.front());
+        completion_thread.requests.pop();
+        completion_thread.is_busy = true;
+
+        lock.unlock();
+        request.wait_context->process_irq(std::move(request.irq_data));
+        lock.lock();
+    }
+}
+
+void InterruptsDispatcher::wait_for_completions()
+{
+    for (auto &completion_thread : m_completion_threads) {
+        std::unique_lock<std::mutex> lock(completion_thread->mutex);
+        completion_thread->cond.wait(lock, [&]{
+            return completion_thread->requests.empty() && !completion_thread->is_busy;
+        });
     }
 }
 
@@ -122,10 +398,30 @@ void InterruptsDispatcher::signal_thread_quit()
 {
     {
         std::unique_lock<std::mutex> lock(m_mutex);
-        assert(m_thread_state == ThreadState::not_active);
+        assert(are_all_threads_not_active());
         m_should_quit = true;
     }
-    m_cond.notify_one();
+    m_cond.notify_all();
+}
+
+bool InterruptsDispatcher::are_all_threads_not_active() const
+{
+    return std::all_of(m_threads_states.begin(), m_threads_states.end(),
+        [](ThreadState state) { return ThreadState::not_active == state; });
+}
+
+bool InterruptsDispatcher::is_dispatching_other_context(const WaitContext *wait_context) const
+{
+    return std::any_of(m_dispatched_contexts.begin(), m_dispatched_contexts.end(),
+        [wait_context](const WaitContext *dispatched_context) {
+            return (nullptr != dispatched_context) && (wait_context != dispatched_context);
+        });
+}
+
+size_t InterruptsDispatcher::get_completion_thread_index(const ChannelId &channel_id) const
+{
+    const size_t channel_key = (channel_id.engine_index * VDMA_CHANNELS_PER_ENGINE) + channel_id.channel_index;
+    return channel_key % m_completion_threads.size();
 }
 
 } /* namespace vdma */
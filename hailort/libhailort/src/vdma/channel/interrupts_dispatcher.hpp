@@ -4,7 +4,7 @@
 **/
 /**
  * @file interrupts_dispatcher.hpp
- * @brief Manages a thread that is waiting for channel interrupts.
+ * @brief Manages the threads that are waiting for channel interrupts, and the threads processing them.
  **/
 
 #ifndef _HAILO_VDMA_INTERRUPTS_DISPATCHER_HPP_
@@ -14,18 +14,42 @@
 #include <thread>
 #include <functional>
 #include <condition_variable>
+#include <atomic>
+#include <queue>
+#include <vector>
 
 namespace hailort {
 namespace vdma {
 
 /// When needed, creates thread (or threads) that waits for interrupts on all channels.
+///
+/// The channels are split between the wait threads (each channel is always waited by the same thread). By default,
+/// the irq is processed on the thread that waited for it. When completion threads are used, the wait threads only
+/// pass the irq data of each channel to the completion thread the channel belongs to, so slow transfer callbacks of
+/// one stream don't delay the interrupts of other streams. Since each channel is handled by a single wait thread and a
+/// single completion thread, the interrupts of a channel are always processed in order.
+///
+/// When switching between core-ops, switch_context() replaces the process_irq callback while the threads keep waiting
+/// (on the union of the channels of all the core-ops switched to), so no stop()/start() handshake is needed.
 class InterruptsDispatcher final {
 public:
-    // The actual irq process callback, should run quickly (blocks the interrupts thread).
+    // The actual irq process callback, should run quickly (blocks the interrupts thread, or the completion thread of
+    // the channels in irq_data).
+    // When more than one thread is used, it may be called concurrently (with the irq data of different channels).
     using ProcessIrqCallback = std::function<void(IrqData &&irq_data)>;
 
-    static Expected<std::unique_ptr<InterruptsDispatcher>> create(std::reference_wrapper<HailoRTDriver> driver);
-    explicit InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver);
+    struct Params {
+        // Number of threads waiting for interrupts
+        size_t wait_threads_count;
+        // Number of threads calling the ProcessIrqCallback, 0 to call it from the wait threads.
+        size_t completion_threads_count;
+    };
+
+    static Params get_default_params();
+
+    static Expected<std::unique_ptr<InterruptsDispatcher>> create(std::reference_wrapper<HailoRTDriver> driver,
+        const Params &params = get_default_params());
+    InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver, const Params &params, hailo_status &status);
     ~InterruptsDispatcher();
 
     InterruptsDispatcher(const InterruptsDispatcher &) = delete;
@@ -36,15 +60,45 @@ public:
     hailo_status start(const ChannelsBitmap &channels_bitmap, bool enable_timestamp_measure,
         const ProcessIrqCallback &process_irq);
     hailo_status stop();
+    bool is_running();
+
+    // Starts processing the interrupts of channels_bitmap with process_irq (instead of the callback given on the
+    // previous start()/switch_context()). The previous callback isn't used once this function returns.
+    // If the dispatcher is running, and the channels are already waited (with the same enable_timestamp_measure), the
+    // wait threads aren't stopped - otherwise the dispatcher is restarted, waiting for the previous channels as well.
+    // Note that channels_bitmap must be activated (i.e. reset by the firmware) before this function is called, since the
+    // first interrupt of each channel may be read before the switch, so its num processed is read from the channel.
+    hailo_status switch_context(const ChannelsBitmap &channels_bitmap, bool enable_timestamp_measure,
+        const ProcessIrqCallback &process_irq);
 
 private:
 
-    void wait_interrupts();
-    void signal_thread_quit();
-
     struct WaitContext {
+        // The waited channels
         ChannelsBitmap bitmap;
+        // The channels waited by each wait thread
+        std::vector<ChannelsBitmap> threads_bitmaps;
+        // The channels passed to process_irq (may be a subset of bitmap after switch_context)
+        ChannelsBitmap process_bitmap;
+        bool enable_timestamp_measure;
         ProcessIrqCallback process_irq;
+        // Channels whose num processed is read from the channel on their next interrupt (set by switch_context)
+        std::array<std::atomic<uint32_t>, MAX_VDMA_ENGINES_COUNT> refresh_bitmap;
+    };
+
+    struct CompletionRequest {
+        std::shared_ptr<WaitContext> wait_context;
+        IrqData irq_data;
+    };
+
+    struct CompletionThread {
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::queue<CompletionRequest> requests;
+        // True while a request is processed
+        bool is_busy = false;
+        bool should_quit = false;
+        std::thread thread;
     };
 
     enum class ThreadState {
@@ -55,18 +109,34 @@ private:
         not_active,
     };
 
+    hailo_status start_impl(const ChannelsBitmap &channels_bitmap, const ChannelsBitmap &process_bitmap,
+        bool enable_timestamp_measure, const ProcessIrqCallback &process_irq);
+    void wait_interrupts(size_t thread_index);
+    void dispatch_irq(const std::shared_ptr<WaitContext> &wait_context, IrqData &&irq_data);
+    void update_irq_data(WaitContext &wait_context, IrqData &irq_data);
+    void process_completions(CompletionThread &completion_thread);
+    void wait_for_completions();
+    void signal_thread_quit();
+    bool are_all_threads_not_active() const;
+    bool is_dispatching_other_context(const WaitContext *wait_context) const;
+    size_t get_completion_thread_index(const ChannelId &channel_id) const;
+
     std::mutex m_mutex;
     std::condition_variable m_cond;
 
     const std::reference_wrapper<HailoRTDriver> m_driver;
+    const Params m_params;
 
-    ThreadState m_thread_state = ThreadState::not_active;
-    // When m_wait_context is not nullptr, the thread should start waiting for interrupts.
-    std::unique_ptr<WaitContext> m_wait_context;
+    std::vector<ThreadState> m_threads_states;
+    // The context each wait thread is dispatching an irq with (nullptr when not dispatching)
+    std::vector<const WaitContext*> m_dispatched_contexts;
+    // When m_wait_context is not nullptr, the threads should start waiting for interrupts.
+    std::shared_ptr<WaitContext> m_wait_context;
 
-    // m_should_quit is used to quit the thread (called on destruction)
+    // m_should_quit is used to quit the threads (called on destruction)
     bool m_should_quit = false;
-    std::thread m_interrupts_thread;
+    std::vector<std::thread> m_interrupts_threads;
+    std::vector<std::unique_ptr<CompletionThread>> m_completion_threads;
 };
 
 } /* namespace vdma */
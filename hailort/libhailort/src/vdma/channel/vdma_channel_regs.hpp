@@ -46,6 +46,11 @@ public:
         return write_integer<uint16_t>(VDMA_CHANNEL_NUM_AVAIL_OFFSET, value);
     }
 
+    Expected<uint16_t> get_num_processed() const
+    {
+        return read_integer<uint16_t>(VDMA_CHANNEL_NUM_PROC_OFFSET);
+    }
+
 #ifndef NDEBUG
     Expected<bool> is_aborted() const
     {
@@ -48,6 +48,7 @@ public:
     virtual size_t size() const override { return m_size; }
     virtual void *user_address() override { return m_user_address; }
     virtual vdma_mapped_buffer_driver_identifier buffer_identifier() override { return HailoRTDriver::INVALID_DRIVER_BUFFER_HANDLE_VALUE; }
+    virtual bool is_user_allocated() const override { return true; }
 
 private:
     const size_t m_size;
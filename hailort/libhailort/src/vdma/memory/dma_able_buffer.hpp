@@ -46,6 +46,9 @@ public:
     virtual void* user_address() = 0;
     virtual size_t size() const = 0;
     virtual vdma_mapped_buffer_driver_identifier buffer_identifier() = 0;
+
+    // True if the buffer is allocated (and owned) by the user, so its dma mappings may be cached by the device.
+    virtual bool is_user_allocated() const { return false; }
 };
 
 } /* namespace vdma */
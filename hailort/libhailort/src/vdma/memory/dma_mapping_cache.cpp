@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file dma_mapping_cache.cpp
+ * @brief Cache of dma mappings of user buffers
+ **/
+
+#include "vdma/memory/dma_mapping_cache.hpp"
+
+#include "common/logger_macros.hpp"
+
+
+namespace hailort {
+namespace vdma {
+
+DmaMappingCache::DmaMappingCache(HailoRTDriver &driver, size_t max_mapped_bytes) :
+    DmaMappingCache([&driver](void *address, size_t size, HailoRTDriver::DmaDirection direction) {
+        return MappedBuffer::create_shared(driver, direction, size, address);
+    }, max_mapped_bytes)
+{}
+
+DmaMappingCache::DmaMappingCache(MapFunction map_function, size_t max_mapped_bytes) :
+    m_map_function(std::move(map_function)),
+    m_max_mapped_bytes(max_mapped_bytes),
+    m_mapped_bytes(0)
+{
+    auto &caches_registry = registry();
+    std::lock_guard<std::mutex> lock(caches_registry.mutex);
+    caches_registry.caches.insert(this);
+}
+
+DmaMappingCache::~DmaMappingCache()
+{
+    auto &caches_registry = registry();
+    std::lock_guard<std::mutex> lock(caches_registry.mutex);
+    caches_registry.caches.erase(this);
+}
+
+DmaMappingCache::Registry &DmaMappingCache::registry()
+{
+    static Registry caches_registry;
+    return caches_registry;
+}
+
+Expected<MappedBufferPtr> DmaMappingCache::get_or_map(void *address, size_t size,
+    HailoRTDriver::DmaDirection direction)
+{
+    if (size > m_max_mapped_bytes) {
+        // Not cached - the buffer is unmapped once the caller releases it.
+        return m_map_function(address, size, direction);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const Key key{reinterpret_cast<uintptr_t>(address), size, direction};
+    auto entry = m_entries.find(key);
+    if (m_entries.end() != entry) {
+        m_lru.splice(m_lru.begin(), m_lru, entry->second);
+        return MappedBufferPtr(entry->second->mapped_buffer);
+    }
+
+    auto mapped_buffer = m_map_function(address, size, direction);
+    CHECK_EXPECTED(mapped_buffer);
+
+    evict_until_fits(size);
+    m_lru.emplace_front(Entry{key, mapped_buffer.value()});
+    m_entries.emplace(key, m_lru.begin());
+    m_mapped_bytes += size;
+
+    return mapped_buffer;
+}
+
+void DmaMappingCache::invalidate(void *address, size_t size)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto start = reinterpret_cast<uintptr_t>(address);
+    const auto end = start + size;
+    for (auto entry = m_lru.begin(); entry != m_lru.end();) {
+        const auto entry_start = entry->key.address;
+        const auto entry_end = entry_start + entry->key.size;
+        auto current = entry++;
+        if ((entry_start < end) && (start < entry_end)) {
+            erase(current);
+        }
+    }
+}
+
+void DmaMappingCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_lru.clear();
+    m_mapped_bytes = 0;
+}
+
+void DmaMappingCache::invalidate_all(void *address, size_t size)
+{
+    auto &caches_registry = registry();
+    std::lock_guard<std::mutex> lock(caches_registry.mutex);
+    for (auto cache : caches_registry.caches) {
+        cache->invalidate(address, size);
+    }
+}
+
+size_t DmaMappingCache::mapped_bytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_mapped_bytes;
+}
+
+void DmaMappingCache::evict_until_fits(size_t size)
+{
+    while (!m_lru.empty() && ((m_mapped_bytes + size) > m_max_mapped_bytes)) {
+        erase(std::prev(m_lru.end()));
+    }
+}
+
+void DmaMappingCache::erase(std::list<Entry>::iterator entry)
+{
+    m_mapped_bytes -= entry->key.size;
+    m_entries.erase(entry->key);
+    // If the mapping is used by an ongoing transfer, it will be unmapped once the transfer is done.
+    m_lru.erase(entry);
+}
+
+} /* namespace vdma */
+} /* namespace hailort */
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file dma_mapping_cache.hpp
+ * @brief Cache of dma mappings of user buffers, so a user buffer that is transferred repeatedly (e.g. every frame)
+ *        is mapped (and its pages pinned) only once.
+ *
+ * Mappings are keyed by (address, size, direction) and evicted in LRU order once the total size of the cached
+ * mappings exceeds the cache capacity. Evicting a mapping that is still used by an ongoing transfer is safe - the
+ * transfer holds its own reference, and the buffer is unmapped when the transfer is done.
+ *
+ * Note: The driver pins the pages of the buffer when it is mapped. If the user frees a buffer (and a new buffer is
+ * allocated at the same address), the cached mapping still points to the old pages. Buffers freed with
+ * hailo_free_buffer or unmapped with hailo_dma_unmap_buffer_from_device are invalidated in all the caches of the
+ * process (see invalidate_all), but a buffer freed by the user must be invalidated before it is freed. This is why
+ * the cache is disabled unless its capacity is set.
+ **/
+
+#ifndef _HAILO_DMA_MAPPING_CACHE_HPP_
+#define _HAILO_DMA_MAPPING_CACHE_HPP_
+
+#include "hailo/expected.hpp"
+
+#include "os/hailort_driver.hpp"
+#include "vdma/memory/mapped_buffer.hpp"
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+
+namespace hailort {
+namespace vdma {
+
+class DmaMappingCache final
+{
+public:
+    // Creates the mapping of a buffer that is not in the cache
+    using MapFunction = std::function<Expected<MappedBufferPtr>(void *address, size_t size,
+        HailoRTDriver::DmaDirection direction)>;
+
+    // The mappings are created using the driver.
+    DmaMappingCache(HailoRTDriver &driver, size_t max_mapped_bytes);
+    DmaMappingCache(MapFunction map_function, size_t max_mapped_bytes);
+
+    DmaMappingCache(const DmaMappingCache &) = delete;
+    DmaMappingCache &operator=(const DmaMappingCache &) = delete;
+    DmaMappingCache(DmaMappingCache &&) = delete;
+    DmaMappingCache &operator=(DmaMappingCache &&) = delete;
+    ~DmaMappingCache();
+
+    // Returns the cached mapping of the buffer, or maps it (and caches the mapping) if it isn't cached.
+    // Buffers larger than the cache capacity are mapped without being cached.
+    Expected<MappedBufferPtr> get_or_map(void *address, size_t size, HailoRTDriver::DmaDirection direction);
+
+    // Removes all cached mappings that overlap [address, address + size).
+    void invalidate(void *address, size_t size);
+    void clear();
+
+    // Removes the cached mappings that overlap [address, address + size) from all the caches of the process.
+    static void invalidate_all(void *address, size_t size);
+
+    bool is_enabled() const { return 0 < m_max_mapped_bytes; }
+    size_t mapped_bytes() const;
+
+private:
+    struct Key {
+        uintptr_t address;
+        size_t size;
+        HailoRTDriver::DmaDirection direction;
+
+        bool operator==(const Key &other) const
+        {
+            return (address == other.address) && (size == other.size) && (direction == other.direction);
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const
+        {
+            size_t hash = std::hash<uintptr_t>()(key.address);
+            hash = combine(hash, std::hash<size_t>()(key.size));
+            hash = combine(hash, std::hash<int>()(static_cast<int>(key.direction)));
+            return hash;
+        }
+
+        // Like boost::hash_combine, so equal fields (e.g. address == size) don't cancel each other out
+        static size_t combine(size_t seed, size_t hash)
+        {
+            return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+        }
+    };
+
+    struct Entry {
+        Key key;
+        MappedBufferPtr mapped_buffer;
+    };
+
+    // The caches of the process, for invalidate_all
+    struct Registry {
+        std::mutex mutex;
+        std::unordered_set<DmaMappingCache*> caches;
+    };
+    static Registry &registry();
+
+    // Must be called with m_mutex locked
+    void evict_until_fits(size_t size);
+    void erase(std::list<Entry>::iterator entry);
+
+    const MapFunction m_map_function;
+    const size_t m_max_mapped_bytes;
+
+    mutable std::mutex m_mutex;
+    // Most recently used mapping first
+    std::list<Entry> m_lru;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_entries;
+    size_t m_mapped_bytes;
+};
+
+} /* namespace vdma */
+} /* namespace hailort */
+
+#endif /* _HAILO_DMA_MAPPING_CACHE_HPP_ */
@@ -30,6 +30,11 @@ VdmaConfigCoreOp::VdmaConfigCoreOp(ActiveCoreOpHolder &active_core_op_holder,
 {}
 
 hailo_status VdmaConfigCoreOp::activate_impl(uint16_t dynamic_batch_size)
+{
+    return activate_impl(dynamic_batch_size, false);
+}
+
+hailo_status VdmaConfigCoreOp::activate_impl(uint16_t dynamic_batch_size, bool keep_interrupts_dispatcher)
 {
     auto status = HAILO_UNINITIALIZED;
 
@@ -42,7 +47,8 @@ hailo_status VdmaConfigCoreOp::activate_impl(uint16_t dynamic_batch_size)
     status = m_resources_manager->enable_state_machine(dynamic_batch_size);
     CHECK_SUCCESS(status, "Failed to activate state-machine");
 
-    status = m_resources_manager->start_vdma_interrupts_dispatcher();
+    // Switching the dispatcher must happen after the channels are reset by enable_state_machine.
+    status = m_resources_manager->start_vdma_interrupts_dispatcher(keep_interrupts_dispatcher);
     CHECK_SUCCESS(status, "Failed to start vdma interrupts");
 
     // Low-level streams assume that the vdma channels are enabled (happens in `enable_state_machine`), and that
@@ -54,7 +60,7 @@ hailo_status VdmaConfigCoreOp::activate_impl(uint16_t dynamic_batch_size)
     }
     CHECK_SUCCESS(status, "Failed to activate low level streams");
 
-    TRACE(SwitchCoreOpTrace, std::string(m_resources_manager->get_dev_id()), vdevice_core_op_handle());
+    TRACE(SwitchCoreOpTrace, m_resources_manager->get_trace_dev_id(), vdevice_core_op_handle());
 
     return HAILO_SUCCESS;
 }
@@ -75,11 +81,17 @@ hailo_status VdmaConfigCoreOp::deactivate_impl()
     return HAILO_SUCCESS;
 }
 
-hailo_status VdmaConfigCoreOp::deactivate_host_resources()
+hailo_status VdmaConfigCoreOp::deactivate_host_resources(bool keep_interrupts_dispatcher)
 {
     auto status = deactivate_low_level_streams();
     CHECK_SUCCESS(status, "Failed to deactivate low level streams");
 
+    if (keep_interrupts_dispatcher) {
+        // Interrupts of this core-op that are processed until the next core-op is activated are ignored, since the
+        // streams are deactivated.
+        return HAILO_SUCCESS;
+    }
+
     // After disabling the vdma interrupts, we may still get some interrupts. On HRT-9430 we need to clean them.
     status = m_resources_manager->stop_vdma_interrupts_dispatcher();
     CHECK_SUCCESS(status, "Failed to stop vdma interrupts");
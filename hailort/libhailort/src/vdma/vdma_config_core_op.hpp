@@ -46,10 +46,15 @@ public:
 
     // Functions to activate and deactivate core ops for scheduler - dont create ActivatedNetworkGroup objects
     virtual hailo_status activate_impl(uint16_t dynamic_batch_size) override;
+    // When keep_interrupts_dispatcher, the vdma interrupts dispatcher is still running from the previous core-op
+    // (deactivated with deactivate_host_resources(true)), and switches to this core-op's channels.
+    hailo_status activate_impl(uint16_t dynamic_batch_size, bool keep_interrupts_dispatcher);
     // Will first deactivate host resources (via deactivate_host_resources) and then reset the core-op on the fw
     virtual hailo_status deactivate_impl() override;
-    // Deactivate all resources related to the core-op on the host, but without resetting the core-op on the fw
-    hailo_status deactivate_host_resources();
+    // Deactivate all resources related to the core-op on the host, but without resetting the core-op on the fw.
+    // When keep_interrupts_dispatcher, the vdma interrupts dispatcher isn't stopped - the next core-op must be activated
+    // with keep_interrupts_dispatcher as well.
+    hailo_status deactivate_host_resources(bool keep_interrupts_dispatcher = false);
 
     virtual Expected<hailo_stream_interface_t> get_default_streams_interface() override;
 
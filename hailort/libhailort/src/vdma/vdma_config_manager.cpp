@@ -9,10 +9,44 @@
 
 #include "vdma_config_manager.hpp"
 #include "hailo/hailort.h"
+#include "common/utils.hpp"
 
 namespace hailort
 {
 
+// When set, the vdma interrupts dispatcher keeps running when switching between core-ops (it waits on the channels of
+// all the core-ops switched to), instead of being stopped and started again on each switch.
+#define FAST_CORE_OP_SWITCH_ENV_VAR ("HAILO_VDMA_FAST_CORE_OP_SWITCH")
+#define FAST_CORE_OP_SWITCH_ENV_VAR_VALUE ("1")
+
+static bool is_fast_core_op_switch_enabled()
+{
+    static const bool is_enabled = is_env_variable_on(FAST_CORE_OP_SWITCH_ENV_VAR, FAST_CORE_OP_SWITCH_ENV_VAR_VALUE,
+        sizeof(FAST_CORE_OP_SWITCH_ENV_VAR_VALUE));
+    return is_enabled;
+}
+
+// Called when switching from current_active_core_op failed after it was deactivated on the host. The interrupts
+// dispatcher may still process irqs with the callback of the current core-op (if it was kept running), or of the next
+// core-op (if it was switched to before the failure), so it is stopped, and the pending transfers of the current
+// core-op are canceled, as on a full deactivation.
+static void abort_core_op_switch(std::shared_ptr<VdmaConfigCoreOp> current_active_core_op)
+{
+    auto &resources_manager = current_active_core_op->get_resources_manager();
+    auto is_running = resources_manager->is_vdma_interrupts_dispatcher_running();
+    if (is_running && is_running.value()) {
+        auto status = resources_manager->stop_vdma_interrupts_dispatcher();
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR("Failed to stop vdma interrupts after a failed core-op switch (status {})", status);
+        }
+    }
+
+    auto status = resources_manager->cancel_pending_transfers();
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed canceling pending transfers after a failed core-op switch (status {})", status);
+    }
+}
+
 hailo_status VdmaConfigManager::switch_core_op(std::shared_ptr<VdmaConfigCoreOp> current_active_core_op,
     std::shared_ptr<VdmaConfigCoreOp> next_core_op, const uint16_t batch_size, const bool is_batch_switch)
 {
@@ -31,19 +65,26 @@ hailo_status VdmaConfigManager::switch_core_op(std::shared_ptr<VdmaConfigCoreOp>
         // We're switching from current_active_core_op to next_core_op.
         // Deactivate the current core-op on the host, meaning the fw state machine won't be reset.
         // This will be handled by activating the next core-op.
-        auto status = current_active_core_op->deactivate_host_resources();
+        const auto keep_interrupts_dispatcher = is_fast_core_op_switch_enabled();
+        auto status = current_active_core_op->deactivate_host_resources(keep_interrupts_dispatcher);
         CHECK_SUCCESS(status, "Failed deactivating current core-op");
 
         // TODO: In mercury we need to reset after deactivate. This will be fixed in MSW-762 and the "if" will be removed
         //       when we make the nn_manager responsible to reset the nn-core.
         if (Device::Type::INTEGRATED == current_active_core_op->get_resources_manager()->get_device().get_type()) {
             status = current_active_core_op->get_resources_manager()->reset_state_machine();
+            if (HAILO_SUCCESS != status) {
+                abort_core_op_switch(current_active_core_op);
+            }
             CHECK_SUCCESS(status, "Failed to reset state machine in switch core-op");
         }
 
         // Switch from the current core-op to the next core-op. I.e. current core-op will be deactivated and
         // next core-op will be activated
-        status = next_core_op->activate_impl(batch_size);
+        status = next_core_op->activate_impl(batch_size, keep_interrupts_dispatcher);
+        if (HAILO_SUCCESS != status) {
+            abort_core_op_switch(current_active_core_op);
+        }
         CHECK_SUCCESS(status, "Failed activating next core-op");
 
         // Current core-op is now deactivated (we are not on batch switch), so we can cancel pending transfers.
@@ -20,6 +20,7 @@
 
 #include <new>
 #include <algorithm>
+#include <cstdlib>
 
 
 namespace hailort
@@ -31,9 +32,25 @@ static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT(1000);
 static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT(50000);
 #endif /* ifndef HAILO_EMULATOR */
 
+// Total size of the user buffers kept mapped by the dma mapping cache (0 disables the cache).
+static constexpr const char *DMA_MAPPING_CACHE_SIZE_MB_ENV_VAR = "HAILO_DMA_MAPPING_CACHE_SIZE_MB";
+static constexpr size_t DEFAULT_DMA_MAPPING_CACHE_SIZE_MB = 0;
+
+static size_t get_dma_mapping_cache_size()
+{
+    size_t size_mb = DEFAULT_DMA_MAPPING_CACHE_SIZE_MB;
+    auto size_mb_env = std::getenv(DMA_MAPPING_CACHE_SIZE_MB_ENV_VAR);
+    if (nullptr != size_mb_env) {
+        size_mb = static_cast<size_t>(std::strtoull(size_mb_env, nullptr, 10));
+    }
+    return size_mb * 1024 * 1024;
+}
+
 VdmaDevice::VdmaDevice(std::unique_ptr<HailoRTDriver> &&driver, Device::Type type) :
     DeviceBase::DeviceBase(type),
-    m_driver(std::move(driver)), m_is_configured(false)
+    m_driver(std::move(driver)),
+    m_dma_mapping_cache(*m_driver, get_dma_mapping_cache_size()),
+    m_is_configured(false)
 {
     activate_notifications(get_dev_id());
 }
@@ -233,6 +250,31 @@ ExpectedRef<vdma::InterruptsDispatcher> VdmaDevice::get_vdma_interrupts_dispatch
     return std::ref(*m_vdma_interrupts_dispatcher);
 }
 
+hailo_status VdmaDevice::map_buffer_using_cache(Buffer &buffer, HailoRTDriver::DmaDirection direction)
+{
+    if (!m_dma_mapping_cache.is_enabled() || (BufferStorage::Type::DMA != buffer.storage().type())) {
+        return HAILO_SUCCESS;
+    }
+
+    auto &storage = static_cast<DmaStorage&>(buffer.storage());
+    if (!storage.is_user_allocated() || storage.is_dma_mapped(get_dev_id())) {
+        // Buffers allocated by hailort hold their own mapping
+        return HAILO_SUCCESS;
+    }
+
+    auto mapped_buffer = m_dma_mapping_cache.get_or_map(storage.user_address(), storage.size(), direction);
+    CHECK_EXPECTED_AS_STATUS(mapped_buffer);
+
+    return storage.set_dma_mapped_buffer(get_dev_id(), mapped_buffer.release());
+}
+
+hailo_status VdmaDevice::invalidate_dma_mapping_cache(void *address, size_t size)
+{
+    CHECK_ARG_NOT_NULL(address);
+    m_dma_mapping_cache.invalidate(address, size);
+    return HAILO_SUCCESS;
+}
+
 VdmaDevice::~VdmaDevice()
 {
     auto status = stop_notification_fetch_thread();
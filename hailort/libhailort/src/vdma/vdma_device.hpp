@@ -18,6 +18,7 @@
 #include "network_group/network_group_internal.hpp"
 #include "os/hailort_driver.hpp"
 #include "vdma/channel/interrupts_dispatcher.hpp"
+#include "vdma/memory/dma_mapping_cache.hpp"
 
 
 namespace hailort
@@ -48,6 +49,11 @@ public:
 
     ExpectedRef<vdma::InterruptsDispatcher> get_vdma_interrupts_dispatcher();
 
+    // If the dma mapping cache is enabled, and buffer is an unmapped user buffer, maps it using the cache (so the
+    // next transfers of the same buffer won't need to map it again).
+    hailo_status map_buffer_using_cache(Buffer &buffer, HailoRTDriver::DmaDirection direction);
+    virtual hailo_status invalidate_dma_mapping_cache(void *address, size_t size) override;
+
 protected:
     VdmaDevice(std::unique_ptr<HailoRTDriver> &&driver, Type type);
 
@@ -58,6 +64,8 @@ protected:
     virtual Expected<ConfiguredNetworkGroupVector> add_hef(Hef &hef, const NetworkGroupsParamsMap &configure_params) override;
 
     std::unique_ptr<HailoRTDriver> m_driver;
+    // Must be destructed before m_driver (the cached buffers are unmapped using the driver)
+    vdma::DmaMappingCache m_dma_mapping_cache;
     std::vector<std::shared_ptr<CoreOp>> m_core_ops;
     std::vector<std::shared_ptr<ConfiguredNetworkGroup>> m_network_groups; // TODO: HRT-9547 - Remove when ConfiguredNetworkGroup will be kept in global context
 
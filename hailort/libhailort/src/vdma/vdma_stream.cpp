@@ -37,7 +37,8 @@ VdmaInputStream::VdmaInputStream(VdmaDevice &device, vdma::BoundaryChannelPtr ch
     AsyncInputStreamBase(edge_layer, stream_interface, std::move(core_op_activated_event), status),
     m_device(device),
     m_channel(std::move(channel)),
-    m_interface(stream_interface)
+    m_interface(stream_interface),
+    m_trace_device_id(TraceStrings::get_id(device.get_dev_id()))
 {
     // Checking status for base class c'tor
     if (HAILO_SUCCESS != status) {
@@ -88,11 +89,37 @@ size_t VdmaInputStream::get_max_ongoing_transfers() const
 
 hailo_status VdmaInputStream::write_async_impl(TransferRequest &&transfer_request)
 {
-    TRACE(InputVdmaDequeueTrace, m_device.get_dev_id(), m_core_op_handle, name());
+    TRACE(InputVdmaDequeueTrace, m_trace_device_id, m_core_op_handle, m_trace_name);
+    auto status = m_device.map_buffer_using_cache(*transfer_request.buffer.base_buffer(),
+        HailoRTDriver::DmaDirection::H2D);
+    CHECK_SUCCESS(status);
+
     const auto user_owns_buffer = (buffer_mode() == StreamBufferMode::NOT_OWNING);
     return m_channel->launch_transfer(std::move(transfer_request), user_owns_buffer);
 }
 
+hailo_status VdmaInputStream::write_async_batch_impl(std::vector<TransferRequest> &transfer_requests)
+{
+    for (auto &transfer_request : transfer_requests) {
+        TRACE(InputVdmaDequeueTrace, m_trace_device_id, m_core_op_handle, m_trace_name);
+        auto status = m_device.map_buffer_using_cache(*transfer_request.buffer.base_buffer(),
+            HailoRTDriver::DmaDirection::H2D);
+        CHECK_SUCCESS(status);
+    }
+
+    const auto user_owns_buffer = (buffer_mode() == StreamBufferMode::NOT_OWNING);
+    return m_channel->launch_transfers(transfer_requests, user_owns_buffer);
+}
+
+hailo_status VdmaInputStream::prepare_async_transfer(TransferRequest &transfer_request, bool is_first_transfer)
+{
+    auto status = m_device.map_buffer_using_cache(*transfer_request.buffer.base_buffer(),
+        HailoRTDriver::DmaDirection::H2D);
+    CHECK_SUCCESS(status);
+
+    return m_channel->prepare_transfer(transfer_request, is_first_transfer);
+}
+
 hailo_status VdmaInputStream::activate_stream_impl()
 {
     return m_channel->activate();
@@ -168,10 +195,32 @@ size_t VdmaOutputStream::get_max_ongoing_transfers() const
 
 hailo_status VdmaOutputStream::read_async_impl(TransferRequest &&transfer_request)
 {
+    auto status = map_buffer(transfer_request.buffer);
+    CHECK_SUCCESS(status);
+
     const auto user_owns_buffer = (buffer_mode() == StreamBufferMode::NOT_OWNING);
     return m_channel->launch_transfer(std::move(transfer_request), user_owns_buffer);
 }
 
+hailo_status VdmaOutputStream::read_async_batch_impl(std::vector<TransferRequest> &transfer_requests)
+{
+    for (auto &transfer_request : transfer_requests) {
+        auto status = map_buffer(transfer_request.buffer);
+        CHECK_SUCCESS(status);
+    }
+
+    const auto user_owns_buffer = (buffer_mode() == StreamBufferMode::NOT_OWNING);
+    return m_channel->launch_transfers(transfer_requests, user_owns_buffer);
+}
+
+hailo_status VdmaOutputStream::prepare_async_transfer(TransferRequest &transfer_request, bool is_first_transfer)
+{
+    auto status = map_buffer(transfer_request.buffer);
+    CHECK_SUCCESS(status);
+
+    return m_channel->prepare_transfer(transfer_request, is_first_transfer);
+}
+
 hailo_status VdmaOutputStream::activate_stream_impl()
 {
     return m_channel->activate();
@@ -182,6 +231,65 @@ hailo_status VdmaOutputStream::deactivate_stream_impl()
     return m_channel->deactivate();
 }
 
+hailo_status VdmaOutputStream::register_buffers_ring(const std::vector<MemoryView> &buffers)
+{
+    auto status = set_buffer_mode(StreamBufferMode::NOT_OWNING);
+    CHECK_SUCCESS(status);
+
+    std::unordered_map<const void*, vdma::MappedBufferPtr> buffers_ring;
+    std::vector<vdma::MappedBufferPtr> mapped_buffers;
+    mapped_buffers.reserve(buffers.size());
+    for (const auto &buffer : buffers) {
+        CHECK_ARG_NOT_NULL(buffer.data());
+        CHECK(buffer.size() == get_frame_size(), HAILO_INVALID_ARGUMENT, "Buffer size {} must be frame size {}",
+            buffer.size(), get_frame_size());
+
+        auto dma_able_buffer = vdma::DmaAbleBuffer::create(buffer.size(), const_cast<uint8_t*>(buffer.data()));
+        CHECK_EXPECTED_AS_STATUS(dma_able_buffer);
+        auto mapped_buffer = vdma::MappedBuffer::create_shared(m_device.get_driver(), dma_able_buffer.release(),
+            HailoRTDriver::DmaDirection::D2H);
+        CHECK_EXPECTED_AS_STATUS(mapped_buffer);
+
+        buffers_ring.emplace(buffer.data(), mapped_buffer.value());
+        mapped_buffers.emplace_back(mapped_buffer.release());
+    }
+
+    status = m_channel->bind_buffers_ring(mapped_buffers);
+    CHECK_SUCCESS(status);
+
+    std::lock_guard<std::mutex> lock(m_buffers_ring_mutex);
+    m_buffers_ring = std::move(buffers_ring);
+    return HAILO_SUCCESS;
+}
+
+hailo_status VdmaOutputStream::unregister_buffers_ring()
+{
+    // The channel holds the ring mappings as its bound buffers, so both must be released.
+    auto status = m_channel->unbind_buffers();
+    CHECK_SUCCESS(status);
+
+    std::lock_guard<std::mutex> lock(m_buffers_ring_mutex);
+    m_buffers_ring.clear();
+    return HAILO_SUCCESS;
+}
+
+hailo_status VdmaOutputStream::map_buffer(TransferBuffer &buffer)
+{
+    auto &base_buffer = *buffer.base_buffer();
+    if (BufferStorage::Type::DMA == base_buffer.storage().type()) {
+        auto &storage = static_cast<DmaStorage&>(base_buffer.storage());
+        std::lock_guard<std::mutex> lock(m_buffers_ring_mutex);
+        const auto ring_buffer = m_buffers_ring.find(storage.user_address());
+        if ((m_buffers_ring.end() != ring_buffer) && (ring_buffer->second->size() == storage.size()) &&
+            storage.is_user_allocated() && !storage.is_dma_mapped(m_device.get_dev_id())) {
+            // Using the mapping the buffer was bound with, so the channel finds it already bound.
+            return storage.set_dma_mapped_buffer(m_device.get_dev_id(), ring_buffer->second);
+        }
+    }
+
+    return m_device.map_buffer_using_cache(base_buffer, HailoRTDriver::DmaDirection::D2H);
+}
+
 uint32_t VdmaOutputStream::get_transfer_size(const hailo_stream_info_t &stream_info, const LayerInfo &layer_info)
 {
     return LayerInfoUtils::get_stream_transfer_size(stream_info, layer_info);
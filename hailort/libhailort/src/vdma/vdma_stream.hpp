@@ -16,6 +16,9 @@
 #include "vdma/vdma_device.hpp"
 #include "vdma/channel/boundary_channel.hpp"
 
+#include <mutex>
+#include <unordered_map>
+
 
 namespace hailort
 {
@@ -41,12 +44,15 @@ private:
     Expected<std::unique_ptr<StreamBufferPool>> allocate_buffer_pool() override;
     virtual size_t get_max_ongoing_transfers() const override;
     virtual hailo_status write_async_impl(TransferRequest &&transfer_request) override;
+    virtual hailo_status write_async_batch_impl(std::vector<TransferRequest> &transfer_requests) override;
+    virtual hailo_status prepare_async_transfer(TransferRequest &transfer_request, bool is_first_transfer) override;
     virtual hailo_status activate_stream_impl() override;
     virtual hailo_status deactivate_stream_impl() override;
 
     VdmaDevice &m_device;
     vdma::BoundaryChannelPtr m_channel;
     const hailo_stream_interface_t m_interface;
+    const trace_string_id_t m_trace_device_id;
     vdevice_core_op_handle_t m_core_op_handle;
 };
 
@@ -67,15 +73,26 @@ public:
     virtual Expected<std::unique_ptr<StreamBufferPool>> allocate_buffer_pool() override;
     virtual size_t get_max_ongoing_transfers() const override;
     virtual hailo_status read_async_impl(TransferRequest &&transfer_request) override;
+    virtual hailo_status read_async_batch_impl(std::vector<TransferRequest> &transfer_requests) override;
+    virtual hailo_status prepare_async_transfer(TransferRequest &transfer_request, bool is_first_transfer) override;
     virtual hailo_status activate_stream_impl() override;
     virtual hailo_status deactivate_stream_impl() override;
+    virtual hailo_status register_buffers_ring(const std::vector<MemoryView> &buffers) override;
+    virtual hailo_status unregister_buffers_ring() override;
 private:
     static uint32_t get_transfer_size(const hailo_stream_info_t &stream_info, const LayerInfo &layer_info);
 
+    // Maps the buffer of the transfer, using the mapping of the registered buffers ring if the buffer is part of it.
+    hailo_status map_buffer(TransferBuffer &buffer);
+
     VdmaDevice &m_device;
     vdma::BoundaryChannelPtr m_channel;
     const hailo_stream_interface_t m_interface;
     const uint32_t m_transfer_size;
+
+    // The mappings of the buffers registered by register_buffers_ring, by their user address.
+    std::mutex m_buffers_ring_mutex;
+    std::unordered_map<const void*, vdma::MappedBufferPtr> m_buffers_ring;
 };
 
 
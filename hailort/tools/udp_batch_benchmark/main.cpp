@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2020-2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file main.cpp
+ * @brief Benchmarks single datagram socket I/O (send_to/recv_from) against batched I/O
+ *        (send_multiple_to/recv_multiple_from), over loopback against a local UDP stand-in for the device.
+ **/
+
+#include "common/socket.hpp"
+
+#include <arpa/inet.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace hailort;
+
+static constexpr size_t DEFAULT_PACKETS_COUNT = 1000000;
+static constexpr size_t PACKET_SIZE = MAX_UDP_PAYLOAD_SIZE;
+static constexpr std::chrono::milliseconds SOCKET_TIMEOUT(100);
+
+enum class IoMode {
+    SINGLE,
+    BATCHED
+};
+
+static const char *io_mode_name(IoMode mode)
+{
+    return (IoMode::SINGLE == mode) ? "single" : "batched";
+}
+
+static Expected<Socket> create_loopback_socket(sockaddr_in &address)
+{
+    auto socket = Socket::create(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    CHECK_EXPECTED(socket);
+
+    auto status = socket->set_recv_buffer_size_max();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    timeval_t timeout{};
+    status = socket->set_timeout(SOCKET_TIMEOUT, &timeout);
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    status = socket->socket_bind(reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    socklen_t address_length = sizeof(address);
+    status = socket->get_sock_name(reinterpret_cast<sockaddr*>(&address), &address_length);
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    return socket;
+}
+
+// Sends packets_count packets, each PACKET_SIZE bytes long
+static hailo_status send_packets(Socket &socket, const sockaddr_in &dest, IoMode mode, size_t packets_count)
+{
+    std::vector<uint8_t> buffer(PACKET_SIZE * MAX_DATAGRAMS_PER_BATCH, 0xAB);
+    std::array<SocketDatagram, MAX_DATAGRAMS_PER_BATCH> datagrams{};
+    for (size_t i = 0; i < datagrams.size(); i++) {
+        datagrams[i].data = buffer.data() + (i * PACKET_SIZE);
+        datagrams[i].size = PACKET_SIZE;
+    }
+
+    size_t packets_sent = 0;
+    while (packets_sent < packets_count) {
+        if (IoMode::SINGLE == mode) {
+            size_t bytes_sent = 0;
+            auto status = socket.send_to(buffer.data(), PACKET_SIZE, 0, reinterpret_cast<const sockaddr*>(&dest),
+                sizeof(dest), &bytes_sent);
+            CHECK_SUCCESS(status);
+            packets_sent++;
+        } else {
+            const auto batch_size = std::min(datagrams.size(), packets_count - packets_sent);
+            size_t datagrams_sent = 0;
+            auto status = socket.send_multiple_to(nullptr, 0, datagrams.data(), batch_size, 0,
+                reinterpret_cast<const sockaddr*>(&dest), sizeof(dest), &datagrams_sent);
+            CHECK_SUCCESS(status);
+            packets_sent += datagrams_sent;
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
+// Receives until packets_count packets were received, or until the socket times out (packets may be dropped).
+static Expected<size_t> recv_packets(Socket &socket, IoMode mode, size_t packets_count)
+{
+    std::vector<uint8_t> buffer(PACKET_SIZE * MAX_DATAGRAMS_PER_BATCH);
+    std::array<SocketDatagram, MAX_DATAGRAMS_PER_BATCH> datagrams{};
+    sockaddr_in src{};
+
+    size_t packets_received = 0;
+    while (packets_received < packets_count) {
+        hailo_status status = HAILO_UNINITIALIZED;
+        if (IoMode::SINGLE == mode) {
+            size_t bytes_received = 0;
+            status = socket.recv_from(buffer.data(), PACKET_SIZE, 0, reinterpret_cast<sockaddr*>(&src), sizeof(src),
+                &bytes_received, true);
+            if (HAILO_SUCCESS == status) {
+                packets_received++;
+            }
+        } else {
+            for (size_t i = 0; i < datagrams.size(); i++) {
+                datagrams[i].data = buffer.data() + (i * PACKET_SIZE);
+                datagrams[i].size = PACKET_SIZE;
+            }
+            const auto batch_size = std::min(datagrams.size(), packets_count - packets_received);
+            size_t datagrams_received = 0;
+            status = socket.recv_multiple_from(datagrams.data(), batch_size, 0, &datagrams_received);
+            if (HAILO_SUCCESS == status) {
+                packets_received += datagrams_received;
+            }
+        }
+        if (HAILO_TIMEOUT == status) {
+            break;
+        }
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    }
+
+    return packets_received;
+}
+
+static void print_result(const std::string &direction, IoMode mode, size_t packets_count, size_t packets_received,
+    std::chrono::duration<double> elapsed)
+{
+    const auto packets_per_sec = static_cast<double>(packets_count) / elapsed.count();
+    const auto gbit_per_sec = (packets_per_sec * PACKET_SIZE * 8) / 1e9;
+    std::cout << direction << " (" << io_mode_name(mode) << "): " << packets_per_sec << " packets/sec, " <<
+        gbit_per_sec << " Gbit/s, received " << packets_received << "/" << packets_count << " packets" << std::endl;
+}
+
+// Host -> device: the host sends (in the given mode), the device stand-in drains the socket with batched receives.
+static hailo_status benchmark_send(IoMode mode, size_t packets_count)
+{
+    sockaddr_in host_address{};
+    auto host = create_loopback_socket(host_address);
+    CHECK_EXPECTED_AS_STATUS(host);
+    sockaddr_in device_address{};
+    auto device = create_loopback_socket(device_address);
+    CHECK_EXPECTED_AS_STATUS(device);
+
+    std::atomic<size_t> packets_received(0);
+    std::thread device_thread([&device, &packets_received, packets_count]() {
+        auto received = recv_packets(device.value(), IoMode::BATCHED, packets_count);
+        packets_received = received ? received.value() : 0;
+    });
+
+    const auto start_time = std::chrono::steady_clock::now();
+    auto status = send_packets(host.value(), device_address, mode, packets_count);
+    const auto elapsed = std::chrono::steady_clock::now() - start_time;
+    device_thread.join();
+    CHECK_SUCCESS(status);
+
+    print_result("host->device", mode, packets_count, packets_received, elapsed);
+    return HAILO_SUCCESS;
+}
+
+// Device -> host: the device stand-in sends with batched sends, the host receives (in the given mode).
+static hailo_status benchmark_recv(IoMode mode, size_t packets_count)
+{
+    sockaddr_in host_address{};
+    auto host = create_loopback_socket(host_address);
+    CHECK_EXPECTED_AS_STATUS(host);
+    sockaddr_in device_address{};
+    auto device = create_loopback_socket(device_address);
+    CHECK_EXPECTED_AS_STATUS(device);
+
+    std::thread device_thread([&device, &host_address, packets_count]() {
+        (void)send_packets(device.value(), host_address, IoMode::BATCHED, packets_count);
+    });
+
+    const auto start_time = std::chrono::steady_clock::now();
+    auto packets_received = recv_packets(host.value(), mode, packets_count);
+    const auto elapsed = std::chrono::steady_clock::now() - start_time;
+    device_thread.join();
+    CHECK_EXPECTED_AS_STATUS(packets_received);
+
+    print_result("device->host", mode, packets_count, packets_received.value(), elapsed);
+    return HAILO_SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+    const size_t packets_count = (argc > 1) ? std::stoul(argv[1]) : DEFAULT_PACKETS_COUNT;
+
+    for (auto mode : {IoMode::SINGLE, IoMode::BATCHED}) {
+        auto status = benchmark_send(mode, packets_count);
+        if (HAILO_SUCCESS != status) {
+            std::cerr << "Send benchmark failed with status " << status << std::endl;
+            return status;
+        }
+
+        status = benchmark_recv(mode, packets_count);
+        if (HAILO_SUCCESS != status) {
+            std::cerr << "Recv benchmark failed with status " << status << std::endl;
+            return status;
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
@@ -0,0 +1,357 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file buffers_ring_tests.cpp
+ * @brief Tests of the buffers ring of an output stream (OutputStream::register_buffers_ring) - a VdmaOutputStream of
+ *        the software device reads the frames looped back from an input channel, and the tests count the buffer
+ *        mappings and descriptors binds of the device.
+ **/
+
+#include "software_tests.hpp"
+#include "loopback_stream.hpp"
+
+#include "hailo/buffer.hpp"
+#include "hailo/event.hpp"
+
+#include "os/software_driver.hpp"
+#include "vdma/vdma_device.hpp"
+#include "vdma/vdma_stream.hpp"
+#include "vdma/channel/interrupts_dispatcher.hpp"
+#include "vdma/memory/descriptor_list.hpp"
+#include "stream_common/transfer_common.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+
+namespace hailort
+{
+
+static constexpr uint32_t FRAME_HEIGHT = 16;
+static constexpr uint32_t FRAME_WIDTH = 64;
+static constexpr uint32_t FRAME_FEATURES = 64;
+static constexpr size_t FRAME_SIZE = FRAME_HEIGHT * FRAME_WIDTH * FRAME_FEATURES;
+static constexpr size_t RING_SIZE = 4;
+static constexpr uint8_t STREAM_INDEX = 0;
+static constexpr auto FRAMES_TIMEOUT = std::chrono::seconds(5);
+
+// A vdma device over the software driver, so vdma streams can be created on it
+class SoftwareVdmaDevice final : public VdmaDevice
+{
+public:
+    SoftwareVdmaDevice(std::unique_ptr<SoftwareDriver> &&driver) :
+        VdmaDevice(std::move(driver), Device::Type::INTEGRATED)
+    {}
+
+    SoftwareDriver &software_driver()
+    {
+        return static_cast<SoftwareDriver&>(get_driver());
+    }
+
+    virtual bool is_stream_interface_supported(const hailo_stream_interface_t &stream_interface) const override
+    {
+        return HAILO_STREAM_INTERFACE_INTEGRATED == stream_interface;
+    }
+
+protected:
+    virtual hailo_status reset_impl(CONTROL_PROTOCOL__reset_type_t /*reset_type*/) override
+    {
+        return HAILO_NOT_SUPPORTED;
+    }
+};
+
+// An output stream of the software device, reading the frames written to the input channel it is looped back from.
+// Each input buffer is filled with its own pattern, and frame i is written from input buffer (i % RING_SIZE), so it is
+// read into buffer (i % RING_SIZE) of the ring.
+class BuffersRingTest final
+{
+public:
+    static Expected<std::unique_ptr<BuffersRingTest>> create()
+    {
+        auto driver = SoftwareDriver::create();
+        CHECK_EXPECTED(driver);
+        auto device = make_unique_nothrow<SoftwareVdmaDevice>(driver.release());
+        CHECK_NOT_NULL_AS_EXPECTED(device, HAILO_OUT_OF_HOST_MEMORY);
+
+        const auto desc_page_size = device->get_driver().desc_max_page_size();
+        const auto descs_count = vdma::DescriptorList::calculate_descriptors_count(static_cast<uint32_t>(FRAME_SIZE),
+            static_cast<uint16_t>(RING_SIZE), desc_page_size);
+        auto input_channel = vdma::BoundaryChannel::create(LoopbackStream::input_channel_id(STREAM_INDEX),
+            HailoRTDriver::DmaDirection::H2D, device->get_driver(), descs_count, desc_page_size, "input");
+        CHECK_EXPECTED(input_channel);
+        auto output_channel = vdma::BoundaryChannel::create(LoopbackStream::output_channel_id(STREAM_INDEX),
+            HailoRTDriver::DmaDirection::D2H, device->get_driver(), descs_count, desc_page_size, "output");
+        CHECK_EXPECTED(output_channel);
+
+        auto core_op_activated_event = Event::create_shared(Event::State::not_signalled);
+        CHECK_EXPECTED(core_op_activated_event);
+        auto stream = VdmaOutputStream::create(HAILO_STREAM_INTERFACE_INTEGRATED, *device, output_channel.value(),
+            output_layer_info(), core_op_activated_event.release());
+        CHECK_EXPECTED(stream);
+
+        auto dispatcher = vdma::InterruptsDispatcher::create(std::ref(device->get_driver()));
+        CHECK_EXPECTED(dispatcher);
+
+        std::vector<BufferPtr> inputs;
+        for (size_t i = 0; i < RING_SIZE; i++) {
+            auto input = Buffer::create_shared(FRAME_SIZE, BufferStorageParams::create_dma());
+            CHECK_EXPECTED(input);
+            fill_pattern(*input.value(), static_cast<uint8_t>(i + 1));
+            inputs.emplace_back(input.release());
+        }
+        // The inputs are bound ahead too, so the only binds while streaming are of the output stream.
+        auto status = LoopbackStream::bind_buffers_ring(device->software_driver(), *input_channel.value(),
+            HailoRTDriver::DmaDirection::H2D, inputs);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        // Mapped user buffers must be page aligned
+        auto ring_memory = Buffer::create_shared(RING_SIZE * FRAME_SIZE, BufferStorageParams::create_dma());
+        CHECK_EXPECTED(ring_memory);
+
+        auto test = make_unique_nothrow<BuffersRingTest>(std::move(device), input_channel.release(),
+            output_channel.release(), stream.release(), dispatcher.release(), std::move(inputs), ring_memory.release());
+        CHECK_NOT_NULL_AS_EXPECTED(test, HAILO_OUT_OF_HOST_MEMORY);
+        return test;
+    }
+
+    BuffersRingTest(std::unique_ptr<SoftwareVdmaDevice> &&device, vdma::BoundaryChannelPtr input_channel,
+        vdma::BoundaryChannelPtr output_channel, std::shared_ptr<VdmaOutputStream> stream,
+        std::unique_ptr<vdma::InterruptsDispatcher> &&dispatcher, std::vector<BufferPtr> &&inputs,
+        BufferPtr ring_memory) :
+            m_device(std::move(device)),
+            m_input_channel(input_channel),
+            m_output_channel(output_channel),
+            m_stream(stream),
+            m_dispatcher(std::move(dispatcher)),
+            m_inputs(std::move(inputs)),
+            m_ring_memory(ring_memory),
+            m_is_started(false),
+            m_done_frames(0),
+            m_failed_status(HAILO_SUCCESS)
+    {}
+
+    ~BuffersRingTest()
+    {
+        (void)stop();
+    }
+
+    OutputStream &stream() { return *m_stream; }
+    SoftwareDriver::OperationsCounters counters() { return m_device->software_driver().get_operations_counters(); }
+
+    std::vector<MemoryView> ring() const
+    {
+        std::vector<MemoryView> ring;
+        for (size_t i = 0; i < RING_SIZE; i++) {
+            ring.emplace_back(ring_buffer(i), FRAME_SIZE);
+        }
+        return ring;
+    }
+
+    // Resets the channels on the device and activates them (as the core-op activation does)
+    hailo_status start()
+    {
+        ChannelsBitmap bitmap{};
+        bitmap[0] = (1u << m_input_channel->get_channel_id().channel_index) |
+            (1u << m_output_channel->get_channel_id().channel_index);
+        auto status = m_device->software_driver().reset_channels(bitmap);
+        CHECK_SUCCESS(status);
+        status = m_input_channel->activate();
+        CHECK_SUCCESS(status);
+        status = m_stream->activate_stream();
+        CHECK_SUCCESS(status);
+
+        m_is_started = true;
+        return m_dispatcher->start(bitmap, false, [this](IrqData &&irq_data) {
+            for (uint8_t i = 0; i < irq_data.channels_count; i++) {
+                const auto &channel_irq_data = irq_data.channels_irq_data[i];
+                auto &channel = (m_input_channel->get_channel_id() == channel_irq_data.channel_id) ?
+                    m_input_channel : m_output_channel;
+                auto status = channel->trigger_channel_completion(channel_irq_data.desc_num_processed);
+                if (HAILO_SUCCESS != status) {
+                    LOGGER__ERROR("Trigger channel completion failed with status {}", status);
+                }
+            }
+        });
+    }
+
+    hailo_status stop()
+    {
+        if (!m_is_started) {
+            return HAILO_SUCCESS;
+        }
+        m_is_started = false;
+
+        auto status = m_dispatcher->stop();
+        CHECK_SUCCESS(status);
+        status = m_stream->deactivate_stream();
+        CHECK_SUCCESS(status);
+        status = m_input_channel->deactivate();
+        CHECK_SUCCESS(status);
+        m_input_channel->cancel_pending_transfers();
+        m_output_channel->cancel_pending_transfers();
+        return HAILO_SUCCESS;
+    }
+
+    // Reads the frames into the ring in order (a ring round at a time), and checks each frame was read into its buffer
+    hailo_status run_frames(size_t frames_count)
+    {
+        for (size_t round_first_frame = 0; round_first_frame < frames_count; round_first_frame += RING_SIZE) {
+            const size_t round_frames = std::min(RING_SIZE, frames_count - round_first_frame);
+            memset(m_ring_memory->data(), 0, m_ring_memory->size());
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_done_frames = 0;
+            }
+
+            // Read through the public interface, as the user reads (AsyncOutputStreamBase hides its overloads)
+            OutputStream &stream = *m_stream;
+            for (size_t i = 0; i < round_frames; i++) {
+                auto status = stream.read_async(ring_buffer(i), FRAME_SIZE,
+                    [this](const OutputStream::CompletionInfo &completion_info) {
+                        on_frame_done(completion_info.status);
+                    });
+                CHECK_SUCCESS(status);
+                status = m_input_channel->launch_transfer(TransferRequest{TransferBuffer(m_inputs[i]),
+                    [](hailo_status) {}}, false);
+                CHECK_SUCCESS(status);
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            CHECK(m_cv.wait_for(lock, FRAMES_TIMEOUT, [this, round_frames]() { return round_frames == m_done_frames; }),
+                HAILO_TIMEOUT, "Timeout waiting for the frames");
+            CHECK_SUCCESS(m_failed_status, "Read failed");
+            for (size_t i = 0; i < round_frames; i++) {
+                CHECK(0 == memcmp(ring_buffer(i), m_inputs[i]->data(), FRAME_SIZE), HAILO_INTERNAL_FAILURE,
+                    "Frame {} wasn't read into its ring buffer", round_first_frame + i);
+            }
+        }
+        return HAILO_SUCCESS;
+    }
+
+private:
+    static LayerInfo output_layer_info()
+    {
+        LayerInfo layer_info = {};
+        layer_info.type = LayerType::BOUNDARY;
+        layer_info.direction = HAILO_D2H_STREAM;
+        layer_info.stream_index = STREAM_INDEX;
+        layer_info.name = "output";
+        layer_info.network_name = "net";
+        layer_info.max_shmifo_size = UINT32_MAX;
+        layer_info.shape = {FRAME_HEIGHT, FRAME_WIDTH, FRAME_FEATURES};
+        layer_info.hw_shape = layer_info.shape;
+        layer_info.hw_data_bytes = 1;
+        layer_info.format = {HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC, HAILO_FORMAT_FLAGS_NONE};
+        return layer_info;
+    }
+
+    static void fill_pattern(Buffer &buffer, uint8_t seed)
+    {
+        for (size_t i = 0; i < buffer.size(); i++) {
+            buffer[i] = static_cast<uint8_t>(i + seed);
+        }
+    }
+
+    uint8_t *ring_buffer(size_t index) const
+    {
+        return m_ring_memory->data() + (index * FRAME_SIZE);
+    }
+
+    void on_frame_done(hailo_status status)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if ((HAILO_SUCCESS != status) && (HAILO_SUCCESS == m_failed_status)) {
+                m_failed_status = status;
+            }
+            m_done_frames++;
+        }
+        m_cv.notify_all();
+    }
+
+    // Must be destructed last (the channels and the dispatcher use its driver)
+    std::unique_ptr<SoftwareVdmaDevice> m_device;
+    vdma::BoundaryChannelPtr m_input_channel;
+    vdma::BoundaryChannelPtr m_output_channel;
+    std::shared_ptr<VdmaOutputStream> m_stream;
+    std::unique_ptr<vdma::InterruptsDispatcher> m_dispatcher;
+    std::vector<BufferPtr> m_inputs;
+    BufferPtr m_ring_memory;
+    bool m_is_started;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    size_t m_done_frames;
+    hailo_status m_failed_status;
+};
+
+static hailo_status test_ring_reads_without_mapping()
+{
+    auto test = BuffersRingTest::create();
+    CHECK_EXPECTED_AS_STATUS(test);
+
+    const auto before_register = test.value()->counters();
+    auto status = test.value()->stream().register_buffers_ring(test.value()->ring());
+    CHECK_SUCCESS(status);
+    const auto before_frames = test.value()->counters();
+    CHECK(RING_SIZE == (before_frames.buffer_maps - before_register.buffer_maps), HAILO_INTERNAL_FAILURE,
+        "Expected the ring buffers to be mapped on registration");
+
+    status = test.value()->start();
+    CHECK_SUCCESS(status);
+    status = test.value()->run_frames(4 * RING_SIZE);
+    CHECK_SUCCESS(status);
+    status = test.value()->stop();
+    CHECK_SUCCESS(status);
+
+    const auto after_frames = test.value()->counters();
+    CHECK(before_frames.buffer_maps == after_frames.buffer_maps, HAILO_INTERNAL_FAILURE,
+        "Reading into the ring mapped {} buffers", after_frames.buffer_maps - before_frames.buffer_maps);
+    CHECK(before_frames.descs_binds == after_frames.descs_binds, HAILO_INTERNAL_FAILURE,
+        "Reading into the ring bound the descriptors {} times", after_frames.descs_binds - before_frames.descs_binds);
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_unregister()
+{
+    auto test = BuffersRingTest::create();
+    CHECK_EXPECTED_AS_STATUS(test);
+
+    auto status = test.value()->stream().register_buffers_ring(test.value()->ring());
+    CHECK_SUCCESS(status);
+    const auto before_unregister = test.value()->counters();
+    status = test.value()->stream().unregister_buffers_ring();
+    CHECK_SUCCESS(status);
+    const auto before_frames = test.value()->counters();
+    CHECK(RING_SIZE == (before_frames.buffer_unmaps - before_unregister.buffer_unmaps), HAILO_INTERNAL_FAILURE,
+        "Expected the ring buffers to be unmapped on unregistration");
+
+    // The buffers aren't in a ring anymore (they could have been freed and reallocated), so each read maps its buffer
+    status = test.value()->start();
+    CHECK_SUCCESS(status);
+    status = test.value()->run_frames(RING_SIZE);
+    CHECK_SUCCESS(status);
+    status = test.value()->stop();
+    CHECK_SUCCESS(status);
+
+    const auto after_frames = test.value()->counters();
+    CHECK(RING_SIZE == (after_frames.buffer_maps - before_frames.buffer_maps), HAILO_INTERNAL_FAILURE,
+        "Expected each read to map its buffer after unregistration (got {} maps)",
+        after_frames.buffer_maps - before_frames.buffer_maps);
+    return HAILO_SUCCESS;
+}
+
+void add_buffers_ring_tests(std::vector<SoftwareTest> &tests)
+{
+    tests.push_back({"buffers_ring.ring_reads_without_mapping", test_ring_reads_without_mapping});
+    tests.push_back({"buffers_ring.unregister", test_unregister});
+}
+
+} /* namespace hailort */
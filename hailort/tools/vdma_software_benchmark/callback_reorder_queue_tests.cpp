@@ -0,0 +1,292 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file callback_reorder_queue_tests.cpp
+ * @brief Tests of CallbackReorderQueue - the callbacks must be called in the wrap order, no matter the order (and the
+ *        threads) they are completed in, and also when several threads wrap callbacks concurrently (as the async
+ *        streams of a vdevice do).
+ **/
+
+#include "software_tests.hpp"
+
+#include "vdevice/callback_reorder_queue.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+
+
+namespace hailort
+{
+
+static constexpr size_t TEST_QUEUE_SIZE = 8;
+static constexpr size_t STRESS_PRODUCERS_COUNT = 4;
+static constexpr size_t STRESS_COMPLETERS_COUNT = 4;
+static constexpr size_t STRESS_CALLBACKS_PER_PRODUCER = 20000;
+static constexpr auto STRESS_QUEUE_FULL_TIMEOUT = std::chrono::seconds(10);
+// Every CANCEL_INTERVAL-th callback of a producer is canceled instead of completed (if canceling is enabled)
+static constexpr size_t CANCEL_INTERVAL = 7;
+
+static hailo_status test_reverse_completion_order()
+{
+    CallbackReorderQueue queue(TEST_QUEUE_SIZE);
+    std::vector<size_t> called;
+    std::vector<InternalTransferDoneCallback> wrapped;
+    for (size_t i = 0; i < TEST_QUEUE_SIZE; i++) {
+        auto callback = queue.wrap_callback([&called, i](hailo_status) { called.push_back(i); });
+        CHECK_EXPECTED_AS_STATUS(callback);
+        wrapped.emplace_back(callback.release().callback);
+    }
+
+    for (size_t i = TEST_QUEUE_SIZE; i > 0; i--) {
+        wrapped[i - 1](HAILO_SUCCESS);
+        // Only the completion of the first callback calls the callbacks
+        CHECK(called.size() == ((i == 1) ? TEST_QUEUE_SIZE : 0), HAILO_INTERNAL_FAILURE,
+            "{} callbacks were called after completing callback {}", called.size(), i - 1);
+    }
+
+    for (size_t i = 0; i < TEST_QUEUE_SIZE; i++) {
+        CHECK(called[i] == i, HAILO_INTERNAL_FAILURE, "Callback {} was called at place {}", called[i], i);
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_status_passed_to_original()
+{
+    CallbackReorderQueue queue(TEST_QUEUE_SIZE);
+    std::vector<hailo_status> statuses;
+    auto first = queue.wrap_callback([&statuses](hailo_status status) { statuses.push_back(status); });
+    CHECK_EXPECTED_AS_STATUS(first);
+    auto second = queue.wrap_callback([&statuses](hailo_status status) { statuses.push_back(status); });
+    CHECK_EXPECTED_AS_STATUS(second);
+
+    second->callback(HAILO_STREAM_ABORTED);
+    first->callback(HAILO_SUCCESS);
+
+    CHECK((2 == statuses.size()) && (HAILO_SUCCESS == statuses[0]) && (HAILO_STREAM_ABORTED == statuses[1]),
+        HAILO_INTERNAL_FAILURE, "Wrong statuses were passed to the original callbacks");
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_queue_full()
+{
+    CallbackReorderQueue queue(TEST_QUEUE_SIZE);
+    std::vector<InternalTransferDoneCallback> wrapped;
+    size_t called_count = 0;
+    while (true) {
+        auto callback = queue.wrap_callback([&called_count](hailo_status) { called_count++; });
+        if (HAILO_QUEUE_IS_FULL == callback.status()) {
+            break;
+        }
+        CHECK_EXPECTED_AS_STATUS(callback);
+        wrapped.emplace_back(callback.release().callback);
+    }
+    CHECK(wrapped.size() >= TEST_QUEUE_SIZE, HAILO_INTERNAL_FAILURE, "The queue is full after {} callbacks",
+        wrapped.size());
+
+    // The original callback is kept by the caller when the queue is full
+    bool was_called = false;
+    InternalTransferDoneCallback original = [&was_called](hailo_status) { was_called = true; };
+    auto full_callback = queue.wrap_callback(std::move(original));
+    CHECK(HAILO_QUEUE_IS_FULL == full_callback.status(), HAILO_INTERNAL_FAILURE, "Expected the queue to be full");
+    CHECK(original, HAILO_INTERNAL_FAILURE, "The original callback was moved although the queue is full");
+
+    // Completing the first callback frees its slot
+    wrapped[0](HAILO_SUCCESS);
+    auto callback = queue.wrap_callback(std::move(original));
+    CHECK_EXPECTED_AS_STATUS(callback);
+    wrapped.emplace_back(callback.release().callback);
+
+    for (size_t i = 1; i < wrapped.size(); i++) {
+        wrapped[i](HAILO_SUCCESS);
+    }
+    CHECK((called_count == (wrapped.size() - 1)) && was_called, HAILO_INTERNAL_FAILURE,
+        "Not all the callbacks were called");
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_cancel()
+{
+    CallbackReorderQueue queue(TEST_QUEUE_SIZE);
+    std::vector<size_t> called;
+    std::vector<CallbackReorderQueue::WrappedCallback> wrapped;
+    for (size_t i = 0; i < 3; i++) {
+        auto callback = queue.wrap_callback([&called, i](hailo_status) { called.push_back(i); });
+        CHECK_EXPECTED_AS_STATUS(callback);
+        wrapped.emplace_back(callback.release());
+    }
+
+    // The canceled callback doesn't block the callbacks after it, and isn't called.
+    wrapped[2].callback(HAILO_SUCCESS);
+    queue.cancel_callback(wrapped[1].index);
+    CHECK(called.empty(), HAILO_INTERNAL_FAILURE, "Callbacks were called before the first one was done");
+    wrapped[0].callback(HAILO_SUCCESS);
+    CHECK((2 == called.size()) && (0 == called[0]) && (2 == called[1]), HAILO_INTERNAL_FAILURE,
+        "Wrong callbacks were called after a cancel");
+
+    // Canceling the first callback calls the done callbacks after it
+    auto first = queue.wrap_callback([&called](hailo_status) { called.push_back(3); });
+    CHECK_EXPECTED_AS_STATUS(first);
+    auto second = queue.wrap_callback([&called](hailo_status) { called.push_back(4); });
+    CHECK_EXPECTED_AS_STATUS(second);
+    second->callback(HAILO_SUCCESS);
+    queue.cancel_callback(first->index);
+    CHECK((3 == called.size()) && (4 == called[2]), HAILO_INTERNAL_FAILURE,
+        "The callback after the canceled one wasn't called");
+    return HAILO_SUCCESS;
+}
+
+// A lost callback leaves the queue full forever, so the wait is bounded.
+static Expected<CallbackReorderQueue::WrappedCallback> wrap_when_not_full(CallbackReorderQueue &queue,
+    InternalTransferDoneCallback &&original)
+{
+    const auto deadline = std::chrono::steady_clock::now() + STRESS_QUEUE_FULL_TIMEOUT;
+    while (std::chrono::steady_clock::now() < deadline) {
+        // original is kept when the queue is full
+        auto callback = queue.wrap_callback(std::move(original));
+        if (HAILO_QUEUE_IS_FULL != callback.status()) {
+            return callback;
+        }
+        std::this_thread::yield();
+    }
+    return make_unexpected(HAILO_TIMEOUT);
+}
+
+// Several producers wrap callbacks concurrently (retrying while the queue is full), and several completers complete
+// them in a random order. Each original callback records its producer and the index it was wrapped with, and the
+// callbacks must be called one at a time, exactly once, in the wrap order.
+static hailo_status run_concurrent_stress(bool cancel_callbacks)
+{
+    struct CalledCallback {
+        size_t producer;
+        size_t sequence;
+    };
+
+    CallbackReorderQueue queue(TEST_QUEUE_SIZE);
+    std::vector<std::vector<uint64_t>> wrapped_indices(STRESS_PRODUCERS_COUNT,
+        std::vector<uint64_t>(STRESS_CALLBACKS_PER_PRODUCER, UINT64_MAX));
+    std::mutex called_mutex;
+    std::vector<CalledCallback> called;
+    called.reserve(STRESS_PRODUCERS_COUNT * STRESS_CALLBACKS_PER_PRODUCER);
+    std::atomic_size_t callbacks_in_progress(0);
+    std::atomic_bool concurrent_callbacks(false);
+
+    std::mutex pending_mutex;
+    std::vector<InternalTransferDoneCallback> pending;
+    std::atomic_size_t producers_done(0);
+    std::atomic_size_t canceled_count(0);
+    std::atomic<hailo_status> producers_status(HAILO_SUCCESS);
+
+    std::vector<std::thread> threads;
+    for (size_t producer = 0; producer < STRESS_PRODUCERS_COUNT; producer++) {
+        threads.emplace_back([&, producer]() {
+            for (size_t sequence = 0; sequence < STRESS_CALLBACKS_PER_PRODUCER; sequence++) {
+                InternalTransferDoneCallback original = [&, producer, sequence](hailo_status) {
+                    if (1 != ++callbacks_in_progress) {
+                        concurrent_callbacks = true;
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(called_mutex);
+                        called.push_back({producer, sequence});
+                    }
+                    callbacks_in_progress--;
+                };
+
+                auto callback = wrap_when_not_full(queue, std::move(original));
+                if (!callback) {
+                    LOGGER__ERROR("wrap_callback failed with {}", callback.status());
+                    producers_status = callback.status();
+                    break;
+                }
+                wrapped_indices[producer][sequence] = callback->index;
+
+                if (cancel_callbacks && (0 == (sequence % CANCEL_INTERVAL))) {
+                    queue.cancel_callback(callback->index);
+                    canceled_count++;
+                    continue;
+                }
+
+                std::lock_guard<std::mutex> lock(pending_mutex);
+                pending.emplace_back(callback.release().callback);
+            }
+            producers_done++;
+        });
+    }
+
+    for (size_t completer = 0; completer < STRESS_COMPLETERS_COUNT; completer++) {
+        threads.emplace_back([&, completer]() {
+            std::mt19937 random_engine(static_cast<uint32_t>(completer));
+            while (true) {
+                InternalTransferDoneCallback callback;
+                {
+                    std::lock_guard<std::mutex> lock(pending_mutex);
+                    if (pending.empty()) {
+                        if (STRESS_PRODUCERS_COUNT == producers_done) {
+                            return;
+                        }
+                    } else {
+                        const auto index = random_engine() % pending.size();
+                        std::swap(pending[index], pending.back());
+                        callback = std::move(pending.back());
+                        pending.pop_back();
+                    }
+                }
+
+                if (callback) {
+                    callback(HAILO_SUCCESS);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    CHECK_SUCCESS(producers_status.load());
+    CHECK(!concurrent_callbacks, HAILO_INTERNAL_FAILURE, "Callbacks were called concurrently");
+    const size_t expected_count = (STRESS_PRODUCERS_COUNT * STRESS_CALLBACKS_PER_PRODUCER) - canceled_count;
+    CHECK(called.size() == expected_count, HAILO_INTERNAL_FAILURE, "{} callbacks were called, expected {}",
+        called.size(), expected_count);
+
+    uint64_t last_index = 0;
+    for (size_t i = 0; i < called.size(); i++) {
+        const auto index = wrapped_indices[called[i].producer][called[i].sequence];
+        CHECK((UINT64_MAX != index) && ((0 == i) || (index > last_index)), HAILO_INTERNAL_FAILURE,
+            "Callback {} of producer {} (index {}) was called out of order", called[i].sequence, called[i].producer,
+            index);
+        last_index = index;
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_concurrent_wrap()
+{
+    return run_concurrent_stress(false);
+}
+
+static hailo_status test_concurrent_wrap_and_cancel()
+{
+    return run_concurrent_stress(true);
+}
+
+void add_callback_reorder_queue_tests(std::vector<SoftwareTest> &tests)
+{
+    tests.push_back({"callback_reorder_queue.reverse_completion_order", test_reverse_completion_order});
+    tests.push_back({"callback_reorder_queue.status_passed_to_original", test_status_passed_to_original});
+    tests.push_back({"callback_reorder_queue.queue_full", test_queue_full});
+    tests.push_back({"callback_reorder_queue.cancel", test_cancel});
+    tests.push_back({"callback_reorder_queue.concurrent_wrap", test_concurrent_wrap});
+    tests.push_back({"callback_reorder_queue.concurrent_wrap_and_cancel", test_concurrent_wrap_and_cancel});
+}
+
+} /* namespace hailort */
@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file core_op_switch_benchmark.cpp
+ * @brief Measures the host side latency of switching between core-ops, when the interrupts dispatcher is stopped and
+ *        started again on each switch, and when it keeps running (InterruptsDispatcher::switch_context, used when
+ *        HAILO_VDMA_FAST_CORE_OP_SWITCH is set).
+ *        Each core-op is emulated by a group of loopback streams, and the switch follows
+ *        VdmaConfigManager::switch_core_op - the streams of the current core-op are deactivated, the streams of the
+ *        next core-op are activated, and the dispatcher is moved to the next core-op's channels.
+ **/
+
+#include "software_benchmarks.hpp"
+#include "loopback_stream.hpp"
+
+#include "vdma/channel/interrupts_dispatcher.hpp"
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+
+namespace hailort
+{
+
+static constexpr size_t DEFAULT_SWITCHES_COUNT = 1000;
+static constexpr size_t DEFAULT_FRAMES_PER_SWITCH = 4;
+static constexpr size_t CORE_OPS_COUNT = 2;
+static constexpr size_t STREAMS_PER_CORE_OP = 2;
+static constexpr size_t FRAME_SIZE = 64 * 1024;
+static constexpr size_t ONGOING_FRAMES = 4;
+static constexpr auto DEVICE_LATENCY = std::chrono::microseconds(100);
+
+using CoreOpStreams = std::vector<std::unique_ptr<LoopbackStream>>;
+
+static ChannelsBitmap get_channels_bitmap(const CoreOpStreams &streams)
+{
+    ChannelsBitmap bitmap{};
+    for (const auto &stream : streams) {
+        bitmap[0] |= stream->channels_bitmap()[0];
+    }
+    return bitmap;
+}
+
+static vdma::InterruptsDispatcher::ProcessIrqCallback get_process_irq(CoreOpStreams &streams)
+{
+    return [&streams](IrqData &&irq_data) {
+        for (uint8_t i = 0; i < irq_data.channels_count; i++) {
+            const auto &channel_irq_data = irq_data.channels_irq_data[i];
+            for (auto &stream : streams) {
+                if (!stream->has_channel(channel_irq_data.channel_id)) {
+                    continue;
+                }
+                auto status = stream->trigger_channel_completion(channel_irq_data);
+                if (HAILO_SUCCESS != status) {
+                    LOGGER__ERROR("Trigger channel completion failed with status {}", status);
+                }
+            }
+        }
+    };
+}
+
+static hailo_status run_core_op_frames(CoreOpStreams &streams, size_t frames_count)
+{
+    std::atomic<hailo_status> run_status(HAILO_SUCCESS);
+    std::vector<std::thread> threads;
+    for (auto &stream : streams) {
+        threads.emplace_back([&stream, &run_status, frames_count]() {
+            auto status = stream->run_frames(frames_count);
+            if (HAILO_SUCCESS != status) {
+                run_status = status;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return run_status.load();
+}
+
+static hailo_status switch_core_op(vdma::InterruptsDispatcher &dispatcher, CoreOpStreams &current,
+    CoreOpStreams &next, bool keep_interrupts_dispatcher)
+{
+    for (auto &stream : current) {
+        auto status = stream->deactivate();
+        CHECK_SUCCESS(status);
+    }
+    if (!keep_interrupts_dispatcher) {
+        auto status = dispatcher.stop();
+        CHECK_SUCCESS(status);
+    }
+
+    for (auto &stream : next) {
+        auto status = stream->activate();
+        CHECK_SUCCESS(status);
+    }
+    return keep_interrupts_dispatcher ?
+        dispatcher.switch_context(get_channels_bitmap(next), false, get_process_irq(next)) :
+        dispatcher.start(get_channels_bitmap(next), false, get_process_irq(next));
+}
+
+struct SwitchBenchmarkResults {
+    std::chrono::duration<double, std::micro> switch_latency;
+    double fps;
+};
+
+static Expected<SwitchBenchmarkResults> run_switches(size_t switches_count, size_t frames_per_switch,
+    bool keep_interrupts_dispatcher)
+{
+    SoftwareDriver::Params driver_params = SoftwareDriver::default_params();
+    driver_params.frame_latency = DEVICE_LATENCY;
+    auto driver = SoftwareDriver::create(driver_params);
+    CHECK_EXPECTED(driver);
+
+    const LoopbackStream::Params stream_params{FRAME_SIZE, ONGOING_FRAMES, ONGOING_FRAMES, false,
+        std::chrono::microseconds(0)};
+    std::vector<CoreOpStreams> core_ops(CORE_OPS_COUNT);
+    uint8_t stream_index = 0;
+    for (auto &core_op : core_ops) {
+        for (size_t i = 0; i < STREAMS_PER_CORE_OP; i++) {
+            auto stream = LoopbackStream::create(*driver.value(), stream_index++, stream_params);
+            CHECK_EXPECTED(stream);
+            core_op.emplace_back(stream.release());
+        }
+    }
+
+    auto dispatcher = vdma::InterruptsDispatcher::create(std::ref(*driver.value()));
+    CHECK_EXPECTED(dispatcher);
+
+    for (auto &stream : core_ops[0]) {
+        auto status = stream->activate();
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    }
+    auto status = dispatcher.value()->start(get_channels_bitmap(core_ops[0]), false, get_process_irq(core_ops[0]));
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    // The first switch to each core-op adds its channels to the waited channels (so the dispatcher is restarted even
+    // when it is kept running), so it isn't measured.
+    size_t current_index = 0;
+    for (size_t i = 0; i < CORE_OPS_COUNT; i++) {
+        const size_t next_index = (current_index + 1) % CORE_OPS_COUNT;
+        status = switch_core_op(*dispatcher.value(), core_ops[current_index], core_ops[next_index],
+            keep_interrupts_dispatcher);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+        current_index = next_index;
+    }
+
+    std::chrono::duration<double, std::micro> total_switch_time(0);
+    const auto start_time = LoopbackStream::Clock::now();
+    for (size_t i = 0; i < switches_count; i++) {
+        status = run_core_op_frames(core_ops[current_index], frames_per_switch);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+
+        const size_t next_index = (current_index + 1) % CORE_OPS_COUNT;
+        const auto switch_start_time = LoopbackStream::Clock::now();
+        status = switch_core_op(*dispatcher.value(), core_ops[current_index], core_ops[next_index],
+            keep_interrupts_dispatcher);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+        total_switch_time += LoopbackStream::Clock::now() - switch_start_time;
+        current_index = next_index;
+    }
+    const auto elapsed = std::chrono::duration<double>(LoopbackStream::Clock::now() - start_time);
+
+    status = dispatcher.value()->stop();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+    for (auto &stream : core_ops[current_index]) {
+        status = stream->deactivate();
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    }
+
+    SwitchBenchmarkResults results{};
+    results.switch_latency = total_switch_time / static_cast<double>(switches_count);
+    results.fps = static_cast<double>(switches_count * frames_per_switch * STREAMS_PER_CORE_OP) / elapsed.count();
+    return results;
+}
+
+hailo_status run_core_op_switch_benchmark(const std::vector<std::string> &args)
+{
+    const size_t switches_count = (args.size() > 0) ? std::stoul(args[0]) : DEFAULT_SWITCHES_COUNT;
+    const size_t frames_per_switch = (args.size() > 1) ? std::stoul(args[1]) : DEFAULT_FRAMES_PER_SWITCH;
+    CHECK(switches_count > 0, HAILO_INVALID_ARGUMENT, "At least one switch is needed");
+
+    std::cout << CORE_OPS_COUNT << " core-ops with " << STREAMS_PER_CORE_OP << " streams each, " << switches_count <<
+        " switches, " << frames_per_switch << " frames per stream between switches" << std::endl;
+    std::cout << std::setw(22) << "interrupts dispatcher" << std::setw(18) << "switch latency" << std::setw(12) <<
+        "FPS" << std::endl;
+
+    for (const bool keep_interrupts_dispatcher : {false, true}) {
+        auto results = run_switches(switches_count, frames_per_switch, keep_interrupts_dispatcher);
+        CHECK_EXPECTED_AS_STATUS(results);
+
+        std::cout << std::setw(22) << (keep_interrupts_dispatcher ? "kept running" : "stop/start") << std::fixed <<
+            std::setprecision(1) << std::setw(16) << results->switch_latency.count() << "us" << std::setw(12) <<
+            results->fps << std::endl;
+    }
+
+    return HAILO_SUCCESS;
+}
+
+} /* namespace hailort */
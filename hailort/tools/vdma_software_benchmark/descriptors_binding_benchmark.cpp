@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file descriptors_binding_benchmark.cpp
+ * @brief Compares binding the descriptors list to the buffer of each transfer, with binding a ring of buffers to the
+ *        descriptors list once (BoundaryChannel::bind_buffers_ring).
+ *        The descriptors binds (an ioctl each on a device) and the host cpu time per frame are reported for:
+ *          - A buffers pool that doesn't return to the same descriptors - each transfer binds its buffer.
+ *          - A buffers ring that returns to the same descriptors - bound by the first transfers, and reused after.
+ *          - The same ring, bound before streaming.
+ **/
+
+#include "software_benchmarks.hpp"
+#include "vdma_benchmark.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+
+namespace hailort
+{
+
+static constexpr size_t DEFAULT_FRAMES_COUNT = 20000;
+static constexpr size_t DEFAULT_FRAME_SIZE = 64 * 1024;
+static constexpr size_t ONGOING_FRAMES = 4;
+static constexpr auto DEVICE_LATENCY = std::chrono::microseconds(0);
+
+struct BindingCase {
+    const char *name;
+    size_t buffers_count;
+    bool bind_buffers_ring;
+};
+
+hailo_status run_descriptors_binding_benchmark(const std::vector<std::string> &args)
+{
+    const size_t frames_count = (args.size() > 0) ? std::stoul(args[0]) : DEFAULT_FRAMES_COUNT;
+    const size_t frame_size = (args.size() > 1) ? std::stoul(args[1]) : DEFAULT_FRAME_SIZE;
+    CHECK(frames_count > 0, HAILO_INVALID_ARGUMENT, "At least one frame is needed");
+    CHECK(is_powerof2(frame_size), HAILO_INVALID_ARGUMENT, "Frame size {} must be a power of 2", frame_size);
+
+    // With a power of 2 frame size, the descriptors list of each channel fits a power of 2 frames (more than
+    // ONGOING_FRAMES), so a ring of ONGOING_FRAMES buffers always returns to the same descriptors, and a pool of
+    // (ONGOING_FRAMES + 1) buffers doesn't.
+    const std::vector<BindingCase> binding_cases = {
+        {"bind per transfer (pool)", ONGOING_FRAMES + 1, false},
+        {"bind per transfer (ring)", ONGOING_FRAMES, false},
+        {"pre-bound ring", ONGOING_FRAMES, true},
+    };
+
+    std::cout << frames_count << " frames of " << frame_size << " bytes, " << ONGOING_FRAMES << " ongoing frames" <<
+        std::endl;
+    std::cout << std::setw(26) << "binding" << std::setw(18) << "binds per frame" << std::setw(20) <<
+        "cpu time per frame" << std::setw(12) << "FPS" << std::endl;
+
+    for (const auto &binding_case : binding_cases) {
+        VdmaBenchmarkParams params{};
+        params.frames_count = frames_count;
+        params.device_latency = DEVICE_LATENCY;
+        params.streams_count = 1;
+        params.stream_params = {frame_size, ONGOING_FRAMES, binding_case.buffers_count,
+            binding_case.bind_buffers_ring, std::chrono::microseconds(0)};
+        params.first_stream_callback_load = std::chrono::microseconds(0);
+        params.dispatcher_params = vdma::InterruptsDispatcher::get_default_params();
+
+        auto benchmark = VdmaBenchmark::create(params);
+        CHECK_EXPECTED_AS_STATUS(benchmark);
+        auto results = benchmark.value()->run();
+        CHECK_EXPECTED_AS_STATUS(results);
+
+        const auto binds_per_frame = static_cast<double>(results->driver_operations.descs_binds) /
+            static_cast<double>(frames_count);
+        std::cout << std::setw(26) << binding_case.name << std::fixed << std::setprecision(3) << std::setw(18) <<
+            binds_per_frame << std::setprecision(1) << std::setw(18) << results->cpu_time_per_frame_us << "us" <<
+            std::setw(12) << results->fps << std::endl;
+    }
+
+    return HAILO_SUCCESS;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file dma_mapping_cache_tests.cpp
+ * @brief Tests of vdma::DmaMappingCache - the buffers are mapped by the software device, and the tests count the
+ *        mappings that were created and check which of them are still alive.
+ **/
+
+#include "software_tests.hpp"
+
+#include "hailo/buffer.hpp"
+
+#include "os/software_driver.hpp"
+#include "vdma/memory/dma_mapping_cache.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <memory>
+
+
+namespace hailort
+{
+
+static constexpr size_t TEST_BUFFER_SIZE = 0x1000;
+static constexpr size_t TEST_BUFFERS_COUNT = 4;
+static constexpr auto H2D = HailoRTDriver::DmaDirection::H2D;
+static constexpr auto D2H = HailoRTDriver::DmaDirection::D2H;
+
+// A cache of TEST_BUFFERS_COUNT - 1 buffers (so mapping all of the test buffers evicts one), that counts the
+// mappings it creates.
+class DmaMappingCacheTest final
+{
+public:
+    static Expected<std::unique_ptr<DmaMappingCacheTest>> create(size_t max_mapped_bytes =
+        (TEST_BUFFERS_COUNT - 1) * TEST_BUFFER_SIZE)
+    {
+        auto driver = SoftwareDriver::create();
+        CHECK_EXPECTED(driver);
+
+        // Mapped user buffers must be page aligned
+        auto memory = Buffer::create_shared(TEST_BUFFERS_COUNT * TEST_BUFFER_SIZE, BufferStorageParams::create_dma());
+        CHECK_EXPECTED(memory);
+
+        auto test = make_unique_nothrow<DmaMappingCacheTest>(driver.release(), memory.release(), max_mapped_bytes);
+        CHECK_NOT_NULL_AS_EXPECTED(test, HAILO_OUT_OF_HOST_MEMORY);
+        return test;
+    }
+
+    DmaMappingCacheTest(std::unique_ptr<SoftwareDriver> &&driver, BufferPtr memory, size_t max_mapped_bytes) :
+        m_driver(std::move(driver)),
+        m_memory(memory),
+        m_maps_count(0),
+        m_cache([this](void *address, size_t size, HailoRTDriver::DmaDirection direction) {
+            m_maps_count++;
+            return vdma::MappedBuffer::create_shared(*m_driver, direction, size, address);
+        }, max_mapped_bytes)
+    {}
+
+    void *buffer(size_t index) { return m_memory->data() + (index * TEST_BUFFER_SIZE); }
+    size_t maps_count() const { return m_maps_count; }
+    vdma::DmaMappingCache &cache() { return m_cache; }
+
+    Expected<vdma::MappedBufferPtr> map(size_t index, HailoRTDriver::DmaDirection direction = H2D)
+    {
+        return m_cache.get_or_map(buffer(index), TEST_BUFFER_SIZE, direction);
+    }
+
+private:
+    std::unique_ptr<SoftwareDriver> m_driver;
+    BufferPtr m_memory;
+    size_t m_maps_count;
+    vdma::DmaMappingCache m_cache;
+};
+
+static hailo_status test_cache_hit()
+{
+    auto test = DmaMappingCacheTest::create();
+    CHECK_EXPECTED_AS_STATUS(test);
+
+    auto first = test.value()->map(0);
+    CHECK_EXPECTED_AS_STATUS(first);
+    auto second = test.value()->map(0);
+    CHECK_EXPECTED_AS_STATUS(second);
+
+    CHECK(first.value() == second.value(), HAILO_INTERNAL_FAILURE, "Cached mapping wasn't reused");
+    CHECK(1 == test.value()->maps_count(), HAILO_INTERNAL_FAILURE, "Expected a single mapping, got {}",
+        test.value()->maps_count());
+    CHECK(TEST_BUFFER_SIZE == test.value()->cache().mapped_bytes(), HAILO_INTERNAL_FAILURE);
+
+    // The mapping stays cached after its users release it
+    std::weak_ptr<vdma::MappedBuffer> weak_mapping = first.value();
+    first.release().reset();
+    second.release().reset();
+    CHECK(!weak_mapping.expired(), HAILO_INTERNAL_FAILURE, "Cached mapping was released");
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_cache_miss()
+{
+    auto test = DmaMappingCacheTest::create();
+    CHECK_EXPECTED_AS_STATUS(test);
+
+    auto h2d_mapping = test.value()->map(0, H2D);
+    CHECK_EXPECTED_AS_STATUS(h2d_mapping);
+
+    // Another address, another direction and another size of the same address are all different mappings
+    auto other_address = test.value()->map(1, H2D);
+    CHECK_EXPECTED_AS_STATUS(other_address);
+    auto other_direction = test.value()->map(0, D2H);
+    CHECK_EXPECTED_AS_STATUS(other_direction);
+    auto other_size = test.value()->cache().get_or_map(test.value()->buffer(0), TEST_BUFFER_SIZE / 2, H2D);
+    CHECK_EXPECTED_AS_STATUS(other_size);
+
+    CHECK(4 == test.value()->maps_count(), HAILO_INTERNAL_FAILURE, "Expected 4 mappings, got {}",
+        test.value()->maps_count());
+    CHECK((h2d_mapping.value() != other_address.value()) && (h2d_mapping.value() != other_direction.value()) &&
+        (h2d_mapping.value() != other_size.value()), HAILO_INTERNAL_FAILURE, "Different buffers share a mapping");
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_lru_eviction()
+{
+    auto test = DmaMappingCacheTest::create();
+    CHECK_EXPECTED_AS_STATUS(test);
+
+    std::weak_ptr<vdma::MappedBuffer> weak_mappings[TEST_BUFFERS_COUNT];
+    for (size_t i = 0; i < (TEST_BUFFERS_COUNT - 1); i++) {
+        auto mapping = test.value()->map(i);
+        CHECK_EXPECTED_AS_STATUS(mapping);
+        weak_mappings[i] = mapping.value();
+    }
+
+    // Buffer 0 becomes the most recently used, so buffer 1 is evicted when the last buffer is mapped
+    auto mapping = test.value()->map(0);
+    CHECK_EXPECTED_AS_STATUS(mapping);
+    auto last_mapping = test.value()->map(TEST_BUFFERS_COUNT - 1);
+    CHECK_EXPECTED_AS_STATUS(last_mapping);
+
+    CHECK(weak_mappings[1].expired(), HAILO_INTERNAL_FAILURE, "Least recently used mapping wasn't evicted");
+    CHECK(!weak_mappings[0].expired() && !weak_mappings[2].expired(), HAILO_INTERNAL_FAILURE,
+        "Recently used mapping was evicted");
+    CHECK(((TEST_BUFFERS_COUNT - 1) * TEST_BUFFER_SIZE) == test.value()->cache().mapped_bytes(),
+        HAILO_INTERNAL_FAILURE, "Unexpected mapped bytes {}", test.value()->cache().mapped_bytes());
+
+    // The evicted buffer is mapped again
+    const auto maps_count = test.value()->maps_count();
+    auto evicted_mapping = test.value()->map(1);
+    CHECK_EXPECTED_AS_STATUS(evicted_mapping);
+    CHECK((maps_count + 1) == test.value()->maps_count(), HAILO_INTERNAL_FAILURE, "Evicted buffer wasn't mapped");
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_eviction_of_used_mapping()
+{
+    auto test = DmaMappingCacheTest::create(TEST_BUFFER_SIZE);
+    CHECK_EXPECTED_AS_STATUS(test);
+
+    // An ongoing transfer holds the mapping - it is evicted from the cache, but stays mapped until released
+    auto used_mapping = test.value()->map(0);
+    CHECK_EXPECTED_AS_STATUS(used_mapping);
+    auto mapping = test.value()->map(1);
+    CHECK_EXPECTED_AS_STATUS(mapping);
+
+    std::weak_ptr<vdma::MappedBuffer> weak_mapping = used_mapping.value();
+    CHECK(TEST_BUFFER_SIZE == test.value()->cache().mapped_bytes(), HAILO_INTERNAL_FAILURE);
+    CHECK(!weak_mapping.expired(), HAILO_INTERNAL_FAILURE, "Used mapping was released");
+    used_mapping.release().reset();
+    CHECK(weak_mapping.expired(), HAILO_INTERNAL_FAILURE, "Evicted mapping wasn't released");
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_oversized_buffer_not_cached()
+{
+    auto test = DmaMappingCacheTest::create(TEST_BUFFER_SIZE);
+    CHECK_EXPECTED_AS_STATUS(test);
+
+    auto mapping = test.value()->cache().get_or_map(test.value()->buffer(0), 2 * TEST_BUFFER_SIZE, H2D);
+    CHECK_EXPECTED_AS_STATUS(mapping);
+    std::weak_ptr<vdma::MappedBuffer> weak_mapping = mapping.value();
+    mapping.release().reset();
+
+    CHECK(weak_mapping.expired(), HAILO_INTERNAL_FAILURE, "Buffer larger than the cache was cached");
+    CHECK(0 == test.value()->cache().mapped_bytes(), HAILO_INTERNAL_FAILURE);
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_invalidate()
+{
+    auto test = DmaMappingCacheTest::create();
+    CHECK_EXPECTED_AS_STATUS(test);
+
+    std::weak_ptr<vdma::MappedBuffer> weak_mappings[TEST_BUFFERS_COUNT - 1];
+    for (size_t i = 0; i < (TEST_BUFFERS_COUNT - 1); i++) {
+        auto mapping = test.value()->map(i, (0 == (i % 2)) ? H2D : D2H);
+        CHECK_EXPECTED_AS_STATUS(mapping);
+        weak_mappings[i] = mapping.value();
+    }
+
+    // A range overlapping the end of buffer 0 and the start of buffer 1 (of both directions) invalidates both
+    auto range_start = static_cast<uint8_t*>(test.value()->buffer(0)) + (TEST_BUFFER_SIZE - 1);
+    test.value()->cache().invalidate(range_start, 2);
+    CHECK(weak_mappings[0].expired() && weak_mappings[1].expired(), HAILO_INTERNAL_FAILURE,
+        "Overlapping mappings weren't invalidated");
+    CHECK(!weak_mappings[2].expired(), HAILO_INTERNAL_FAILURE, "Non overlapping mapping was invalidated");
+    CHECK(TEST_BUFFER_SIZE == test.value()->cache().mapped_bytes(), HAILO_INTERNAL_FAILURE);
+
+    // The invalidated buffer is mapped again on its next use
+    const auto maps_count = test.value()->maps_count();
+    auto mapping = test.value()->map(0);
+    CHECK_EXPECTED_AS_STATUS(mapping);
+    CHECK((maps_count + 1) == test.value()->maps_count(), HAILO_INTERNAL_FAILURE,
+        "Invalidated buffer wasn't mapped again");
+
+    test.value()->cache().clear();
+    CHECK(0 == test.value()->cache().mapped_bytes(), HAILO_INTERNAL_FAILURE);
+    CHECK(weak_mappings[2].expired(), HAILO_INTERNAL_FAILURE, "Mapping wasn't released on clear");
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_invalidate_all()
+{
+    auto first_test = DmaMappingCacheTest::create();
+    CHECK_EXPECTED_AS_STATUS(first_test);
+    auto second_test = DmaMappingCacheTest::create();
+    CHECK_EXPECTED_AS_STATUS(second_test);
+
+    auto first_mapping = first_test.value()->map(0);
+    CHECK_EXPECTED_AS_STATUS(first_mapping);
+    auto second_mapping = second_test.value()->map(0);
+    CHECK_EXPECTED_AS_STATUS(second_mapping);
+    std::weak_ptr<vdma::MappedBuffer> weak_first_mapping = first_mapping.release();
+    std::weak_ptr<vdma::MappedBuffer> weak_second_mapping = second_mapping.release();
+
+    // Like hailo_free_buffer - the buffer is invalidated in every cache that mapped it
+    vdma::DmaMappingCache::invalidate_all(first_test.value()->buffer(0), TEST_BUFFER_SIZE);
+    CHECK(weak_first_mapping.expired(), HAILO_INTERNAL_FAILURE, "Mapping wasn't invalidated");
+    CHECK(!weak_second_mapping.expired(), HAILO_INTERNAL_FAILURE, "Mapping of another buffer was invalidated");
+
+    vdma::DmaMappingCache::invalidate_all(second_test.value()->buffer(0), TEST_BUFFER_SIZE);
+    CHECK(weak_second_mapping.expired(), HAILO_INTERNAL_FAILURE, "Mapping of the second cache wasn't invalidated");
+    return HAILO_SUCCESS;
+}
+
+void add_dma_mapping_cache_tests(std::vector<SoftwareTest> &tests)
+{
+    tests.push_back({"dma_mapping_cache.hit", test_cache_hit});
+    tests.push_back({"dma_mapping_cache.miss", test_cache_miss});
+    tests.push_back({"dma_mapping_cache.lru_eviction", test_lru_eviction});
+    tests.push_back({"dma_mapping_cache.eviction_of_used_mapping", test_eviction_of_used_mapping});
+    tests.push_back({"dma_mapping_cache.oversized_buffer_not_cached", test_oversized_buffer_not_cached});
+    tests.push_back({"dma_mapping_cache.invalidate", test_invalidate});
+    tests.push_back({"dma_mapping_cache.invalidate_all", test_invalidate_all});
+}
+
+} /* namespace hailort */
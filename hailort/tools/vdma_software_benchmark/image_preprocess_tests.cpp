@@ -0,0 +1,339 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file image_preprocess_tests.cpp
+ * @brief Tests of ImagePreprocessContext - the host image pre-process of inputs (crop, resize, letterbox and color
+ *        conversion into the device's input layout).
+ **/
+
+#include "software_tests.hpp"
+
+#include "transform/image_preprocess.hpp"
+
+#include "hailo/hailort_common.hpp"
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <vector>
+
+
+namespace hailort
+{
+
+static constexpr uint8_t PAD_VALUE = 114;
+static const hailo_format_t NHWC_FORMAT = {HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHWC, HAILO_FORMAT_FLAGS_QUANTIZED};
+
+static hailo_image_preprocess_params_t image_params(hailo_image_color_format_t color_format, uint32_t width,
+    uint32_t height, hailo_image_interpolation_t interpolation = HAILO_IMAGE_INTERPOLATION_BILINEAR)
+{
+    hailo_image_preprocess_params_t params{};
+    params.color_format = color_format;
+    params.width = width;
+    params.height = height;
+    params.resize_mode = HAILO_IMAGE_RESIZE_MODE_STRETCH;
+    params.interpolation = interpolation;
+    params.pad_value = PAD_VALUE;
+    return params;
+}
+
+// Packed RGB image whose pixels (and channels) all differ
+static std::vector<uint8_t> rgb_image(uint32_t width, uint32_t height, uint32_t row_stride = 0)
+{
+    row_stride = (0 == row_stride) ? (width * 3) : row_stride;
+    std::vector<uint8_t> image(static_cast<size_t>(row_stride) * height, 0);
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < (width * 3); x++) {
+            image[(y * row_stride) + x] = static_cast<uint8_t>((y * 37) + (x * 11) + 5);
+        }
+    }
+    return image;
+}
+
+static Expected<std::vector<uint8_t>> preprocess(const hailo_image_preprocess_params_t &params,
+    const std::vector<uint8_t> &src, const hailo_3d_image_shape_t &dst_shape,
+    const hailo_3d_image_shape_t &dst_padded_shape, const hailo_format_t &dst_format = NHWC_FORMAT)
+{
+    auto context = ImagePreprocessContext::create(params, dst_shape, dst_padded_shape, dst_format);
+    CHECK_EXPECTED(context);
+    CHECK_AS_EXPECTED(src.size() == context.value()->get_src_frame_size(), HAILO_INTERNAL_FAILURE,
+        "Source frame size {} != image size {}", context.value()->get_src_frame_size(), src.size());
+
+    // Filled with garbage, so pixels that aren't written are detected
+    std::vector<uint8_t> dst(context.value()->get_dst_frame_size(), 0xA5);
+    auto status = context.value()->process(MemoryView::create_const(src.data(), src.size()),
+        MemoryView(dst.data(), dst.size()));
+    CHECK_SUCCESS_AS_EXPECTED(status);
+    return dst;
+}
+
+static Expected<std::vector<uint8_t>> preprocess(const hailo_image_preprocess_params_t &params,
+    const std::vector<uint8_t> &src, const hailo_3d_image_shape_t &dst_shape)
+{
+    return preprocess(params, src, dst_shape, dst_shape);
+}
+
+// Same as the kernel - BT.601 limited range
+static std::array<uint8_t, 3> yuv_to_rgb(uint8_t y, uint8_t u, uint8_t v)
+{
+    const int32_t c = 298 * (static_cast<int32_t>(y) - 16);
+    const int32_t d = static_cast<int32_t>(u) - 128;
+    const int32_t e = static_cast<int32_t>(v) - 128;
+    auto clamp = [](int32_t value) { return static_cast<uint8_t>(std::min(std::max(value, 0), 255)); };
+    return {{clamp((c + (409 * e) + 128) >> 8), clamp((c - (100 * d) - (208 * e) + 128) >> 8),
+        clamp((c + (516 * d) + 128) >> 8)}};
+}
+
+static hailo_status test_rgb_copy()
+{
+    // Without scaling, bilinear interpolation is an exact copy
+    const auto src = rgb_image(8, 4);
+    auto dst = preprocess(image_params(HAILO_IMAGE_COLOR_FORMAT_RGB, 8, 4), src, {4, 8, 3});
+    CHECK_EXPECTED_AS_STATUS(dst);
+    CHECK(src == dst.value(), HAILO_INTERNAL_FAILURE, "RGB image wasn't copied as is");
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_bgr_to_rgb()
+{
+    const auto src = rgb_image(8, 4);
+    auto dst = preprocess(image_params(HAILO_IMAGE_COLOR_FORMAT_BGR, 8, 4), src, {4, 8, 3});
+    CHECK_EXPECTED_AS_STATUS(dst);
+    for (size_t pixel = 0; pixel < (8 * 4); pixel++) {
+        for (size_t channel = 0; channel < 3; channel++) {
+            CHECK(src[(pixel * 3) + channel] == dst.value()[(pixel * 3) + (2 - channel)], HAILO_INTERNAL_FAILURE,
+                "Wrong channel {} of pixel {}", channel, pixel);
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_row_stride()
+{
+    const auto packed_src = rgb_image(6, 4);
+    const auto strided_src = rgb_image(6, 4, 32);
+    auto params = image_params(HAILO_IMAGE_COLOR_FORMAT_RGB, 6, 4);
+    auto packed_dst = preprocess(params, packed_src, {4, 6, 3});
+    CHECK_EXPECTED_AS_STATUS(packed_dst);
+    params.row_stride = 32;
+    auto strided_dst = preprocess(params, strided_src, {4, 6, 3});
+    CHECK_EXPECTED_AS_STATUS(strided_dst);
+    CHECK(packed_dst.value() == strided_dst.value(), HAILO_INTERNAL_FAILURE, "Row padding was read as pixels");
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_nearest_downscale()
+{
+    // Pixel centers are aligned, so destination pixel i samples source pixel (2 * i) + 1
+    const auto src = rgb_image(8, 8);
+    auto dst = preprocess(image_params(HAILO_IMAGE_COLOR_FORMAT_RGB, 8, 8, HAILO_IMAGE_INTERPOLATION_NEAREST), src,
+        {4, 4, 3});
+    CHECK_EXPECTED_AS_STATUS(dst);
+    for (size_t y = 0; y < 4; y++) {
+        for (size_t x = 0; x < (4 * 3); x++) {
+            const auto src_x = ((((x / 3) * 2) + 1) * 3) + (x % 3);
+            CHECK(src[(((y * 2) + 1) * 8 * 3) + src_x] == dst.value()[(y * 4 * 3) + x], HAILO_INTERNAL_FAILURE,
+                "Wrong sample at row {} byte {}", y, x);
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_bilinear_downscale()
+{
+    // Downscaling by 2 averages each 2x2 block
+    const auto src = rgb_image(8, 8);
+    auto dst = preprocess(image_params(HAILO_IMAGE_COLOR_FORMAT_RGB, 8, 8), src, {4, 4, 3});
+    CHECK_EXPECTED_AS_STATUS(dst);
+    for (size_t y = 0; y < 4; y++) {
+        for (size_t x = 0; x < (4 * 3); x++) {
+            const auto top_left = ((y * 2) * 8 * 3) + ((x / 3) * 2 * 3) + (x % 3);
+            const uint32_t sum = src[top_left] + src[top_left + 3] + src[top_left + (8 * 3)] +
+                src[top_left + (8 * 3) + 3];
+            CHECK(((sum + 2) / 4) == dst.value()[(y * 4 * 3) + x], HAILO_INTERNAL_FAILURE,
+                "Wrong average at row {} byte {} ({} != {})", y, x, (sum + 2) / 4, dst.value()[(y * 4 * 3) + x]);
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_bilinear_upscale_of_constant_image()
+{
+    const std::vector<uint8_t> src(7 * 5 * 3, 200);
+    auto dst = preprocess(image_params(HAILO_IMAGE_COLOR_FORMAT_RGB, 7, 5), src, {9, 13, 3});
+    CHECK_EXPECTED_AS_STATUS(dst);
+    for (size_t i = 0; i < dst->size(); i++) {
+        CHECK(200 == dst.value()[i], HAILO_INTERNAL_FAILURE, "Interpolation changed a constant image at {}", i);
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_crop()
+{
+    const auto src = rgb_image(8, 4);
+    auto params = image_params(HAILO_IMAGE_COLOR_FORMAT_RGB, 8, 4);
+    params.crop = {2, 1, 4, 2};
+    auto dst = preprocess(params, src, {2, 4, 3});
+    CHECK_EXPECTED_AS_STATUS(dst);
+    for (size_t y = 0; y < 2; y++) {
+        for (size_t x = 0; x < (4 * 3); x++) {
+            CHECK(src[((y + 1) * 8 * 3) + (2 * 3) + x] == dst.value()[(y * 4 * 3) + x], HAILO_INTERNAL_FAILURE,
+                "Wrong cropped pixel at row {} byte {}", y, x);
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_letterbox()
+{
+    // An 8x4 image in an 8x8 frame keeps its size, centered between 2 padding rows at the top and at the bottom
+    const auto src = rgb_image(8, 4);
+    auto params = image_params(HAILO_IMAGE_COLOR_FORMAT_RGB, 8, 4);
+    params.resize_mode = HAILO_IMAGE_RESIZE_MODE_LETTERBOX;
+    auto dst = preprocess(params, src, {8, 8, 3});
+    CHECK_EXPECTED_AS_STATUS(dst);
+
+    const size_t row_size = 8 * 3;
+    for (size_t y = 0; y < 8; y++) {
+        const bool is_content_row = (2 <= y) && (y < 6);
+        for (size_t x = 0; x < row_size; x++) {
+            const auto expected = is_content_row ? src[((y - 2) * row_size) + x] : PAD_VALUE;
+            CHECK(expected == dst.value()[(y * row_size) + x], HAILO_INTERNAL_FAILURE,
+                "Wrong letterboxed pixel at row {} byte {}", y, x);
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_yuv_formats()
+{
+    // A constant color is converted the same from all of the YUV layouts, at any scale
+    const uint8_t Y = 81;
+    const uint8_t U = 90;
+    const uint8_t V = 240;
+    const auto expected = yuv_to_rgb(Y, U, V);
+    const uint32_t width = 6;
+    const uint32_t height = 4;
+
+    std::vector<uint8_t> nv12(width * height, Y);
+    for (uint32_t i = 0; i < ((width / 2) * (height / 2)); i++) {
+        nv12.push_back(U);
+        nv12.push_back(V);
+    }
+    std::vector<uint8_t> i420(width * height, Y);
+    i420.insert(i420.end(), (width / 2) * (height / 2), U);
+    i420.insert(i420.end(), (width / 2) * (height / 2), V);
+    std::vector<uint8_t> yuy2;
+    for (uint32_t i = 0; i < ((width / 2) * height); i++) {
+        yuy2.insert(yuy2.end(), {Y, U, Y, V});
+    }
+
+    const std::vector<std::pair<hailo_image_color_format_t, const std::vector<uint8_t>*>> images = {
+        {HAILO_IMAGE_COLOR_FORMAT_NV12, &nv12}, {HAILO_IMAGE_COLOR_FORMAT_I420, &i420},
+        {HAILO_IMAGE_COLOR_FORMAT_YUY2, &yuy2}};
+    const std::vector<hailo_3d_image_shape_t> dst_shapes = {{height, width, 3}, {3, 5, 3}, {7, 11, 3}};
+    for (const auto &image : images) {
+        for (const auto &dst_shape : dst_shapes) {
+            const auto params = image_params(image.first, width, height);
+            CHECK(image.second->size() == HailoRTCommon::get_image_frame_size(params), HAILO_INTERNAL_FAILURE,
+                "Unexpected frame size of color format {}", static_cast<int>(image.first));
+            auto dst = preprocess(params, *image.second, dst_shape);
+            CHECK_EXPECTED_AS_STATUS(dst);
+            for (size_t i = 0; i < dst->size(); i++) {
+                CHECK(expected[i % 3] == dst.value()[i], HAILO_INTERNAL_FAILURE,
+                    "Wrong conversion of color format {} at {} ({} != {})", static_cast<int>(image.first), i,
+                    expected[i % 3], dst.value()[i]);
+            }
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_padded_layouts()
+{
+    // The device layouts (padded features and width, or planar rows) hold the same pixels as NHWC, and zeros in
+    // the padding
+    const uint32_t width = 6;
+    const uint32_t height = 4;
+    const auto src = rgb_image(width, height);
+    const auto params = image_params(HAILO_IMAGE_COLOR_FORMAT_RGB, width, height);
+    const hailo_3d_image_shape_t dst_shape = {height, width, 3};
+
+    const hailo_3d_image_shape_t fcr_shape = {height, 8, 4};
+    const hailo_format_t fcr_format = {HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_FCR, HAILO_FORMAT_FLAGS_QUANTIZED};
+    auto fcr = preprocess(params, src, dst_shape, fcr_shape, fcr_format);
+    CHECK_EXPECTED_AS_STATUS(fcr);
+
+    const hailo_3d_image_shape_t nhcw_shape = {height, 8, 3};
+    const hailo_format_t nhcw_format = {HAILO_FORMAT_TYPE_UINT8, HAILO_FORMAT_ORDER_NHCW, HAILO_FORMAT_FLAGS_QUANTIZED};
+    auto nhcw = preprocess(params, src, dst_shape, nhcw_shape, nhcw_format);
+    CHECK_EXPECTED_AS_STATUS(nhcw);
+
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < fcr_shape.width; x++) {
+            for (uint32_t c = 0; c < fcr_shape.features; c++) {
+                const bool is_pixel = (x < width) && (c < 3);
+                const uint8_t expected = is_pixel ? src[(((y * width) + x) * 3) + c] : 0;
+                CHECK(expected == fcr.value()[(((y * fcr_shape.width) + x) * fcr_shape.features) + c],
+                    HAILO_INTERNAL_FAILURE, "Wrong FCR byte at ({},{},{})", y, x, c);
+            }
+        }
+        for (uint32_t c = 0; c < 3; c++) {
+            for (uint32_t x = 0; x < nhcw_shape.width; x++) {
+                const uint8_t expected = (x < width) ? src[(((y * width) + x) * 3) + c] : 0;
+                CHECK(expected == nhcw.value()[(((y * 3) + c) * nhcw_shape.width) + x], HAILO_INTERNAL_FAILURE,
+                    "Wrong NHCW byte at ({},{},{})", y, c, x);
+            }
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status test_invalid_params()
+{
+    const hailo_3d_image_shape_t dst_shape = {4, 4, 3};
+    auto params = image_params(HAILO_IMAGE_COLOR_FORMAT_RGB, 8, 4);
+
+    params.crop = {6, 0, 4, 4};
+    auto context = ImagePreprocessContext::create(params, dst_shape, dst_shape, NHWC_FORMAT);
+    CHECK(HAILO_INVALID_ARGUMENT == context.status(), HAILO_INTERNAL_FAILURE, "Crop outside of the image was accepted");
+    params.crop = {};
+
+    params.row_stride = (8 * 3) - 1;
+    auto strided_context = ImagePreprocessContext::create(params, dst_shape, dst_shape, NHWC_FORMAT);
+    CHECK(HAILO_INVALID_ARGUMENT == strided_context.status(), HAILO_INTERNAL_FAILURE,
+        "Row stride shorter than a row was accepted");
+    params.row_stride = 0;
+
+    const hailo_3d_image_shape_t gray_shape = {4, 4, 1};
+    auto gray_context = ImagePreprocessContext::create(params, gray_shape, gray_shape, NHWC_FORMAT);
+    CHECK(HAILO_INVALID_ARGUMENT == gray_context.status(), HAILO_INTERNAL_FAILURE,
+        "Input without 3 features was accepted");
+
+    auto valid_context = ImagePreprocessContext::create(params, dst_shape, dst_shape, NHWC_FORMAT);
+    CHECK_EXPECTED_AS_STATUS(valid_context);
+    std::vector<uint8_t> src(valid_context.value()->get_src_frame_size() - 1);
+    std::vector<uint8_t> dst(valid_context.value()->get_dst_frame_size());
+    auto status = valid_context.value()->process(MemoryView::create_const(src.data(), src.size()),
+        MemoryView(dst.data(), dst.size()));
+    CHECK(HAILO_INVALID_ARGUMENT == status, HAILO_INTERNAL_FAILURE, "Short source buffer was accepted");
+    return HAILO_SUCCESS;
+}
+
+void add_image_preprocess_tests(std::vector<SoftwareTest> &tests)
+{
+    tests.push_back({"image_preprocess.rgb_copy", test_rgb_copy});
+    tests.push_back({"image_preprocess.bgr_to_rgb", test_bgr_to_rgb});
+    tests.push_back({"image_preprocess.row_stride", test_row_stride});
+    tests.push_back({"image_preprocess.nearest_downscale", test_nearest_downscale});
+    tests.push_back({"image_preprocess.bilinear_downscale", test_bilinear_downscale});
+    tests.push_back({"image_preprocess.bilinear_upscale_of_constant_image", test_bilinear_upscale_of_constant_image});
+    tests.push_back({"image_preprocess.crop", test_crop});
+    tests.push_back({"image_preprocess.letterbox", test_letterbox});
+    tests.push_back({"image_preprocess.yuv_formats", test_yuv_formats});
+    tests.push_back({"image_preprocess.padded_layouts", test_padded_layouts});
+    tests.push_back({"image_preprocess.invalid_params", test_invalid_params});
+}
+
+} /* namespace hailort */
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file interrupts_dispatcher_benchmark.cpp
+ * @brief Measures how a slow transfer callback of one stream delays the completions of the other streams, with the
+ *        interrupts dispatcher threads configurations (see vdma::InterruptsDispatcher::Params).
+ **/
+
+#include "software_benchmarks.hpp"
+#include "vdma_benchmark.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+
+namespace hailort
+{
+
+static constexpr size_t DEFAULT_STREAMS_COUNT = 4;
+static constexpr size_t DEFAULT_CALLBACK_LOAD_US = 500;
+static constexpr size_t DEFAULT_FRAMES_COUNT = 5000;
+static constexpr size_t FRAME_SIZE = 64 * 1024;
+static constexpr size_t ONGOING_FRAMES = 4;
+static constexpr auto DEVICE_LATENCY = std::chrono::microseconds(100);
+
+hailo_status run_interrupts_dispatcher_benchmark(const std::vector<std::string> &args)
+{
+    const size_t streams_count = (args.size() > 0) ? std::stoul(args[0]) : DEFAULT_STREAMS_COUNT;
+    const auto callback_load = std::chrono::microseconds((args.size() > 1) ? std::stoul(args[1]) : DEFAULT_CALLBACK_LOAD_US);
+    const size_t frames_count = (args.size() > 2) ? std::stoul(args[2]) : DEFAULT_FRAMES_COUNT;
+    CHECK(streams_count > 1, HAILO_INVALID_ARGUMENT, "At least 2 streams are needed");
+
+    // {wait threads, completion threads} - the default (everything on a single thread), a completion thread pool, and
+    // a wait thread and a completion thread per stream.
+    const std::vector<vdma::InterruptsDispatcher::Params> dispatcher_params_list = {
+        {1, 0},
+        {1, streams_count},
+        {streams_count, streams_count},
+    };
+
+    std::cout << streams_count << " streams, " << callback_load.count() << "us callback load on stream 0, " <<
+        frames_count << " frames per stream" << std::endl;
+    std::cout << std::setw(14) << "wait threads" << std::setw(20) << "completion threads" << std::setw(12) << "FPS" <<
+        std::setw(26) << "loaded stream latency" << std::setw(26) << "other streams latency" << std::endl;
+
+    for (const auto &dispatcher_params : dispatcher_params_list) {
+        VdmaBenchmarkParams params{};
+        params.frames_count = frames_count;
+        params.device_latency = DEVICE_LATENCY;
+        params.streams_count = streams_count;
+        params.stream_params = {FRAME_SIZE, ONGOING_FRAMES, ONGOING_FRAMES, false,
+            std::chrono::microseconds(0)};
+        params.first_stream_callback_load = callback_load;
+        params.dispatcher_params = dispatcher_params;
+
+        auto benchmark = VdmaBenchmark::create(params);
+        CHECK_EXPECTED_AS_STATUS(benchmark);
+        auto results = benchmark.value()->run();
+        CHECK_EXPECTED_AS_STATUS(results);
+
+        std::chrono::duration<double, std::micro> others_latency(0);
+        for (size_t i = 1; i < streams_count; i++) {
+            others_latency += results->streams_latency[i];
+        }
+        others_latency /= static_cast<double>(streams_count - 1);
+
+        std::cout << std::fixed << std::setprecision(1) << std::setw(14) << dispatcher_params.wait_threads_count <<
+            std::setw(20) << dispatcher_params.completion_threads_count << std::setw(12) << results->fps <<
+            std::setw(24) << results->streams_latency[0].count() << "us" << std::setw(24) << others_latency.count() <<
+            "us" << std::endl;
+    }
+
+    return HAILO_SUCCESS;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file loopback_stream.cpp
+ * @brief A pair of boundary channels of the software device, streaming frames through the device loopback
+ **/
+
+#include "loopback_stream.hpp"
+
+#include "vdma/memory/descriptor_list.hpp"
+#include "stream_common/transfer_common.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+
+
+namespace hailort
+{
+
+vdma::ChannelId LoopbackStream::input_channel_id(uint8_t stream_index)
+{
+    return vdma::ChannelId{0, static_cast<uint8_t>(MIN_H2D_CHANNEL_INDEX + stream_index)};
+}
+
+vdma::ChannelId LoopbackStream::output_channel_id(uint8_t stream_index)
+{
+    // The software device loops back each input channel to the output channel of the same index
+    return vdma::ChannelId{0, static_cast<uint8_t>(MIN_D2H_CHANNEL_INDEX + stream_index)};
+}
+
+Expected<std::unique_ptr<LoopbackStream>> LoopbackStream::create(SoftwareDriver &driver, uint8_t stream_index,
+    const Params &params)
+{
+    CHECK_AS_EXPECTED((MIN_H2D_CHANNEL_INDEX + stream_index) <= MAX_H2D_CHANNEL_INDEX, HAILO_INVALID_ARGUMENT,
+        "Invalid loopback stream index {}", stream_index);
+    CHECK_AS_EXPECTED(params.buffers_count >= params.ongoing_frames, HAILO_INVALID_ARGUMENT,
+        "Buffers count {} is smaller than the ongoing frames {}", params.buffers_count, params.ongoing_frames);
+
+    const auto desc_page_size = driver.desc_max_page_size();
+    const auto descs_count = vdma::DescriptorList::calculate_descriptors_count(
+        static_cast<uint32_t>(params.frame_size), static_cast<uint16_t>(params.ongoing_frames), desc_page_size);
+
+    auto input_channel = vdma::BoundaryChannel::create(input_channel_id(stream_index),
+        HailoRTDriver::DmaDirection::H2D, driver, descs_count, desc_page_size, "input" + std::to_string(stream_index));
+    CHECK_EXPECTED(input_channel);
+    auto output_channel = vdma::BoundaryChannel::create(output_channel_id(stream_index),
+        HailoRTDriver::DmaDirection::D2H, driver, descs_count, desc_page_size, "output" + std::to_string(stream_index));
+    CHECK_EXPECTED(output_channel);
+
+    std::vector<BufferPtr> inputs;
+    std::vector<BufferPtr> outputs;
+    for (size_t i = 0; i < params.buffers_count; i++) {
+        auto input = Buffer::create_shared(params.frame_size, BufferStorageParams::create_dma());
+        CHECK_EXPECTED(input);
+        inputs.emplace_back(input.release());
+        auto output = Buffer::create_shared(params.frame_size, BufferStorageParams::create_dma());
+        CHECK_EXPECTED(output);
+        outputs.emplace_back(output.release());
+    }
+
+    if (params.bind_buffers_ring) {
+        auto status = bind_buffers_ring(driver, *input_channel.value(), HailoRTDriver::DmaDirection::H2D, inputs);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+        status = bind_buffers_ring(driver, *output_channel.value(), HailoRTDriver::DmaDirection::D2H, outputs);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    }
+
+    auto stream = make_unique_nothrow<LoopbackStream>(driver, params, input_channel.release(),
+        output_channel.release(), std::move(inputs), std::move(outputs));
+    CHECK_NOT_NULL_AS_EXPECTED(stream, HAILO_OUT_OF_HOST_MEMORY);
+    return stream;
+}
+
+hailo_status LoopbackStream::bind_buffers_ring(SoftwareDriver &driver, vdma::BoundaryChannel &channel,
+    HailoRTDriver::DmaDirection direction, const std::vector<BufferPtr> &buffers)
+{
+    // The buffers are mapped as the transfers map them, so the transfers find them bound.
+    std::vector<vdma::MappedBufferPtr> mapped_buffers;
+    for (const auto &buffer : buffers) {
+        auto mapped_buffer = TransferBuffer(buffer).map_buffer(driver, direction);
+        CHECK_EXPECTED_AS_STATUS(mapped_buffer);
+        mapped_buffers.emplace_back(mapped_buffer.release());
+    }
+    return channel.bind_buffers_ring(mapped_buffers);
+}
+
+LoopbackStream::LoopbackStream(SoftwareDriver &driver, const Params &params, vdma::BoundaryChannelPtr input_channel,
+    vdma::BoundaryChannelPtr output_channel, std::vector<BufferPtr> &&inputs, std::vector<BufferPtr> &&outputs) :
+    m_driver(driver),
+    m_params(params),
+    m_input_channel(input_channel),
+    m_output_channel(output_channel),
+    m_ongoing_frames(0),
+    m_done_frames(0),
+    m_total_latency(0)
+{
+    for (size_t i = 0; i < inputs.size(); i++) {
+        m_slots.emplace_back(FrameSlot{inputs[i], outputs[i], Clock::time_point(), false});
+    }
+}
+
+ChannelsBitmap LoopbackStream::channels_bitmap() const
+{
+    ChannelsBitmap bitmap{};
+    bitmap[0] = (1u << m_input_channel->get_channel_id().channel_index) |
+        (1u << m_output_channel->get_channel_id().channel_index);
+    return bitmap;
+}
+
+bool LoopbackStream::has_channel(const vdma::ChannelId &channel_id) const
+{
+    return (m_input_channel->get_channel_id() == channel_id) || (m_output_channel->get_channel_id() == channel_id);
+}
+
+hailo_status LoopbackStream::trigger_channel_completion(const ChannelIrqData &channel_irq_data)
+{
+    auto &channel = (m_input_channel->get_channel_id() == channel_irq_data.channel_id) ? m_input_channel :
+        m_output_channel;
+    return channel->trigger_channel_completion(channel_irq_data.desc_num_processed);
+}
+
+hailo_status LoopbackStream::activate()
+{
+    auto status = m_driver.get().reset_channels(channels_bitmap());
+    CHECK_SUCCESS(status);
+    status = m_input_channel->activate();
+    CHECK_SUCCESS(status);
+    return m_output_channel->activate();
+}
+
+hailo_status LoopbackStream::deactivate()
+{
+    auto status = m_input_channel->deactivate();
+    CHECK_SUCCESS(status);
+    status = m_output_channel->deactivate();
+    CHECK_SUCCESS(status);
+    m_input_channel->cancel_pending_transfers();
+    m_output_channel->cancel_pending_transfers();
+    return HAILO_SUCCESS;
+}
+
+hailo_status LoopbackStream::run_frames(size_t frames_count)
+{
+    for (size_t frame_index = 0; frame_index < frames_count; frame_index++) {
+        auto &slot = m_slots[frame_index % m_slots.size()];
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this, &slot]() {
+                return !slot.is_ongoing && (m_ongoing_frames < m_params.ongoing_frames);
+            });
+            slot.is_ongoing = true;
+            m_ongoing_frames++;
+            slot.launch_time = Clock::now();
+        }
+
+        // The output is launched first, so it is ready when the input is looped back.
+        auto status = m_output_channel->launch_transfer(TransferRequest{TransferBuffer(slot.output),
+            [this, &slot](hailo_status) { on_frame_done(slot); }}, false);
+        CHECK_SUCCESS(status);
+        status = m_input_channel->launch_transfer(TransferRequest{TransferBuffer(slot.input),
+            [](hailo_status) {}}, false);
+        CHECK_SUCCESS(status);
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]() { return 0 == m_ongoing_frames; });
+    return HAILO_SUCCESS;
+}
+
+std::chrono::duration<double, std::micro> LoopbackStream::average_latency() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return (0 == m_done_frames) ? std::chrono::duration<double, std::micro>(0) :
+        (m_total_latency / static_cast<double>(m_done_frames));
+}
+
+void LoopbackStream::reset_statistics()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_frames = 0;
+    m_total_latency = std::chrono::duration<double, std::micro>(0);
+}
+
+void LoopbackStream::on_frame_done(FrameSlot &slot)
+{
+    const auto done_time = Clock::now();
+
+    // Busy, as a callback that processes the frame would be
+    while ((Clock::now() - done_time) < m_params.callback_load) {}
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_total_latency += std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+            done_time - slot.launch_time);
+        m_done_frames++;
+        m_ongoing_frames--;
+        slot.is_ongoing = false;
+    }
+    m_cv.notify_all();
+}
+
+} /* namespace hailort */
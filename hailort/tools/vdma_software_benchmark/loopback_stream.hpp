@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file loopback_stream.hpp
+ * @brief A pair of boundary channels of the software device - an input channel, and the output channel the device
+ *        loops its frames back to. Used by the benchmarks to stream frames and measure their latency.
+ **/
+
+#ifndef _HAILO_VDMA_BENCHMARK_LOOPBACK_STREAM_HPP_
+#define _HAILO_VDMA_BENCHMARK_LOOPBACK_STREAM_HPP_
+
+#include "os/software_driver.hpp"
+#include "vdma/channel/boundary_channel.hpp"
+
+#include "hailo/buffer.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+
+namespace hailort
+{
+
+class LoopbackStream final
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Params {
+        size_t frame_size;
+        // Max frames launched and not done yet
+        size_t ongoing_frames;
+        // Buffers of each channel, cycled through by the frames (at least ongoing_frames). When the buffers don't
+        // return to the same descriptors, the descriptors are bound to the buffer of each transfer.
+        size_t buffers_count;
+        // Binds the descriptors to the buffers once, on creation (see BoundaryChannel::bind_buffers_ring)
+        bool bind_buffers_ring;
+        // Time the output transfer callback keeps the thread busy (emulates post-processing in the user callback)
+        std::chrono::microseconds callback_load;
+    };
+
+    // Uses the input channel stream_index of the software device, and the output channel it is looped back to.
+    static Expected<std::unique_ptr<LoopbackStream>> create(SoftwareDriver &driver, uint8_t stream_index,
+        const Params &params);
+
+    LoopbackStream(SoftwareDriver &driver, const Params &params, vdma::BoundaryChannelPtr input_channel,
+        vdma::BoundaryChannelPtr output_channel, std::vector<BufferPtr> &&inputs, std::vector<BufferPtr> &&outputs);
+
+    // Bitmap of the stream's channels (to be waited by the interrupts dispatcher)
+    ChannelsBitmap channels_bitmap() const;
+    bool has_channel(const vdma::ChannelId &channel_id) const;
+    // Passes the interrupt of one of the stream's channels to the channel
+    hailo_status trigger_channel_completion(const ChannelIrqData &channel_irq_data);
+
+    // Resets the stream's channels on the device (as the core-op activation does) and activates them
+    hailo_status activate();
+    hailo_status deactivate();
+
+    // Streams frames_count frames, and waits until all of them are done
+    hailo_status run_frames(size_t frames_count);
+
+    // Average latency of the frames run since the stream was created (or since reset_statistics())
+    std::chrono::duration<double, std::micro> average_latency() const;
+    void reset_statistics();
+
+    static vdma::ChannelId input_channel_id(uint8_t stream_index);
+    static vdma::ChannelId output_channel_id(uint8_t stream_index);
+
+    // Maps the buffers as the transfers map them, and binds them to the channel as a buffers ring
+    static hailo_status bind_buffers_ring(SoftwareDriver &driver, vdma::BoundaryChannel &channel,
+        HailoRTDriver::DmaDirection direction, const std::vector<BufferPtr> &buffers);
+
+private:
+    struct FrameSlot {
+        BufferPtr input;
+        BufferPtr output;
+        Clock::time_point launch_time;
+        bool is_ongoing;
+    };
+
+    void on_frame_done(FrameSlot &slot);
+
+    std::reference_wrapper<SoftwareDriver> m_driver;
+    const Params m_params;
+    vdma::BoundaryChannelPtr m_input_channel;
+    vdma::BoundaryChannelPtr m_output_channel;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<FrameSlot> m_slots;
+    size_t m_ongoing_frames;
+    size_t m_done_frames;
+    std::chrono::duration<double, std::micro> m_total_latency;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_VDMA_BENCHMARK_LOOPBACK_STREAM_HPP_ */
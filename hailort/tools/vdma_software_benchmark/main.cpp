@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2020-2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file main.cpp
+ * @brief Benchmarks the host side of the vdma data path (boundary channels, descriptors programming, buffer mapping
+ *        and the interrupts dispatcher) against the in-process software device, which loops back each input frame
+ *        to the output channel after a configurable latency.
+ *        Reports the achieved FPS, the average frame latency and the host cpu time per frame.
+ *        The 'test' mode runs the functional tests of the host side components (see software_tests.hpp), and the other
+ *        modes run benchmarks of specific flows (see software_benchmarks.hpp).
+ *
+ * Usage: vdma_software_benchmark [frames_count] [frame_size] [device_latency_us] [ongoing_frames]
+ *        vdma_software_benchmark test [test_name_filter]
+ *        vdma_software_benchmark dispatcher [streams_count] [callback_load_us] [frames_count]
+ *        vdma_software_benchmark switch [switches_count] [frames_per_switch]
+ *        vdma_software_benchmark readiness [models_count] [inputs_count] [decisions_count]
+ *        vdma_software_benchmark binding [frames_count] [frame_size]
+ **/
+
+#include "software_tests.hpp"
+#include "software_benchmarks.hpp"
+#include "vdma_benchmark.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace hailort;
+
+static constexpr size_t DEFAULT_FRAMES_COUNT = 100000;
+static constexpr size_t DEFAULT_FRAME_SIZE = 640 * 640 * 3;
+static constexpr size_t DEFAULT_DEVICE_LATENCY_US = 100;
+static constexpr size_t DEFAULT_ONGOING_FRAMES = 4;
+
+static hailo_status run_streaming_benchmark(int argc, char **argv)
+{
+    VdmaBenchmarkParams params{};
+    params.frames_count = (argc > 1) ? std::stoul(argv[1]) : DEFAULT_FRAMES_COUNT;
+    params.stream_params.frame_size = (argc > 2) ? std::stoul(argv[2]) : DEFAULT_FRAME_SIZE;
+    params.device_latency = std::chrono::microseconds((argc > 3) ? std::stoul(argv[3]) : DEFAULT_DEVICE_LATENCY_US);
+    params.stream_params.ongoing_frames = (argc > 4) ? std::stoul(argv[4]) : DEFAULT_ONGOING_FRAMES;
+    params.stream_params.buffers_count = params.stream_params.ongoing_frames;
+    params.streams_count = 1;
+    params.dispatcher_params = vdma::InterruptsDispatcher::get_default_params();
+
+    auto benchmark = VdmaBenchmark::create(params);
+    CHECK_EXPECTED_AS_STATUS(benchmark, "Failed creating benchmark");
+    auto results = benchmark.value()->run();
+    CHECK_EXPECTED_AS_STATUS(results, "Benchmark failed");
+
+    std::cout << "frame size " << params.stream_params.frame_size << ", ongoing frames " <<
+        params.stream_params.ongoing_frames << ", device latency " << params.device_latency.count() << "us: " <<
+        results->fps << " FPS, average latency " << results->streams_latency[0].count() << "us, cpu time " <<
+        results->cpu_time_per_frame_us << "us/frame" << std::endl;
+    return HAILO_SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc > 1) && (std::string("test") == argv[1])) {
+        const auto failed_count = run_software_tests((argc > 2) ? argv[2] : "");
+        return (0 == failed_count) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const std::map<std::string, std::function<hailo_status(const std::vector<std::string>&)>> benchmarks = {
+        {"dispatcher", run_interrupts_dispatcher_benchmark},
+        {"switch", run_core_op_switch_benchmark},
+        {"readiness", run_scheduler_readiness_benchmark},
+        {"binding", run_descriptors_binding_benchmark},
+    };
+    if ((argc > 1) && (benchmarks.end() != benchmarks.find(argv[1]))) {
+        const std::vector<std::string> args(argv + 2, argv + argc);
+        auto status = benchmarks.at(argv[1])(args);
+        if (HAILO_SUCCESS != status) {
+            std::cerr << "Benchmark " << argv[1] << " failed with status " << status << std::endl;
+        }
+        return status;
+    }
+
+    auto status = run_streaming_benchmark(argc, argv);
+    if (HAILO_SUCCESS != status) {
+        std::cerr << "Benchmark failed with status " << status << std::endl;
+        return status;
+    }
+
+    return HAILO_SUCCESS;
+}
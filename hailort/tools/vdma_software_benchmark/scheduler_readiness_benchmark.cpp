@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file scheduler_readiness_benchmark.cpp
+ * @brief Measures the cost of the scheduler readiness check (see CoreOpsScheduler::is_core_op_ready) of many
+ *        configured models, while their pending frames are signaled concurrently.
+ *        Each scheduling decision checks the threshold, the timeout and the pending frames of all the models (as the
+ *        oracle does when no model is ready), and a ready model is then "run" - its pending frames are consumed.
+ *
+ *        The scheduler itself can't be created without devices, so the check is modeled on the ScheduledCoreOp
+ *        objects the scheduler keeps (with no ongoing frames on the device). It is measured as the scheduler does it
+ *        now (the inputs over threshold are counted when the pending frames change), and as it was done before (the
+ *        threshold, the timeout and the pending frames of each input are looked up by name).
+ **/
+
+#include "software_benchmarks.hpp"
+
+#include "vdevice/scheduler/scheduled_core_op_state.hpp"
+#include "core_op/active_core_op_holder.hpp"
+#include "hef/core_op_metadata.hpp"
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+
+namespace hailort
+{
+
+static constexpr size_t DEFAULT_MODELS_COUNT = 16;
+static constexpr size_t DEFAULT_INPUTS_COUNT = 4;
+static constexpr size_t DEFAULT_DECISIONS_COUNT = 200000;
+static constexpr size_t OUTPUTS_COUNT = 4;
+static constexpr uint32_t THRESHOLD = 4;
+static constexpr auto TIMEOUT = std::chrono::milliseconds(10);
+
+// Only the streams names and directions are used by the readiness check, so the core-op has no streams.
+class ReadinessBenchmarkCoreOp final : public CoreOp
+{
+public:
+    ReadinessBenchmarkCoreOp(std::shared_ptr<CoreOpMetadata> metadata, ActiveCoreOpHolder &active_core_op_holder,
+        hailo_status &status) :
+        CoreOp(ConfigureNetworkParams(), metadata, active_core_op_holder, status)
+    {}
+
+    virtual bool is_scheduled() const override { return true; }
+    virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &, const std::string &) override
+    {
+        return HAILO_NOT_IMPLEMENTED;
+    }
+    virtual hailo_status set_scheduler_threshold(uint32_t, const std::string &) override
+    {
+        return HAILO_NOT_IMPLEMENTED;
+    }
+    virtual hailo_status set_scheduler_priority(uint8_t, const std::string &) override
+    {
+        return HAILO_NOT_IMPLEMENTED;
+    }
+    virtual Expected<hailo_stream_interface_t> get_default_streams_interface() override
+    {
+        return make_unexpected(HAILO_NOT_IMPLEMENTED);
+    }
+    virtual hailo_status activate_impl(uint16_t) override { return HAILO_NOT_IMPLEMENTED; }
+    virtual hailo_status deactivate_impl() override { return HAILO_NOT_IMPLEMENTED; }
+    virtual Expected<HwInferResults> run_hw_infer_estimator() override
+    {
+        return make_unexpected(HAILO_NOT_IMPLEMENTED);
+    }
+
+protected:
+    virtual Expected<std::shared_ptr<LatencyMetersMap>> get_latency_meters() override
+    {
+        return make_unexpected(HAILO_NOT_IMPLEMENTED);
+    }
+    virtual Expected<vdma::BoundaryChannelPtr> get_boundary_vdma_channel_by_stream_name(const std::string &) override
+    {
+        return make_unexpected(HAILO_NOT_IMPLEMENTED);
+    }
+};
+
+static hailo_stream_info_t create_stream_info(const std::string &name, hailo_stream_direction_t direction)
+{
+    hailo_stream_info_t stream_info{};
+    strncpy(stream_info.name, name.c_str(), sizeof(stream_info.name) - 1);
+    stream_info.direction = direction;
+    return stream_info;
+}
+
+static Expected<std::shared_ptr<ScheduledCoreOp>> create_scheduled_core_op(ActiveCoreOpHolder &active_core_op_holder,
+    size_t model_index, size_t inputs_count)
+{
+    const auto prefix = "model" + std::to_string(model_index);
+    SupportedFeatures supported_features{};
+    auto metadata = make_shared_nothrow<CoreOpMetadata>(prefix, ContextMetadata({}, {}),
+        std::vector<ContextMetadata>(), std::vector<ConfigChannelInfo>(), supported_features,
+        std::vector<std::string>());
+    CHECK_NOT_NULL_AS_EXPECTED(metadata, HAILO_OUT_OF_HOST_MEMORY);
+
+    hailo_status status = HAILO_UNINITIALIZED;
+    auto core_op = make_shared_nothrow<ReadinessBenchmarkCoreOp>(metadata, active_core_op_holder, status);
+    CHECK_NOT_NULL_AS_EXPECTED(core_op, HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    StreamInfoVector stream_infos;
+    for (size_t i = 0; i < inputs_count; i++) {
+        stream_infos.emplace_back(create_stream_info(prefix + "/input" + std::to_string(i), HAILO_H2D_STREAM));
+    }
+    for (size_t i = 0; i < OUTPUTS_COUNT; i++) {
+        stream_infos.emplace_back(create_stream_info(prefix + "/output" + std::to_string(i), HAILO_D2H_STREAM));
+    }
+
+    const uint16_t max_batch_size = 1;
+    auto scheduled_core_op = make_shared_nothrow<ScheduledCoreOp>(core_op, TIMEOUT, max_batch_size, false,
+        stream_infos);
+    CHECK_NOT_NULL_AS_EXPECTED(scheduled_core_op, HAILO_OUT_OF_HOST_MEMORY);
+
+    status = scheduled_core_op->set_threshold(THRESHOLD);
+    CHECK_SUCCESS_AS_EXPECTED(status);
+    return scheduled_core_op;
+}
+
+using ReadinessCheck = bool(*)(ScheduledCoreOp &scheduled_core_op);
+
+// Same checks as CoreOpsScheduler::is_core_op_ready (with the threshold checked, and no ongoing frames on the device)
+static bool is_ready(ScheduledCoreOp &scheduled_core_op)
+{
+    if (!scheduled_core_op.are_all_inputs_over_threshold() &&
+        !scheduled_core_op.is_over_timeout(std::chrono::steady_clock::now())) {
+        return false;
+    }
+    return scheduled_core_op.pending_frames().get_min_value() > 0;
+}
+
+// The checks CoreOpsScheduler::is_core_op_ready did before the inputs over threshold were counted (the pending frames
+// are read from the current counters, so the cost of the old counters isn't included).
+static bool is_ready_by_input_lookups(ScheduledCoreOp &scheduled_core_op)
+{
+    std::vector<bool> over_threshold;
+    over_threshold.reserve(scheduled_core_op.get_inputs_names().size());
+    std::vector<bool> over_timeout;
+    over_timeout.reserve(scheduled_core_op.get_inputs_names().size());
+
+    for (const auto &name : scheduled_core_op.get_inputs_names()) {
+        const auto threshold = (DEFAULT_SCHEDULER_MIN_THRESHOLD == scheduled_core_op.get_threshold()) ? 1 :
+            scheduled_core_op.get_threshold();
+        const auto timeout = scheduled_core_op.get_timeout();
+
+        const auto stream_over_threshold = scheduled_core_op.pending_frames()[name] >= threshold;
+        const auto stream_over_timeout =
+            timeout <= (std::chrono::steady_clock::now() - scheduled_core_op.get_last_run_timestamp());
+        over_threshold.push_back(stream_over_threshold);
+        over_timeout.push_back(stream_over_timeout);
+        if (!stream_over_threshold && !stream_over_timeout) {
+            return false;
+        }
+    }
+    return scheduled_core_op.pending_frames().get_min_value() > 0;
+}
+
+// Consumes the pending frames of the model (of the inputs and of the outputs), as a burst sent to the device would
+static void run_core_op(ScheduledCoreOp &scheduled_core_op)
+{
+    const auto frames_count = scheduled_core_op.pending_frames().get_min_value();
+    for (const auto &name : scheduled_core_op.get_inputs_names()) {
+        scheduled_core_op.decrease_pending_frames(name, HAILO_H2D_STREAM, frames_count);
+    }
+    for (const auto &name : scheduled_core_op.get_outputs_names()) {
+        scheduled_core_op.decrease_pending_frames(name, HAILO_D2H_STREAM, frames_count);
+    }
+    scheduled_core_op.set_last_run_timestamp(std::chrono::steady_clock::now());
+}
+
+// Runs decisions_count scheduling decisions, returns the average time of the readiness checks of a decision
+static std::chrono::duration<double, std::nano> run_decisions(
+    std::vector<std::shared_ptr<ScheduledCoreOp>> &scheduled_core_ops, size_t decisions_count, ReadinessCheck check,
+    size_t &ready_decisions)
+{
+    const auto models_count = scheduled_core_ops.size();
+    ready_decisions = 0;
+    std::chrono::duration<double, std::nano> total_check_time(0);
+    for (size_t decision = 0; decision < decisions_count; decision++) {
+        const auto start_time = std::chrono::steady_clock::now();
+        std::shared_ptr<ScheduledCoreOp> ready_core_op = nullptr;
+        for (size_t i = 0; i < models_count; i++) {
+            // Round robin, starting after the last model (as the oracle does)
+            auto &scheduled_core_op = scheduled_core_ops[(decision + i) % models_count];
+            if (check(*scheduled_core_op)) {
+                ready_core_op = scheduled_core_op;
+                break;
+            }
+        }
+        total_check_time += std::chrono::steady_clock::now() - start_time;
+
+        if (nullptr != ready_core_op) {
+            run_core_op(*ready_core_op);
+            ready_decisions++;
+        }
+    }
+    return total_check_time / static_cast<double>(decisions_count);
+}
+
+hailo_status run_scheduler_readiness_benchmark(const std::vector<std::string> &args)
+{
+    const size_t models_count = (args.size() > 0) ? std::stoul(args[0]) : DEFAULT_MODELS_COUNT;
+    const size_t inputs_count = (args.size() > 1) ? std::stoul(args[1]) : DEFAULT_INPUTS_COUNT;
+    const size_t decisions_count = (args.size() > 2) ? std::stoul(args[2]) : DEFAULT_DECISIONS_COUNT;
+    CHECK((models_count > 0) && (inputs_count > 0), HAILO_INVALID_ARGUMENT, "At least one model and input are needed");
+    CHECK(decisions_count > 0, HAILO_INVALID_ARGUMENT, "At least one decision is needed");
+
+    ActiveCoreOpHolder active_core_op_holder;
+    std::vector<std::shared_ptr<ScheduledCoreOp>> scheduled_core_ops;
+    for (size_t i = 0; i < models_count; i++) {
+        auto scheduled_core_op = create_scheduled_core_op(active_core_op_holder, i, inputs_count);
+        CHECK_EXPECTED_AS_STATUS(scheduled_core_op);
+        scheduled_core_ops.emplace_back(scheduled_core_op.release());
+    }
+
+    // Signals the frames written to the inputs, and the reads requested from the outputs, of all the models (as the
+    // streams of the models would). A model is ready once all of its streams have pending frames.
+    std::atomic_bool should_stop(false);
+    std::thread signal_thread([&]() {
+        const size_t streams_count = inputs_count + OUTPUTS_COUNT;
+        size_t index = 0;
+        while (!should_stop) {
+            auto &scheduled_core_op = *scheduled_core_ops[index % models_count];
+            const auto stream_index = (index / models_count) % streams_count;
+            const bool is_input = (stream_index < inputs_count);
+            const auto &name = is_input ? scheduled_core_op.get_inputs_names()[stream_index] :
+                scheduled_core_op.get_outputs_names()[stream_index - inputs_count];
+            if (scheduled_core_op.pending_frames()[name] < (THRESHOLD * 2)) {
+                scheduled_core_op.increase_pending_frames(name, is_input ? HAILO_H2D_STREAM : HAILO_D2H_STREAM);
+            }
+            index++;
+        }
+    });
+
+    struct ReadinessCase {
+        const char *name;
+        ReadinessCheck check;
+    };
+    const std::vector<ReadinessCase> readiness_cases = {
+        {"input lookups (before)", is_ready_by_input_lookups},
+        {"counted inputs (now)", is_ready},
+    };
+
+    std::cout << models_count << " models, " << inputs_count << " inputs each, " << decisions_count <<
+        " decisions per check" << std::endl;
+    std::cout << "The readiness check is modeled on the scheduled core-ops (CoreOpsScheduler isn't driven)" << std::endl;
+    std::cout << std::setw(24) << "readiness check" << std::setw(22) << "time per decision" << std::setw(18) <<
+        "ready decisions" << std::endl;
+    for (const auto &readiness_case : readiness_cases) {
+        size_t ready_decisions = 0;
+        const auto check_time = run_decisions(scheduled_core_ops, decisions_count, readiness_case.check,
+            ready_decisions);
+        std::cout << std::fixed << std::setprecision(1) << std::setw(24) << readiness_case.name <<
+            std::setw(20) << check_time.count() << "ns" << std::setw(18) << ready_decisions << std::endl;
+    }
+
+    should_stop = true;
+    signal_thread.join();
+
+    return HAILO_SUCCESS;
+}
+
+} /* namespace hailort */
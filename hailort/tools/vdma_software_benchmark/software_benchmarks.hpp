@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file software_benchmarks.hpp
+ * @brief Benchmarks of specific host side flows, each run by its own mode of vdma_software_benchmark
+ *        ('vdma_software_benchmark <mode> [args]'). Each benchmark parses its own arguments, and prints its results.
+ **/
+
+#ifndef _HAILO_VDMA_SOFTWARE_BENCHMARKS_HPP_
+#define _HAILO_VDMA_SOFTWARE_BENCHMARKS_HPP_
+
+#include "hailo/hailort.h"
+
+#include <string>
+#include <vector>
+
+
+namespace hailort
+{
+
+// 'dispatcher [streams_count] [callback_load_us] [frames_count]' - latency of the streams while the callback of the
+// first stream is loaded, for several interrupts dispatcher threads configurations.
+hailo_status run_interrupts_dispatcher_benchmark(const std::vector<std::string> &args);
+
+// 'switch [switches_count] [frames_per_switch]' - host side latency of switching between two core-ops, when the
+// interrupts dispatcher is stopped and started on each switch, and when it is kept running.
+hailo_status run_core_op_switch_benchmark(const std::vector<std::string> &args);
+
+// 'readiness [models_count] [inputs_count] [decisions_count]' - cost of the scheduler readiness check of all the
+// configured models on each decision, while frames are signaled concurrently (the check is modeled on the scheduled
+// core-ops, as it is done now and as it was done with per-input lookups).
+hailo_status run_scheduler_readiness_benchmark(const std::vector<std::string> &args);
+
+// 'binding [frames_count] [frame_size]' - descriptors binds and cpu time per frame, when the descriptors are bound to
+// the buffer of each transfer, and when a buffers ring is bound once.
+hailo_status run_descriptors_binding_benchmark(const std::vector<std::string> &args);
+
+} /* namespace hailort */
+
+#endif /* _HAILO_VDMA_SOFTWARE_BENCHMARKS_HPP_ */
@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file software_tests.cpp
+ * @brief Runs the functional tests of the host side components
+ **/
+
+#include "software_tests.hpp"
+
+#include <iostream>
+
+
+namespace hailort
+{
+
+static std::vector<SoftwareTest> all_tests()
+{
+    std::vector<SoftwareTest> tests;
+    add_dma_mapping_cache_tests(tests);
+    add_image_preprocess_tests(tests);
+    add_callback_reorder_queue_tests(tests);
+    add_buffers_ring_tests(tests);
+    return tests;
+}
+
+size_t run_software_tests(const std::string &filter)
+{
+    size_t failed_count = 0;
+    size_t run_count = 0;
+    for (const auto &test : all_tests()) {
+        if (std::string::npos == test.name.find(filter)) {
+            continue;
+        }
+
+        run_count++;
+        const auto status = test.run();
+        if (HAILO_SUCCESS == status) {
+            std::cout << "[  PASSED  ] " << test.name << std::endl;
+        } else {
+            std::cout << "[  FAILED  ] " << test.name << " (status " << status << ")" << std::endl;
+            failed_count++;
+        }
+    }
+
+    std::cout << (run_count - failed_count) << "/" << run_count << " tests passed" << std::endl;
+    return failed_count;
+}
+
+} /* namespace hailort */
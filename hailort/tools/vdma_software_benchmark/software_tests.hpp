@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file software_tests.hpp
+ * @brief Functional tests of host side components (vdma components are run against the in-process software device)
+ *        ('vdma_software_benchmark test').
+ *
+ * A test returns HAILO_SUCCESS if it passed. Failed expectations are reported using the CHECK macros, which log the
+ * failed condition.
+ **/
+
+#ifndef _HAILO_VDMA_SOFTWARE_TESTS_HPP_
+#define _HAILO_VDMA_SOFTWARE_TESTS_HPP_
+
+#include "hailo/hailort.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+
+namespace hailort
+{
+
+struct SoftwareTest {
+    std::string name;
+    std::function<hailo_status()> run;
+};
+
+// Each tests file appends its tests to the list
+void add_dma_mapping_cache_tests(std::vector<SoftwareTest> &tests);
+void add_image_preprocess_tests(std::vector<SoftwareTest> &tests);
+void add_callback_reorder_queue_tests(std::vector<SoftwareTest> &tests);
+void add_buffers_ring_tests(std::vector<SoftwareTest> &tests);
+
+// Runs the tests whose name contains filter (all the tests if filter is empty), returns the number of failed tests.
+size_t run_software_tests(const std::string &filter);
+
+} /* namespace hailort */
+
+#endif /* _HAILO_VDMA_SOFTWARE_TESTS_HPP_ */
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file vdma_benchmark.cpp
+ * @brief Streams frames through loopback streams of the software device
+ **/
+
+#include "vdma_benchmark.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <atomic>
+#include <ctime>
+#include <thread>
+
+
+namespace hailort
+{
+
+Expected<std::unique_ptr<VdmaBenchmark>> VdmaBenchmark::create(const VdmaBenchmarkParams &params)
+{
+    SoftwareDriver::Params driver_params = SoftwareDriver::default_params();
+    driver_params.frame_latency = params.device_latency;
+    auto driver = SoftwareDriver::create(driver_params);
+    CHECK_EXPECTED(driver);
+
+    std::vector<std::unique_ptr<LoopbackStream>> streams;
+    for (size_t i = 0; i < params.streams_count; i++) {
+        auto stream_params = params.stream_params;
+        if (0 == i) {
+            stream_params.callback_load = params.first_stream_callback_load;
+        }
+        auto stream = LoopbackStream::create(*driver.value(), static_cast<uint8_t>(i), stream_params);
+        CHECK_EXPECTED(stream);
+        streams.emplace_back(stream.release());
+    }
+
+    auto dispatcher = vdma::InterruptsDispatcher::create(std::ref(*driver.value()), params.dispatcher_params);
+    CHECK_EXPECTED(dispatcher);
+
+    auto benchmark = make_unique_nothrow<VdmaBenchmark>(params, driver.release(), std::move(streams),
+        dispatcher.release());
+    CHECK_NOT_NULL_AS_EXPECTED(benchmark, HAILO_OUT_OF_HOST_MEMORY);
+    return benchmark;
+}
+
+VdmaBenchmark::VdmaBenchmark(const VdmaBenchmarkParams &params, std::unique_ptr<SoftwareDriver> &&driver,
+    std::vector<std::unique_ptr<LoopbackStream>> &&streams, std::unique_ptr<vdma::InterruptsDispatcher> &&dispatcher) :
+    m_params(params),
+    m_driver(std::move(driver)),
+    m_streams(std::move(streams)),
+    m_dispatcher(std::move(dispatcher))
+{}
+
+Expected<VdmaBenchmarkResults> VdmaBenchmark::run()
+{
+    auto status = start();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    const auto start_operations = m_driver->get_operations_counters();
+    const auto start_time = LoopbackStream::Clock::now();
+    const auto start_cpu_time = std::clock();
+    std::atomic<hailo_status> run_status(HAILO_SUCCESS);
+    std::vector<std::thread> threads;
+    for (auto &stream : m_streams) {
+        threads.emplace_back([this, &stream, &run_status]() {
+            auto stream_status = stream->run_frames(m_params.frames_count);
+            if (HAILO_SUCCESS != stream_status) {
+                run_status = stream_status;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    const auto elapsed = std::chrono::duration<double>(LoopbackStream::Clock::now() - start_time);
+    const auto cpu_seconds = static_cast<double>(std::clock() - start_cpu_time) / CLOCKS_PER_SEC;
+    const auto end_operations = m_driver->get_operations_counters();
+
+    status = stop();
+    CHECK_SUCCESS_AS_EXPECTED(run_status.load());
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    const auto frames = static_cast<double>(m_params.frames_count * m_streams.size());
+    VdmaBenchmarkResults results{};
+    results.fps = frames / elapsed.count();
+    results.cpu_time_per_frame_us = cpu_seconds * 1e6 / frames;
+    for (const auto &stream : m_streams) {
+        results.streams_latency.emplace_back(stream->average_latency());
+    }
+    results.driver_operations.buffer_maps = end_operations.buffer_maps - start_operations.buffer_maps;
+    results.driver_operations.buffer_unmaps = end_operations.buffer_unmaps - start_operations.buffer_unmaps;
+    results.driver_operations.descs_binds = end_operations.descs_binds - start_operations.descs_binds;
+    results.driver_operations.channel_register_writes =
+        end_operations.channel_register_writes - start_operations.channel_register_writes;
+    return results;
+}
+
+hailo_status VdmaBenchmark::start()
+{
+    ChannelsBitmap bitmap{};
+    for (auto &stream : m_streams) {
+        auto status = stream->activate();
+        CHECK_SUCCESS(status);
+        bitmap[0] |= stream->channels_bitmap()[0];
+    }
+
+    return m_dispatcher->start(bitmap, false, [this](IrqData &&irq_data) {
+        for (uint8_t i = 0; i < irq_data.channels_count; i++) {
+            const auto &channel_irq_data = irq_data.channels_irq_data[i];
+            for (auto &stream : m_streams) {
+                if (!stream->has_channel(channel_irq_data.channel_id)) {
+                    continue;
+                }
+                auto status = stream->trigger_channel_completion(channel_irq_data);
+                if (HAILO_SUCCESS != status) {
+                    LOGGER__ERROR("Trigger channel completion failed with status {}", status);
+                }
+            }
+        }
+    });
+}
+
+hailo_status VdmaBenchmark::stop()
+{
+    auto status = m_dispatcher->stop();
+    CHECK_SUCCESS(status);
+    for (auto &stream : m_streams) {
+        status = stream->deactivate();
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file vdma_benchmark.hpp
+ * @brief Streams frames through loopback streams of the software device, whose interrupts are dispatched by an
+ *        InterruptsDispatcher, and measures the FPS, the frames latency and the host cpu time.
+ **/
+
+#ifndef _HAILO_VDMA_BENCHMARK_HPP_
+#define _HAILO_VDMA_BENCHMARK_HPP_
+
+#include "loopback_stream.hpp"
+
+#include "vdma/channel/interrupts_dispatcher.hpp"
+
+#include <memory>
+#include <vector>
+
+
+namespace hailort
+{
+
+struct VdmaBenchmarkParams {
+    // Frames streamed by each stream
+    size_t frames_count;
+    std::chrono::microseconds device_latency;
+    size_t streams_count;
+    LoopbackStream::Params stream_params;
+    // Callback load of the first stream (the other streams use stream_params.callback_load)
+    std::chrono::microseconds first_stream_callback_load;
+    vdma::InterruptsDispatcher::Params dispatcher_params;
+};
+
+struct VdmaBenchmarkResults {
+    // Frames of all the streams per second
+    double fps;
+    double cpu_time_per_frame_us;
+    std::vector<std::chrono::duration<double, std::micro>> streams_latency;
+    // Driver operations done while the frames were streamed
+    SoftwareDriver::OperationsCounters driver_operations;
+};
+
+class VdmaBenchmark final
+{
+public:
+    static Expected<std::unique_ptr<VdmaBenchmark>> create(const VdmaBenchmarkParams &params);
+
+    VdmaBenchmark(const VdmaBenchmarkParams &params, std::unique_ptr<SoftwareDriver> &&driver,
+        std::vector<std::unique_ptr<LoopbackStream>> &&streams,
+        std::unique_ptr<vdma::InterruptsDispatcher> &&dispatcher);
+
+    // Streams the frames of all the streams concurrently (each stream from its own thread)
+    Expected<VdmaBenchmarkResults> run();
+
+private:
+    hailo_status start();
+    hailo_status stop();
+
+    const VdmaBenchmarkParams m_params;
+    std::unique_ptr<SoftwareDriver> m_driver;
+    std::vector<std::unique_ptr<LoopbackStream>> m_streams;
+    std::unique_ptr<vdma::InterruptsDispatcher> m_dispatcher;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_VDMA_BENCHMARK_HPP_ */